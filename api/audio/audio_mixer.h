@@ -12,6 +12,7 @@
 #define API_AUDIO_AUDIO_MIXER_H_
 
 #include <memory>
+#include <optional>
 
 #include "api/audio/audio_frame.h"
 #include "rtc_base/ref_count.h"
@@ -48,6 +49,15 @@ class AudioMixer : public RefCountInterface {
     // with this sample rate or higher will not cause quality loss.
     virtual int PreferredSampleRate() const = 0;
 
+    // Returns the level of the audio that the next call to
+    // GetAudioFrameWithInfo() would produce, in -dBov as in RFC 6464, if the
+    // source can tell without producing the audio, e.g. from the audio level
+    // RTP header extension of the received packets. A mixer which only mixes
+    // the loudest sources may then not call GetAudioFrameWithInfo() on the
+    // sources which are too quiet, so a source should only return a level if
+    // it copes with that.
+    virtual std::optional<int> AudioLevelDbov() const { return std::nullopt; }
+
     virtual ~Source() {}
   };
 
@@ -30,6 +30,9 @@ std::string NetEq::Config::ToString() const {
      << (enable_fast_accelerate ? "true" : "false")
      << ", enable_muted_state=" << (enable_muted_state ? "true" : "false")
      << ", enable_rtx_handling=" << (enable_rtx_handling ? "true" : "false");
+  if (inactive_stream_timeout_ms) {
+    ss << ", inactive_stream_timeout_ms=" << *inactive_stream_timeout_ms;
+  }
   return ss.str();
 }
 
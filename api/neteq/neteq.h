@@ -137,6 +137,11 @@ class NetEq {
     bool enable_fast_accelerate = false;
     bool enable_muted_state = false;
     bool enable_rtx_handling = false;
+    // If set, the stream becomes inactive after this long without decoded
+    // speech. An inactive stream deletes its decoders and outputs muted frames
+    // without any signal processing, until a packet that is neither DTX nor
+    // comfort noise is inserted. Playout then restarts from that packet.
+    std::optional<int> inactive_stream_timeout_ms;
     std::optional<AudioCodecPairId> codec_pair_id;
     bool for_test_no_time_stretching = false;  // Use only for testing.
   };
@@ -19,9 +19,11 @@
 #include <string>
 #include <vector>
 
+#include "api/function_view.h"
 #include "api/stats/attribute.h"
 #include "api/units/timestamp.h"
 #include "rtc_base/checks.h"
+#include "rtc_base/strings/string_builder.h"
 #include "rtc_base/system/rtc_export.h"
 
 namespace webrtc {
@@ -51,6 +53,8 @@ namespace webrtc {
 // for (const auto& attribute : foo.Attributes()) {
 //   printf("%s = %s\n", attribute.name(), attribute.ToString().c_str());
 // }
+//
+// or, without building the list, with `VisitAttributes()`.
 class RTC_EXPORT RTCStats {
  public:
   RTCStats(const std::string& id, Timestamp timestamp)
@@ -70,6 +74,9 @@ class RTC_EXPORT RTCStats {
   // Returns all attributes of this stats object, i.e. a list of its individual
   // metrics as viewed via the Attribute wrapper.
   std::vector<Attribute> Attributes() const;
+  // Invokes `visitor` for each attribute of this stats object, in the same
+  // order as `Attributes()`.
+  void VisitAttributes(rtc::FunctionView<void(const Attribute&)> visitor) const;
   template <typename T>
   Attribute GetAttribute(const std::optional<T>& stat) const {
     for (const auto& attribute : Attributes()) {
@@ -91,6 +98,8 @@ class RTC_EXPORT RTCStats {
   // Creates a JSON readable string representation of the stats
   // object, listing all of its attributes (names and values).
   std::string ToJson() const;
+  // Appends the same representation as `ToJson()` to `sb`.
+  void AppendJson(rtc::StringBuilder& sb) const;
 
   // Downcasts the stats object to an `RTCStats` subclass `T`. DCHECKs that the
   // object is of type `T`.
@@ -101,8 +110,15 @@ class RTC_EXPORT RTCStats {
   }
 
  protected:
-  virtual std::vector<Attribute> AttributesImpl(
-      size_t additional_capacity) const;
+  virtual void VisitAttributesImpl(
+      rtc::FunctionView<void(const Attribute&)> visitor) const;
+  // Subclasses that implement this instead of `VisitAttributesImpl()` keep
+  // working until it is removed, but `VisitAttributes()` and `ToJson()` build
+  // the list for them. The default implementation lists the attributes of
+  // `VisitAttributesImpl()`.
+  [[deprecated("Use WEBRTC_RTCSTATS_IMPL, which implements "
+               "VisitAttributesImpl()")]] virtual std::vector<Attribute>
+  AttributesImpl(size_t additional_capacity) const;
 
   std::string id_;
   Timestamp timestamp_;
@@ -114,8 +130,9 @@ class RTC_EXPORT RTCStats {
 //
 // These macros declare (in _DECL) and define (in _IMPL) the static `kType` and
 // overrides methods as required by subclasses of `RTCStats`: `copy`, `type` and
-// `AttributesImpl`. The |...| argument is a list of addresses to each attribute
-// defined in the implementing class. The list must have at least one attribute.
+// `VisitAttributesImpl`. The |...| argument is a list of addresses to each
+// attribute defined in the implementing class. The list must have at least one
+// attribute.
 //
 // (Since class names need to be known to implement these methods this cannot be
 // part of the base `RTCStats`. While these methods could be implemented using
@@ -150,7 +167,8 @@ class RTC_EXPORT RTCStats {
 //
 #define WEBRTC_RTCSTATS_DECL(SelfT)                                         \
  protected:                                                                 \
-  std::vector<webrtc::Attribute> AttributesImpl(size_t additional_capacity) \
+  void VisitAttributesImpl(                                                 \
+      rtc::FunctionView<void(const webrtc::Attribute&)> visitor)            \
       const override;                                                       \
                                                                             \
  public:                                                                    \
@@ -175,21 +193,17 @@ class RTC_EXPORT RTCStats {
     return this_class::kType;                                                 \
   }                                                                           \
                                                                               \
-  std::vector<webrtc::Attribute> this_class::AttributesImpl(                  \
-      size_t additional_capacity) const {                                     \
+  void this_class::VisitAttributesImpl(                                       \
+      rtc::FunctionView<void(const webrtc::Attribute&)> visitor) const {      \
+    parent_class::VisitAttributesImpl(visitor);                               \
     webrtc::AttributeInit attribute_inits[] = {__VA_ARGS__};                  \
-    size_t attribute_inits_size =                                             \
-        sizeof(attribute_inits) / sizeof(attribute_inits[0]);                 \
-    std::vector<webrtc::Attribute> attributes = parent_class::AttributesImpl( \
-        attribute_inits_size + additional_capacity);                          \
-    for (size_t i = 0; i < attribute_inits_size; ++i) {                       \
-      attributes.push_back(absl::visit(                                       \
+    for (const webrtc::AttributeInit& attribute_init : attribute_inits) {     \
+      absl::visit(                                                            \
           [&](const auto* field) {                                            \
-            return Attribute(attribute_inits[i].name, field);                 \
+            visitor(webrtc::Attribute(attribute_init.name, field));           \
           },                                                                  \
-          attribute_inits[i].variant));                                       \
+          attribute_init.variant);                                            \
     }                                                                         \
-    return attributes;                                                        \
   }
 
 }  // namespace webrtc
@@ -105,7 +105,8 @@ class VideoCodecTestFixture {
     std::optional<int> reference_width;
     std::optional<int> reference_height;
 
-    // File to process. This must be a video file in the YUV format.
+    // File to process. This must be a video file in the YUV format, or in the
+    // Y4M format if the file name ends with ".y4m".
     std::string filepath;
 
     // Number of frames to process.
@@ -136,6 +136,9 @@ const size_t kStunMessageIntegritySize = 20;
 // Size of STUN_ATTR_MESSAGE_INTEGRITY_32
 const size_t kStunMessageIntegrity32Size = 4;
 
+// The FINGERPRINT attribute holds the CRC-32 of the message XOR-ed with this.
+const uint32_t STUN_FINGERPRINT_XOR_VALUE = 0x5354554E;
+
 class StunAddressAttribute;
 class StunAttribute;
 class StunByteStringAttribute;
@@ -139,10 +139,11 @@ RtpVideoFrameAssembler::FrameVector RtpVideoFrameAssembler::Impl::InsertPacket(
 
   parsed_payload->video_header.is_last_packet_in_frame |= rtp_packet.Marker();
 
-  auto packet = std::make_unique<video_coding::PacketBuffer::Packet>(
-      rtp_packet,
-      rtp_sequence_number_unwrapper_.Unwrap(rtp_packet.SequenceNumber()),
-      parsed_payload->video_header);
+  std::unique_ptr<video_coding::PacketBuffer::Packet> packet =
+      packet_buffer_.CreatePacket(
+          rtp_packet,
+          rtp_sequence_number_unwrapper_.Unwrap(rtp_packet.SequenceNumber()),
+          parsed_payload->video_header);
   packet->video_payload = std::move(parsed_payload->video_payload);
 
   ClearOldData(rtp_packet.SequenceNumber());
@@ -201,6 +202,7 @@ RtpVideoFrameAssembler::Impl::AssembleFrames(
           std::move(bitstream)));
     }
   }
+  packet_buffer_.ReturnPackets(std::move(insert_result.packets));
 
   return result;
 }
@@ -87,7 +87,8 @@ std::unique_ptr<voe::ChannelReceiveInterface> CreateChannelReceive(
       env, neteq_factory, internal_audio_state->audio_device_module(),
       config.rtcp_send_transport, config.rtp.local_ssrc, config.rtp.remote_ssrc,
       config.jitter_buffer_max_packets, config.jitter_buffer_fast_accelerate,
-      config.jitter_buffer_min_delay_ms, config.enable_non_sender_rtt,
+      config.jitter_buffer_min_delay_ms,
+      config.jitter_buffer_inactive_timeout_ms, config.enable_non_sender_rtt,
       config.decoder_factory, config.codec_pair_id,
       std::move(config.frame_decryptor), config.crypto_options,
       std::move(config.frame_transformer));
@@ -397,6 +398,10 @@ int AudioReceiveStreamImpl::PreferredSampleRate() const {
   return channel_receive_->PreferredSampleRate();
 }
 
+std::optional<int> AudioReceiveStreamImpl::AudioLevelDbov() const {
+  return channel_receive_->AudioLevelDbov();
+}
+
 uint32_t AudioReceiveStreamImpl::id() const {
   RTC_DCHECK_RUN_ON(&worker_thread_checker_);
   return remote_ssrc();
@@ -112,6 +112,7 @@ class AudioReceiveStreamImpl final : public webrtc::AudioReceiveStreamInterface,
                                        AudioFrame* audio_frame) override;
   int Ssrc() const override;
   int PreferredSampleRate() const override;
+  std::optional<int> AudioLevelDbov() const override;
 
   // Syncable
   uint32_t id() const override;
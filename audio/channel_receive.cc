@@ -64,6 +64,7 @@
 #include "modules/rtp_rtcp/include/rtp_rtcp_defines.h"
 #include "modules/rtp_rtcp/source/absolute_capture_time_interpolator.h"
 #include "modules/rtp_rtcp/source/capture_clock_offset_updater.h"
+#include "modules/rtp_rtcp/source/rtp_header_extensions.h"
 #include "modules/rtp_rtcp/source/rtp_packet_received.h"
 #include "modules/rtp_rtcp/source/rtp_rtcp_config.h"
 #include "modules/rtp_rtcp/source/rtp_rtcp_impl2.h"
@@ -95,12 +96,17 @@ constexpr double kAudioSampleDurationSeconds = 0.01;
 constexpr int kVoiceEngineMinMinPlayoutDelayMs = 0;
 constexpr int kVoiceEngineMaxMinPlayoutDelayMs = 10000;
 
+// Received audio levels older than this are not reported. Senders using DTX
+// send a packet at least every 400 ms during silence.
+constexpr TimeDelta kMaxAudioLevelAge = TimeDelta::Millis(500);
+
 std::unique_ptr<NetEq> CreateNetEq(
     NetEqFactory* neteq_factory,
     std::optional<AudioCodecPairId> codec_pair_id,
     size_t jitter_buffer_max_packets,
     bool jitter_buffer_fast_playout,
     int jitter_buffer_min_delay_ms,
+    std::optional<int> jitter_buffer_inactive_timeout_ms,
     const Environment& env,
     scoped_refptr<AudioDecoderFactory> decoder_factory) {
   NetEq::Config config;
@@ -109,6 +115,7 @@ std::unique_ptr<NetEq> CreateNetEq(
   config.enable_fast_accelerate = jitter_buffer_fast_playout;
   config.enable_muted_state = true;
   config.min_delay_ms = jitter_buffer_min_delay_ms;
+  config.inactive_stream_timeout_ms = jitter_buffer_inactive_timeout_ms;
   if (neteq_factory) {
     return neteq_factory->Create(env, config, std::move(decoder_factory));
   }
@@ -129,6 +136,7 @@ class ChannelReceive : public ChannelReceiveInterface,
       size_t jitter_buffer_max_packets,
       bool jitter_buffer_fast_playout,
       int jitter_buffer_min_delay_ms,
+      std::optional<int> jitter_buffer_inactive_timeout_ms,
       bool enable_non_sender_rtt,
       rtc::scoped_refptr<AudioDecoderFactory> decoder_factory,
       std::optional<AudioCodecPairId> codec_pair_id,
@@ -200,6 +208,8 @@ class ChannelReceive : public ChannelReceiveInterface,
 
   int PreferredSampleRate() const override;
 
+  std::optional<int> AudioLevelDbov() const override;
+
   std::vector<RtpSource> GetSources() const override;
 
   // Sets a frame transformer between the depacketizer and the decoder, to
@@ -271,6 +281,10 @@ class ChannelReceive : public ChannelReceiveInterface,
       RTC_GUARDED_BY(&worker_thread_checker_);
   std::optional<int64_t> last_received_rtp_system_time_ms_
       RTC_GUARDED_BY(&worker_thread_checker_);
+  // Sum of RtpPacketReceived::bytes_copied() over all received packets,
+  // reported per packet when the channel is destroyed.
+  int64_t rtp_bytes_copied_ RTC_GUARDED_BY(&worker_thread_checker_) = 0;
+  int64_t rtp_packets_received_ RTC_GUARDED_BY(&worker_thread_checker_) = 0;
 
   const std::unique_ptr<NetEq> neteq_;  // NetEq is thread-safe; no lock needed.
   acm2::ResamplerHelper resampler_helper_
@@ -336,6 +350,14 @@ class ChannelReceive : public ChannelReceiveInterface,
   RtcpPacketTypeCounter rtcp_packet_type_counter_
       RTC_GUARDED_BY(rtcp_counter_mutex_);
 
+  // Audio level of the most recently received packet with the audio level
+  // header extension, and when it was received.
+  mutable Mutex received_audio_level_mutex_;
+  std::optional<int> received_audio_level_dbov_
+      RTC_GUARDED_BY(received_audio_level_mutex_);
+  Timestamp received_audio_level_time_
+      RTC_GUARDED_BY(received_audio_level_mutex_) = Timestamp::MinusInfinity();
+
   std::map<int, SdpAudioFormat> payload_type_map_;
 };
 
@@ -564,6 +586,7 @@ ChannelReceive::ChannelReceive(
     size_t jitter_buffer_max_packets,
     bool jitter_buffer_fast_playout,
     int jitter_buffer_min_delay_ms,
+    std::optional<int> jitter_buffer_inactive_timeout_ms,
     bool enable_non_sender_rtt,
     rtc::scoped_refptr<AudioDecoderFactory> decoder_factory,
     std::optional<AudioCodecPairId> codec_pair_id,
@@ -580,6 +603,7 @@ ChannelReceive::ChannelReceive(
                          jitter_buffer_max_packets,
                          jitter_buffer_fast_playout,
                          jitter_buffer_min_delay_ms,
+                         jitter_buffer_inactive_timeout_ms,
                          env_,
                          decoder_factory)),
       _outputAudioLevel(),
@@ -623,6 +647,11 @@ ChannelReceive::~ChannelReceive() {
     frame_transformer_delegate_->Reset();
 
   StopPlayout();
+
+  if (rtp_packets_received_ > 0) {
+    RTC_HISTOGRAM_COUNTS_10000("WebRTC.Audio.RtpReceiveBytesCopiedPerPacket",
+                               rtp_bytes_copied_ / rtp_packets_received_);
+  }
 }
 
 void ChannelReceive::SetSink(AudioSinkInterface* sink) {
@@ -671,10 +700,22 @@ void ChannelReceive::OnRtpPacket(const RtpPacketReceived& packet) {
 
   last_received_rtp_timestamp_ = packet.Timestamp();
   last_received_rtp_system_time_ms_ = now_ms;
+  rtp_bytes_copied_ += packet.bytes_copied();
+  ++rtp_packets_received_;
 
   // Store playout timestamp for the received RTP packet
   UpdatePlayoutTimestamp(false, now_ms);
 
+  // Packets are only played out while playing.
+  if (playing_) {
+    if (std::optional<webrtc::AudioLevel> audio_level =
+            packet.GetExtension<AudioLevelExtension>()) {
+      MutexLock lock(&received_audio_level_mutex_);
+      received_audio_level_dbov_ = audio_level->level();
+      received_audio_level_time_ = env_.clock().CurrentTime();
+    }
+  }
+
   const auto& it = payload_type_frequencies_.find(packet.PayloadType());
   if (it == payload_type_frequencies_.end())
     return;
@@ -1177,6 +1218,17 @@ int ChannelReceive::GetRtpTimestampRateHz() const {
              : neteq_->last_output_sample_rate_hz();
 }
 
+std::optional<int> ChannelReceive::AudioLevelDbov() const {
+  MutexLock lock(&received_audio_level_mutex_);
+  // Without recent packets, e.g. when the sender stopped sending, the level
+  // is unknown.
+  if (env_.clock().CurrentTime() - received_audio_level_time_ >
+      kMaxAudioLevelAge) {
+    return std::nullopt;
+  }
+  return received_audio_level_dbov_;
+}
+
 std::vector<RtpSource> ChannelReceive::GetSources() const {
   RTC_DCHECK_RUN_ON(&worker_thread_checker_);
   return source_tracker_.GetSources();
@@ -1194,6 +1246,7 @@ std::unique_ptr<ChannelReceiveInterface> CreateChannelReceive(
     size_t jitter_buffer_max_packets,
     bool jitter_buffer_fast_playout,
     int jitter_buffer_min_delay_ms,
+    std::optional<int> jitter_buffer_inactive_timeout_ms,
     bool enable_non_sender_rtt,
     rtc::scoped_refptr<AudioDecoderFactory> decoder_factory,
     std::optional<AudioCodecPairId> codec_pair_id,
@@ -1203,9 +1256,9 @@ std::unique_ptr<ChannelReceiveInterface> CreateChannelReceive(
   return std::make_unique<ChannelReceive>(
       env, neteq_factory, audio_device_module, rtcp_send_transport, local_ssrc,
       remote_ssrc, jitter_buffer_max_packets, jitter_buffer_fast_playout,
-      jitter_buffer_min_delay_ms, enable_non_sender_rtt, decoder_factory,
-      codec_pair_id, std::move(frame_decryptor), crypto_options,
-      std::move(frame_transformer));
+      jitter_buffer_min_delay_ms, jitter_buffer_inactive_timeout_ms,
+      enable_non_sender_rtt, decoder_factory, codec_pair_id,
+      std::move(frame_decryptor), crypto_options, std::move(frame_transformer));
 }
 
 }  // namespace voe
@@ -159,6 +159,10 @@ class ChannelReceiveInterface : public RtpPacketSinkInterface {
 
   virtual int PreferredSampleRate() const = 0;
 
+  // Returns the audio level of the recently received packets, in -dBov, from
+  // their RFC 6464 header extension. See AudioMixer::Source::AudioLevelDbov().
+  virtual std::optional<int> AudioLevelDbov() const = 0;
+
   virtual std::vector<RtpSource> GetSources() const = 0;
 
   // Sets a frame transformer between the depacketizer and the decoder, to
@@ -184,6 +188,7 @@ std::unique_ptr<ChannelReceiveInterface> CreateChannelReceive(
     size_t jitter_buffer_max_packets,
     bool jitter_buffer_fast_playout,
     int jitter_buffer_min_delay_ms,
+    std::optional<int> jitter_buffer_inactive_timeout_ms,
     bool enable_non_sender_rtt,
     rtc::scoped_refptr<AudioDecoderFactory> decoder_factory,
     std::optional<AudioCodecPairId> codec_pair_id,
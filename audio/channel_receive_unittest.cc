@@ -18,11 +18,13 @@
 #include "api/test/mock_frame_transformer.h"
 #include "modules/audio_device/include/mock_audio_device.h"
 #include "modules/rtp_rtcp/source/byte_io.h"
+#include "modules/rtp_rtcp/include/rtp_header_extension_map.h"
 #include "modules/rtp_rtcp/source/ntp_time_util.h"
 #include "modules/rtp_rtcp/source/rtcp_packet/receiver_report.h"
 #include "modules/rtp_rtcp/source/rtcp_packet/report_block.h"
 #include "modules/rtp_rtcp/source/rtcp_packet/sdes.h"
 #include "modules/rtp_rtcp/source/rtcp_packet/sender_report.h"
+#include "modules/rtp_rtcp/source/rtp_header_extensions.h"
 #include "modules/rtp_rtcp/source/rtp_packet_received.h"
 #include "rtc_base/logging.h"
 #include "rtc_base/thread.h"
@@ -57,15 +59,16 @@ class ChannelReceiveTest : public Test {
     ON_CALL(*audio_device_module_, PlayoutDelay).WillByDefault(Return(0));
   }
 
-  std::unique_ptr<ChannelReceiveInterface> CreateTestChannelReceive() {
+  std::unique_ptr<ChannelReceiveInterface> CreateTestChannelReceive(
+      size_t jitter_buffer_max_packets = 0) {
     CryptoOptions crypto_options;
     auto channel = CreateChannelReceive(
         CreateEnvironment(time_controller_.GetClock()),
         /* neteq_factory= */ nullptr, audio_device_module_.get(), &transport_,
-        kLocalSsrc, kRemoteSsrc,
-        /* jitter_buffer_max_packets= */ 0,
+        kLocalSsrc, kRemoteSsrc, jitter_buffer_max_packets,
         /* jitter_buffer_fast_playout= */ false,
         /* jitter_buffer_min_delay_ms= */ 0,
+        /* jitter_buffer_inactive_timeout_ms= */ std::nullopt,
         /* enable_non_sender_rtt= */ false, audio_decoder_factory_,
         /* codec_pair_id= */ std::nullopt,
         /* frame_decryptor_interface= */ nullptr, crypto_options,
@@ -95,6 +98,24 @@ class ChannelReceiveTest : public Test {
     return packet;
   }
 
+  // Creates a packet with 10 ms of audio and an audio level header extension.
+  RtpPacketReceived CreateRtpPacketWithAudioLevel(uint16_t sequence_number,
+                                                  int audio_level_dbov) {
+    RtpHeaderExtensionMap extensions;
+    extensions.Register<AudioLevelExtension>(/*id=*/1);
+    RtpPacketReceived packet(&extensions);
+    packet.set_arrival_time(time_controller_.GetClock()->CurrentTime());
+    packet.SetSequenceNumber(sequence_number);
+    packet.SetTimestamp(sequence_number * kSampleRateHz / 100);
+    packet.SetSsrc(kRemoteSsrc);
+    packet.SetPayloadType(kPayloadType);
+    packet.SetExtension<AudioLevelExtension>(
+        AudioLevel(/*voice_activity=*/true, audio_level_dbov));
+    uint8_t* datapos = packet.SetPayloadSize(kSampleRateHz / 100);
+    memset(datapos, 0, kSampleRateHz / 100);
+    return packet;
+  }
+
   std::vector<uint8_t> CreateRtcpSenderReport() {
     std::vector<uint8_t> packet(1024);
     size_t pos = 0;
@@ -260,6 +281,64 @@ TEST_F(ChannelReceiveTest, SettingFrameTransformerMultipleTimes) {
   channel->SetDepacketizerToDecoderFrameTransformer(mock_frame_transformer);
 }
 
+TEST_F(ChannelReceiveTest, ReportsAudioLevelOfReceivedPackets) {
+  auto channel = CreateTestChannelReceive();
+  channel->StartPlayout();
+  EXPECT_EQ(channel->AudioLevelDbov(), std::nullopt);
+
+  channel->OnRtpPacket(CreateRtpPacket());
+  EXPECT_EQ(channel->AudioLevelDbov(), std::nullopt);
+
+  channel->OnRtpPacket(CreateRtpPacketWithAudioLevel(/*sequence_number=*/1,
+                                                    /*audio_level_dbov=*/25));
+  EXPECT_EQ(channel->AudioLevelDbov(), 25);
+  channel->OnRtpPacket(CreateRtpPacketWithAudioLevel(/*sequence_number=*/2,
+                                                    /*audio_level_dbov=*/90));
+  EXPECT_EQ(channel->AudioLevelDbov(), 90);
+
+  // The level is unknown once the sender stops sending.
+  time_controller_.AdvanceTime(TimeDelta::Seconds(1));
+  EXPECT_EQ(channel->AudioLevelDbov(), std::nullopt);
+}
+
+TEST_F(ChannelReceiveTest, DoesNotReportAudioLevelWhenNotPlaying) {
+  auto channel = CreateTestChannelReceive();
+  channel->OnRtpPacket(CreateRtpPacketWithAudioLevel(/*sequence_number=*/1,
+                                                    /*audio_level_dbov=*/25));
+  EXPECT_EQ(channel->AudioLevelDbov(), std::nullopt);
+}
+
+TEST_F(ChannelReceiveTest, KeepsAudioReceivedWhileSkippedByMixer) {
+  constexpr int kNumPackets = 20;
+  auto pulled_channel =
+      CreateTestChannelReceive(/*jitter_buffer_max_packets=*/50);
+  auto skipped_channel =
+      CreateTestChannelReceive(/*jitter_buffer_max_packets=*/50);
+  pulled_channel->StartPlayout();
+  skipped_channel->StartPlayout();
+
+  // Audio is received for 200 ms. A mixer queries the level of the skipped
+  // channel every 10 ms without pulling its audio.
+  for (uint16_t i = 0; i < kNumPackets; ++i) {
+    RtpPacketReceived packet =
+        CreateRtpPacketWithAudioLevel(i, /*audio_level_dbov=*/100);
+    pulled_channel->OnRtpPacket(packet);
+    skipped_channel->OnRtpPacket(packet);
+    EXPECT_EQ(skipped_channel->AudioLevelDbov(), 100);
+    time_controller_.AdvanceTime(TimeDelta::Millis(10));
+  }
+
+  // Querying the level has no effect on the buffered audio, which NetEq
+  // plays out from the start once the mixer pulls the channel again.
+  AudioFrame audio_frame;
+  pulled_channel->GetAudioFrameWithInfo(kSampleRateHz, &audio_frame);
+  skipped_channel->GetAudioFrameWithInfo(kSampleRateHz, &audio_frame);
+  EXPECT_EQ(skipped_channel->GetNetworkStatistics(false).currentBufferSize,
+            pulled_channel->GetNetworkStatistics(false).currentBufferSize);
+  EXPECT_GT(skipped_channel->GetNetworkStatistics(false).currentBufferSize,
+            150);
+}
+
 }  // namespace
 }  // namespace voe
 }  // namespace webrtc
@@ -140,6 +140,9 @@ class AudioReceiveStreamInterface : public MediaReceiveStreamInterface {
     size_t jitter_buffer_max_packets = 200;
     bool jitter_buffer_fast_accelerate = false;
     int jitter_buffer_min_delay_ms = 0;
+    // If set, NetEq releases its decoders after this long without speech, see
+    // NetEq::Config::inactive_stream_timeout_ms.
+    std::optional<int> jitter_buffer_inactive_timeout_ms;
 
     // Identifier for an A/V synchronization group. Empty string to disable.
     // TODO(pbos): Synchronize streams in a sync group, not just one video
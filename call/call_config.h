@@ -30,6 +30,7 @@
 namespace webrtc {
 
 class AudioProcessing;
+class SharedPacer;
 
 struct CallConfig {
   // If `network_task_queue` is set to nullptr, Call will assume that network
@@ -87,6 +88,9 @@ struct CallConfig {
   // The burst interval of the pacer, see TaskQueuePacedSender constructor.
   std::optional<TimeDelta> pacer_burst_interval;
 
+  // Pacer shared with other calls, see RtpTransportConfig::shared_pacer.
+  SharedPacer* shared_pacer = nullptr;
+
   // Enables send packet batching from the egress RTP sender.
   bool enable_send_packet_batching = false;
 };
@@ -21,6 +21,8 @@
 
 namespace webrtc {
 
+class SharedPacer;
+
 struct RtpTransportConfig {
   Environment env;
 
@@ -37,6 +39,11 @@ struct RtpTransportConfig {
 
   // The burst interval of the pacer, see TaskQueuePacedSender constructor.
   std::optional<TimeDelta> pacer_burst_interval;
+
+  // If set, packets are paced by a connection of this pacer, shared with other
+  // calls, instead of by a TaskQueuePacedSender of the call's own. Must
+  // outlive the call, and run on the task queue the call is created on.
+  SharedPacer* shared_pacer = nullptr;
 };
 }  // namespace webrtc
 
@@ -102,11 +102,25 @@ RtpTransportControllerSend::RtpTransportControllerSend(
       task_queue_(TaskQueueBase::Current()),
       bitrate_configurator_(config.bitrate_config),
       pacer_started_(false),
-      pacer_(&env_.clock(),
-             &packet_router_,
-             env_.field_trials(),
-             TimeDelta::Millis(5),
-             3),
+      task_queue_pacer_(config.shared_pacer
+                            ? nullptr
+                            : std::make_unique<TaskQueuePacedSender>(
+                                  &env_.clock(),
+                                  &packet_router_,
+                                  env_.field_trials(),
+                                  TimeDelta::Millis(5),
+                                  3)),
+      shared_pacer_connection_(
+          config.shared_pacer
+              ? config.shared_pacer->AddConnection(&packet_router_)
+              : nullptr),
+      pacer_(shared_pacer_connection_
+                 ? static_cast<RtpPacketPacer*>(shared_pacer_connection_.get())
+                 : task_queue_pacer_.get()),
+      pacer_packet_sender_(
+          shared_pacer_connection_
+              ? static_cast<RtpPacketSender*>(shared_pacer_connection_.get())
+              : task_queue_pacer_.get()),
       observer_(nullptr),
       controller_factory_override_(config.network_controller_factory),
       controller_factory_fallback_(
@@ -135,13 +149,22 @@ RtpTransportControllerSend::RtpTransportControllerSend(
   initial_config_.constraints =
       ConvertConstraints(config.bitrate_config, &env_.clock());
   RTC_DCHECK(config.bitrate_config.start_bitrate_bps > 0);
+  // The shared pacer calls `packet_router_`, and through it
+  // NotifyBweOfPacedSentPacket(), on its task queue.
+  RTC_DCHECK(!config.shared_pacer ||
+             config.shared_pacer->task_queue() == task_queue_);
 
-  pacer_.SetPacingRates(
+  pacer_->SetPacingRates(
       DataRate::BitsPerSec(config.bitrate_config.start_bitrate_bps),
       DataRate::Zero());
   if (config.pacer_burst_interval) {
     // Default burst interval overriden by config.
-    pacer_.SetSendBurstInterval(*config.pacer_burst_interval);
+    if (shared_pacer_connection_) {
+      shared_pacer_connection_->SetSendBurstInterval(
+          *config.pacer_burst_interval);
+    } else {
+      task_queue_pacer_->SetSendBurstInterval(*config.pacer_burst_interval);
+    }
   }
   packet_router_.RegisterNotifyBweCallback(
       [this](const RtpPacketToSend& packet,
@@ -199,9 +222,7 @@ void RtpTransportControllerSend::RegisterSendingRtpStream(
   // Allow pacer to send packets using this module.
   packet_router_.AddSendRtpModule(&rtp_module,
                                   /*remb_candidate=*/true);
-  pacer_.SetAllowProbeWithoutMediaPacket(
-      bwe_settings_.allow_probe_without_media &&
-      packet_router_.SupportsRtxPayloadPadding());
+  SetAllowProbeWithoutMediaPacket();
 }
 
 void RtpTransportControllerSend::DeRegisterSendingRtpStream(
@@ -212,16 +233,24 @@ void RtpTransportControllerSend::DeRegisterSendingRtpStream(
   // to a disabled module.
   packet_router_.RemoveSendRtpModule(&rtp_module);
   // Clear the pacer queue of any packets pertaining to this module.
-  pacer_.RemovePacketsForSsrc(rtp_module.SSRC());
+  pacer_packet_sender_->RemovePacketsForSsrc(rtp_module.SSRC());
   if (rtp_module.RtxSsrc().has_value()) {
-    pacer_.RemovePacketsForSsrc(*rtp_module.RtxSsrc());
+    pacer_packet_sender_->RemovePacketsForSsrc(*rtp_module.RtxSsrc());
   }
   if (rtp_module.FlexfecSsrc().has_value()) {
-    pacer_.RemovePacketsForSsrc(*rtp_module.FlexfecSsrc());
+    pacer_packet_sender_->RemovePacketsForSsrc(*rtp_module.FlexfecSsrc());
+  }
+  SetAllowProbeWithoutMediaPacket();
+}
+
+void RtpTransportControllerSend::SetAllowProbeWithoutMediaPacket() {
+  const bool allow = bwe_settings_.allow_probe_without_media &&
+                     packet_router_.SupportsRtxPayloadPadding();
+  if (shared_pacer_connection_) {
+    shared_pacer_connection_->SetAllowProbeWithoutMediaPacket(allow);
+  } else {
+    task_queue_pacer_->SetAllowProbeWithoutMediaPacket(allow);
   }
-  pacer_.SetAllowProbeWithoutMediaPacket(
-      bwe_settings_.allow_probe_without_media &&
-      packet_router_.SupportsRtxPayloadPadding());
 }
 
 void RtpTransportControllerSend::UpdateControlState() {
@@ -237,7 +266,7 @@ void RtpTransportControllerSend::UpdateControlState() {
 void RtpTransportControllerSend::UpdateCongestedState() {
   if (auto update = GetCongestedStateUpdate()) {
     is_congested_ = update.value();
-    pacer_.SetCongested(update.value());
+    pacer_->SetCongested(update.value());
   }
 }
 
@@ -260,7 +289,7 @@ RtpTransportControllerSend::network_state_estimate_observer() {
 }
 
 RtpPacketSender* RtpTransportControllerSend::packet_sender() {
-  return &pacer_;
+  return pacer_packet_sender_;
 }
 
 void RtpTransportControllerSend::SetAllocatedSendBitrateLimits(
@@ -277,7 +306,7 @@ void RtpTransportControllerSend::SetPacingFactor(float pacing_factor) {
   UpdateStreamsConfig();
 }
 void RtpTransportControllerSend::SetQueueTimeLimit(int limit_ms) {
-  pacer_.SetQueueTimeLimit(TimeDelta::Millis(limit_ms));
+  pacer_->SetQueueTimeLimit(TimeDelta::Millis(limit_ms));
 }
 StreamFeedbackProvider*
 RtpTransportControllerSend::GetStreamFeedbackProvider() {
@@ -291,9 +320,7 @@ void RtpTransportControllerSend::ReconfigureBandwidthEstimation(
 
   streams_config_.enable_repeated_initial_probing =
       bwe_settings_.allow_probe_without_media;
-  bool allow_probe_without_media = bwe_settings_.allow_probe_without_media &&
-                                   packet_router_.SupportsRtxPayloadPadding();
-  pacer_.SetAllowProbeWithoutMediaPacket(allow_probe_without_media);
+  SetAllowProbeWithoutMediaPacket();
 
   if (controller_) {
     // Recreate the controller and handler.
@@ -409,7 +436,7 @@ void RtpTransportControllerSend::OnNetworkRouteChanged(
       UpdateInitialConstraints(msg.constraints);
     }
     is_congested_ = false;
-    pacer_.SetCongested(false);
+    pacer_->SetCongested(false);
   }
 }
 void RtpTransportControllerSend::OnNetworkAvailability(bool network_available) {
@@ -418,12 +445,12 @@ void RtpTransportControllerSend::OnNetworkAvailability(bool network_available) {
                       << (network_available ? "Up" : "Down");
   network_available_ = network_available;
   if (network_available) {
-    pacer_.Resume();
+    pacer_->Resume();
   } else {
-    pacer_.Pause();
+    pacer_->Pause();
   }
   is_congested_ = false;
-  pacer_.SetCongested(false);
+  pacer_->SetCongested(false);
 
   if (!controller_) {
     MaybeCreateControllers();
@@ -437,11 +464,11 @@ NetworkLinkRtcpObserver* RtpTransportControllerSend::GetRtcpObserver() {
   return this;
 }
 int64_t RtpTransportControllerSend::GetPacerQueuingDelayMs() const {
-  return pacer_.OldestPacketWaitTime().ms();
+  return pacer_->OldestPacketWaitTime().ms();
 }
 std::optional<Timestamp> RtpTransportControllerSend::GetFirstPacketTime()
     const {
-  return pacer_.FirstSentPacketTime();
+  return pacer_->FirstSentPacketTime();
 }
 void RtpTransportControllerSend::EnablePeriodicAlrProbing(bool enable) {
   RTC_DCHECK_RUN_ON(&sequence_checker_);
@@ -558,7 +585,7 @@ void RtpTransportControllerSend::OnTransportOverheadChanged(
     return;
   }
 
-  pacer_.SetTransportOverhead(
+  pacer_->SetTransportOverhead(
       DataSize::Bytes(transport_overhead_bytes_per_packet));
 
   // TODO(holmer): Call AudioRtpSenders when they have been moved to
@@ -571,18 +598,20 @@ void RtpTransportControllerSend::OnTransportOverheadChanged(
 
 void RtpTransportControllerSend::AccountForAudioPacketsInPacedSender(
     bool account_for_audio) {
-  pacer_.SetAccountForAudioPackets(account_for_audio);
+  pacer_->SetAccountForAudioPackets(account_for_audio);
 }
 
 void RtpTransportControllerSend::IncludeOverheadInPacedSender() {
-  pacer_.SetIncludeOverhead();
+  pacer_->SetIncludeOverhead();
 }
 
 void RtpTransportControllerSend::EnsureStarted() {
   RTC_DCHECK_RUN_ON(&sequence_checker_);
   if (!pacer_started_) {
     pacer_started_ = true;
-    pacer_.EnsureStarted();
+    if (task_queue_pacer_) {
+      task_queue_pacer_->EnsureStarted();
+    }
   }
 }
 
@@ -751,7 +780,7 @@ void RtpTransportControllerSend::StartProcessPeriodicTasks() {
     pacer_queue_update_task_ = RepeatingTaskHandle::DelayedStart(
         task_queue_, kPacerQueueUpdateInterval, [this]() {
           RTC_DCHECK_RUN_ON(&sequence_checker_);
-          TimeDelta expected_queue_time = pacer_.ExpectedQueueTime();
+          TimeDelta expected_queue_time = pacer_->ExpectedQueueTime();
           control_handler_->SetPacerQueue(expected_queue_time);
           UpdateControlState();
           return kPacerQueueUpdateInterval;
@@ -773,7 +802,7 @@ void RtpTransportControllerSend::UpdateControllerWithTimeInterval() {
   ProcessInterval msg;
   msg.at_time = Timestamp::Millis(env_.clock().TimeInMilliseconds());
   if (add_pacing_to_cwin_)
-    msg.pacer_queue = pacer_.QueueSizeData();
+    msg.pacer_queue = pacer_->QueueSizeData();
   PostUpdates(controller_->OnProcessInterval(msg));
 }
 
@@ -790,11 +819,11 @@ void RtpTransportControllerSend::PostUpdates(NetworkControlUpdate update) {
     UpdateCongestedState();
   }
   if (update.pacer_config) {
-    pacer_.SetPacingRates(update.pacer_config->data_rate(),
+    pacer_->SetPacingRates(update.pacer_config->data_rate(),
                           update.pacer_config->pad_rate());
   }
   if (!update.probe_cluster_configs.empty()) {
-    pacer_.CreateProbeClusters(std::move(update.probe_cluster_configs));
+    pacer_->CreateProbeClusters(std::move(update.probe_cluster_configs));
   }
   if (update.target_rate) {
     control_handler_->SetTargetRate(*update.target_rate);
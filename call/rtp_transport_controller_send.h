@@ -24,6 +24,7 @@
 #include "api/environment/environment.h"
 #include "api/fec_controller.h"
 #include "api/frame_transformer_interface.h"
+#include "api/rtp_packet_sender.h"
 #include "api/scoped_refptr.h"
 #include "api/sequence_checker.h"
 #include "api/task_queue/pending_task_safety_flag.h"
@@ -45,6 +46,8 @@
 #include "modules/congestion_controller/rtp/transport_feedback_adapter.h"
 #include "modules/congestion_controller/rtp/transport_feedback_demuxer.h"
 #include "modules/pacing/packet_router.h"
+#include "modules/pacing/rtp_packet_pacer.h"
+#include "modules/pacing/shared_pacer.h"
 #include "modules/pacing/task_queue_paced_sender.h"
 #include "modules/rtp_rtcp/include/report_block_data.h"
 #include "modules/rtp_rtcp/include/rtp_rtcp_defines.h"
@@ -183,6 +186,7 @@ class RtpTransportControllerSend final
       RTC_RUN_ON(sequence_checker_);
   void ProcessSentPacketUpdates(NetworkControlUpdate updates)
       RTC_RUN_ON(sequence_checker_);
+  void SetAllowProbeWithoutMediaPacket() RTC_RUN_ON(sequence_checker_);
 
   const Environment env_;
   SequenceChecker sequence_checker_;
@@ -196,7 +200,13 @@ class RtpTransportControllerSend final
       RTC_GUARDED_BY(sequence_checker_);
   BandwidthEstimationSettings bwe_settings_ RTC_GUARDED_BY(sequence_checker_);
   bool pacer_started_ RTC_GUARDED_BY(sequence_checker_);
-  TaskQueuePacedSender pacer_;
+  // Exactly one of these paces the packets, see
+  // RtpTransportConfig::shared_pacer.
+  const std::unique_ptr<TaskQueuePacedSender> task_queue_pacer_;
+  const std::unique_ptr<SharedPacer::Connection> shared_pacer_connection_;
+  // The pacer in use.
+  RtpPacketPacer* const pacer_;
+  RtpPacketSender* const pacer_packet_sender_;
 
   TargetTransferRateObserver* observer_ RTC_GUARDED_BY(sequence_checker_);
   TransportFeedbackDemuxer feedback_demuxer_;
@@ -46,6 +46,7 @@
 #include "call/video_send_stream.h"
 #include "common_video/frame_counts.h"
 #include "common_video/generic_frame_descriptor/generic_frame_info.h"
+#include "modules/pacing/shared_pacer.h"
 #include "modules/rtp_rtcp/include/report_block_data.h"
 #include "modules/rtp_rtcp/include/rtcp_statistics.h"
 #include "modules/rtp_rtcp/include/rtp_header_extension_map.h"
@@ -157,7 +158,8 @@ class RtpVideoSenderTestFixture {
       const std::map<uint32_t, RtpPayloadState>& suspended_payload_states,
       FrameCountObserver* frame_count_observer,
       rtc::scoped_refptr<FrameTransformerInterface> frame_transformer,
-      const FieldTrialsView* field_trials = nullptr)
+      const FieldTrialsView* field_trials = nullptr,
+      bool use_shared_pacer = false)
       : time_controller_(Timestamp::Millis(1000000)),
         env_(CreateEnvironment(&field_trials_,
                                field_trials,
@@ -168,8 +170,16 @@ class RtpVideoSenderTestFixture {
                                             rtx_ssrcs,
                                             payload_type)),
         bitrate_config_(GetBitrateConfig()),
+        // The pacer runs on the worker queue of the transport controller.
+        shared_pacer_(use_shared_pacer ? std::make_unique<SharedPacer>(
+                                             env_,
+                                             time_controller_.GetMainThread(),
+                                             SharedPacer::Config())
+                                       : nullptr),
         transport_controller_(
-            RtpTransportConfig{.env = env_, .bitrate_config = bitrate_config_}),
+            RtpTransportConfig{.env = env_,
+                               .bitrate_config = bitrate_config_,
+                               .shared_pacer = shared_pacer_.get()}),
         stats_proxy_(time_controller_.GetClock(),
                      config_,
                      VideoEncoderConfig::ContentType::kRealtimeVideo,
@@ -234,6 +244,7 @@ class RtpVideoSenderTestFixture {
   Environment env_;
   VideoSendStream::Config config_;
   BitrateConstraints bitrate_config_;
+  std::unique_ptr<SharedPacer> shared_pacer_;
   RtpTransportControllerSend transport_controller_;
   SendStatisticsProxy stats_proxy_;
   RateLimiter retransmission_rate_limiter_;
@@ -274,6 +285,46 @@ TEST(RtpVideoSenderTest, SendOnOneModule) {
             test.router()->OnEncodedImage(encoded_image, nullptr).error);
 }
 
+TEST(RtpVideoSenderTest, SendsPacketsThroughSharedPacer) {
+  RtpVideoSenderTestFixture test({kSsrc1}, {kRtxSsrc1}, kPayloadType, {},
+                                 /*frame_count_observer=*/nullptr,
+                                 /*frame_transformer=*/nullptr,
+                                 /*field_trials=*/nullptr,
+                                 /*use_shared_pacer=*/true);
+  test.SetSending(true);
+
+  constexpr uint8_t kPayload = 'a';
+  EncodedImage encoded_image;
+  encoded_image.SetRtpTimestamp(1);
+  encoded_image.capture_time_ms_ = 2;
+  encoded_image._frameType = VideoFrameType::kVideoFrameKey;
+  encoded_image.SetEncodedData(EncodedImageBuffer::Create(&kPayload, 1));
+
+  // The packets reach the transport with transport sequence numbers, so they
+  // went through the packet router of the call.
+  std::vector<int64_t> transport_sequence_numbers;
+  EXPECT_CALL(test.transport(), SendRtp)
+      .Times(2)
+      .WillRepeatedly([&](rtc::ArrayView<const uint8_t> packet,
+                          const PacketOptions& options) {
+        RtpPacket rtp_packet;
+        EXPECT_TRUE(rtp_packet.Parse(packet));
+        EXPECT_EQ(rtp_packet.Ssrc(), kSsrc1);
+        transport_sequence_numbers.push_back(options.packet_id);
+        return true;
+      });
+  EXPECT_EQ(EncodedImageCallback::Result::OK,
+            test.router()->OnEncodedImage(encoded_image, nullptr).error);
+  encoded_image.SetRtpTimestamp(2);
+  encoded_image.capture_time_ms_ = 3;
+  EXPECT_EQ(EncodedImageCallback::Result::OK,
+            test.router()->OnEncodedImage(encoded_image, nullptr).error);
+  test.AdvanceTime(TimeDelta::Millis(33));
+
+  ASSERT_THAT(transport_sequence_numbers, SizeIs(2));
+  EXPECT_EQ(transport_sequence_numbers[1], transport_sequence_numbers[0] + 1);
+}
+
 TEST(RtpVideoSenderTest, OnEncodedImageReturnOkWhenSendingTrue) {
   constexpr uint8_t kPayload = 'a';
   EncodedImage encoded_image_1;
@@ -0,0 +1,77 @@
+/*
+ *  Copyright 2025 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <immintrin.h>
+
+#include "common_audio/signal_processing/include/signal_processing_library.h"
+
+// Returns the sum of the eight 32-bit lanes of `v`.
+static int32_t HorizontalSum(__m256i v) {
+  __m128i sum = _mm_add_epi32(_mm256_castsi256_si128(v),
+                              _mm256_extracti128_si256(v, 1));
+  sum = _mm_add_epi32(sum, _mm_shuffle_epi32(sum, _MM_SHUFFLE(1, 0, 3, 2)));
+  sum = _mm_add_epi32(sum, _mm_shuffle_epi32(sum, _MM_SHUFFLE(2, 3, 0, 1)));
+  return _mm_cvtsi128_si32(sum);
+}
+
+// Each product is shifted before it is accumulated, like in the C version.
+// The 32-bit sums wrap around like the C version, so the result is bit-exact
+// regardless of the order of the additions.
+static int32_t DotProductWithShift(const int16_t* seq1,
+                                   const int16_t* seq2,
+                                   size_t length,
+                                   int right_shifts) {
+  __m256i sum = _mm256_setzero_si256();
+  int32_t corr = 0;
+  size_t j = 0;
+
+  if (right_shifts == 0) {
+    // Without shift, pairs of products can be added by _mm256_madd_epi16().
+    for (; j + 16 <= length; j += 16) {
+      __m256i in1 = _mm256_loadu_si256((const __m256i*)&seq1[j]);
+      __m256i in2 = _mm256_loadu_si256((const __m256i*)&seq2[j]);
+      sum = _mm256_add_epi32(sum, _mm256_madd_epi16(in1, in2));
+    }
+  } else {
+    const __m128i shift = _mm_cvtsi32_si128(right_shifts);
+    for (; j + 8 <= length; j += 8) {
+      __m256i in1 =
+          _mm256_cvtepi16_epi32(_mm_loadu_si128((const __m128i*)&seq1[j]));
+      __m256i in2 =
+          _mm256_cvtepi16_epi32(_mm_loadu_si128((const __m128i*)&seq2[j]));
+      __m256i product = _mm256_mullo_epi32(in1, in2);
+      sum = _mm256_add_epi32(sum, _mm256_sra_epi32(product, shift));
+    }
+  }
+  corr = HorizontalSum(sum);
+
+  for (; j < length; j++) {
+    corr += (seq1[j] * seq2[j]) >> right_shifts;
+  }
+  return corr;
+}
+
+// AVX2 version of WebRtcSpl_CrossCorrelation(), bit-exact with
+// WebRtcSpl_CrossCorrelationC().
+void WebRtcSpl_CrossCorrelationAVX2(int32_t* cross_correlation,
+                                    const int16_t* seq1,
+                                    const int16_t* seq2,
+                                    size_t dim_seq,
+                                    size_t dim_cross_correlation,
+                                    int right_shifts,
+                                    int step_seq2) {
+  size_t i = 0;
+
+  for (i = 0; i < dim_cross_correlation; i++) {
+    *cross_correlation++ =
+        DotProductWithShift(seq1, seq2, dim_seq, right_shifts);
+    seq2 += step_seq2;
+  }
+}
@@ -0,0 +1,104 @@
+/*
+ *  Copyright 2025 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <immintrin.h>
+
+#include "common_audio/signal_processing/include/signal_processing_library.h"
+
+// Loads the 32-bit words starting at `data`[k * `factor`] for k = 0..7, i.e.
+// the sample pairs (data[k * factor], data[k * factor + 1]).
+static __m256i LoadSamplePairs(const int16_t* data,
+                               __m256i offsets,
+                               int factor) {
+  if (factor == 2) {
+    // The pairs are adjacent.
+    return _mm256_loadu_si256((const __m256i*)data);
+  }
+  return _mm256_i32gather_epi32((const int*)data, offsets, 2);
+}
+
+// AVX2 version of WebRtcSpl_DownsampleFast(), bit-exact with
+// WebRtcSpl_DownsampleFastC(). Eight output samples are computed at a time,
+// two filter taps per multiply-add.
+int WebRtcSpl_DownsampleFastAVX2(const int16_t* data_in,
+                                 size_t data_in_length,
+                                 int16_t* data_out,
+                                 size_t data_out_length,
+                                 const int16_t* __restrict coefficients,
+                                 size_t coefficients_length,
+                                 int factor,
+                                 size_t delay) {
+  // Using signed indexes to be able to compute negative i-j that
+  // is used to index data_in.
+  int i = delay;
+  int j = 0;
+  int32_t out_s32 = 0;
+  const int endpos = delay + factor * (data_out_length - 1) + 1;
+  const int endpos1 = endpos - factor * (data_out_length & 0x7);
+
+  // Return error if any of the running conditions doesn't meet.
+  if (data_out_length == 0 || coefficients_length == 0 ||
+      (int)data_in_length < endpos) {
+    return -1;
+  }
+
+  // The taps are processed in pairs (j + 1, j), reading the samples
+  // data_in[i - j - 1] and data_in[i - j]. A single last tap is paired with a
+  // zero tap, reading data_in[i - j] and data_in[i - j + 1], which needs at
+  // least one earlier tap to stay within the input.
+  if (coefficients_length > 1) {
+    const __m256i offsets =
+        _mm256_mullo_epi32(_mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7),
+                           _mm256_set1_epi32(factor));
+    const int num_tap_pairs = (int)coefficients_length / 2;
+    const int has_single_tap = (int)coefficients_length % 2;
+
+    for (; i < endpos1; i += factor * 8) {
+      __m256i out = _mm256_set1_epi32(2048);  // Round value, 0.5 in Q12.
+      __m128i out16;
+
+      for (j = 0; j < 2 * num_tap_pairs; j += 2) {
+        const __m256i taps = _mm256_set1_epi32(
+            (int32_t)(((uint32_t)(uint16_t)coefficients[j] << 16) |
+                      (uint16_t)coefficients[j + 1]));
+        const __m256i in =
+            LoadSamplePairs(&data_in[i - j - 1], offsets, factor);
+        out = _mm256_add_epi32(out, _mm256_madd_epi16(in, taps));
+      }
+      if (has_single_tap) {
+        const __m256i taps = _mm256_set1_epi32((uint16_t)coefficients[j]);
+        const __m256i in = LoadSamplePairs(&data_in[i - j], offsets, factor);
+        out = _mm256_add_epi32(out, _mm256_madd_epi16(in, taps));
+      }
+
+      // Shift to Q0, saturate and store the output.
+      out = _mm256_srai_epi32(out, 12);
+      out16 = _mm_packs_epi32(_mm256_castsi256_si128(out),
+                              _mm256_extracti128_si256(out, 1));
+      _mm_storeu_si128((__m128i*)data_out, out16);
+      data_out += 8;
+    }
+  }
+
+  // Do the rest of the iterations (if any) like the C version.
+  for (; i < endpos; i += factor) {
+    out_s32 = 2048;  // Round value, 0.5 in Q12.
+
+    for (j = 0; j < (int)coefficients_length; j++) {
+      out_s32 += coefficients[j] * data_in[i - j];
+    }
+
+    // Saturate and store the output.
+    out_s32 >>= 12;
+    *data_out++ = WebRtcSpl_SatW32ToW16(out_s32);
+  }
+
+  return 0;
+}
@@ -20,6 +20,7 @@
 #include <string.h>
 
 #include "common_audio/signal_processing/dot_product_with_scale.h"
+#include "rtc_base/system/arch.h"
 
 // Macros specific for the fixed point implementation
 #define WEBRTC_SPL_WORD16_MAX 32767
@@ -136,6 +137,10 @@ void WebRtcSpl_ZerosArrayW32(int32_t* vector, size_t vector_length);
 typedef int16_t (*MaxAbsValueW16)(const int16_t* vector, size_t length);
 extern const MaxAbsValueW16 WebRtcSpl_MaxAbsValueW16;
 int16_t WebRtcSpl_MaxAbsValueW16C(const int16_t* vector, size_t length);
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+int16_t WebRtcSpl_MaxAbsValueW16X86(const int16_t* vector, size_t length);
+int16_t WebRtcSpl_MaxAbsValueW16AVX2(const int16_t* vector, size_t length);
+#endif
 #if defined(WEBRTC_HAS_NEON)
 int16_t WebRtcSpl_MaxAbsValueW16Neon(const int16_t* vector, size_t length);
 #endif
@@ -153,6 +158,10 @@ int16_t WebRtcSpl_MaxAbsValueW16_mips(const int16_t* vector, size_t length);
 typedef int32_t (*MaxAbsValueW32)(const int32_t* vector, size_t length);
 extern const MaxAbsValueW32 WebRtcSpl_MaxAbsValueW32;
 int32_t WebRtcSpl_MaxAbsValueW32C(const int32_t* vector, size_t length);
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+int32_t WebRtcSpl_MaxAbsValueW32X86(const int32_t* vector, size_t length);
+int32_t WebRtcSpl_MaxAbsValueW32AVX2(const int32_t* vector, size_t length);
+#endif
 #if defined(WEBRTC_HAS_NEON)
 int32_t WebRtcSpl_MaxAbsValueW32Neon(const int32_t* vector, size_t length);
 #endif
@@ -170,6 +179,10 @@ int32_t WebRtcSpl_MaxAbsValueW32_mips(const int32_t* vector, size_t length);
 typedef int16_t (*MaxValueW16)(const int16_t* vector, size_t length);
 extern const MaxValueW16 WebRtcSpl_MaxValueW16;
 int16_t WebRtcSpl_MaxValueW16C(const int16_t* vector, size_t length);
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+int16_t WebRtcSpl_MaxValueW16X86(const int16_t* vector, size_t length);
+int16_t WebRtcSpl_MaxValueW16AVX2(const int16_t* vector, size_t length);
+#endif
 #if defined(WEBRTC_HAS_NEON)
 int16_t WebRtcSpl_MaxValueW16Neon(const int16_t* vector, size_t length);
 #endif
@@ -187,6 +200,10 @@ int16_t WebRtcSpl_MaxValueW16_mips(const int16_t* vector, size_t length);
 typedef int32_t (*MaxValueW32)(const int32_t* vector, size_t length);
 extern const MaxValueW32 WebRtcSpl_MaxValueW32;
 int32_t WebRtcSpl_MaxValueW32C(const int32_t* vector, size_t length);
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+int32_t WebRtcSpl_MaxValueW32X86(const int32_t* vector, size_t length);
+int32_t WebRtcSpl_MaxValueW32AVX2(const int32_t* vector, size_t length);
+#endif
 #if defined(WEBRTC_HAS_NEON)
 int32_t WebRtcSpl_MaxValueW32Neon(const int32_t* vector, size_t length);
 #endif
@@ -204,6 +221,10 @@ int32_t WebRtcSpl_MaxValueW32_mips(const int32_t* vector, size_t length);
 typedef int16_t (*MinValueW16)(const int16_t* vector, size_t length);
 extern const MinValueW16 WebRtcSpl_MinValueW16;
 int16_t WebRtcSpl_MinValueW16C(const int16_t* vector, size_t length);
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+int16_t WebRtcSpl_MinValueW16X86(const int16_t* vector, size_t length);
+int16_t WebRtcSpl_MinValueW16AVX2(const int16_t* vector, size_t length);
+#endif
 #if defined(WEBRTC_HAS_NEON)
 int16_t WebRtcSpl_MinValueW16Neon(const int16_t* vector, size_t length);
 #endif
@@ -221,6 +242,10 @@ int16_t WebRtcSpl_MinValueW16_mips(const int16_t* vector, size_t length);
 typedef int32_t (*MinValueW32)(const int32_t* vector, size_t length);
 extern const MinValueW32 WebRtcSpl_MinValueW32;
 int32_t WebRtcSpl_MinValueW32C(const int32_t* vector, size_t length);
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+int32_t WebRtcSpl_MinValueW32X86(const int32_t* vector, size_t length);
+int32_t WebRtcSpl_MinValueW32AVX2(const int32_t* vector, size_t length);
+#endif
 #if defined(WEBRTC_HAS_NEON)
 int32_t WebRtcSpl_MinValueW32Neon(const int32_t* vector, size_t length);
 #endif
@@ -630,6 +655,22 @@ void WebRtcSpl_CrossCorrelationC(int32_t* cross_correlation,
                                  size_t dim_cross_correlation,
                                  int right_shifts,
                                  int step_seq2);
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+void WebRtcSpl_CrossCorrelationX86(int32_t* cross_correlation,
+                                   const int16_t* seq1,
+                                   const int16_t* seq2,
+                                   size_t dim_seq,
+                                   size_t dim_cross_correlation,
+                                   int right_shifts,
+                                   int step_seq2);
+void WebRtcSpl_CrossCorrelationAVX2(int32_t* cross_correlation,
+                                    const int16_t* seq1,
+                                    const int16_t* seq2,
+                                    size_t dim_seq,
+                                    size_t dim_cross_correlation,
+                                    int right_shifts,
+                                    int step_seq2);
+#endif
 #if defined(WEBRTC_HAS_NEON)
 void WebRtcSpl_CrossCorrelationNeon(int32_t* cross_correlation,
                                     const int16_t* seq1,
@@ -778,6 +819,24 @@ int WebRtcSpl_DownsampleFastC(const int16_t* data_in,
                               size_t coefficients_length,
                               int factor,
                               size_t delay);
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+int WebRtcSpl_DownsampleFastX86(const int16_t* data_in,
+                                size_t data_in_length,
+                                int16_t* data_out,
+                                size_t data_out_length,
+                                const int16_t* __restrict coefficients,
+                                size_t coefficients_length,
+                                int factor,
+                                size_t delay);
+int WebRtcSpl_DownsampleFastAVX2(const int16_t* data_in,
+                                 size_t data_in_length,
+                                 int16_t* data_out,
+                                 size_t data_out_length,
+                                 const int16_t* __restrict coefficients,
+                                 size_t coefficients_length,
+                                 int factor,
+                                 size_t delay);
+#endif
 #if defined(WEBRTC_HAS_NEON)
 int WebRtcSpl_DownsampleFastNeon(const int16_t* data_in,
                                  size_t data_in_length,
@@ -0,0 +1,209 @@
+/*
+ *  Copyright 2025 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+/*
+ * This file contains the AVX2 implementations of the functions
+ * WebRtcSpl_MaxAbsValueW16AVX2()
+ * WebRtcSpl_MaxAbsValueW32AVX2()
+ * WebRtcSpl_MaxValueW16AVX2()
+ * WebRtcSpl_MaxValueW32AVX2()
+ * WebRtcSpl_MinValueW16AVX2()
+ * WebRtcSpl_MinValueW32AVX2()
+ * which give the same results as the C versions.
+ */
+
+#include <immintrin.h>
+#include <limits.h>
+#include <stdlib.h>
+
+#include "common_audio/signal_processing/include/signal_processing_library.h"
+#include "rtc_base/checks.h"
+
+// Reduces the 16 lanes of `v` with `op`, leaving the result in lane 0.
+#define REDUCE_EPI16(v, op)                                            \
+  do {                                                                 \
+    __m128i r =                                                        \
+        op(_mm256_castsi256_si128(v), _mm256_extracti128_si256(v, 1)); \
+    r = op(r, _mm_shuffle_epi32(r, _MM_SHUFFLE(1, 0, 3, 2)));          \
+    r = op(r, _mm_shuffle_epi32(r, _MM_SHUFFLE(2, 3, 0, 1)));          \
+    r = op(r, _mm_srli_epi32(r, 16));                                  \
+    v = _mm256_castsi128_si256(r);                                     \
+  } while (0)
+
+// Reduces the 8 lanes of `v` with `op`, leaving the result in lane 0.
+#define REDUCE_EPI32(v, op)                                            \
+  do {                                                                 \
+    __m128i r =                                                        \
+        op(_mm256_castsi256_si128(v), _mm256_extracti128_si256(v, 1)); \
+    r = op(r, _mm_shuffle_epi32(r, _MM_SHUFFLE(1, 0, 3, 2)));          \
+    r = op(r, _mm_shuffle_epi32(r, _MM_SHUFFLE(2, 3, 0, 1)));          \
+    v = _mm256_castsi128_si256(r);                                     \
+  } while (0)
+
+// Maximum absolute value of word16 vector.
+int16_t WebRtcSpl_MaxAbsValueW16AVX2(const int16_t* vector, size_t length) {
+  size_t i = 0;
+  int absolute = 0, maximum = 0;
+
+  RTC_DCHECK_GT(length, 0);
+
+  if (length >= 16) {
+    // abs(-32768) is 0x8000, which is 32768 when compared as unsigned.
+    __m256i max = _mm256_setzero_si256();
+    for (; i + 16 <= length; i += 16) {
+      __m256i in = _mm256_loadu_si256((const __m256i*)&vector[i]);
+      max = _mm256_max_epu16(max, _mm256_abs_epi16(in));
+    }
+    REDUCE_EPI16(max, _mm_max_epu16);
+    maximum = _mm_cvtsi128_si32(_mm256_castsi256_si128(max)) & 0xFFFF;
+  }
+
+  for (; i < length; i++) {
+    absolute = abs((int)vector[i]);
+    if (absolute > maximum) {
+      maximum = absolute;
+    }
+  }
+
+  // Guard the case for abs(-32768).
+  if (maximum > WEBRTC_SPL_WORD16_MAX) {
+    maximum = WEBRTC_SPL_WORD16_MAX;
+  }
+
+  return (int16_t)maximum;
+}
+
+// Maximum absolute value of word32 vector.
+int32_t WebRtcSpl_MaxAbsValueW32AVX2(const int32_t* vector, size_t length) {
+  // Use uint32_t for the local variables, to accommodate the return value
+  // of abs(0x80000000), which is 0x80000000.
+  uint32_t absolute = 0, maximum = 0;
+  size_t i = 0;
+
+  RTC_DCHECK_GT(length, 0);
+
+  if (length >= 8) {
+    __m256i max = _mm256_setzero_si256();
+    for (; i + 8 <= length; i += 8) {
+      __m256i in = _mm256_loadu_si256((const __m256i*)&vector[i]);
+      max = _mm256_max_epu32(max, _mm256_abs_epi32(in));
+    }
+    REDUCE_EPI32(max, _mm_max_epu32);
+    maximum = (uint32_t)_mm_cvtsi128_si32(_mm256_castsi256_si128(max));
+  }
+
+  for (; i < length; i++) {
+    absolute =
+        (vector[i] != INT_MIN) ? abs((int)vector[i]) : INT_MAX + (uint32_t)1;
+    if (absolute > maximum) {
+      maximum = absolute;
+    }
+  }
+
+  maximum = WEBRTC_SPL_MIN(maximum, WEBRTC_SPL_WORD32_MAX);
+
+  return (int32_t)maximum;
+}
+
+// Maximum value of word16 vector.
+int16_t WebRtcSpl_MaxValueW16AVX2(const int16_t* vector, size_t length) {
+  int16_t maximum = WEBRTC_SPL_WORD16_MIN;
+  size_t i = 0;
+
+  RTC_DCHECK_GT(length, 0);
+
+  if (length >= 16) {
+    __m256i max = _mm256_set1_epi16(WEBRTC_SPL_WORD16_MIN);
+    for (; i + 16 <= length; i += 16) {
+      max = _mm256_max_epi16(
+          max, _mm256_loadu_si256((const __m256i*)&vector[i]));
+    }
+    REDUCE_EPI16(max, _mm_max_epi16);
+    maximum = (int16_t)_mm_cvtsi128_si32(_mm256_castsi256_si128(max));
+  }
+
+  for (; i < length; i++) {
+    if (vector[i] > maximum)
+      maximum = vector[i];
+  }
+  return maximum;
+}
+
+// Maximum value of word32 vector.
+int32_t WebRtcSpl_MaxValueW32AVX2(const int32_t* vector, size_t length) {
+  int32_t maximum = WEBRTC_SPL_WORD32_MIN;
+  size_t i = 0;
+
+  RTC_DCHECK_GT(length, 0);
+
+  if (length >= 8) {
+    __m256i max = _mm256_set1_epi32(WEBRTC_SPL_WORD32_MIN);
+    for (; i + 8 <= length; i += 8) {
+      max = _mm256_max_epi32(
+          max, _mm256_loadu_si256((const __m256i*)&vector[i]));
+    }
+    REDUCE_EPI32(max, _mm_max_epi32);
+    maximum = _mm_cvtsi128_si32(_mm256_castsi256_si128(max));
+  }
+
+  for (; i < length; i++) {
+    if (vector[i] > maximum)
+      maximum = vector[i];
+  }
+  return maximum;
+}
+
+// Minimum value of word16 vector.
+int16_t WebRtcSpl_MinValueW16AVX2(const int16_t* vector, size_t length) {
+  int16_t minimum = WEBRTC_SPL_WORD16_MAX;
+  size_t i = 0;
+
+  RTC_DCHECK_GT(length, 0);
+
+  if (length >= 16) {
+    __m256i min = _mm256_set1_epi16(WEBRTC_SPL_WORD16_MAX);
+    for (; i + 16 <= length; i += 16) {
+      min = _mm256_min_epi16(
+          min, _mm256_loadu_si256((const __m256i*)&vector[i]));
+    }
+    REDUCE_EPI16(min, _mm_min_epi16);
+    minimum = (int16_t)_mm_cvtsi128_si32(_mm256_castsi256_si128(min));
+  }
+
+  for (; i < length; i++) {
+    if (vector[i] < minimum)
+      minimum = vector[i];
+  }
+  return minimum;
+}
+
+// Minimum value of word32 vector.
+int32_t WebRtcSpl_MinValueW32AVX2(const int32_t* vector, size_t length) {
+  int32_t minimum = WEBRTC_SPL_WORD32_MAX;
+  size_t i = 0;
+
+  RTC_DCHECK_GT(length, 0);
+
+  if (length >= 8) {
+    __m256i min = _mm256_set1_epi32(WEBRTC_SPL_WORD32_MAX);
+    for (; i + 8 <= length; i += 8) {
+      min = _mm256_min_epi32(
+          min, _mm256_loadu_si256((const __m256i*)&vector[i]));
+    }
+    REDUCE_EPI32(min, _mm_min_epi32);
+    minimum = _mm_cvtsi128_si32(_mm256_castsi256_si128(min));
+  }
+
+  for (; i < length; i++) {
+    if (vector[i] < minimum)
+      minimum = vector[i];
+  }
+  return minimum;
+}
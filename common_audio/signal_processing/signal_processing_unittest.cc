@@ -9,9 +9,13 @@
  */
 
 #include <algorithm>
+#include <vector>
 
 #include "common_audio/signal_processing/include/signal_processing_library.h"
+#include "rtc_base/random.h"
 #include "rtc_base/strings/string_builder.h"
+#include "rtc_base/system/arch.h"
+#include "system_wrappers/include/cpu_features_wrapper.h"
 #include "test/gtest.h"
 
 static const size_t kVector16Size = 9;
@@ -544,7 +548,7 @@ TEST(SplTest, CrossCorrelationTest) {
   const int32_t kExpected[kCrossCorrelationDimension] = {-266947903, -15579555,
                                                          -171282001};
   const int32_t* expected = kExpected;
-#if !defined(MIPS32_LE)
+#if defined(WEBRTC_HAS_NEON)
   const int32_t kExpectedNeon[kCrossCorrelationDimension] = {
       -266947901, -15579553, -171281999};
   if (WebRtcSpl_CrossCorrelation != WebRtcSpl_CrossCorrelationC) {
@@ -671,3 +675,74 @@ TEST(SplTest, Resample48WithSaturationTest) {
     EXPECT_EQ(kRefValue16kHz2, out_vector_w16[i]);
   }
 }
+
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+// The AVX2 versions must give exactly the same results as the C versions,
+// since either may be picked at runtime.
+TEST(SplTest, Avx2VersionsAreBitExact) {
+  if (!webrtc::GetCPUInfo(webrtc::kAVX2)) {
+    GTEST_SKIP() << "AVX2 is not supported.";
+  }
+  webrtc::Random random(42);
+  for (int iteration = 0; iteration < 1000; ++iteration) {
+    const size_t length = random.Rand(1, 300);
+    std::vector<int16_t> vector16(length);
+    std::vector<int32_t> vector32(length);
+    // Use the extreme values now and then, to check the saturation.
+    for (size_t i = 0; i < length; ++i) {
+      vector16[i] = random.Rand(0, 20) == 0
+                        ? WEBRTC_SPL_WORD16_MIN
+                        : random.Rand<int16_t>();
+      vector32[i] = random.Rand(0, 20) == 0
+                        ? WEBRTC_SPL_WORD32_MIN
+                        : random.Rand<int32_t>();
+    }
+
+    EXPECT_EQ(WebRtcSpl_MaxAbsValueW16C(vector16.data(), length),
+              WebRtcSpl_MaxAbsValueW16AVX2(vector16.data(), length));
+    EXPECT_EQ(WebRtcSpl_MaxAbsValueW32C(vector32.data(), length),
+              WebRtcSpl_MaxAbsValueW32AVX2(vector32.data(), length));
+    EXPECT_EQ(WebRtcSpl_MaxValueW16C(vector16.data(), length),
+              WebRtcSpl_MaxValueW16AVX2(vector16.data(), length));
+    EXPECT_EQ(WebRtcSpl_MaxValueW32C(vector32.data(), length),
+              WebRtcSpl_MaxValueW32AVX2(vector32.data(), length));
+    EXPECT_EQ(WebRtcSpl_MinValueW16C(vector16.data(), length),
+              WebRtcSpl_MinValueW16AVX2(vector16.data(), length));
+    EXPECT_EQ(WebRtcSpl_MinValueW32C(vector32.data(), length),
+              WebRtcSpl_MinValueW32AVX2(vector32.data(), length));
+
+    // Cross correlation of the first third with the rest of the vector.
+    const size_t dim_seq = length / 3;
+    const size_t dim_cross_correlation = length - 2 * dim_seq + 1;
+    const int right_shifts = random.Rand(0, 8);
+    std::vector<int32_t> expected_correlation(dim_cross_correlation);
+    std::vector<int32_t> correlation(dim_cross_correlation);
+    WebRtcSpl_CrossCorrelationC(expected_correlation.data(), vector16.data(),
+                                vector16.data() + dim_seq, dim_seq,
+                                dim_cross_correlation, right_shifts, 1);
+    WebRtcSpl_CrossCorrelationAVX2(correlation.data(), vector16.data(),
+                                   vector16.data() + dim_seq, dim_seq,
+                                   dim_cross_correlation, right_shifts, 1);
+    EXPECT_EQ(expected_correlation, correlation);
+
+    const int16_t kCoefficients[] = {1200, -2300, 4100, 8000,
+                                     4100, -2300, 1200};
+    const size_t coefficients_length = random.Rand(1, 7);
+    const int factor = random.Rand(2, 4);
+    const size_t delay = coefficients_length - 1;
+    if (length <= delay) {
+      continue;
+    }
+    const size_t out_length = (length - delay - 1) / factor + 1;
+    std::vector<int16_t> expected_out(out_length);
+    std::vector<int16_t> out(out_length);
+    EXPECT_EQ(0, WebRtcSpl_DownsampleFastC(
+                     vector16.data(), length, expected_out.data(), out_length,
+                     kCoefficients, coefficients_length, factor, delay));
+    EXPECT_EQ(0, WebRtcSpl_DownsampleFastAVX2(
+                     vector16.data(), length, out.data(), out_length,
+                     kCoefficients, coefficients_length, factor, delay));
+    EXPECT_EQ(expected_out, out);
+  }
+}
+#endif  // defined(WEBRTC_ARCH_X86_FAMILY)
@@ -11,6 +11,7 @@
 // Some code came from common/rtcd.c in the WebM project.
 
 #include "common_audio/signal_processing/include/signal_processing_library.h"
+#include "rtc_base/system/arch.h"
 
 // TODO(bugs.webrtc.org/9553): These function pointers are useless. Refactor
 // things so that we simply have a bunch of regular functions with different
@@ -53,6 +54,21 @@ const ScaleAndAddVectorsWithRound WebRtcSpl_ScaleAndAddVectorsWithRound =
     WebRtcSpl_ScaleAndAddVectorsWithRoundC;
 #endif
 
+#elif defined(WEBRTC_ARCH_X86_FAMILY)
+
+// The X86 functions select the AVX2 or the C version at runtime.
+const MaxAbsValueW16 WebRtcSpl_MaxAbsValueW16 = WebRtcSpl_MaxAbsValueW16X86;
+const MaxAbsValueW32 WebRtcSpl_MaxAbsValueW32 = WebRtcSpl_MaxAbsValueW32X86;
+const MaxValueW16 WebRtcSpl_MaxValueW16 = WebRtcSpl_MaxValueW16X86;
+const MaxValueW32 WebRtcSpl_MaxValueW32 = WebRtcSpl_MaxValueW32X86;
+const MinValueW16 WebRtcSpl_MinValueW16 = WebRtcSpl_MinValueW16X86;
+const MinValueW32 WebRtcSpl_MinValueW32 = WebRtcSpl_MinValueW32X86;
+const CrossCorrelation WebRtcSpl_CrossCorrelation =
+    WebRtcSpl_CrossCorrelationX86;
+const DownsampleFast WebRtcSpl_DownsampleFast = WebRtcSpl_DownsampleFastX86;
+const ScaleAndAddVectorsWithRound WebRtcSpl_ScaleAndAddVectorsWithRound =
+    WebRtcSpl_ScaleAndAddVectorsWithRoundC;
+
 #else
 
 const MaxAbsValueW16 WebRtcSpl_MaxAbsValueW16 = WebRtcSpl_MaxAbsValueW16C;
@@ -0,0 +1,93 @@
+/*
+ *  Copyright 2025 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+// Runtime selection of the x86 versions of the functions that are called
+// through the function pointers in spl_init.c. CPU detection needs C++, so it
+// is done here rather than in spl_init.c.
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "common_audio/signal_processing/include/signal_processing_library.h"
+#include "system_wrappers/include/cpu_features_wrapper.h"
+
+namespace {
+
+bool HasAvx2() {
+  static const bool has_avx2 = webrtc::GetCPUInfo(webrtc::kAVX2) != 0;
+  return has_avx2;
+}
+
+}  // namespace
+
+int16_t WebRtcSpl_MaxAbsValueW16X86(const int16_t* vector, size_t length) {
+  return HasAvx2() ? WebRtcSpl_MaxAbsValueW16AVX2(vector, length)
+                   : WebRtcSpl_MaxAbsValueW16C(vector, length);
+}
+
+int32_t WebRtcSpl_MaxAbsValueW32X86(const int32_t* vector, size_t length) {
+  return HasAvx2() ? WebRtcSpl_MaxAbsValueW32AVX2(vector, length)
+                   : WebRtcSpl_MaxAbsValueW32C(vector, length);
+}
+
+int16_t WebRtcSpl_MaxValueW16X86(const int16_t* vector, size_t length) {
+  return HasAvx2() ? WebRtcSpl_MaxValueW16AVX2(vector, length)
+                   : WebRtcSpl_MaxValueW16C(vector, length);
+}
+
+int32_t WebRtcSpl_MaxValueW32X86(const int32_t* vector, size_t length) {
+  return HasAvx2() ? WebRtcSpl_MaxValueW32AVX2(vector, length)
+                   : WebRtcSpl_MaxValueW32C(vector, length);
+}
+
+int16_t WebRtcSpl_MinValueW16X86(const int16_t* vector, size_t length) {
+  return HasAvx2() ? WebRtcSpl_MinValueW16AVX2(vector, length)
+                   : WebRtcSpl_MinValueW16C(vector, length);
+}
+
+int32_t WebRtcSpl_MinValueW32X86(const int32_t* vector, size_t length) {
+  return HasAvx2() ? WebRtcSpl_MinValueW32AVX2(vector, length)
+                   : WebRtcSpl_MinValueW32C(vector, length);
+}
+
+void WebRtcSpl_CrossCorrelationX86(int32_t* cross_correlation,
+                                   const int16_t* seq1,
+                                   const int16_t* seq2,
+                                   size_t dim_seq,
+                                   size_t dim_cross_correlation,
+                                   int right_shifts,
+                                   int step_seq2) {
+  if (HasAvx2()) {
+    WebRtcSpl_CrossCorrelationAVX2(cross_correlation, seq1, seq2, dim_seq,
+                                   dim_cross_correlation, right_shifts,
+                                   step_seq2);
+  } else {
+    WebRtcSpl_CrossCorrelationC(cross_correlation, seq1, seq2, dim_seq,
+                                dim_cross_correlation, right_shifts,
+                                step_seq2);
+  }
+}
+
+int WebRtcSpl_DownsampleFastX86(const int16_t* data_in,
+                                size_t data_in_length,
+                                int16_t* data_out,
+                                size_t data_out_length,
+                                const int16_t* __restrict coefficients,
+                                size_t coefficients_length,
+                                int factor,
+                                size_t delay) {
+  return HasAvx2()
+             ? WebRtcSpl_DownsampleFastAVX2(
+                   data_in, data_in_length, data_out, data_out_length,
+                   coefficients, coefficients_length, factor, delay)
+             : WebRtcSpl_DownsampleFastC(data_in, data_in_length, data_out,
+                                         data_out_length, coefficients,
+                                         coefficients_length, factor, delay);
+}
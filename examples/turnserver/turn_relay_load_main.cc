@@ -0,0 +1,379 @@
+/*
+ *  Copyright 2025 The WebRTC Project Authors. All rights reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+// Measures how a ShardedTurnServer scales with its number of threads. For each
+// thread count, it starts a server on the loopback interface, and TURN clients
+// that allocate, bind a channel to a peer socket, and then relay packets at a
+// fixed rate. The peers echo the packets back through the relay. Every packet
+// carries the time it was sent, so the latency of each relayed packet, in both
+// directions, is measured. Prints relayed packets/s and the latency
+// percentiles.
+
+#include <stdio.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "absl/flags/flag.h"
+#include "absl/flags/parse.h"
+#include "absl/strings/string_view.h"
+#include "api/transport/stun.h"
+#include "api/units/time_delta.h"
+#include "p2p/base/port_interface.h"
+#include "p2p/base/sharded_turn_server.h"
+#include "p2p/base/turn_server.h"
+#include "rtc_base/async_packet_socket.h"
+#include "rtc_base/async_udp_socket.h"
+#include "rtc_base/byte_buffer.h"
+#include "rtc_base/byte_order.h"
+#include "rtc_base/checks.h"
+#include "rtc_base/crypto_random.h"
+#include "rtc_base/ip_address.h"
+#include "rtc_base/logging.h"
+#include "rtc_base/network/received_packet.h"
+#include "rtc_base/socket_address.h"
+#include "rtc_base/task_utils/repeating_task.h"
+#include "rtc_base/thread.h"
+#include "rtc_base/time_utils.h"
+
+ABSL_FLAG(int, max_threads, 8, "Largest number of server threads to test");
+ABSL_FLAG(int, clients, 64, "Number of TURN clients");
+ABSL_FLAG(int, client_threads, 4, "Number of threads running the clients");
+ABSL_FLAG(int, rate, 500, "Packets per second each client sends");
+ABSL_FLAG(int, payload_size, 200, "Size of the relayed packets in bytes");
+ABSL_FLAG(int, duration, 5, "Seconds to measure for each thread count");
+
+namespace {
+
+using ::webrtc::TimeDelta;
+
+constexpr char kRealm[] = "load.test";
+constexpr char kUsername[] = "load";
+constexpr char kPassword[] = "load";
+constexpr uint16_t kChannelId = 0x4000;
+constexpr size_t kChannelHeaderSize = 4;
+
+class LoadAuth : public cricket::TurnAuthInterface {
+ public:
+  LoadAuth() {
+    cricket::ComputeStunCredentialHash(kUsername, kRealm, kPassword, &key_);
+  }
+  // Thread-safe, as required by ShardedTurnServer.
+  bool GetKey(absl::string_view username,
+              absl::string_view realm,
+              std::string* key) override {
+    if (username != kUsername) {
+      return false;
+    }
+    *key = key_;
+    return true;
+  }
+
+ private:
+  std::string key_;
+};
+
+// The measurements of the clients on one thread.
+struct Stats {
+  int64_t relayed_packets = 0;
+  std::vector<int64_t> latencies_us;
+};
+
+void WriteTimestamp(uint8_t* payload) {
+  rtc::SetBE64(payload, rtc::TimeMicros());
+}
+
+int64_t ReadLatencyUs(rtc::ArrayView<const uint8_t> payload) {
+  return rtc::TimeMicros() - static_cast<int64_t>(rtc::GetBE64(payload.data()));
+}
+
+// A TURN client and its peer. Runs on the thread it was created on.
+class LoadClient {
+ public:
+  LoadClient(rtc::Thread* thread,
+             const rtc::SocketAddress& server_address,
+             Stats* stats)
+      : server_address_(server_address),
+        stats_(stats),
+        socket_(rtc::AsyncUDPSocket::Create(
+            thread->socketserver(),
+            rtc::SocketAddress(server_address.ipaddr(), 0))),
+        peer_socket_(rtc::AsyncUDPSocket::Create(
+            thread->socketserver(),
+            rtc::SocketAddress(server_address.ipaddr(), 0))) {
+    RTC_CHECK(socket_);
+    RTC_CHECK(peer_socket_);
+    cricket::ComputeStunCredentialHash(kUsername, kRealm, kPassword, &key_);
+    socket_->RegisterReceivedPacketCallback(
+        [this](rtc::AsyncPacketSocket*, const rtc::ReceivedPacket& packet) {
+          OnServerPacket(packet);
+        });
+    peer_socket_->RegisterReceivedPacketCallback(
+        [this](rtc::AsyncPacketSocket*, const rtc::ReceivedPacket& packet) {
+          OnPeerPacket(packet);
+        });
+    packet_.resize(kChannelHeaderSize +
+                   std::max(absl::GetFlag(FLAGS_payload_size), 8));
+    rtc::SetBE16(packet_.data(), kChannelId);
+    rtc::SetBE16(packet_.data() + 2,
+                 static_cast<uint16_t>(packet_.size() - kChannelHeaderSize));
+
+    cricket::TurnMessage request(cricket::STUN_ALLOCATE_REQUEST,
+                                 NewTransactionId());
+    SendStun(request);
+  }
+
+  bool ready() const { return ready_; }
+
+  void SendPacket() {
+    if (!ready_) {
+      return;
+    }
+    WriteTimestamp(packet_.data() + kChannelHeaderSize);
+    rtc::PacketOptions options;
+    socket_->SendTo(packet_.data(), packet_.size(), server_address_, options);
+  }
+
+ private:
+  static std::string NewTransactionId() {
+    return rtc::CreateRandomString(cricket::kStunTransactionIdLength);
+  }
+
+  void SendStun(const cricket::StunMessage& message) {
+    rtc::ByteBufferWriter buf;
+    message.Write(&buf);
+    rtc::PacketOptions options;
+    socket_->SendTo(buf.Data(), buf.Length(), server_address_, options);
+  }
+
+  void AddAuthentication(cricket::TurnMessage& request) {
+    request.AddAttribute(std::make_unique<cricket::StunByteStringAttribute>(
+        cricket::STUN_ATTR_USERNAME, kUsername));
+    request.AddAttribute(std::make_unique<cricket::StunByteStringAttribute>(
+        cricket::STUN_ATTR_REALM, kRealm));
+    request.AddAttribute(std::make_unique<cricket::StunByteStringAttribute>(
+        cricket::STUN_ATTR_NONCE, nonce_));
+    request.AddMessageIntegrity(key_);
+  }
+
+  void OnServerPacket(const rtc::ReceivedPacket& packet) {
+    rtc::ArrayView<const uint8_t> data = packet.payload();
+    if (data.size() >= kChannelHeaderSize &&
+        (rtc::GetBE16(data.data()) & 0xC000) == 0x4000) {
+      // ChannelData echoed by the peer.
+      if (data.size() >= kChannelHeaderSize + 8) {
+        ++stats_->relayed_packets;
+        stats_->latencies_us.push_back(
+            ReadLatencyUs(data.subview(kChannelHeaderSize)));
+      }
+      return;
+    }
+
+    cricket::TurnMessage response;
+    rtc::ByteBufferReader reader(data);
+    if (!response.Read(&reader)) {
+      return;
+    }
+    if (response.type() == cricket::STUN_ALLOCATE_ERROR_RESPONSE) {
+      const cricket::StunByteStringAttribute* nonce =
+          response.GetByteString(cricket::STUN_ATTR_NONCE);
+      RTC_CHECK(nonce) << "Allocation failed, error="
+                       << response.GetErrorCodeValue();
+      nonce_ = std::string(nonce->string_view());
+      cricket::TurnMessage request(cricket::STUN_ALLOCATE_REQUEST,
+                                   NewTransactionId());
+      request.AddAttribute(std::make_unique<cricket::StunUInt32Attribute>(
+          cricket::STUN_ATTR_REQUESTED_TRANSPORT, IPPROTO_UDP << 24));
+      AddAuthentication(request);
+      SendStun(request);
+    } else if (response.type() == cricket::STUN_ALLOCATE_RESPONSE) {
+      const cricket::StunAddressAttribute* relayed_address =
+          response.GetAddress(cricket::STUN_ATTR_XOR_RELAYED_ADDRESS);
+      RTC_CHECK(relayed_address);
+      relayed_address_ = relayed_address->GetAddress();
+      cricket::TurnMessage request(cricket::TURN_CHANNEL_BIND_REQUEST,
+                                   NewTransactionId());
+      request.AddAttribute(std::make_unique<cricket::StunUInt32Attribute>(
+          cricket::STUN_ATTR_CHANNEL_NUMBER, kChannelId << 16));
+      request.AddAttribute(std::make_unique<cricket::StunXorAddressAttribute>(
+          cricket::STUN_ATTR_XOR_PEER_ADDRESS,
+          peer_socket_->GetLocalAddress()));
+      AddAuthentication(request);
+      SendStun(request);
+    } else if (response.type() == cricket::TURN_CHANNEL_BIND_RESPONSE) {
+      ready_ = true;
+    } else {
+      RTC_LOG(LS_WARNING) << "Unexpected TURN response, type="
+                          << response.type()
+                          << ", error=" << response.GetErrorCodeValue();
+    }
+  }
+
+  void OnPeerPacket(const rtc::ReceivedPacket& packet) {
+    rtc::ArrayView<const uint8_t> data = packet.payload();
+    if (data.size() < 8) {
+      return;
+    }
+    ++stats_->relayed_packets;
+    stats_->latencies_us.push_back(ReadLatencyUs(data));
+    // Echo the packet back through the relay, which forwards it to the client
+    // as ChannelData.
+    peer_packet_.assign(data.begin(), data.end());
+    WriteTimestamp(peer_packet_.data());
+    rtc::PacketOptions options;
+    peer_socket_->SendTo(peer_packet_.data(), peer_packet_.size(),
+                         relayed_address_, options);
+  }
+
+  const rtc::SocketAddress server_address_;
+  Stats* const stats_;
+  std::unique_ptr<rtc::AsyncUDPSocket> socket_;
+  std::unique_ptr<rtc::AsyncUDPSocket> peer_socket_;
+  std::string key_;
+  std::string nonce_;
+  rtc::SocketAddress relayed_address_;
+  bool ready_ = false;
+  std::vector<uint8_t> packet_;
+  std::vector<uint8_t> peer_packet_;
+};
+
+// The clients of one client thread, sending at the configured rate.
+struct ClientThread {
+  std::unique_ptr<rtc::Thread> thread;
+  std::vector<std::unique_ptr<LoadClient>> clients;
+  Stats stats;
+  webrtc::RepeatingTaskHandle sender;
+  double packets_due = 0.0;
+};
+
+void RunWithThreads(int num_threads, LoadAuth* auth) {
+  cricket::ShardedTurnServer::Config config;
+  config.num_shards = num_threads;
+  config.internal_address =
+      rtc::SocketAddress(rtc::IPAddress(INADDR_LOOPBACK), 0);
+  config.external_ip = rtc::IPAddress(INADDR_LOOPBACK);
+  config.realm = kRealm;
+  config.auth_hook = auth;
+  cricket::ShardedTurnServer server(config);
+  RTC_CHECK(server.Start()) << "Failed to start the TURN server";
+
+  const int num_clients = absl::GetFlag(FLAGS_clients);
+  const int num_client_threads = absl::GetFlag(FLAGS_client_threads);
+  std::vector<ClientThread> client_threads(num_client_threads);
+  for (int i = 0; i < num_client_threads; ++i) {
+    ClientThread& client_thread = client_threads[i];
+    client_thread.thread = rtc::Thread::CreateWithSocketServer();
+    client_thread.thread->Start();
+    client_thread.thread->BlockingCall([&] {
+      for (int j = i; j < num_clients; j += num_client_threads) {
+        client_thread.clients.push_back(std::make_unique<LoadClient>(
+            client_thread.thread.get(), server.internal_address(),
+            &client_thread.stats));
+      }
+    });
+  }
+
+  // Wait for the allocations and channel bindings.
+  for (ClientThread& client_thread : client_threads) {
+    while (!client_thread.thread->BlockingCall([&] {
+      return std::all_of(
+          client_thread.clients.begin(), client_thread.clients.end(),
+          [](const std::unique_ptr<LoadClient>& c) { return c->ready(); });
+    })) {
+      rtc::Thread::SleepMs(10);
+    }
+  }
+
+  // Send every millisecond, at the configured rate per client.
+  const double packets_per_tick = absl::GetFlag(FLAGS_rate) / 1000.0;
+  for (ClientThread& client_thread : client_threads) {
+    client_thread.thread->BlockingCall([&] {
+      client_thread.sender = webrtc::RepeatingTaskHandle::Start(
+          client_thread.thread.get(),
+          [&client_thread, packets_per_tick] {
+            client_thread.packets_due += packets_per_tick;
+            for (; client_thread.packets_due >= 1.0;
+                 client_thread.packets_due -= 1.0) {
+              for (auto& client : client_thread.clients) {
+                client->SendPacket();
+              }
+            }
+            return TimeDelta::Millis(1);
+          },
+          webrtc::TaskQueueBase::DelayPrecision::kHigh);
+    });
+  }
+
+  // Warm up, then measure.
+  rtc::Thread::SleepMs(500);
+  for (ClientThread& client_thread : client_threads) {
+    client_thread.thread->BlockingCall([&] { client_thread.stats = Stats(); });
+  }
+  const int64_t start_us = rtc::TimeMicros();
+  rtc::Thread::SleepMs(absl::GetFlag(FLAGS_duration) * 1000);
+
+  Stats total;
+  for (ClientThread& client_thread : client_threads) {
+    client_thread.thread->BlockingCall([&] {
+      total.relayed_packets += client_thread.stats.relayed_packets;
+      total.latencies_us.insert(total.latencies_us.end(),
+                                client_thread.stats.latencies_us.begin(),
+                                client_thread.stats.latencies_us.end());
+    });
+  }
+  const double elapsed_s = (rtc::TimeMicros() - start_us) / 1e6;
+
+  for (ClientThread& client_thread : client_threads) {
+    client_thread.thread->BlockingCall([&] {
+      client_thread.sender.Stop();
+      client_thread.clients.clear();
+    });
+    client_thread.thread->Stop();
+  }
+  server.Stop();
+
+  auto percentile_ms = [&](double p) {
+    if (total.latencies_us.empty()) {
+      return 0.0;
+    }
+    size_t index = static_cast<size_t>(p * (total.latencies_us.size() - 1));
+    std::nth_element(total.latencies_us.begin(),
+                     total.latencies_us.begin() + index,
+                     total.latencies_us.end());
+    return total.latencies_us[index] / 1000.0;
+  };
+  const double p50_ms = percentile_ms(0.5);
+  const double p99_ms = percentile_ms(0.99);
+  printf("%7d %16.0f %10.3f %10.3f\n", num_threads,
+         total.relayed_packets / elapsed_s, p50_ms, p99_ms);
+  fflush(stdout);
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  absl::ParseCommandLine(argc, argv);
+
+  LoadAuth auth;
+  printf("%d clients sending %d packets/s of %d bytes each\n",
+         absl::GetFlag(FLAGS_clients), absl::GetFlag(FLAGS_rate),
+         absl::GetFlag(FLAGS_payload_size));
+  printf("%7s %16s %10s %10s\n", "threads", "relayed pkts/s", "p50 ms",
+         "p99 ms");
+  for (int threads = 1; threads <= absl::GetFlag(FLAGS_max_threads);
+       threads *= 2) {
+    RunWithThreads(threads, &auth);
+  }
+  return 0;
+}
@@ -8,6 +8,7 @@
  *  be found in the AUTHORS file in the root of the source tree.
  */
 
+#include <cstdlib>
 #include <fstream>
 #include <iostream>
 #include <map>
@@ -18,6 +19,7 @@
 #include "examples/turnserver/read_auth_file.h"
 #include "p2p/base/basic_packet_socket_factory.h"
 #include "p2p/base/port_interface.h"
+#include "p2p/base/sharded_turn_server.h"
 #include "p2p/base/turn_server.h"
 #include "rtc_base/async_udp_socket.h"
 #include "rtc_base/ip_address.h"
@@ -52,8 +54,8 @@ class TurnFileAuth : public cricket::TurnAuthInterface {
 }  // namespace
 
 int main(int argc, char* argv[]) {
-  if (argc != 5) {
-    std::cerr << "usage: turnserver int-addr ext-ip realm auth-file"
+  if (argc != 5 && argc != 6) {
+    std::cerr << "usage: turnserver int-addr ext-ip realm auth-file [threads]"
               << std::endl;
     return 1;
   }
@@ -70,8 +72,42 @@ int main(int argc, char* argv[]) {
     return 1;
   }
 
+  // With more than one thread, UDP allocations are sharded over that many
+  // network threads.
+  const int num_threads = argc == 6 ? std::atoi(argv[5]) : 1;
+  if (num_threads < 1) {
+    std::cerr << "Invalid number of threads: " << argv[5] << std::endl;
+    return 1;
+  }
+
+  std::fstream auth_file(argv[4], std::fstream::in);
+  TurnFileAuth auth(auth_file.is_open()
+                        ? webrtc_examples::ReadAuthFile(&auth_file)
+                        : std::map<std::string, std::string>());
+
   rtc::PhysicalSocketServer socket_server;
   rtc::AutoSocketServerThread main(&socket_server);
+  if (num_threads > 1) {
+    cricket::ShardedTurnServer::Config config;
+    config.num_shards = num_threads;
+    config.internal_address = int_addr;
+    config.external_ip = ext_addr;
+    config.realm = argv[3];
+    config.software = kSoftware;
+    config.auth_hook = &auth;
+    cricket::ShardedTurnServer server(config);
+    if (!server.Start()) {
+      std::cerr << "Failed to start " << num_threads
+                << " TURN threads bound at " << int_addr.ToString()
+                << std::endl;
+      return 1;
+    }
+    std::cout << "Listening internally at " << int_addr.ToString() << " on "
+              << num_threads << " threads" << std::endl;
+    main.Run();
+    return 0;
+  }
+
   rtc::AsyncUDPSocket* int_socket =
       rtc::AsyncUDPSocket::Create(&socket_server, int_addr);
   if (!int_socket) {
@@ -81,11 +117,6 @@ int main(int argc, char* argv[]) {
   }
 
   cricket::TurnServer server(&main);
-  std::fstream auth_file(argv[4], std::fstream::in);
-
-  TurnFileAuth auth(auth_file.is_open()
-                        ? webrtc_examples::ReadAuthFile(&auth_file)
-                        : std::map<std::string, std::string>());
   server.set_realm(argv[3]);
   server.set_software(kSoftware);
   server.set_auth_hook(&auth);
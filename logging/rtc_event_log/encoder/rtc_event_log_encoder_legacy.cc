@@ -425,6 +425,8 @@ std::string RtcEventLogEncoderLegacy::EncodeAudioNetworkAdaptation(
     audio_network_adaptation->set_enable_dtx(*event.config().enable_dtx);
   if (event.config().num_channels)
     audio_network_adaptation->set_num_channels(*event.config().num_channels);
+  if (event.config().complexity)
+    audio_network_adaptation->set_complexity(*event.config().complexity);
 
   return Serialize(&rtclog_event);
 }
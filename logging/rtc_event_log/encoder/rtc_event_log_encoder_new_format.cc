@@ -1014,6 +1014,8 @@ void RtcEventLogEncoderNewFormat::EncodeAudioNetworkAdaptation(
   // no bits will be spared.
   if (base_event->config().num_channels.has_value())
     proto_batch->set_num_channels(base_event->config().num_channels.value());
+  if (base_event->config().complexity.has_value())
+    proto_batch->set_complexity(base_event->config().complexity.value());
 
   if (batch.size() == 1)
     return;
@@ -1131,6 +1133,25 @@ void RtcEventLogEncoderNewFormat::EncodeAudioNetworkAdaptation(
   if (!encoded_deltas.empty()) {
     proto_batch->set_num_channels_deltas(encoded_deltas);
   }
+
+  // complexity
+  for (size_t i = 0; i < values.size(); ++i) {
+    const RtcEventAudioNetworkAdaptation* event = batch[i + 1];
+    const std::optional<int> complexity = event->config().complexity;
+    if (complexity.has_value()) {
+      RTC_DCHECK_GE(complexity.value(), 0);
+      values[i] = complexity.value();
+    } else {
+      values[i].reset();
+    }
+  }
+  std::optional<uint64_t> base_complexity;
+  if (base_event->config().complexity.has_value())
+    base_complexity = base_event->config().complexity.value();
+  encoded_deltas = EncodeDeltas(base_complexity, values);
+  if (!encoded_deltas.empty()) {
+    proto_batch->set_complexity_deltas(encoded_deltas);
+  }
 }
 
 void RtcEventLogEncoderNewFormat::EncodeAudioPlayout(
@@ -26,6 +26,7 @@
 #include "api/field_trials_view.h"
 #include "api/rtc_event_log/rtc_event.h"
 #include "api/rtc_event_log/rtc_event_log.h"
+#include "api/transport/bandwidth_usage.h"
 #include "api/units/time_delta.h"
 #include "api/units/timestamp.h"
 #include "logging/rtc_event_log/encoder/rtc_event_log_encoder_legacy.h"
@@ -51,6 +52,7 @@
 #include "logging/rtc_event_log/events/rtc_event_video_send_stream_config.h"
 #include "logging/rtc_event_log/rtc_event_log_parser.h"
 #include "logging/rtc_event_log/rtc_event_log_unittest_helper.h"
+#include "logging/rtc_event_log/rtc_stream_config.h"
 #include "modules/audio_coding/audio_network_adaptor/include/audio_network_adaptor_config.h"
 #include "modules/rtp_rtcp/include/rtp_header_extension_map.h"
 #include "modules/rtp_rtcp/include/rtp_rtcp_defines.h"
@@ -1503,4 +1505,42 @@ INSTANTIATE_TEST_SUITE_P(
     ::testing::Values(RtcEventLog::EncodingType::Legacy,
                       RtcEventLog::EncodingType::NewFormat));
 
+class RtcEventLogEncoderEventTypesTest : public RtcEventLogEncoderSimpleTest {};
+
+TEST_P(RtcEventLogEncoderEventTypesTest, ParsesOnlySelectedEventTypes) {
+  constexpr uint32_t kSsrc = 1234;
+  auto config = std::make_unique<rtclog::StreamConfig>();
+  config->remote_ssrc = kSsrc;
+  history_.push_back(
+      std::make_unique<RtcEventAudioReceiveStreamConfig>(std::move(config)));
+  for (int i = 0; i < 3; ++i) {
+    history_.push_back(std::make_unique<RtcEventAudioPlayout>(kSsrc));
+    history_.push_back(std::make_unique<RtcEventBweUpdateDelayBased>(
+        100000 + i, BandwidthUsage::kBwNormal));
+    history_.push_back(
+        std::make_unique<RtcEventBweUpdateLossBased>(200000 + i, 0, 100));
+  }
+  encoded_ += encoder_->EncodeBatch(history_.begin(), history_.end());
+  encoded_ += encoder_->EncodeLogEnd(rtc::TimeMillis());
+
+  parsed_log_.SetEventTypesToParse({RtcEvent::Type::BweUpdateDelayBased});
+  ParsedRtcEventLog::ParseStatus status = parsed_log_.ParseString(encoded_);
+  ASSERT_TRUE(status.ok()) << status.message();
+
+  EXPECT_EQ(parsed_log_.bwe_delay_updates().size(), 3u);
+  EXPECT_TRUE(parsed_log_.bwe_loss_updates().empty());
+  EXPECT_TRUE(parsed_log_.audio_playout_events().empty());
+  // Configs and start and stop events are parsed regardless of the filter.
+  EXPECT_EQ(parsed_log_.audio_recv_configs().size(), 1u);
+  EXPECT_EQ(parsed_log_.start_log_events().size(), 1u);
+  EXPECT_EQ(parsed_log_.stop_log_events().size(), 1u);
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    AllFormats,
+    RtcEventLogEncoderEventTypesTest,
+    ::testing::Values(RtcEventLog::EncodingType::Legacy,
+                      RtcEventLog::EncodingType::NewFormat,
+                      RtcEventLog::EncodingType::ProtoFree));
+
 }  // namespace webrtc
@@ -10,6 +10,7 @@
 
 #include "logging/rtc_event_log/rtc_event_log_impl.h"
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
 #include <functional>
@@ -58,14 +59,18 @@ RtcEventLogImpl::RtcEventLogImpl(const Environment& env)
 RtcEventLogImpl::RtcEventLogImpl(std::unique_ptr<RtcEventLogEncoder> encoder,
                                  TaskQueueFactory* task_queue_factory,
                                  size_t max_events_in_history,
-                                 size_t max_config_events_in_history)
+                                 size_t max_config_events_in_history,
+                                 size_t max_events_in_memory)
     : max_events_in_history_(max_events_in_history),
       max_config_events_in_history_(max_config_events_in_history),
+      max_events_in_memory_(max_events_in_memory),
       event_encoder_(std::move(encoder)),
       last_output_ms_(rtc::TimeMillis()),
       task_queue_(task_queue_factory->CreateTaskQueue(
           "rtc_event_log",
-          TaskQueueFactory::Priority::NORMAL)) {}
+          TaskQueueFactory::Priority::NORMAL)) {
+  RTC_DCHECK_GE(max_events_in_memory_, max_events_in_history_);
+}
 
 RtcEventLogImpl::~RtcEventLogImpl() {
   // If we're logging to the output, this will stop that. Blocking function.
@@ -164,6 +169,8 @@ void RtcEventLogImpl::StopLogging(std::function<void()> callback) {
         if (event_output_) {
           RTC_DCHECK(event_output_->IsActive());
           LogEventsToOutput(std::move(histories));
+        } else {
+          ReleasePendingEvents(histories.history.size());
         }
         StopLoggingInternal();
         callback();
@@ -173,6 +180,7 @@ void RtcEventLogImpl::StopLogging(std::function<void()> callback) {
 RtcEventLogImpl::EventHistories RtcEventLogImpl::ExtractRecentHistories() {
   EventHistories histories;
   std::swap(histories, recent_);
+  num_pending_events_ += histories.history.size();
   return histories;
 }
 
@@ -180,6 +188,14 @@ void RtcEventLogImpl::Log(std::unique_ptr<RtcEvent> event) {
   RTC_CHECK(event);
   MutexLock lock(&mutex_);
 
+  if (logging_state_started_ && !event->IsConfigEvent() &&
+      recent_.history.size() + num_pending_events_ >= max_events_in_memory_) {
+    // The output is not keeping up. Config events are always kept since they
+    // are needed to interpret the other events.
+    ++num_dropped_events_;
+    return;
+  }
+
   LogToMemory(std::move(event));
   if (logging_state_started_) {
     if (ShouldOutputImmediately()) {
@@ -190,6 +206,8 @@ void RtcEventLogImpl::Log(std::unique_ptr<RtcEvent> event) {
             if (event_output_) {
               RTC_DCHECK(event_output_->IsActive());
               LogEventsToOutput(std::move(histories));
+            } else {
+              ReleasePendingEvents(histories.history.size());
             }
           });
     } else if (need_schedule_output_) {
@@ -258,6 +276,17 @@ void RtcEventLogImpl::LogToMemory(std::unique_ptr<RtcEvent> event) {
 void RtcEventLogImpl::LogEventsToOutput(EventHistories histories) {
   last_output_ms_ = rtc::TimeMillis();
 
+  {
+    MutexLock lock(&mutex_);
+    if (num_dropped_events_ > 0) {
+      RTC_LOG(LS_WARNING) << "Dropped " << num_dropped_events_
+                          << " events since the last output, exceeding the "
+                             "maximum of "
+                          << max_events_in_memory_ << " events in memory.";
+      num_dropped_events_ = 0;
+    }
+  }
+
   // Serialize the stream configurations.
   std::string encoded_configs = event_encoder_->EncodeBatch(
       histories.config_history.begin(), histories.config_history.end());
@@ -269,10 +298,21 @@ void RtcEventLogImpl::LogEventsToOutput(EventHistories histories) {
   // log is started immediately after the first one becomes full, then one
   // cannot rely on the second log to contain everything that isn't in the first
   // log; one batch of events might be missing.
-  std::string encoded_history = event_encoder_->EncodeBatch(
-      histories.history.begin(), histories.history.end());
-
-  WriteConfigsAndHistoryToOutput(encoded_configs, encoded_history);
+  // The events are encoded and written in parts of at most
+  // `kMaxEventsPerEncodedBatch` events, and freed once written. Each part is a
+  // sequence of complete messages, so the parser reads them like one batch.
+  EventDeque& history = histories.history;
+  const size_t num_events = history.size();
+  do {
+    const size_t batch_size =
+        std::min(history.size(), kMaxEventsPerEncodedBatch);
+    std::string encoded_history = event_encoder_->EncodeBatch(
+        history.begin(), history.begin() + batch_size);
+    WriteConfigsAndHistoryToOutput(encoded_configs, encoded_history);
+    encoded_configs.clear();
+    history.erase(history.begin(), history.begin() + batch_size);
+  } while (!history.empty() && event_output_);
+  ReleasePendingEvents(num_events);
 
   // Unlike other events, the configs are retained. If we stop/start logging
   // again, these configs are used to interpret other events.
@@ -291,6 +331,12 @@ void RtcEventLogImpl::LogEventsToOutput(EventHistories histories) {
   }
 }
 
+void RtcEventLogImpl::ReleasePendingEvents(size_t num_events) {
+  MutexLock lock(&mutex_);
+  RTC_DCHECK_GE(num_pending_events_, num_events);
+  num_pending_events_ -= num_events;
+}
+
 void RtcEventLogImpl::WriteConfigsAndHistoryToOutput(
     absl::string_view encoded_configs,
     absl::string_view encoded_history) {
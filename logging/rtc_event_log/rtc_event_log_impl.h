@@ -40,13 +40,23 @@ class RtcEventLogImpl final : public RtcEventLog {
   // The config-history is supposed to be unbounded, but needs to have some
   // bound to prevent an attack via unreasonable memory use.
   static constexpr size_t kMaxEventsInConfigHistory = 1000;
+  // The max number of non-config events that are held in memory while logging,
+  // including events that are waiting to be encoded on the task queue. Events
+  // logged beyond this are dropped and counted, so that an output that cannot
+  // keep up does not make memory grow without bound.
+  static constexpr size_t kMaxEventsInMemory = 5 * kMaxEventsInHistory;
+  // The max number of events encoded into one string. Larger histories are
+  // encoded and written in several parts, which bounds the size of the
+  // temporary encoding buffers.
+  static constexpr size_t kMaxEventsPerEncodedBatch = 1000;
 
   explicit RtcEventLogImpl(const Environment& env);
   RtcEventLogImpl(
       std::unique_ptr<RtcEventLogEncoder> encoder,
       TaskQueueFactory* task_queue_factory,
       size_t max_events_in_history = kMaxEventsInHistory,
-      size_t max_config_events_in_history = kMaxEventsInConfigHistory);
+      size_t max_config_events_in_history = kMaxEventsInConfigHistory,
+      size_t max_events_in_memory = kMaxEventsInMemory);
   RtcEventLogImpl(const RtcEventLogImpl&) = delete;
   RtcEventLogImpl& operator=(const RtcEventLogImpl&) = delete;
 
@@ -76,6 +86,9 @@ class RtcEventLogImpl final : public RtcEventLog {
   void LogToMemory(std::unique_ptr<RtcEvent> event)
       RTC_EXCLUSIVE_LOCKS_REQUIRED(mutex_);
   void LogEventsToOutput(EventHistories histories) RTC_RUN_ON(task_queue_);
+  // Called when `num_events` extracted by ExtractRecentHistories() have been
+  // written or discarded.
+  void ReleasePendingEvents(size_t num_events) RTC_LOCKS_EXCLUDED(mutex_);
 
   void StopOutput() RTC_RUN_ON(task_queue_);
 
@@ -95,6 +108,10 @@ class RtcEventLogImpl final : public RtcEventLog {
   // Max size of config event history.
   const size_t max_config_events_in_history_;
 
+  // Max number of non-config events in `recent_` and in tasks on the
+  // `task_queue_` while logging.
+  const size_t max_events_in_memory_;
+
   // History containing all past configuration events.
   EventDeque all_config_history_ RTC_GUARDED_BY(task_queue_);
 
@@ -113,6 +130,10 @@ class RtcEventLogImpl final : public RtcEventLog {
   bool logging_state_started_ RTC_GUARDED_BY(mutex_) = false;
   bool immediately_output_mode_ RTC_GUARDED_BY(mutex_) = false;
   bool need_schedule_output_ RTC_GUARDED_BY(mutex_) = false;
+  // Non-config events extracted from `recent_` that have not been written yet.
+  size_t num_pending_events_ RTC_GUARDED_BY(mutex_) = 0;
+  // Events dropped because of `max_events_in_memory_` since the last output.
+  size_t num_dropped_events_ RTC_GUARDED_BY(mutex_) = 0;
 
   std::unique_ptr<TaskQueueBase, TaskQueueDeleter> task_queue_;
 
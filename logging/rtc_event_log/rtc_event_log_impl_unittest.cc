@@ -270,6 +270,39 @@ TEST_F(RtcEventLogImplTest, DoNotDropEventsIfHistoryFullAfterStarted) {
   Mock::VerifyAndClearExpectations(encoder_ptr_);
 }
 
+TEST_F(RtcEventLogImplTest, DropsEventsBeyondMemoryLimitAfterStarted) {
+  constexpr size_t kMaxEventsInMemory = 2 * kMaxEventsInHistory;
+  constexpr size_t kNumberOfEvents = 10 * kMaxEventsInHistory;
+  auto encoder = std::make_unique<MockEventEncoder>();
+  MockEventEncoder* encoder_ptr = encoder.get();
+  std::string written_data;
+  RtcEventLogImpl event_log(std::move(encoder),
+                            time_controller_.GetTaskQueueFactory(),
+                            kMaxEventsInHistory, kMaxEventsInConfigHistory,
+                            kMaxEventsInMemory);
+
+  event_log.StartLogging(std::make_unique<FakeOutput>(written_data),
+                         kOutputPeriod.ms());
+  event_log.Log(std::make_unique<FakeConfigEvent>());
+  for (size_t i = 0; i < kNumberOfEvents; i++) {
+    event_log.Log(std::make_unique<FakeEvent>());
+  }
+  // Config events are never dropped.
+  EXPECT_CALL(*encoder_ptr, OnEncode(Property(&RtcEvent::IsConfigEvent, true)));
+  EXPECT_CALL(*encoder_ptr,
+              OnEncode(Property(&RtcEvent::IsConfigEvent, false)))
+      .Times(kMaxEventsInMemory);
+  time_controller_.AdvanceTime(kOutputPeriod);
+  Mock::VerifyAndClearExpectations(encoder_ptr);
+
+  // Once written, new events are accepted again.
+  event_log.Log(std::make_unique<FakeEvent>());
+  EXPECT_CALL(*encoder_ptr,
+              OnEncode(Property(&RtcEvent::IsConfigEvent, false)));
+  time_controller_.AdvanceTime(kOutputPeriod);
+  Mock::VerifyAndClearExpectations(encoder_ptr);
+}
+
 TEST_F(RtcEventLogImplTest, StopOutputOnWriteFailure) {
   constexpr size_t kNumberOfEvents = 10;
   constexpr size_t kFailsWriteOnEventsCount = 5;
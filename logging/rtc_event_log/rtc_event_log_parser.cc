@@ -106,6 +106,8 @@ namespace webrtc {
 
 namespace {
 constexpr size_t kMaxLogSize = 250000000;
+// Files are read in parts of this size.
+constexpr size_t kFileReadChunkSize = 64 * 1024;
 
 constexpr size_t kIpv4Overhead = 20;
 constexpr size_t kIpv6Overhead = 40;
@@ -118,6 +120,53 @@ constexpr uint16_t kDefaultOverhead =
 constexpr char kIncompleteLogError[] =
     "Could not parse the entire log. Only the beginning will be used.";
 
+// Returns the value of the type field of the encoded rtclog::Event `event`,
+// skipping over the other fields without decoding them.
+std::optional<uint64_t> PeekLegacyEventType(absl::string_view event) {
+  while (!event.empty()) {
+    bool success = false;
+    uint64_t tag = 0;
+    std::tie(success, event) = DecodeVarInt(event, &tag);
+    if (!success) {
+      return std::nullopt;
+    }
+    uint64_t value = 0;
+    switch (tag & 0x07) {
+      case 0:  // Varint.
+        std::tie(success, event) = DecodeVarInt(event, &value);
+        if (!success) {
+          return std::nullopt;
+        }
+        if (tag >> 3 == rtclog::Event::kTypeFieldNumber) {
+          return value;
+        }
+        break;
+      case 1:  // 64 bit.
+        if (event.size() < 8) {
+          return std::nullopt;
+        }
+        event.remove_prefix(8);
+        break;
+      case 2:  // Length delimited.
+        std::tie(success, event) = DecodeVarInt(event, &value);
+        if (!success || value > event.size()) {
+          return std::nullopt;
+        }
+        event.remove_prefix(value);
+        break;
+      case 5:  // 32 bit.
+        if (event.size() < 4) {
+          return std::nullopt;
+        }
+        event.remove_prefix(4);
+        break;
+      default:
+        return std::nullopt;
+    }
+  }
+  return std::nullopt;
+}
+
 struct MediaStreamInfo {
   MediaStreamInfo() = default;
   MediaStreamInfo(LoggedMediaType media_type, bool rtx)
@@ -1239,15 +1288,62 @@ ParsedRtcEventLog::ParseStatus ParsedRtcEventLog::ParseFile(
   RTC_PARSE_CHECK_OR_RETURN_GE(*file_size, 0u);
   RTC_PARSE_CHECK_OR_RETURN_LE(*file_size, kMaxLogSize);
 
-  // Read file into memory.
-  std::string buffer(*file_size, '\0');
+  // Read the first part, which tells whether the log can be parsed in parts.
+  std::string buffer(std::min(*file_size, kFileReadChunkSize), '\0');
   size_t bytes_read = file.Read(&buffer[0], buffer.size());
-  if (bytes_read != *file_size) {
+  if (bytes_read != buffer.size()) {
     RTC_LOG(LS_WARNING) << "Failed to read file " << filename;
-    RTC_PARSE_CHECK_OR_RETURN_EQ(bytes_read, *file_size);
+    RTC_PARSE_CHECK_OR_RETURN_EQ(bytes_read, buffer.size());
   }
-
-  return ParseStream(buffer);
+  size_t total_bytes_read = bytes_read;
+  uint64_t tag = 0;
+  bool is_v3_log =
+      DecodeVarInt(buffer, &tag).first &&
+      tag >> 1 == static_cast<uint64_t>(RtcEvent::Type::BeginV3Log);
+  if (*file_size <= buffer.size() || is_v3_log) {
+    // Small logs, and logs in the v3 format, are parsed in one go.
+    buffer.resize(*file_size);
+    bytes_read = file.Read(&buffer[total_bytes_read],
+                           buffer.size() - total_bytes_read);
+    if (total_bytes_read + bytes_read != *file_size) {
+      RTC_LOG(LS_WARNING) << "Failed to read file " << filename;
+      RTC_PARSE_CHECK_OR_RETURN_EQ(total_bytes_read + bytes_read, *file_size);
+    }
+    return ParseStream(buffer);
+  }
+
+  // Parse the complete events of each part and keep the bytes of an event
+  // that continues in the next part.
+  Clear();
+  ParseStatus status = ParseStatus::Success();
+  while (status.ok()) {
+    const bool is_last_part = total_bytes_read == *file_size;
+    constexpr size_t kNotParsed = std::numeric_limits<size_t>::max();
+    size_t bytes_parsed = kNotParsed;
+    status =
+        ParseStreamInternal(buffer, is_last_part ? nullptr : &bytes_parsed);
+    if (is_last_part || !status.ok()) {
+      break;
+    }
+    if (bytes_parsed == kNotParsed) {
+      // Parsing stopped at a corrupt event that `allow_incomplete_logs_`
+      // tolerates. The rest of the file is dropped like in ParseStream().
+      break;
+    }
+    buffer.erase(0, bytes_parsed);
+    const size_t old_size = buffer.size();
+    const size_t part_size =
+        std::min(*file_size - total_bytes_read, kFileReadChunkSize);
+    buffer.resize(old_size + part_size);
+    bytes_read = file.Read(&buffer[old_size], part_size);
+    if (bytes_read != part_size) {
+      RTC_LOG(LS_WARNING) << "Failed to read file " << filename;
+      RTC_PARSE_CHECK_OR_RETURN_EQ(bytes_read, part_size);
+    }
+    total_bytes_read += bytes_read;
+  }
+  FinishParsing();
+  return status;
 }
 
 ParsedRtcEventLog::ParseStatus ParsedRtcEventLog::ParseString(
@@ -1259,7 +1355,11 @@ ParsedRtcEventLog::ParseStatus ParsedRtcEventLog::ParseStream(
     absl::string_view s) {
   Clear();
   ParseStatus status = ParseStreamInternal(s);
+  FinishParsing();
+  return status;
+}
 
+void ParsedRtcEventLog::FinishParsing() {
   // Cache the configured SSRCs.
   for (const auto& video_recv_config : video_recv_configs()) {
     incoming_video_ssrcs_.insert(video_recv_config.config.remote_ssrc);
@@ -1406,12 +1506,11 @@ ParsedRtcEventLog::ParseStatus ParsedRtcEventLog::ParseStream(
   if (first_timestamp_ > last_timestamp_) {
     first_timestamp_ = last_timestamp_ = Timestamp::Zero();
   }
-
-  return status;
 }
 
 ParsedRtcEventLog::ParseStatus ParsedRtcEventLog::ParseStreamInternal(
-    absl::string_view s) {
+    absl::string_view s,
+    size_t* bytes_parsed) {
   constexpr uint64_t kMaxEventSize = 10000000;  // Sanity check.
   // Protobuf defines the message tag as
   // (field_number << 3) | wire_type. In the legacy encoding, the field number
@@ -1425,6 +1524,11 @@ ParsedRtcEventLog::ParseStatus ParsedRtcEventLog::ParseStreamInternal(
   absl::string_view event_start = s;
   uint64_t tag = 0;
   std::tie(success, std::ignore) = DecodeVarInt(s, &tag);
+  if (!success && bytes_parsed != nullptr) {
+    // The first event continues in the next part.
+    *bytes_parsed = 0;
+    return ParseStatus::Success();
+  }
   if (!success) {
     RTC_LOG(LS_WARNING) << "Failed to read varint from beginning of event log.";
     RTC_PARSE_WARN_AND_RETURN_SUCCESS_IF(allow_incomplete_logs_,
@@ -1435,13 +1539,20 @@ ParsedRtcEventLog::ParseStatus ParsedRtcEventLog::ParseStreamInternal(
   s = event_start;
 
   if (tag >> 1 == static_cast<uint64_t>(RtcEvent::Type::BeginV3Log)) {
+    RTC_DCHECK(bytes_parsed == nullptr);
     return ParseStreamInternalV3(s);
   }
 
+  const size_t stream_size = s.size();
   while (!s.empty()) {
     // If not, "reset" event_start and read the field tag for the next event.
     event_start = s;
     std::tie(success, s) = DecodeVarInt(s, &tag);
+    if (!success && bytes_parsed != nullptr) {
+      // The event continues in the next part.
+      *bytes_parsed = stream_size - event_start.size();
+      return ParseStatus::Success();
+    }
     if (!success) {
       RTC_LOG(LS_WARNING)
           << "Failed to read field tag from beginning of protobuf event.";
@@ -1465,6 +1576,15 @@ ParsedRtcEventLog::ParseStatus ParsedRtcEventLog::ParseStreamInternal(
     // Read the length field.
     uint64_t message_length = 0;
     std::tie(success, s) = DecodeVarInt(s, &message_length);
+    if ((!success || message_length > s.size()) && bytes_parsed != nullptr) {
+      // The event continues in the next part. Don't wait for more than a
+      // single event can hold.
+      if (success) {
+        RTC_PARSE_CHECK_OR_RETURN_LE(message_length, kMaxEventSize);
+      }
+      *bytes_parsed = stream_size - event_start.size();
+      return ParseStatus::Success();
+    }
     if (!success) {
       RTC_LOG(LS_WARNING) << "Missing message length after protobuf field tag.";
       RTC_PARSE_WARN_AND_RETURN_SUCCESS_IF(allow_incomplete_logs_,
@@ -1485,12 +1605,16 @@ ParsedRtcEventLog::ParseStatus ParsedRtcEventLog::ParseStreamInternal(
     }
 
     RTC_PARSE_CHECK_OR_RETURN_LE(message_length, kMaxEventSize);
+    const absl::string_view message = s.substr(0, message_length);
     // Skip forward to the start of the next event.
     s = s.substr(message_length);
     size_t total_event_size = event_start.size() - s.size();
     RTC_CHECK_LE(total_event_size, event_start.size());
 
     if (tag == kExpectedV1Tag) {
+      if (!ShouldParseLegacyEvent(message)) {
+        continue;
+      }
       // Parse the protobuf event from the buffer.
       rtclog::EventStream event_stream;
       if (!event_stream.ParseFromArray(event_start.data(), total_event_size)) {
@@ -1504,7 +1628,7 @@ ParsedRtcEventLog::ParseStatus ParsedRtcEventLog::ParseStreamInternal(
       RTC_PARSE_CHECK_OR_RETURN_EQ(event_stream.stream_size(), 1);
       auto status = StoreParsedLegacyEvent(event_stream.stream(0));
       RTC_RETURN_IF_ERROR(status);
-    } else {
+    } else if (ShouldParseNewFormatEvent(tag >> 3)) {
       // Parse the protobuf event from the buffer.
       rtclog2::EventStream event_stream;
       if (!event_stream.ParseFromArray(event_start.data(), total_event_size)) {
@@ -1517,6 +1641,9 @@ ParsedRtcEventLog::ParseStatus ParsedRtcEventLog::ParseStreamInternal(
       RTC_RETURN_IF_ERROR(status);
     }
   }
+  if (bytes_parsed != nullptr) {
+    *bytes_parsed = stream_size;
+  }
   return ParseStatus::Success();
 }
 
@@ -1554,6 +1681,11 @@ ParsedRtcEventLog::ParseStatus ParsedRtcEventLog::ParseStreamInternalV3(
       expect_begin_log_event = false;
     }
 
+    if (event_type <= std::numeric_limits<uint32_t>::max() &&
+        !ShouldParseEventType(static_cast<RtcEvent::Type>(event_type))) {
+      continue;
+    }
+
     switch (event_type) {
       case static_cast<uint32_t>(RtcEvent::Type::BeginV3Log):
         RtcEventBeginLog::Parse(event_fields, batched, start_log_events_);
@@ -2157,6 +2289,11 @@ ParsedRtcEventLog::GetAudioNetworkAdaptation(const rtclog::Event& event) const {
     res.config.frame_length_ms = ana_event.frame_length_ms();
   if (ana_event.has_num_channels())
     res.config.num_channels = ana_event.num_channels();
+  if (ana_event.has_complexity()) {
+    RTC_PARSE_CHECK_OR_RETURN(
+        rtc::IsValueInRangeForNumericType<int>(ana_event.complexity()));
+    res.config.complexity = ana_event.complexity();
+  }
   if (ana_event.has_uplink_packet_loss_fraction())
     res.config.uplink_packet_loss_fraction =
         ana_event.uplink_packet_loss_fraction();
@@ -2610,7 +2747,149 @@ std::vector<MatchedSendArrivalTimes> GetNetworkTrace(
   return rtp_rtcp_matched;
 }
 
+bool ParsedRtcEventLog::ShouldParseEventType(RtcEvent::Type type) const {
+  switch (type) {
+    case RtcEvent::Type::AudioReceiveStreamConfig:
+    case RtcEvent::Type::AudioSendStreamConfig:
+    case RtcEvent::Type::VideoReceiveStreamConfig:
+    case RtcEvent::Type::VideoSendStreamConfig:
+    case RtcEvent::Type::BeginV3Log:
+    case RtcEvent::Type::EndV3Log:
+      // Needed to interpret the other events.
+      return true;
+    default:
+      return event_types_to_parse_.empty() ||
+             event_types_to_parse_.count(type) > 0;
+  }
+}
+
+bool ParsedRtcEventLog::ShouldParseLegacyEvent(absl::string_view event) const {
+  if (event_types_to_parse_.empty()) {
+    return true;
+  }
+  std::optional<uint64_t> type = PeekLegacyEventType(event);
+  if (!type) {
+    // Leave malformed events to the full parse, which reports them.
+    return true;
+  }
+  switch (*type) {
+    case rtclog::Event::RTP_EVENT:
+      return ShouldParseEventType(RtcEvent::Type::RtpPacketIncoming) ||
+             ShouldParseEventType(RtcEvent::Type::RtpPacketOutgoing);
+    case rtclog::Event::RTCP_EVENT:
+      return ShouldParseEventType(RtcEvent::Type::RtcpPacketIncoming) ||
+             ShouldParseEventType(RtcEvent::Type::RtcpPacketOutgoing);
+    case rtclog::Event::AUDIO_PLAYOUT_EVENT:
+      return ShouldParseEventType(RtcEvent::Type::AudioPlayout);
+    case rtclog::Event::LOSS_BASED_BWE_UPDATE:
+      return ShouldParseEventType(RtcEvent::Type::BweUpdateLossBased);
+    case rtclog::Event::DELAY_BASED_BWE_UPDATE:
+      return ShouldParseEventType(RtcEvent::Type::BweUpdateDelayBased);
+    case rtclog::Event::AUDIO_NETWORK_ADAPTATION_EVENT:
+      return ShouldParseEventType(RtcEvent::Type::AudioNetworkAdaptation);
+    case rtclog::Event::BWE_PROBE_CLUSTER_CREATED_EVENT:
+      return ShouldParseEventType(RtcEvent::Type::ProbeClusterCreated);
+    case rtclog::Event::BWE_PROBE_RESULT_EVENT:
+      return ShouldParseEventType(RtcEvent::Type::ProbeResultSuccess) ||
+             ShouldParseEventType(RtcEvent::Type::ProbeResultFailure);
+    case rtclog::Event::ALR_STATE_EVENT:
+      return ShouldParseEventType(RtcEvent::Type::AlrStateEvent);
+    case rtclog::Event::ICE_CANDIDATE_PAIR_CONFIG:
+      return ShouldParseEventType(RtcEvent::Type::IceCandidatePairConfig);
+    case rtclog::Event::ICE_CANDIDATE_PAIR_EVENT:
+      return ShouldParseEventType(RtcEvent::Type::IceCandidatePairEvent);
+    case rtclog::Event::REMOTE_ESTIMATE:
+      return ShouldParseEventType(RtcEvent::Type::RemoteEstimateEvent);
+    default:
+      // Stream configs, start and stop events, and unknown events.
+      return true;
+  }
+}
+
 // Helper functions for new format start here
+bool ParsedRtcEventLog::ShouldParseNewFormatEvent(
+    uint64_t field_number) const {
+  if (event_types_to_parse_.empty()) {
+    return true;
+  }
+  RtcEvent::Type type;
+  switch (field_number) {
+    case rtclog2::EventStream::kIncomingRtpPacketsFieldNumber:
+      type = RtcEvent::Type::RtpPacketIncoming;
+      break;
+    case rtclog2::EventStream::kOutgoingRtpPacketsFieldNumber:
+      type = RtcEvent::Type::RtpPacketOutgoing;
+      break;
+    case rtclog2::EventStream::kIncomingRtcpPacketsFieldNumber:
+      type = RtcEvent::Type::RtcpPacketIncoming;
+      break;
+    case rtclog2::EventStream::kOutgoingRtcpPacketsFieldNumber:
+      type = RtcEvent::Type::RtcpPacketOutgoing;
+      break;
+    case rtclog2::EventStream::kAudioPlayoutEventsFieldNumber:
+      type = RtcEvent::Type::AudioPlayout;
+      break;
+    case rtclog2::EventStream::kFrameDecodedEventsFieldNumber:
+      type = RtcEvent::Type::FrameDecoded;
+      break;
+    case rtclog2::EventStream::kLossBasedBweUpdatesFieldNumber:
+      type = RtcEvent::Type::BweUpdateLossBased;
+      break;
+    case rtclog2::EventStream::kDelayBasedBweUpdatesFieldNumber:
+      type = RtcEvent::Type::BweUpdateDelayBased;
+      break;
+    case rtclog2::EventStream::kAudioNetworkAdaptationsFieldNumber:
+      type = RtcEvent::Type::AudioNetworkAdaptation;
+      break;
+    case rtclog2::EventStream::kProbeClustersFieldNumber:
+      type = RtcEvent::Type::ProbeClusterCreated;
+      break;
+    case rtclog2::EventStream::kProbeSuccessFieldNumber:
+      type = RtcEvent::Type::ProbeResultSuccess;
+      break;
+    case rtclog2::EventStream::kProbeFailureFieldNumber:
+      type = RtcEvent::Type::ProbeResultFailure;
+      break;
+    case rtclog2::EventStream::kAlrStatesFieldNumber:
+      type = RtcEvent::Type::AlrStateEvent;
+      break;
+    case rtclog2::EventStream::kIceCandidateConfigsFieldNumber:
+      type = RtcEvent::Type::IceCandidatePairConfig;
+      break;
+    case rtclog2::EventStream::kIceCandidateEventsFieldNumber:
+      type = RtcEvent::Type::IceCandidatePairEvent;
+      break;
+    case rtclog2::EventStream::kDtlsTransportStateEventsFieldNumber:
+      type = RtcEvent::Type::DtlsTransportState;
+      break;
+    case rtclog2::EventStream::kDtlsWritableStatesFieldNumber:
+      type = RtcEvent::Type::DtlsWritableState;
+      break;
+    case rtclog2::EventStream::kGenericPacketsSentFieldNumber:
+      type = RtcEvent::Type::GenericPacketSent;
+      break;
+    case rtclog2::EventStream::kGenericPacketsReceivedFieldNumber:
+      type = RtcEvent::Type::GenericPacketReceived;
+      break;
+    case rtclog2::EventStream::kGenericAcksReceivedFieldNumber:
+      type = RtcEvent::Type::GenericAckReceived;
+      break;
+    case rtclog2::EventStream::kRouteChangesFieldNumber:
+      type = RtcEvent::Type::RouteChangeEvent;
+      break;
+    case rtclog2::EventStream::kRemoteEstimatesFieldNumber:
+      type = RtcEvent::Type::RemoteEstimateEvent;
+      break;
+    case rtclog2::EventStream::kNeteqSetMinimumDelayFieldNumber:
+      type = RtcEvent::Type::NetEqSetMinimumDelay;
+      break;
+    default:
+      // Stream configs, start and stop events, and unknown messages.
+      return true;
+  }
+  return ShouldParseEventType(type);
+}
+
 ParsedRtcEventLog::ParseStatus ParsedRtcEventLog::StoreParsedNewFormatEvent(
     const rtclog2::EventStream& stream) {
   RTC_DCHECK_EQ(stream.stream_size(), 0);  // No legacy format event.
@@ -3462,6 +3741,11 @@ ParsedRtcEventLog::StoreAudioNetworkAdaptationEvent(
       // Note: Encoding N as N-1 only done for `num_channels_deltas`.
       runtime_config.num_channels = proto.num_channels();
     }
+    if (proto.has_complexity()) {
+      RTC_PARSE_CHECK_OR_RETURN(
+          rtc::IsValueInRangeForNumericType<int>(proto.complexity()));
+      runtime_config.complexity = proto.complexity();
+    }
     audio_network_adaptation_events_.emplace_back(
         Timestamp::Millis(proto.timestamp_ms()), runtime_config);
   }
@@ -3544,6 +3828,14 @@ ParsedRtcEventLog::StoreAudioNetworkAdaptationEvent(
   }
   RTC_PARSE_CHECK_OR_RETURN_EQ(num_channels_values.size(), number_of_deltas);
 
+  // complexity
+  const std::optional<uint64_t> complexity =
+      proto.has_complexity() ? std::optional<uint64_t>(proto.complexity())
+                             : std::optional<uint64_t>();
+  std::vector<std::optional<uint64_t>> complexity_values =
+      DecodeDeltas(proto.complexity_deltas(), complexity, number_of_deltas);
+  RTC_PARSE_CHECK_OR_RETURN_EQ(complexity_values.size(), number_of_deltas);
+
   // Populate events from decoded deltas
   for (size_t i = 0; i < number_of_deltas; ++i) {
     RTC_PARSE_CHECK_OR_RETURN(timestamp_ms_values[i].has_value());
@@ -3591,6 +3883,12 @@ ParsedRtcEventLog::StoreAudioNetworkAdaptationEvent(
       runtime_config.num_channels =
           static_cast<size_t>(num_channels_values[i].value());
     }
+    if (complexity_values[i].has_value()) {
+      RTC_PARSE_CHECK_OR_RETURN(rtc::IsValueInRangeForNumericType<int>(
+          complexity_values[i].value()));
+      runtime_config.complexity =
+          static_cast<int>(complexity_values[i].value());
+    }
     audio_network_adaptation_events_.emplace_back(
         Timestamp::Millis(timestamp_ms), runtime_config);
   }
@@ -17,12 +17,14 @@
 #include <map>
 #include <set>
 #include <type_traits>
+#include <utility>
 #include <vector>
 
 #include "absl/base/attributes.h"
 #include "absl/strings/string_view.h"
 #include "api/candidate.h"
 #include "api/dtls_transport_interface.h"
+#include "api/rtc_event_log/rtc_event.h"
 #include "api/rtp_parameters.h"
 #include "api/transport/bandwidth_usage.h"
 #include "api/units/time_delta.h"
@@ -390,6 +392,8 @@ class ParsedRtcEventLog {
   void Clear();
 
   // Reads an RtcEventLog file and returns success if parsing was successful.
+  // The file is read and parsed in parts, so only the events being parsed are
+  // held in memory rather than the whole file.
   ParseStatus ParseFile(absl::string_view filename);
 
   // Reads an RtcEventLog from a string and returns success if successful.
@@ -398,6 +402,18 @@ class ParsedRtcEventLog {
   // Reads an RtcEventLog from an string and returns success if successful.
   ParseStatus ParseStream(absl::string_view s);
 
+  // Restricts parsing to the given event types, e.g. for analysis tools that
+  // only need a few of them. Events of other types are skipped without being
+  // decoded, which makes parsing large logs considerably faster. Stream
+  // configs and start and stop events are always parsed since they are needed
+  // to interpret the other events. Legacy logs don't tell the direction of an
+  // RTP or RTCP packet, or the outcome of a probe, without decoding the event,
+  // so there both directions or outcomes are parsed if one of them is
+  // selected. An empty set, which is the default, parses all event types.
+  void SetEventTypesToParse(std::set<RtcEvent::Type> event_types) {
+    event_types_to_parse_ = std::move(event_types);
+  }
+
   MediaType GetMediaType(uint32_t ssrc, PacketDirection direction) const;
 
   // Configured SSRCs.
@@ -686,8 +702,24 @@ class ParsedRtcEventLog {
   std::vector<InferredRouteChangeEvent> GetRouteChanges() const;
 
  private:
-  ABSL_MUST_USE_RESULT ParseStatus ParseStreamInternal(absl::string_view s);
+  // If `bytes_parsed` is not null, `s` may end with an incomplete event. Then
+  // parsing stops before that event and `bytes_parsed` is set to the number of
+  // bytes that were parsed. If parsing instead stops early at a corrupt event
+  // that `allow_incomplete_logs_` tolerates, `bytes_parsed` is not modified.
+  ABSL_MUST_USE_RESULT ParseStatus
+  ParseStreamInternal(absl::string_view s, size_t* bytes_parsed = nullptr);
   ABSL_MUST_USE_RESULT ParseStatus ParseStreamInternalV3(absl::string_view s);
+  // Returns false if events of `type` can be skipped because of
+  // `event_types_to_parse_`.
+  bool ShouldParseEventType(RtcEvent::Type type) const;
+  // Returns false if the encoded rtclog::Event `event` can be skipped because
+  // of `event_types_to_parse_`. Only the type field of `event` is decoded.
+  bool ShouldParseLegacyEvent(absl::string_view event) const;
+  // Returns false if the new format message with field number `field_number`
+  // in rtclog2::EventStream can be skipped because of `event_types_to_parse_`.
+  bool ShouldParseNewFormatEvent(uint64_t field_number) const;
+  // Builds the per-SSRC state that is derived from all parsed events.
+  void FinishParsing();
 
   ABSL_MUST_USE_RESULT ParseStatus
   StoreParsedLegacyEvent(const rtclog::Event& event);
@@ -818,6 +850,7 @@ class ParsedRtcEventLog {
 
   const UnconfiguredHeaderExtensions parse_unconfigured_header_extensions_;
   const bool allow_incomplete_logs_;
+  std::set<RtcEvent::Type> event_types_to_parse_;
 
   // Make a default extension map for streams without configuration information.
   // TODO(ivoc): Once configuration of audio streams is stored in the event log,
@@ -0,0 +1,115 @@
+/*
+ *  Copyright 2025 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <string>
+
+#include "api/rtc_event_log/rtc_event.h"
+#include "api/transport/bandwidth_usage.h"
+#include "api/units/time_delta.h"
+#include "benchmark/benchmark.h"
+#include "logging/rtc_event_log/encoder/rtc_event_log_encoder_new_format.h"
+#include "logging/rtc_event_log/events/rtc_event_alr_state.h"
+#include "logging/rtc_event_log/events/rtc_event_bwe_update_delay_based.h"
+#include "logging/rtc_event_log/events/rtc_event_rtp_packet_incoming.h"
+#include "logging/rtc_event_log/rtc_event_log_parser.h"
+#include "modules/rtp_rtcp/source/rtp_packet_received.h"
+#include "rtc_base/checks.h"
+#include "rtc_base/fake_clock.h"
+#include "rtc_base/time_utils.h"
+#include "test/explicit_key_value_config.h"
+
+namespace webrtc {
+namespace {
+
+// Events are encoded in batches of this size, like RtcEventLogImpl does.
+constexpr size_t kEventsPerBatch = 1000;
+constexpr uint32_t kSsrc = 0x12345678;
+
+// Creates a log of a call with an incoming video stream, receiving one packet
+// per millisecond, and a delay based bandwidth estimate every 25 packets.
+std::string CreateLog(int num_packets) {
+  rtc::ScopedBaseFakeClock clock;
+  RtcEventLogEncoderNewFormat encoder(test::ExplicitKeyValueConfig(""));
+  std::string log =
+      encoder.EncodeLogStart(rtc::TimeMicros(), rtc::TimeUTCMicros());
+
+  std::deque<std::unique_ptr<RtcEvent>> batch;
+  for (int i = 0; i < num_packets; ++i) {
+    clock.AdvanceTime(TimeDelta::Millis(1));
+    RtpPacketReceived packet;
+    packet.SetPayloadType(96);
+    packet.SetSequenceNumber(static_cast<uint16_t>(i));
+    packet.SetTimestamp(90 * i);
+    packet.SetSsrc(kSsrc);
+    packet.SetPayloadSize(1100);
+    batch.push_back(std::make_unique<RtcEventRtpPacketIncoming>(packet));
+    if (i % 25 == 0) {
+      batch.push_back(std::make_unique<RtcEventBweUpdateDelayBased>(
+          1'000'000 + i, BandwidthUsage::kBwNormal));
+    }
+    if (i % 1000 == 0) {
+      batch.push_back(std::make_unique<RtcEventAlrState>(i % 2000 == 0));
+    }
+    if (batch.size() >= kEventsPerBatch) {
+      log += encoder.EncodeBatch(batch.begin(), batch.end());
+      batch.clear();
+    }
+  }
+  log += encoder.EncodeBatch(batch.begin(), batch.end());
+  log += encoder.EncodeLogEnd(rtc::TimeMicros());
+  return log;
+}
+
+void BM_ParseLog(benchmark::State& state) {
+  const std::string log = CreateLog(state.range(0));
+  for (auto _ : state) {
+    ParsedRtcEventLog parsed_log;
+    RTC_CHECK(parsed_log.ParseString(log).ok());
+    benchmark::DoNotOptimize(parsed_log);
+  }
+  state.SetBytesProcessed(state.iterations() * log.size());
+}
+
+// Parses only the bandwidth estimates, as a tool plotting them would.
+void BM_ParseLogBweUpdatesOnly(benchmark::State& state) {
+  const std::string log = CreateLog(state.range(0));
+  for (auto _ : state) {
+    ParsedRtcEventLog parsed_log;
+    parsed_log.SetEventTypesToParse({RtcEvent::Type::BweUpdateDelayBased});
+    RTC_CHECK(parsed_log.ParseString(log).ok());
+    RTC_DCHECK(parsed_log.incoming_rtp_packets_by_ssrc().empty());
+    benchmark::DoNotOptimize(parsed_log);
+  }
+  state.SetBytesProcessed(state.iterations() * log.size());
+}
+
+BENCHMARK(BM_ParseLog)
+    ->RangeMultiplier(10)
+    ->Range(10'000, 1'000'000)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_ParseLogBweUpdatesOnly)
+    ->RangeMultiplier(10)
+    ->Range(10'000, 1'000'000)
+    ->Unit(benchmark::kMillisecond);
+
+}  // namespace
+}  // namespace webrtc
+
+/*
+
+The argument is the number of RTP packets in the log; 1'000'000 packets is
+about 17 minutes of a video call. Run with:
+
+  out/Default/benchmarks --benchmark_filter=ParseLog
+*/
@@ -13,6 +13,7 @@
 #include <algorithm>
 #include <cstddef>
 #include <cstdint>
+#include <deque>
 #include <limits>
 #include <map>
 #include <memory>
@@ -23,9 +24,11 @@
 
 #include "api/environment/environment.h"
 #include "api/environment/environment_factory.h"
+#include "api/rtc_event_log/rtc_event.h"
 #include "api/rtc_event_log/rtc_event_log_factory.h"
 #include "api/units/time_delta.h"
 #include "api/units/timestamp.h"
+#include "logging/rtc_event_log/encoder/rtc_event_log_encoder_legacy.h"
 #include "logging/rtc_event_log/events/rtc_event_alr_state.h"
 #include "logging/rtc_event_log/events/rtc_event_audio_network_adaptation.h"
 #include "logging/rtc_event_log/events/rtc_event_audio_playout.h"
@@ -60,6 +63,7 @@
 #include "rtc_base/checks.h"
 #include "rtc_base/fake_clock.h"
 #include "rtc_base/random.h"
+#include "rtc_base/system/file_wrapper.h"
 #include "rtc_base/time_utils.h"
 #include "test/explicit_key_value_config.h"
 #include "test/gtest.h"
@@ -619,6 +623,52 @@ void RtcEventLogSession::ReadAndVerifyLog() {
   ASSERT_TRUE(it != log_storage_.logs().end());
   ASSERT_TRUE(parsed_log.ParseString(it->second).ok());
 
+  // A log file is parsed in parts, which must give the same events.
+  {
+    FileWrapper file = FileWrapper::OpenWriteOnly(temp_filename_);
+    ASSERT_TRUE(file.is_open());
+    ASSERT_TRUE(file.Write(it->second.data(), it->second.size()));
+  }
+  ParsedRtcEventLog parsed_file_log;
+  ASSERT_TRUE(parsed_file_log.ParseFile(temp_filename_).ok());
+  EXPECT_TRUE(test::RemoveFile(temp_filename_));
+  EXPECT_EQ(parsed_file_log.start_log_events().size(),
+            parsed_log.start_log_events().size());
+  EXPECT_EQ(parsed_file_log.stop_log_events().size(),
+            parsed_log.stop_log_events().size());
+  EXPECT_EQ(parsed_file_log.audio_playout_events().size(),
+            parsed_log.audio_playout_events().size());
+  EXPECT_EQ(parsed_file_log.incoming_rtcp_packets().size(),
+            parsed_log.incoming_rtcp_packets().size());
+  EXPECT_EQ(parsed_file_log.outgoing_rtcp_packets().size(),
+            parsed_log.outgoing_rtcp_packets().size());
+  const auto& file_rtp_streams = parsed_file_log.incoming_rtp_packets_by_ssrc();
+  const auto& rtp_streams = parsed_log.incoming_rtp_packets_by_ssrc();
+  ASSERT_EQ(file_rtp_streams.size(), rtp_streams.size());
+  for (size_t i = 0; i < rtp_streams.size(); ++i) {
+    EXPECT_EQ(file_rtp_streams[i].ssrc, rtp_streams[i].ssrc);
+    EXPECT_EQ(file_rtp_streams[i].incoming_packets.size(),
+              rtp_streams[i].incoming_packets.size());
+  }
+  EXPECT_EQ(parsed_file_log.first_timestamp(), parsed_log.first_timestamp());
+  EXPECT_EQ(parsed_file_log.last_timestamp(), parsed_log.last_timestamp());
+
+  if (IsNewFormat()) {
+    // Events of the types that are not selected are skipped, but the configs
+    // are always parsed.
+    ParsedRtcEventLog parsed_bwe_log;
+    parsed_bwe_log.SetEventTypesToParse({RtcEvent::Type::BweUpdateDelayBased});
+    ASSERT_TRUE(parsed_bwe_log.ParseString(it->second).ok());
+    EXPECT_EQ(parsed_bwe_log.bwe_delay_updates().size(),
+              parsed_log.bwe_delay_updates().size());
+    EXPECT_EQ(parsed_bwe_log.video_recv_configs().size(),
+              parsed_log.video_recv_configs().size());
+    EXPECT_EQ(parsed_bwe_log.start_log_events().size(), 1u);
+    EXPECT_TRUE(parsed_bwe_log.bwe_loss_updates().empty());
+    EXPECT_TRUE(parsed_bwe_log.incoming_rtp_packets_by_ssrc().empty());
+    EXPECT_TRUE(parsed_bwe_log.audio_playout_events().empty());
+  }
+
   // Start and stop events.
   auto& parsed_start_log_events = parsed_log.start_log_events();
   ASSERT_EQ(parsed_start_log_events.size(), static_cast<size_t>(1));
@@ -1036,6 +1086,56 @@ INSTANTIATE_TEST_SUITE_P(
 // TODO(terelius): Verify parser behavior if the timestamps are not
 // monotonically increasing in the log.
 
+TEST(RtcEventLogParserTest, ParseFileStopsAtCorruptEventLikeParseString) {
+  constexpr uint32_t kSsrc = 1234;
+  constexpr size_t kNumEvents = 20000;
+  constexpr size_t kCorruptEvent = kNumEvents / 2;
+  RtcEventLogEncoderLegacy encoder;
+  std::string log = encoder.EncodeLogStart(/*timestamp_us=*/0,
+                                           /*utc_time_us=*/0);
+  size_t corrupt_event_offset = 0;
+  for (size_t i = 0; i < kNumEvents; ++i) {
+    std::deque<std::unique_ptr<RtcEvent>> batch;
+    batch.push_back(std::make_unique<RtcEventAudioPlayout>(kSsrc));
+    if (i == kCorruptEvent) {
+      corrupt_event_offset = log.size();
+    }
+    log += encoder.EncodeBatch(batch.begin(), batch.end());
+  }
+  // The log must span several of the parts that ParseFile() reads.
+  ASSERT_GT(corrupt_event_offset, size_t{64 * 1024});
+  ASSERT_GT(log.size() - corrupt_event_offset, size_t{64 * 1024});
+  // Replace the wire type of the event's field tag, which is a single byte.
+  ASSERT_EQ(log[corrupt_event_offset], (1 << 3) | 2);
+  log[corrupt_event_offset] = 1 << 3;
+
+  ParsedRtcEventLog parsed_log(
+      ParsedRtcEventLog::UnconfiguredHeaderExtensions::kDontParse,
+      /*allow_incomplete_log=*/true);
+  ASSERT_TRUE(parsed_log.ParseString(log).ok());
+  ASSERT_EQ(parsed_log.audio_playout_events().size(), 1u);
+  EXPECT_EQ(parsed_log.audio_playout_events().at(kSsrc).size(),
+            kCorruptEvent);
+
+  const std::string filename =
+      test::OutputPath() + "parse_file_stops_at_corrupt_event";
+  {
+    FileWrapper file = FileWrapper::OpenWriteOnly(filename);
+    ASSERT_TRUE(file.is_open());
+    ASSERT_TRUE(file.Write(log.data(), log.size()));
+  }
+  ParsedRtcEventLog parsed_file_log(
+      ParsedRtcEventLog::UnconfiguredHeaderExtensions::kDontParse,
+      /*allow_incomplete_log=*/true);
+  ASSERT_TRUE(parsed_file_log.ParseFile(filename).ok());
+  EXPECT_TRUE(test::RemoveFile(filename));
+  EXPECT_EQ(parsed_file_log.start_log_events().size(),
+            parsed_log.start_log_events().size());
+  ASSERT_EQ(parsed_file_log.audio_playout_events().size(), 1u);
+  EXPECT_EQ(parsed_file_log.audio_playout_events().at(kSsrc).size(),
+            kCorruptEvent);
+}
+
 TEST(DereferencingVectorTest, NonConstVector) {
   std::vector<int> v{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
   DereferencingVector<int> even;
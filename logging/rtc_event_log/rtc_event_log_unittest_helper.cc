@@ -166,6 +166,7 @@ EventGenerator::NewAudioNetworkAdaptation() {
   config->enable_dtx = prng_.Rand<bool>();
   config->frame_length_ms = prng_.Rand(10, 120);
   config->num_channels = prng_.Rand(1, 2);
+  config->complexity = prng_.Rand(0, 10);
   config->uplink_packet_loss_fraction = prng_.Rand<float>();
 
   return std::make_unique<RtcEventAudioNetworkAdaptation>(std::move(config));
@@ -914,6 +915,8 @@ void EventVerifier::VerifyLoggedAudioNetworkAdaptationEvent(
             logged_event.config.frame_length_ms);
   EXPECT_EQ(original_event.config().num_channels,
             logged_event.config.num_channels);
+  EXPECT_EQ(original_event.config().complexity,
+            logged_event.config.complexity);
 
   // uplink_packet_loss_fraction
   ASSERT_EQ(original_event.config().uplink_packet_loss_fraction.has_value(),
@@ -100,6 +100,15 @@ void AudioNetworkAdaptorImpl::SetOverhead(size_t overhead_bytes_per_packet) {
   UpdateNetworkMetrics(network_metrics);
 }
 
+void AudioNetworkAdaptorImpl::SetCpuLoad(int encode_time_per_frame_us,
+                                         float process_cpu_usage) {
+  // The CPU load is not part of the debug dump.
+  Controller::NetworkMetrics network_metrics;
+  network_metrics.encode_time_per_frame_us = encode_time_per_frame_us;
+  network_metrics.process_cpu_usage = process_cpu_usage;
+  UpdateNetworkMetrics(network_metrics);
+}
+
 AudioEncoderRuntimeConfig AudioNetworkAdaptorImpl::GetEncoderRuntimeConfig() {
   AudioEncoderRuntimeConfig config;
   for (auto& controller :
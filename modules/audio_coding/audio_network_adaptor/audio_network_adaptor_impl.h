@@ -56,6 +56,9 @@ class AudioNetworkAdaptorImpl final : public AudioNetworkAdaptor {
 
   void SetOverhead(size_t overhead_bytes_per_packet) override;
 
+  void SetCpuLoad(int encode_time_per_frame_us,
+                  float process_cpu_usage) override;
+
   AudioEncoderRuntimeConfig GetEncoderRuntimeConfig() override;
 
   void StartDebugDump(FILE* file_handle) override;
@@ -27,6 +27,9 @@ class Controller {
     std::optional<int> target_audio_bitrate_bps;
     std::optional<int> rtt_ms;
     std::optional<size_t> overhead_bytes_per_packet;
+    // Not network metrics, but the load of the CPU of the sender.
+    std::optional<int> encode_time_per_frame_us;
+    std::optional<float> process_cpu_usage;
   };
 
   virtual ~Controller() = default;
@@ -18,6 +18,7 @@
 #include "absl/strings/string_view.h"
 #include "modules/audio_coding/audio_network_adaptor/bitrate_controller.h"
 #include "modules/audio_coding/audio_network_adaptor/channel_controller.h"
+#include "modules/audio_coding/audio_network_adaptor/cpu_load_controller.h"
 #include "modules/audio_coding/audio_network_adaptor/debug_dump_writer.h"
 #include "modules/audio_coding/audio_network_adaptor/dtx_controller.h"
 #include "modules/audio_coding/audio_network_adaptor/fec_controller_plr_based.h"
@@ -206,6 +207,43 @@ std::unique_ptr<FrameLengthControllerV2> CreateFrameLengthControllerV2(
       encoder_frame_lengths_ms, config.min_payload_bitrate_bps(),
       config.use_slow_adaptation());
 }
+
+std::unique_ptr<CpuLoadController> CreateCpuLoadController(
+    const audio_network_adaptor::config::CpuLoadController& config,
+    rtc::ArrayView<const int> encoder_frame_lengths_ms,
+    int initial_frame_length_ms) {
+  CpuLoadController::Config controller_config;
+  if (config.has_max_complexity())
+    controller_config.max_complexity = config.max_complexity();
+  if (config.has_min_complexity())
+    controller_config.min_complexity = config.min_complexity();
+  if (config.has_complexity_step())
+    controller_config.complexity_step = config.complexity_step();
+  if (config.has_max_frame_length_ms())
+    controller_config.max_frame_length_ms = config.max_frame_length_ms();
+  if (config.has_overuse_encode_usage())
+    controller_config.overuse_encode_usage = config.overuse_encode_usage();
+  if (config.has_overuse_process_cpu_usage()) {
+    controller_config.overuse_process_cpu_usage =
+        config.overuse_process_cpu_usage();
+  }
+  if (config.has_underuse_encode_usage())
+    controller_config.underuse_encode_usage = config.underuse_encode_usage();
+  if (config.has_underuse_process_cpu_usage()) {
+    controller_config.underuse_process_cpu_usage =
+        config.underuse_process_cpu_usage();
+  }
+  if (config.has_num_overuse_updates_to_step_down()) {
+    controller_config.num_overuse_updates_to_step_down =
+        config.num_overuse_updates_to_step_down();
+  }
+  if (config.has_num_underuse_updates_to_step_up()) {
+    controller_config.num_underuse_updates_to_step_up =
+        config.num_underuse_updates_to_step_up();
+  }
+  return std::make_unique<CpuLoadController>(
+      controller_config, encoder_frame_lengths_ms, initial_frame_length_ms);
+}
 #endif  // WEBRTC_ENABLE_PROTOBUF
 
 }  // namespace
@@ -292,6 +330,11 @@ std::unique_ptr<ControllerManager> ControllerManagerImpl::Create(
             controller_config.frame_length_controller_v2(),
             encoder_frame_lengths_ms);
         break;
+      case audio_network_adaptor::config::Controller::kCpuLoadController:
+        controller = CreateCpuLoadController(
+            controller_config.cpu_load_controller(), encoder_frame_lengths_ms,
+            initial_frame_length_ms);
+        break;
       default:
         RTC_DCHECK_NOTREACHED();
     }
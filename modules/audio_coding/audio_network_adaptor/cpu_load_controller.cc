@@ -0,0 +1,158 @@
+/*
+ *  Copyright 2025 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "modules/audio_coding/audio_network_adaptor/cpu_load_controller.h"
+
+#include <algorithm>
+#include <iterator>
+
+#include "rtc_base/checks.h"
+#include "rtc_base/logging.h"
+
+namespace webrtc {
+
+namespace {
+
+std::vector<int> SortedFrameLengths(rtc::ArrayView<const int> frame_lengths) {
+  std::vector<int> sorted(frame_lengths.begin(), frame_lengths.end());
+  std::sort(sorted.begin(), sorted.end());
+  return sorted;
+}
+
+}  // namespace
+
+CpuLoadController::Config::Config() = default;
+
+CpuLoadController::CpuLoadController(
+    const Config& config,
+    rtc::ArrayView<const int> encoder_frame_lengths_ms,
+    int initial_frame_length_ms)
+    : config_(config),
+      encoder_frame_lengths_ms_(SortedFrameLengths(encoder_frame_lengths_ms)),
+      initial_frame_length_ms_(initial_frame_length_ms),
+      complexity_(config.max_complexity),
+      frame_length_ms_(initial_frame_length_ms) {
+  RTC_DCHECK_LE(config_.min_complexity, config_.max_complexity);
+  RTC_DCHECK_GT(config_.complexity_step, 0);
+  RTC_DCHECK_LE(config_.underuse_encode_usage, config_.overuse_encode_usage);
+  RTC_DCHECK_LE(config_.underuse_process_cpu_usage,
+                config_.overuse_process_cpu_usage);
+  RTC_DCHECK_GT(initial_frame_length_ms_, 0);
+}
+
+CpuLoadController::~CpuLoadController() = default;
+
+void CpuLoadController::UpdateNetworkMetrics(
+    const NetworkMetrics& network_metrics) {
+  if (!network_metrics.encode_time_per_frame_us &&
+      !network_metrics.process_cpu_usage) {
+    return;
+  }
+  std::optional<float> encode_usage;
+  if (network_metrics.encode_time_per_frame_us) {
+    encode_usage = *network_metrics.encode_time_per_frame_us /
+                   (1000.f * frame_length_ms_);
+  }
+  const std::optional<float>& process_cpu_usage =
+      network_metrics.process_cpu_usage;
+
+  const bool overuse =
+      (encode_usage && *encode_usage > config_.overuse_encode_usage) ||
+      (process_cpu_usage &&
+       *process_cpu_usage > config_.overuse_process_cpu_usage);
+  const bool underuse =
+      (!encode_usage || *encode_usage < config_.underuse_encode_usage) &&
+      (!process_cpu_usage ||
+       *process_cpu_usage < config_.underuse_process_cpu_usage);
+
+  if (overuse) {
+    num_underuse_updates_ = 0;
+    if (++num_overuse_updates_ >= config_.num_overuse_updates_to_step_down) {
+      num_overuse_updates_ = 0;
+      StepDown();
+    }
+  } else if (underuse) {
+    num_overuse_updates_ = 0;
+    if (++num_underuse_updates_ >= config_.num_underuse_updates_to_step_up) {
+      num_underuse_updates_ = 0;
+      StepUp();
+    }
+  } else {
+    num_overuse_updates_ = 0;
+    num_underuse_updates_ = 0;
+  }
+}
+
+void CpuLoadController::MakeDecision(AudioEncoderRuntimeConfig* config) {
+  // Decision on `complexity` should not have been made.
+  RTC_DCHECK(!config->complexity);
+
+  if (min_frame_length_ms_) {
+    if (!config->frame_length_ms ||
+        *config->frame_length_ms < *min_frame_length_ms_) {
+      config->frame_length_ms = *min_frame_length_ms_;
+    }
+  } else if (frame_length_raised_) {
+    // Restore the frame length, unless another controller decides it.
+    if (!config->frame_length_ms) {
+      config->frame_length_ms = initial_frame_length_ms_;
+    }
+    frame_length_raised_ = false;
+  }
+  if (config->frame_length_ms) {
+    frame_length_ms_ = *config->frame_length_ms;
+  }
+  config->complexity = complexity_;
+}
+
+void CpuLoadController::StepDown() {
+  if (complexity_ > config_.min_complexity) {
+    complexity_ = std::max(complexity_ - config_.complexity_step,
+                           config_.min_complexity);
+    RTC_LOG(LS_INFO) << "CPU overuse, lowering the complexity to "
+                     << complexity_;
+    return;
+  }
+  const int frame_length_ms =
+      std::max(frame_length_ms_, min_frame_length_ms_.value_or(0));
+  auto it = std::upper_bound(encoder_frame_lengths_ms_.begin(),
+                             encoder_frame_lengths_ms_.end(), frame_length_ms);
+  if (it == encoder_frame_lengths_ms_.end() ||
+      *it > config_.max_frame_length_ms) {
+    return;
+  }
+  min_frame_length_ms_ = *it;
+  frame_length_raised_ = true;
+  RTC_LOG(LS_INFO) << "CPU overuse, raising the frame length to " << *it
+                   << " ms";
+}
+
+void CpuLoadController::StepUp() {
+  if (min_frame_length_ms_) {
+    auto it = std::lower_bound(encoder_frame_lengths_ms_.begin(),
+                               encoder_frame_lengths_ms_.end(),
+                               *min_frame_length_ms_);
+    if (it == encoder_frame_lengths_ms_.begin() ||
+        *std::prev(it) <= initial_frame_length_ms_) {
+      min_frame_length_ms_.reset();
+    } else {
+      min_frame_length_ms_ = *std::prev(it);
+    }
+    return;
+  }
+  if (complexity_ < config_.max_complexity) {
+    complexity_ = std::min(complexity_ + config_.complexity_step,
+                           config_.max_complexity);
+    RTC_LOG(LS_INFO) << "CPU underuse, raising the complexity to "
+                     << complexity_;
+  }
+}
+
+}  // namespace webrtc
@@ -0,0 +1,87 @@
+/*
+ *  Copyright 2025 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef MODULES_AUDIO_CODING_AUDIO_NETWORK_ADAPTOR_CPU_LOAD_CONTROLLER_H_
+#define MODULES_AUDIO_CODING_AUDIO_NETWORK_ADAPTOR_CPU_LOAD_CONTROLLER_H_
+
+#include <optional>
+#include <vector>
+
+#include "api/array_view.h"
+#include "modules/audio_coding/audio_network_adaptor/controller.h"
+#include "modules/audio_coding/audio_network_adaptor/include/audio_network_adaptor_config.h"
+
+namespace webrtc {
+
+// Lowers the encoder complexity, and then raises the frame length, when the
+// CPU is overloaded, and restores them in the reverse order when it is not.
+// The frame length decided by other controllers is only ever raised, so this
+// controller should come after them in the configuration.
+class CpuLoadController final : public Controller {
+ public:
+  struct Config {
+    Config();
+    // Complexity used when the CPU is not overloaded.
+    int max_complexity = 10;
+    // Complexity below which the encoder is never set.
+    int min_complexity = 3;
+    int complexity_step = 2;
+    // Frame length above which the encoder is never set because of overload.
+    int max_frame_length_ms = 60;
+    // The CPU is overloaded when encoding a frame takes more than this
+    // fraction of its duration, or when the process uses more than this
+    // fraction of all the cores.
+    float overuse_encode_usage = 0.1f;
+    float overuse_process_cpu_usage = 0.9f;
+    // The CPU is underused when both are below these.
+    float underuse_encode_usage = 0.05f;
+    float underuse_process_cpu_usage = 0.7f;
+    // Number of consecutive CPU load updates showing overuse or underuse
+    // before a step is taken. Recovering slower than backing off avoids
+    // oscillating around the overload.
+    int num_overuse_updates_to_step_down = 2;
+    int num_underuse_updates_to_step_up = 10;
+  };
+
+  CpuLoadController(const Config& config,
+                    rtc::ArrayView<const int> encoder_frame_lengths_ms,
+                    int initial_frame_length_ms);
+
+  ~CpuLoadController() override;
+
+  CpuLoadController(const CpuLoadController&) = delete;
+  CpuLoadController& operator=(const CpuLoadController&) = delete;
+
+  void UpdateNetworkMetrics(const NetworkMetrics& network_metrics) override;
+
+  void MakeDecision(AudioEncoderRuntimeConfig* config) override;
+
+ private:
+  void StepDown();
+  void StepUp();
+
+  const Config config_;
+  // Frame lengths supported by the encoder, in increasing order.
+  const std::vector<int> encoder_frame_lengths_ms_;
+  const int initial_frame_length_ms_;
+  int complexity_;
+  // Frame length below which the encoder is not set, if any.
+  std::optional<int> min_frame_length_ms_;
+  // Whether the frame length has been raised since the last decision that
+  // restored it.
+  bool frame_length_raised_ = false;
+  int frame_length_ms_;
+  int num_overuse_updates_ = 0;
+  int num_underuse_updates_ = 0;
+};
+
+}  // namespace webrtc
+
+#endif  // MODULES_AUDIO_CODING_AUDIO_NETWORK_ADAPTOR_CPU_LOAD_CONTROLLER_H_
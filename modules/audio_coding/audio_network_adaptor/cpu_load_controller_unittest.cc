@@ -0,0 +1,149 @@
+/*
+ *  Copyright 2025 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "modules/audio_coding/audio_network_adaptor/cpu_load_controller.h"
+
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "test/gtest.h"
+
+namespace webrtc {
+
+namespace {
+
+constexpr int kInitialFrameLengthMs = 20;
+const std::vector<int> kEncoderFrameLengthsMs = {10, 20, 40, 60, 120};
+
+// Encode times per 20 ms frame.
+constexpr int kOveruseEncodeTimeUs = 4000;
+constexpr int kNormalEncodeTimeUs = 1500;
+constexpr int kUnderuseEncodeTimeUs = 500;
+
+CpuLoadController::Config CreateConfig() {
+  CpuLoadController::Config config;
+  config.max_complexity = 9;
+  config.min_complexity = 5;
+  config.complexity_step = 2;
+  config.max_frame_length_ms = 60;
+  config.num_overuse_updates_to_step_down = 2;
+  config.num_underuse_updates_to_step_up = 3;
+  return config;
+}
+
+std::unique_ptr<CpuLoadController> CreateController() {
+  return std::make_unique<CpuLoadController>(
+      CreateConfig(), kEncoderFrameLengthsMs, kInitialFrameLengthMs);
+}
+
+void UpdateCpuLoad(CpuLoadController* controller,
+                   std::optional<int> encode_time_per_frame_us,
+                   std::optional<float> process_cpu_usage,
+                   int num_updates) {
+  Controller::NetworkMetrics network_metrics;
+  network_metrics.encode_time_per_frame_us = encode_time_per_frame_us;
+  network_metrics.process_cpu_usage = process_cpu_usage;
+  for (int i = 0; i < num_updates; ++i) {
+    controller->UpdateNetworkMetrics(network_metrics);
+  }
+}
+
+void CheckDecision(CpuLoadController* controller,
+                   std::optional<int> decided_frame_length_ms,
+                   int expected_complexity,
+                   std::optional<int> expected_frame_length_ms) {
+  AudioEncoderRuntimeConfig config;
+  config.frame_length_ms = decided_frame_length_ms;
+  controller->MakeDecision(&config);
+  EXPECT_EQ(expected_complexity, config.complexity);
+  EXPECT_EQ(expected_frame_length_ms, config.frame_length_ms);
+}
+
+}  // namespace
+
+TEST(CpuLoadControllerTest, OutputMaxComplexityWhenLoadUnknown) {
+  auto controller = CreateController();
+  CheckDecision(controller.get(), std::nullopt, 9, std::nullopt);
+  CheckDecision(controller.get(), 40, 9, 40);
+}
+
+TEST(CpuLoadControllerTest, IgnoreNetworkMetrics) {
+  auto controller = CreateController();
+  Controller::NetworkMetrics network_metrics;
+  network_metrics.uplink_bandwidth_bps = 10000;
+  for (int i = 0; i < 10; ++i) {
+    controller->UpdateNetworkMetrics(network_metrics);
+  }
+  CheckDecision(controller.get(), std::nullopt, 9, std::nullopt);
+}
+
+TEST(CpuLoadControllerTest, LowerComplexityAfterConsecutiveOveruse) {
+  auto controller = CreateController();
+  UpdateCpuLoad(controller.get(), kOveruseEncodeTimeUs, std::nullopt, 1);
+  CheckDecision(controller.get(), std::nullopt, 9, std::nullopt);
+  UpdateCpuLoad(controller.get(), kOveruseEncodeTimeUs, std::nullopt, 1);
+  CheckDecision(controller.get(), std::nullopt, 7, std::nullopt);
+}
+
+TEST(CpuLoadControllerTest, NormalLoadResetsOveruse) {
+  auto controller = CreateController();
+  UpdateCpuLoad(controller.get(), kOveruseEncodeTimeUs, std::nullopt, 1);
+  UpdateCpuLoad(controller.get(), kNormalEncodeTimeUs, std::nullopt, 1);
+  UpdateCpuLoad(controller.get(), kOveruseEncodeTimeUs, std::nullopt, 1);
+  CheckDecision(controller.get(), std::nullopt, 9, std::nullopt);
+}
+
+TEST(CpuLoadControllerTest, HighProcessCpuUsageIsOveruse) {
+  auto controller = CreateController();
+  UpdateCpuLoad(controller.get(), kUnderuseEncodeTimeUs, 0.95f, 2);
+  CheckDecision(controller.get(), std::nullopt, 7, std::nullopt);
+}
+
+TEST(CpuLoadControllerTest, RaiseFrameLengthAtMinComplexity) {
+  auto controller = CreateController();
+  // 9 -> 7 -> 5.
+  UpdateCpuLoad(controller.get(), kOveruseEncodeTimeUs, std::nullopt, 4);
+  CheckDecision(controller.get(), kInitialFrameLengthMs, 5,
+                kInitialFrameLengthMs);
+  UpdateCpuLoad(controller.get(), kOveruseEncodeTimeUs, std::nullopt, 2);
+  CheckDecision(controller.get(), kInitialFrameLengthMs, 5, 40);
+  // A longer frame length decided by another controller is kept.
+  CheckDecision(controller.get(), 60, 5, 60);
+  CheckDecision(controller.get(), kInitialFrameLengthMs, 5, 40);
+  // The encode time is relative to the longer frames now.
+  UpdateCpuLoad(controller.get(), 2 * kOveruseEncodeTimeUs, std::nullopt, 2);
+  CheckDecision(controller.get(), kInitialFrameLengthMs, 5, 60);
+  // The frame length is not raised above the maximum.
+  UpdateCpuLoad(controller.get(), 3 * kOveruseEncodeTimeUs, std::nullopt, 10);
+  CheckDecision(controller.get(), kInitialFrameLengthMs, 5, 60);
+}
+
+TEST(CpuLoadControllerTest, RecoverInReverseOrderAfterUnderuse) {
+  auto controller = CreateController();
+  UpdateCpuLoad(controller.get(), kOveruseEncodeTimeUs, std::nullopt, 6);
+  CheckDecision(controller.get(), std::nullopt, 5, 40);
+
+  UpdateCpuLoad(controller.get(), 2 * kUnderuseEncodeTimeUs, 0.2f, 2);
+  CheckDecision(controller.get(), std::nullopt, 5, 40);
+  // The frame length is restored first.
+  UpdateCpuLoad(controller.get(), 2 * kUnderuseEncodeTimeUs, 0.2f, 1);
+  CheckDecision(controller.get(), std::nullopt, 5, kInitialFrameLengthMs);
+  CheckDecision(controller.get(), std::nullopt, 5, std::nullopt);
+  UpdateCpuLoad(controller.get(), kUnderuseEncodeTimeUs, 0.2f, 3);
+  CheckDecision(controller.get(), std::nullopt, 7, std::nullopt);
+  UpdateCpuLoad(controller.get(), kUnderuseEncodeTimeUs, 0.2f, 3);
+  CheckDecision(controller.get(), std::nullopt, 9, std::nullopt);
+  // The complexity is not raised above the maximum.
+  UpdateCpuLoad(controller.get(), kUnderuseEncodeTimeUs, 0.2f, 10);
+  CheckDecision(controller.get(), std::nullopt, 9, std::nullopt);
+}
+
+}  // namespace webrtc
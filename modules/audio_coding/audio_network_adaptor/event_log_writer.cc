@@ -48,6 +48,8 @@ void EventLogWriter::MaybeLogEncoderConfig(
     return LogEncoderConfig(config);
   if (last_logged_config_.frame_length_ms != config.frame_length_ms)
     return LogEncoderConfig(config);
+  if (last_logged_config_.complexity != config.complexity)
+    return LogEncoderConfig(config);
   if ((!last_logged_config_.bitrate_bps && config.bitrate_bps) ||
       (last_logged_config_.bitrate_bps && config.bitrate_bps &&
        std::abs(*last_logged_config_.bitrate_bps - *config.bitrate_bps) >=
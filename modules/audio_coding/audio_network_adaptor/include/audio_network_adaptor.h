@@ -36,6 +36,12 @@ class AudioNetworkAdaptor {
 
   virtual void SetOverhead(size_t overhead_bytes_per_packet) = 0;
 
+  // `encode_time_per_frame_us` is the average time spent encoding a frame,
+  // and `process_cpu_usage` the fraction of all the cores used by the
+  // process, in [0, 1].
+  virtual void SetCpuLoad(int encode_time_per_frame_us,
+                          float process_cpu_usage) = 0;
+
   virtual AudioEncoderRuntimeConfig GetEncoderRuntimeConfig() = 0;
 
   virtual void StartDebugDump(FILE* file_handle) = 0;
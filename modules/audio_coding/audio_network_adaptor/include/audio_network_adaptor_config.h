@@ -36,6 +36,9 @@ struct AudioEncoderRuntimeConfig {
   // to encode.
   std::optional<size_t> num_channels;
 
+  // Highest encoder complexity to use, lowered when the CPU is overloaded.
+  std::optional<int> complexity;
+
   // This is true if the last frame length change was an increase, and otherwise
   // false.
   // The value of this boolean is used to apply a different offset to the
@@ -40,6 +40,11 @@ class MockAudioNetworkAdaptor : public AudioNetworkAdaptor {
               (size_t overhead_bytes_per_packet),
               (override));
 
+  MOCK_METHOD(void,
+              SetCpuLoad,
+              (int encode_time_per_frame_us, float process_cpu_usage),
+              (override));
+
   MOCK_METHOD(AudioEncoderRuntimeConfig,
               GetEncoderRuntimeConfig,
               (),
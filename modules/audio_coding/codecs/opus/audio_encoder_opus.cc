@@ -26,6 +26,7 @@
 #include "modules/audio_coding/codecs/opus/opus_interface.h"
 #include "rtc_base/arraysize.h"
 #include "rtc_base/checks.h"
+#include "rtc_base/cpu_time.h"
 #include "rtc_base/logging.h"
 #include "rtc_base/numerics/exp_filter.h"
 #include "rtc_base/numerics/safe_conversions.h"
@@ -33,6 +34,7 @@
 #include "rtc_base/string_encode.h"
 #include "rtc_base/string_to_number.h"
 #include "rtc_base/time_utils.h"
+#include "system_wrappers/include/cpu_info.h"
 
 namespace webrtc {
 
@@ -70,6 +72,9 @@ constexpr int kOpusSupportedFrameLengths[] = {10, 20, 40, 60};
 constexpr float kAlphaForPacketLossFractionSmoother = 0.9999f;
 constexpr float kMaxPacketLossFraction = 0.2f;
 
+// Interval between the CPU load updates given to the audio network adaptor.
+constexpr int64_t kCpuLoadUpdateIntervalMs = 1000;
+
 int CalculateDefaultBitrate(int max_playback_rate, size_t num_channels) {
   const int bitrate = [&] {
     if (max_playback_rate <= 8000) {
@@ -476,6 +481,10 @@ bool AudioEncoderOpusImpl::EnableAudioNetworkAdaptor(
 
 void AudioEncoderOpusImpl::DisableAudioNetworkAdaptor() {
   audio_network_adaptor_.reset(nullptr);
+  cpu_load_last_update_time_us_.reset();
+  encode_time_us_ = 0;
+  num_encoded_frames_ = 0;
+  SetMaxComplexity(std::nullopt);
 }
 
 void AudioEncoderOpusImpl::OnReceivedUplinkPacketLossFraction(
@@ -583,6 +592,7 @@ AudioEncoder::EncodedInfo AudioEncoderOpusImpl::EncodeImpl(
     rtc::ArrayView<const int16_t> audio,
     rtc::Buffer* encoded) {
   MaybeUpdateUplinkBandwidth();
+  MaybeUpdateCpuLoad();
 
   if (input_buffer_.empty())
     first_timestamp_in_buffer_ = rtp_timestamp;
@@ -599,12 +609,19 @@ AudioEncoder::EncodedInfo AudioEncoderOpusImpl::EncodeImpl(
   EncodedInfo info;
   info.encoded_bytes = encoded->AppendData(
       max_encoded_bytes, [&](rtc::ArrayView<uint8_t> encoded) {
+        // The encode time is only needed by the audio network adaptor.
+        const int64_t start_time_us =
+            audio_network_adaptor_ ? rtc::TimeMicros() : 0;
         int status = WebRtcOpus_Encode(
             inst_, &input_buffer_[0],
             rtc::CheckedDivExact(input_buffer_.size(), config_.num_channels),
             rtc::saturated_cast<int16_t>(max_encoded_bytes), encoded.data());
 
         RTC_CHECK_GE(status, 0);  // Fails only if fed invalid data.
+        if (audio_network_adaptor_) {
+          encode_time_us_ += rtc::TimeMicros() - start_time_us;
+          ++num_encoded_frames_;
+        }
 
         return static_cast<size_t>(status);
       });
@@ -681,7 +698,7 @@ bool AudioEncoderOpusImpl::RecreateEncoderInstance(
   // Use the default complexity if the start bitrate is within the hysteresis
   // window.
   complexity_ = GetNewComplexity(config).value_or(config.complexity);
-  RTC_CHECK_EQ(0, WebRtcOpus_SetComplexity(inst_, complexity_));
+  RTC_CHECK_EQ(0, WebRtcOpus_SetComplexity(inst_, EncoderComplexity()));
   bitrate_changed_ = true;
   if (config.dtx_enabled) {
     RTC_CHECK_EQ(0, WebRtcOpus_EnableDtx(inst_));
@@ -750,10 +767,26 @@ void AudioEncoderOpusImpl::SetTargetBitrate(int bits_per_second) {
   const auto new_complexity = GetNewComplexity(config_);
   if (new_complexity && complexity_ != *new_complexity) {
     complexity_ = *new_complexity;
-    RTC_CHECK_EQ(0, WebRtcOpus_SetComplexity(inst_, complexity_));
+    RTC_CHECK_EQ(0, WebRtcOpus_SetComplexity(inst_, EncoderComplexity()));
+  }
+}
+
+void AudioEncoderOpusImpl::SetMaxComplexity(
+    std::optional<int> max_complexity) {
+  if (max_complexity_ == max_complexity)
+    return;
+  const int old_complexity = EncoderComplexity();
+  max_complexity_ = max_complexity;
+  if (EncoderComplexity() != old_complexity) {
+    RTC_CHECK_EQ(0, WebRtcOpus_SetComplexity(inst_, EncoderComplexity()));
   }
 }
 
+int AudioEncoderOpusImpl::EncoderComplexity() const {
+  return max_complexity_ ? std::min(complexity_, *max_complexity_)
+                         : complexity_;
+}
+
 void AudioEncoderOpusImpl::ApplyAudioNetworkAdaptor() {
   auto config = audio_network_adaptor_->GetEncoderRuntimeConfig();
 
@@ -765,6 +798,8 @@ void AudioEncoderOpusImpl::ApplyAudioNetworkAdaptor() {
     SetDtx(*config.enable_dtx);
   if (config.num_channels)
     SetNumChannelsToEncode(*config.num_channels);
+  if (config.complexity)
+    SetMaxComplexity(*config.complexity);
 }
 
 std::unique_ptr<AudioNetworkAdaptor>
@@ -795,6 +830,37 @@ void AudioEncoderOpusImpl::MaybeUpdateUplinkBandwidth() {
   }
 }
 
+void AudioEncoderOpusImpl::MaybeUpdateCpuLoad() {
+  if (!audio_network_adaptor_)
+    return;
+  const int64_t now_us = rtc::TimeMicros();
+  if (!cpu_load_last_update_time_us_) {
+    cpu_load_last_update_time_us_ = now_us;
+    cpu_load_last_process_cpu_time_ns_ = rtc::GetProcessCpuTimeNanos();
+    return;
+  }
+  const int64_t elapsed_us = now_us - *cpu_load_last_update_time_us_;
+  if (elapsed_us < kCpuLoadUpdateIntervalMs * rtc::kNumMicrosecsPerMillisec ||
+      num_encoded_frames_ == 0) {
+    return;
+  }
+  // Reading the process CPU time is a system call, so only do it when an
+  // update is due.
+  const int64_t process_cpu_time_ns = rtc::GetProcessCpuTimeNanos();
+  const float process_cpu_usage =
+      (process_cpu_time_ns - cpu_load_last_process_cpu_time_ns_) /
+      (elapsed_us * static_cast<float>(rtc::kNumNanosecsPerMicrosec) *
+       CpuInfo::DetectNumberOfCores());
+  audio_network_adaptor_->SetCpuLoad(
+      rtc::dchecked_cast<int>(encode_time_us_ / num_encoded_frames_),
+      process_cpu_usage);
+  cpu_load_last_update_time_us_ = now_us;
+  cpu_load_last_process_cpu_time_ns_ = process_cpu_time_ns;
+  encode_time_us_ = 0;
+  num_encoded_frames_ = 0;
+  ApplyAudioNetworkAdaptor();
+}
+
 ANAStats AudioEncoderOpusImpl::GetANAStats() const {
   if (audio_network_adaptor_) {
     return audio_network_adaptor_->GetStats();
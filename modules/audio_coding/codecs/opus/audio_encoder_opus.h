@@ -140,6 +140,10 @@ class AudioEncoderOpusImpl final : public AudioEncoder {
   void SetFrameLength(int frame_length_ms);
   void SetNumChannelsToEncode(size_t num_channels_to_encode);
   void SetProjectedPacketLossRate(float fraction);
+  void SetMaxComplexity(std::optional<int> max_complexity);
+  // The complexity set on the encoder, which is `complexity_` limited by the
+  // maximum decided by the audio network adaptor, if any.
+  int EncoderComplexity() const;
 
   void OnReceivedUplinkBandwidth(
       int target_audio_bitrate_bps,
@@ -156,6 +160,9 @@ class AudioEncoderOpusImpl final : public AudioEncoder {
       RtcEventLog* event_log) const;
 
   void MaybeUpdateUplinkBandwidth();
+  // Reports the time spent encoding and the CPU usage of the process to the
+  // audio network adaptor every `kCpuLoadUpdateIntervalMs`.
+  void MaybeUpdateCpuLoad();
 
   AudioEncoderOpusConfig config_;
   const int payload_type_;
@@ -173,12 +180,18 @@ class AudioEncoderOpusImpl final : public AudioEncoder {
   size_t num_channels_to_encode_;
   int next_frame_length_ms_;
   int complexity_;
+  std::optional<int> max_complexity_;
   std::unique_ptr<PacketLossFractionSmoother> packet_loss_fraction_smoother_;
   const AudioNetworkAdaptorCreator audio_network_adaptor_creator_;
   std::unique_ptr<AudioNetworkAdaptor> audio_network_adaptor_;
   std::optional<size_t> overhead_bytes_per_packet_;
   const std::unique_ptr<SmoothingFilter> bitrate_smoother_;
   std::optional<int64_t> bitrate_smoother_last_update_time_;
+  // Encode time and number of frames encoded since the last CPU load update.
+  int64_t encode_time_us_ = 0;
+  int num_encoded_frames_ = 0;
+  std::optional<int64_t> cpu_load_last_update_time_us_;
+  int64_t cpu_load_last_process_cpu_time_ns_ = 0;
 
   friend struct AudioEncoderOpus;
 };
@@ -519,6 +519,38 @@ TEST_P(AudioEncoderOpusTest, UpdateUplinkBandwidthInAudioNetworkAdaptor) {
   }
 }
 
+TEST_P(AudioEncoderOpusTest, UpdateCpuLoadInAudioNetworkAdaptor) {
+  auto states = CreateCodec(sample_rate_hz_, 2);
+  states->encoder->EnableAudioNetworkAdaptor("", nullptr);
+  const size_t opus_rate_khz = rtc::CheckedDivExact(sample_rate_hz_, 1000);
+  const std::vector<int16_t> audio(opus_rate_khz * 10 * 2, 0);
+  rtc::Buffer encoded;
+  // Encode one packet to start measuring.
+  for (int i = 0; i < 2; ++i) {
+    states->encoder->Encode(
+        0, rtc::ArrayView<const int16_t>(audio.data(), audio.size()), &encoded);
+  }
+
+  // Don't update till it is time to update.
+  EXPECT_CALL(*states->mock_audio_network_adaptor, SetCpuLoad).Times(0);
+  states->fake_clock->AdvanceTime(TimeDelta::Millis(999));
+  states->encoder->Encode(
+      0, rtc::ArrayView<const int16_t>(audio.data(), audio.size()), &encoded);
+  ::testing::Mock::VerifyAndClearExpectations(
+      states->mock_audio_network_adaptor);
+
+  // Update when it is time to update, and apply the resulting config.
+  auto config = CreateEncoderRuntimeConfig();
+  config.complexity = 2;
+  EXPECT_CALL(*states->mock_audio_network_adaptor, SetCpuLoad);
+  EXPECT_CALL(*states->mock_audio_network_adaptor, GetEncoderRuntimeConfig())
+      .WillOnce(Return(config));
+  states->fake_clock->AdvanceTime(TimeDelta::Millis(1));
+  states->encoder->Encode(
+      0, rtc::ArrayView<const int16_t>(audio.data(), audio.size()), &encoded);
+  CheckEncoderRuntimeConfig(states->encoder.get(), config);
+}
+
 TEST_P(AudioEncoderOpusTest, EncodeAtMinBitrate) {
   auto states = CreateCodec(sample_rate_hz_, 1);
   constexpr int kNumPacketsToEncode = 2;
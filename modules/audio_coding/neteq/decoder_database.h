@@ -161,6 +161,11 @@ class DecoderDatabase {
   // comfort noise decoder exists.
   virtual ComfortNoiseDecoder* GetActiveCngDecoder() const;
 
+  // Deletes all AudioDecoder and comfort noise decoder objects, keeping the
+  // registered payload types and the active decoders. The objects are created
+  // again when needed.
+  void DropDecoders();
+
   // The following are utility methods: they will look up DecoderInfo through
   // GetDecoderInfo and call the respective method on that info object, if it
   // exists.
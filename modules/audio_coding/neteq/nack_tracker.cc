@@ -11,7 +11,6 @@
 #include "modules/audio_coding/neteq/nack_tracker.h"
 
 #include <cstdint>
-#include <utility>
 
 #include "api/field_trials_view.h"
 #include "rtc_base/checks.h"
@@ -53,6 +52,7 @@ NackTracker::NackTracker(const FieldTrialsView& field_trials)
       timestamp_last_decoded_rtp_(0),
       any_rtp_decoded_(false),
       sample_rate_khz_(kDefaultSampleRateKhz),
+      nack_list_(kNackListSizeLimit),
       max_nack_list_size_(kNackListSizeLimit) {}
 
 NackTracker::~NackTracker() = default;
@@ -83,7 +83,7 @@ void NackTracker::UpdateLastReceivedPacket(uint16_t sequence_number,
     return;
 
   // Received RTP should not be in the list.
-  nack_list_.erase(sequence_number);
+  nack_list_.Erase(sequence_number);
 
   // If this is an old sequence number, no more action is required, return.
   if (IsNewerSequenceNumber(sequence_num_last_received_rtp_, sequence_number))
@@ -131,11 +131,16 @@ void NackTracker::UpdateList(uint16_t sequence_number_current_received_rtp,
     return;
   }
 
-  for (uint16_t n = sequence_num_last_received_rtp_ + 1;
-       IsNewerSequenceNumber(sequence_number_current_received_rtp, n); ++n) {
+  uint16_t n = sequence_num_last_received_rtp_ + 1;
+  // Older packets would be removed again by LimitNackListSize().
+  uint16_t oldest = sequence_number_current_received_rtp -
+                    static_cast<uint16_t>(max_nack_list_size_);
+  if (IsNewerSequenceNumber(oldest, n)) {
+    n = oldest;
+  }
+  for (; IsNewerSequenceNumber(sequence_number_current_received_rtp, n); ++n) {
     uint32_t timestamp = EstimateTimestamp(n, *samples_per_packet);
-    NackElement nack_element(TimeToPlay(timestamp), timestamp);
-    nack_list_.insert(nack_list_.end(), std::make_pair(n, nack_element));
+    nack_list_.Insert(n, NackElement(TimeToPlay(timestamp), timestamp));
   }
 }
 
@@ -153,22 +158,25 @@ void NackTracker::UpdateLastDecodedPacket(uint16_t sequence_number,
   // Packets in the list with sequence numbers less than the
   // sequence number of the decoded RTP should be removed from the lists.
   // They will be discarded by the jitter buffer if they arrive.
-  nack_list_.erase(nack_list_.begin(),
-                   nack_list_.upper_bound(sequence_num_last_decoded_rtp_));
+  nack_list_.EraseBefore(sequence_num_last_decoded_rtp_ + 1);
 
   // Update estimated time-to-play.
-  for (NackList::iterator it = nack_list_.begin(); it != nack_list_.end();
-       ++it) {
-    it->second.time_to_play_ms = TimeToPlay(it->second.estimated_timestamp);
-  }
+  nack_list_.ForEach([&](uint16_t /* sequence_number */, NackElement& element) {
+    element.time_to_play_ms = TimeToPlay(element.estimated_timestamp);
+  });
 }
 
 NackTracker::NackList NackTracker::GetNackList() const {
-  return nack_list_;
+  NackList nack_list;
+  nack_list_.ForEach(
+      [&](uint16_t sequence_number, const NackElement& element) {
+        nack_list.emplace_hint(nack_list.end(), sequence_number, element);
+      });
+  return nack_list;
 }
 
 void NackTracker::Reset() {
-  nack_list_.clear();
+  nack_list_.Clear();
 
   sequence_num_last_received_rtp_ = 0;
   timestamp_last_received_rtp_ = 0;
@@ -190,9 +198,8 @@ void NackTracker::SetMaxNackListSize(size_t max_nack_list_size) {
 }
 
 void NackTracker::LimitNackListSize() {
-  uint16_t limit = sequence_num_last_received_rtp_ -
-                   static_cast<uint16_t>(max_nack_list_size_) - 1;
-  nack_list_.erase(nack_list_.begin(), nack_list_.upper_bound(limit));
+  nack_list_.EraseBefore(sequence_num_last_received_rtp_ -
+                         static_cast<uint16_t>(max_nack_list_size_));
 }
 
 int64_t NackTracker::TimeToPlay(uint32_t timestamp) const {
@@ -219,17 +226,16 @@ std::vector<uint16_t> NackTracker::GetNackList(int64_t round_trip_time_ms) {
   // here.
   int max_wait_ms =
       100.0 * config_.ms_per_loss_percent * packet_loss_rate_ / (1 << 30);
-  for (NackList::const_iterator it = nack_list_.begin(); it != nack_list_.end();
-       ++it) {
+  nack_list_.ForEach([&](uint16_t sequence_number, NackElement& element) {
     int64_t time_since_packet_ms =
-        (timestamp_last_received_rtp_ - it->second.estimated_timestamp) /
+        (timestamp_last_received_rtp_ - element.estimated_timestamp) /
         sample_rate_khz_;
-    if (it->second.time_to_play_ms > round_trip_time_ms ||
+    if (element.time_to_play_ms > round_trip_time_ms ||
         time_since_packet_ms + round_trip_time_ms < max_wait_ms)
-      sequence_numbers.push_back(it->first);
-  }
+      sequence_numbers.push_back(sequence_number);
+  });
   if (config_.never_nack_multiple_times) {
-    nack_list_.clear();
+    nack_list_.Clear();
   }
   return sequence_numbers;
 }
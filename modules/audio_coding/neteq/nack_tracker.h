@@ -21,6 +21,7 @@
 #include "api/field_trials_view.h"
 #include "modules/include/module_common_types_public.h"
 #include "rtc_base/gtest_prod_util.h"
+#include "rtc_base/numerics/sequence_number_window.h"
 
 //
 // The NackTracker class keeps track of the lost packets, an estimate of
@@ -118,13 +119,14 @@ class NackTracker {
   };
 
   struct NackElement {
+    NackElement() = default;
     NackElement(int64_t initial_time_to_play_ms, uint32_t initial_timestamp)
         : time_to_play_ms(initial_time_to_play_ms),
           estimated_timestamp(initial_timestamp) {}
 
     // Estimated time (ms) left for this packet to be decoded. This estimate is
     // updated every time jitter buffer decodes a packet.
-    int64_t time_to_play_ms;
+    int64_t time_to_play_ms = 0;
 
     // A guess about the timestamp of the missing packet, it is used for
     // estimation of `time_to_play_ms`. The estimate might be slightly wrong if
@@ -132,7 +134,7 @@ class NackTracker {
     // missing packet. However, the risk of this is low, and in case of such
     // errors, there will be a minor misestimation in time-to-play of missing
     // packets. This will have a very minor effect on NACK performance.
-    uint32_t estimated_timestamp;
+    uint32_t estimated_timestamp = 0;
   };
 
   class NackListCompare {
@@ -146,7 +148,7 @@ class NackTracker {
   typedef std::map<uint16_t, NackElement, NackListCompare> NackList;
 
   // This API is used only for testing to assess whether time-to-play is
-  // computed correctly.
+  // computed correctly. Returns a copy of the NACK list.
   NackList GetNackList() const;
 
   // Returns a valid number of samples per packet given the current received
@@ -192,7 +194,7 @@ class NackTracker {
   // A list of missing packets to be retransmitted. Components of the list
   // contain the sequence number of missing packets and the estimated time that
   // each pack is going to be played out.
-  NackList nack_list_;
+  SequenceNumberWindow<NackElement> nack_list_;
 
   // NACK list will not keep track of missing packets prior to
   // `sequence_num_last_received_rtp_` - `max_nack_list_size_`.
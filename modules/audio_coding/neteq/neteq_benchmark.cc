@@ -0,0 +1,158 @@
+/*
+ *  Copyright 2025 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "api/neteq/tick_timer.h"
+#include "benchmark/benchmark.h"
+#include "common_audio/signal_processing/include/signal_processing_library.h"
+#include "modules/audio_coding/neteq/packet.h"
+#include "modules/audio_coding/neteq/packet_buffer.h"
+#include "modules/audio_coding/neteq/statistics_calculator.h"
+#include "modules/audio_coding/neteq/tools/neteq_performance_test.h"
+#include "rtc_base/checks.h"
+#include "rtc_base/random.h"
+
+namespace webrtc {
+namespace {
+
+constexpr int kRuntimeMs = 10000;
+constexpr double kDriftFactor = 0.1;
+
+// Decodes `kRuntimeMs` of PCM16b audio, dropping one packet out of
+// state.range(0), which makes NetEq conceal the losses and time-stretch to
+// recover the buffer level.
+void BM_NetEqDecodeWithLoss(benchmark::State& state) {
+  const int lossrate = static_cast<int>(state.range(0));
+  for (auto _ : state) {
+    RTC_CHECK_GT(
+        test::NetEqPerformanceTest::Run(kRuntimeMs, lossrate, kDriftFactor),
+        -1);
+  }
+  // One output frame per 10 ms.
+  state.SetItemsProcessed(state.iterations() * kRuntimeMs / 10);
+}
+
+std::vector<int16_t> CreateSignal(size_t length) {
+  Random random(0x1234);
+  std::vector<int16_t> signal(length);
+  for (int16_t& sample : signal) {
+    sample = static_cast<int16_t>(random.Rand(-8000, 8000));
+  }
+  return signal;
+}
+
+// A correlation of the size done on the 4 kHz signal in Expand and
+// TimeStretch. state.range(0) selects the C version (0) or the version used
+// at runtime (1), state.range(1) is the right shift of the products.
+void BM_CrossCorrelation(benchmark::State& state) {
+  constexpr size_t kDimSeq = 60;
+  constexpr size_t kDimCrossCorrelation = 60;
+  const std::vector<int16_t> signal =
+      CreateSignal(kDimSeq + kDimCrossCorrelation);
+  const CrossCorrelation cross_correlation =
+      state.range(0) == 0 ? WebRtcSpl_CrossCorrelationC
+                          : WebRtcSpl_CrossCorrelation;
+  const int right_shifts = static_cast<int>(state.range(1));
+  int32_t correlation[kDimCrossCorrelation];
+  for (auto _ : state) {
+    cross_correlation(correlation, signal.data(), signal.data(), kDimSeq,
+                      kDimCrossCorrelation, right_shifts, 1);
+    benchmark::DoNotOptimize(correlation);
+  }
+}
+
+// The 48 kHz to 4 kHz decimation done by DspHelper::DownsampleTo4kHz.
+void BM_DownsampleFast(benchmark::State& state) {
+  constexpr int16_t kCoefficients[] = {1019, 390, 427, 440, 427, 390, 1019};
+  constexpr size_t kNumCoefficients = 7;
+  constexpr size_t kDelay = 4;
+  constexpr int kFactor = 12;
+  constexpr size_t kOutputLength = 124;
+  const std::vector<int16_t> signal =
+      CreateSignal(kNumCoefficients + kFactor * kOutputLength);
+  const DownsampleFast downsample_fast = state.range(0) == 0
+                                             ? WebRtcSpl_DownsampleFastC
+                                             : WebRtcSpl_DownsampleFast;
+  int16_t output[kOutputLength];
+  for (auto _ : state) {
+    RTC_CHECK_EQ(0, downsample_fast(signal.data(), signal.size(), output,
+                                    kOutputLength, kCoefficients,
+                                    kNumCoefficients, kFactor, kDelay));
+    benchmark::DoNotOptimize(output);
+  }
+}
+
+// Creates the packet with index `n`, with timestamps and sequence numbers
+// wrapping around like those of a long running stream.
+Packet CreatePacket(uint32_t n) {
+  constexpr uint32_t kFrameSizeSamples = 960;
+  constexpr size_t kPayloadSizeBytes = 80;
+  Packet packet;
+  packet.sequence_number = static_cast<uint16_t>(n);
+  packet.timestamp = n * kFrameSizeSamples;
+  packet.payload_type = 0;
+  packet.payload.SetSize(kPayloadSizeBytes);
+  return packet;
+}
+
+// Inserts and extracts one packet per iteration with state.range(0) packets
+// in the buffer. If state.range(1) is 1, every other pair of packets is
+// inserted in reverse order.
+void BM_PacketBufferInsertExtract(benchmark::State& state) {
+  const uint32_t depth = static_cast<uint32_t>(state.range(0));
+  const bool reorder = state.range(1) == 1;
+  TickTimer tick_timer;
+  StatisticsCalculator stats(&tick_timer);
+  PacketBuffer buffer(depth + 2, &tick_timer, &stats);
+  uint32_t n = 0;
+  for (; n < depth; ++n) {
+    buffer.InsertPacket(CreatePacket(n));
+  }
+  for (auto _ : state) {
+    const uint32_t insert_n = reorder && n % 4 >= 2 ? n ^ 1 : n;
+    ++n;
+    RTC_CHECK_EQ(PacketBuffer::kOK,
+                 buffer.InsertPacket(CreatePacket(insert_n)));
+    if (buffer.NumPacketsInBuffer() > depth) {
+      std::optional<Packet> packet = buffer.GetNextPacket();
+      benchmark::DoNotOptimize(packet);
+    }
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(BM_NetEqDecodeWithLoss)
+    ->Arg(0)
+    ->Arg(10)
+    ->Arg(3)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_CrossCorrelation)->ArgsProduct({{0, 1}, {0, 2}});
+BENCHMARK(BM_DownsampleFast)->Arg(0)->Arg(1);
+BENCHMARK(BM_PacketBufferInsertExtract)
+    ->ArgsProduct({{1, 10, 50, 200}, {0, 1}});
+
+}  // namespace
+}  // namespace webrtc
+
+/*
+
+BM_NetEqDecodeWithLoss takes the packet loss rate as argument, dropping one
+packet out of N; 0 means no loss. The kernel benchmarks take 0 for the C
+version and 1 for the version selected at runtime. BM_PacketBufferInsertExtract
+takes the number of buffered packets and whether packets are reordered. Run
+with:
+
+  out/Default/benchmarks --benchmark_filter=NetEq\|CrossCorrelation\|Downsample\|PacketBuffer
+*/
@@ -159,6 +159,7 @@ NetEqImpl::NetEqImpl(const NetEq::Config& config,
       enable_fast_accelerate_(config.enable_fast_accelerate),
       nack_enabled_(false),
       enable_muted_state_(config.enable_muted_state),
+      inactive_stream_timeout_ms_(config.inactive_stream_timeout_ms),
       no_time_stretching_(config.for_test_no_time_stretching) {
   RTC_LOG(LS_INFO) << "NetEq config: " << config.ToString();
   int fs = config.sample_rate_hz;
@@ -212,6 +213,9 @@ int NetEqImpl::GetAudio(AudioFrame* audio_frame,
   if (GetAudioInternal(audio_frame, action_override) != 0) {
     return kFail;
   }
+  if (inactive_stream_timeout_ms_) {
+    MaybeEnterInactiveState();
+  }
   stats_->IncreaseCounter(output_size_samples_, fs_hz_);
   RTC_DCHECK_EQ(
       audio_frame->sample_rate_hz_,
@@ -462,6 +466,25 @@ int NetEqImpl::InsertPacketInternal(const RTPHeader& rtp_header,
   }
   stats_->ReceivedPacket();
 
+  if (inactive_) {
+    // DTX and comfort noise packets do not wake up an inactive stream. Opus
+    // DTX packets are at most 2 bytes long, see OpusFrame::IsDtxPacket().
+    constexpr size_t kMaxOpusDtxPacketSizeBytes = 2;
+    const DecoderDatabase::DecoderInfo* decoder_info =
+        decoder_database_->GetDecoderInfo(rtp_header.payloadType);
+    const bool is_opus_dtx = payload.size() <= kMaxOpusDtxPacketSizeBytes &&
+                             decoder_info && decoder_info->IsType("opus");
+    if (is_opus_dtx ||
+        decoder_database_->IsComfortNoise(rtp_header.payloadType)) {
+      if (nack_enabled_) {
+        nack_->UpdateLastReceivedPacket(rtp_header.sequenceNumber,
+                                        rtp_header.timestamp);
+      }
+      return 0;
+    }
+    LeaveInactiveState();
+  }
+
   PacketList packet_list;
   // Insert packet in a packet list.
   packet_list.push_back([&rtp_header, &payload] {
@@ -746,25 +769,17 @@ int NetEqImpl::GetAudioInternal(AudioFrame* audio_frame,
   last_decoded_packet_infos_.clear();
   tick_timer_->Increment();
 
+  if (inactive_) {
+    return OutputMutedFrame(audio_frame);
+  }
+
   // Check for muted state.
   if (enable_muted_state_ && expand_->Muted() && packet_buffer_->Empty()) {
     RTC_DCHECK_EQ(last_mode_, Mode::kExpand);
-    audio_frame->Reset();
-    RTC_DCHECK(audio_frame->muted());  // Reset() should mute the frame.
-    playout_timestamp_ += static_cast<uint32_t>(output_size_samples_);
-    audio_frame->sample_rate_hz_ = fs_hz_;
-    // Make sure the total number of samples fits in the AudioFrame.
-    if (output_size_samples_ * sync_buffer_->Channels() >
-        AudioFrame::kMaxDataSizeSamples) {
-      return kSampleUnderrun;
+    const int return_value = OutputMutedFrame(audio_frame);
+    if (return_value != 0) {
+      return return_value;
     }
-    audio_frame->samples_per_channel_ = output_size_samples_;
-    audio_frame->timestamp_ =
-        first_packet_
-            ? 0
-            : timestamp_scaler_->ToExternal(playout_timestamp_) -
-                  static_cast<uint32_t>(audio_frame->samples_per_channel_);
-    audio_frame->num_channels_ = sync_buffer_->Channels();
     stats_->ExpandedNoiseSamples(output_size_samples_, false);
     controller_->NotifyMutedState();
     return 0;
@@ -2076,6 +2091,61 @@ NetEqImpl::OutputType NetEqImpl::LastOutputType() {
   }
 }
 
+int NetEqImpl::OutputMutedFrame(AudioFrame* audio_frame) {
+  audio_frame->Reset();
+  RTC_DCHECK(audio_frame->muted());  // Reset() should mute the frame.
+  playout_timestamp_ += static_cast<uint32_t>(output_size_samples_);
+  audio_frame->sample_rate_hz_ = fs_hz_;
+  // Make sure the total number of samples fits in the AudioFrame.
+  if (output_size_samples_ * sync_buffer_->Channels() >
+      AudioFrame::kMaxDataSizeSamples) {
+    return kSampleUnderrun;
+  }
+  audio_frame->samples_per_channel_ = output_size_samples_;
+  audio_frame->timestamp_ =
+      first_packet_
+          ? 0
+          : timestamp_scaler_->ToExternal(playout_timestamp_) -
+                static_cast<uint32_t>(audio_frame->samples_per_channel_);
+  audio_frame->num_channels_ = sync_buffer_->Channels();
+  return 0;
+}
+
+void NetEqImpl::MaybeEnterInactiveState() {
+  RTC_DCHECK(inactive_stream_timeout_ms_);
+  if (inactive_) {
+    return;
+  }
+  if (LastOutputType() == OutputType::kNormalSpeech) {
+    no_speech_stopwatch_.reset();
+    return;
+  }
+  if (!no_speech_stopwatch_) {
+    no_speech_stopwatch_ = tick_timer_->GetNewStopwatch();
+  }
+  if (no_speech_stopwatch_->ElapsedMs() <
+          static_cast<uint64_t>(*inactive_stream_timeout_ms_) ||
+      !packet_buffer_->Empty() || !dtmf_buffer_->Empty()) {
+    return;
+  }
+  RTC_LOG(LS_INFO) << "No speech for " << no_speech_stopwatch_->ElapsedMs()
+                   << " ms, entering the inactive state.";
+  inactive_ = true;
+  no_speech_stopwatch_.reset();
+  decoder_database_->DropDecoders();
+}
+
+void NetEqImpl::LeaveInactiveState() {
+  RTC_DCHECK(inactive_);
+  RTC_LOG(LS_INFO) << "Leaving the inactive state.";
+  inactive_ = false;
+  packet_buffer_->Flush();
+  sync_buffer_->Flush();
+  sync_buffer_->set_next_index(sync_buffer_->next_index() -
+                               expand_->overlap_length());
+  first_packet_ = true;
+}
+
 NetEqController::PacketArrivedInfo NetEqImpl::ToPacketArrivedInfo(
     const Packet& packet) const {
   const DecoderDatabase::DecoderInfo* dec_info =
@@ -350,6 +350,18 @@ class NetEqImpl : public webrtc::NetEq {
   NetEqController::PacketArrivedInfo ToPacketArrivedInfo(
       const Packet& packet) const RTC_EXCLUSIVE_LOCKS_REQUIRED(mutex_);
 
+  // Writes a muted frame to `audio_frame` and advances the playout timestamp,
+  // without any signal processing.
+  int OutputMutedFrame(AudioFrame* audio_frame)
+      RTC_EXCLUSIVE_LOCKS_REQUIRED(mutex_);
+
+  // Enters the inactive state if no speech has been output for
+  // `inactive_stream_timeout_ms_` and there is nothing left to play out.
+  void MaybeEnterInactiveState() RTC_EXCLUSIVE_LOCKS_REQUIRED(mutex_);
+
+  // Leaves the inactive state. Playout restarts as after FlushBuffers().
+  void LeaveInactiveState() RTC_EXCLUSIVE_LOCKS_REQUIRED(mutex_);
+
   const Environment env_;
 
   mutable Mutex mutex_;
@@ -404,6 +416,11 @@ class NetEqImpl : public webrtc::NetEq {
   std::unique_ptr<NackTracker> nack_ RTC_GUARDED_BY(mutex_);
   bool nack_enabled_ RTC_GUARDED_BY(mutex_);
   const bool enable_muted_state_ RTC_GUARDED_BY(mutex_);
+  const std::optional<int> inactive_stream_timeout_ms_ RTC_GUARDED_BY(mutex_);
+  // Measures the time since speech was last output.
+  std::unique_ptr<TickTimer::Stopwatch> no_speech_stopwatch_
+      RTC_GUARDED_BY(mutex_);
+  bool inactive_ RTC_GUARDED_BY(mutex_) = false;
   std::unique_ptr<TickTimer::Stopwatch> generated_noise_stopwatch_
       RTC_GUARDED_BY(mutex_);
   std::vector<RtpPacketInfo> last_decoded_packet_infos_ RTC_GUARDED_BY(mutex_);
@@ -738,6 +738,60 @@ TEST_F(NetEqDecodingTestWithMutedState, RecoverAfterExtendedCngWithoutPackets) {
   GetAudioUntilNormal();
 }
 
+class NetEqDecodingTestWithInactiveStream
+    : public NetEqDecodingTestWithMutedState {
+ public:
+  NetEqDecodingTestWithInactiveStream() {
+    config_.enable_muted_state = false;
+    config_.inactive_stream_timeout_ms = kInactiveStreamTimeoutMs;
+  }
+
+ protected:
+  static constexpr int kInactiveStreamTimeoutMs = 1000;
+};
+
+// Verifies that NetEq becomes inactive after a long CNG period, stays inactive
+// when given CNG packets, and resumes when given speech.
+TEST_F(NetEqDecodingTestWithInactiveStream, InactiveAfterExtendedCng) {
+  InsertCngPacket(0);
+  GetAudioUntilMuted();
+  EXPECT_GE(counter_ * kTimeStepMs, kInactiveStreamTimeoutMs);
+
+  InsertCngPacket(kSamples * counter_);
+  EXPECT_TRUE(GetAudioReturnMuted());
+
+  InsertPacket(kSamples * counter_);
+  GetAudioUntilNormal();
+}
+
+// Verifies that NetEq becomes inactive after a long expand period and resumes
+// when given speech.
+TEST_F(NetEqDecodingTestWithInactiveStream, InactiveAfterExtendedExpand) {
+  InsertPacket(0);
+  EXPECT_FALSE(GetAudioReturnMuted());
+  GetAudioUntilMuted();
+  EXPECT_GE(counter_ * kTimeStepMs, kInactiveStreamTimeoutMs);
+
+  InsertPacket(kSamples * counter_);
+  GetAudioUntilNormal();
+  EXPECT_FALSE(out_frame_.muted());
+}
+
+// Verifies that small packets only count as DTX for Opus, so a small L16
+// packet resumes an inactive stream.
+TEST_F(NetEqDecodingTestWithInactiveStream, SmallNonOpusPacketResumes) {
+  InsertPacket(0);
+  EXPECT_FALSE(GetAudioReturnMuted());
+  GetAudioUntilMuted();
+
+  // A single L16 sample.
+  const uint8_t payload[2] = {0};
+  RTPHeader rtp_info;
+  PopulateRtpInfo(1, kSamples * counter_, &rtp_info);
+  EXPECT_EQ(0, neteq_->InsertPacket(rtp_info, payload, clock_.CurrentTime()));
+  EXPECT_FALSE(GetAudioReturnMuted());
+}
+
 namespace {
 ::testing::AssertionResult AudioFramesEqualExceptData(const AudioFrame& a,
                                                       const AudioFrame& b) {
@@ -8,17 +8,17 @@
  *  be found in the AUTHORS file in the root of the source tree.
  */
 
-// This is the implementation of the PacketBuffer class. It is mostly based on
-// an STL list. The list is kept sorted at all times so that the next packet to
-// decode is at the beginning of the list.
+// This is the implementation of the PacketBuffer class. The packets are kept
+// sorted in a ring of slots at all times so that the next packet to decode is
+// at the beginning of the ring.
 
 #include "modules/audio_coding/neteq/packet_buffer.h"
 
 #include <algorithm>
-#include <list>
 #include <memory>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #include "api/audio_codecs/audio_decoder.h"
 #include "api/neteq/tick_timer.h"
@@ -31,17 +31,9 @@
 
 namespace webrtc {
 namespace {
-// Predicate used when inserting packets in the buffer list.
-// Operator() returns true when `packet` goes before `new_packet`.
-class NewTimestampIsLarger {
- public:
-  explicit NewTimestampIsLarger(const Packet& new_packet)
-      : new_packet_(new_packet) {}
-  bool operator()(const Packet& packet) { return (new_packet_ >= packet); }
-
- private:
-  const Packet& new_packet_;
-};
+
+// Number of slots allocated for the first packet.
+constexpr size_t kMinNumberOfSlots = 16;
 
 }  // namespace
 
@@ -53,21 +45,20 @@ PacketBuffer::PacketBuffer(size_t max_number_of_packets,
       stats_(stats) {}
 
 // Destructor. All packets in the buffer will be destroyed.
-PacketBuffer::~PacketBuffer() {
-  buffer_.clear();
-}
+PacketBuffer::~PacketBuffer() = default;
 
 // Flush the buffer. All packets in the buffer will be destroyed.
 void PacketBuffer::Flush() {
-  for (auto& p : buffer_) {
-    LogPacketDiscarded(p.priority.codec_level);
+  while (size_ > 0) {
+    LogPacketDiscarded(Front().priority.codec_level);
+    PopFront();
   }
-  buffer_.clear();
+  first_ = 0;
   stats_->FlushedPacketBuffer();
 }
 
 bool PacketBuffer::Empty() const {
-  return buffer_.empty();
+  return size_ == 0;
 }
 
 int PacketBuffer::InsertPacket(Packet&& packet) {
@@ -83,36 +74,38 @@ int PacketBuffer::InsertPacket(Packet&& packet) {
 
   packet.waiting_time = tick_timer_->GetNewStopwatch();
 
-  if (buffer_.size() >= max_number_of_packets_) {
+  if (size_ >= max_number_of_packets_) {
     // Buffer is full.
     Flush();
     return_val = kFlushed;
     RTC_LOG(LS_WARNING) << "Packet buffer flushed.";
   }
 
-  // Get an iterator pointing to the place in the buffer where the new packet
-  // should be inserted. The list is searched from the back, since the most
-  // likely case is that the new packet should be near the end of the list.
-  PacketList::reverse_iterator rit = std::find_if(
-      buffer_.rbegin(), buffer_.rend(), NewTimestampIsLarger(packet));
+  // Find the position in the buffer where the new packet should be inserted.
+  // The buffer is searched from the back, since the most likely case is that
+  // the new packet should be near the end of the buffer.
+  size_t index = size_;
+  while (index > 0 && packet < At(index - 1)) {
+    --index;
+  }
 
-  // The new packet is to be inserted to the right of `rit`. If it has the same
-  // timestamp as `rit`, which has a higher priority, do not insert the new
-  // packet to list.
-  if (rit != buffer_.rend() && packet.timestamp == rit->timestamp) {
+  // The new packet is to be inserted after the packet at `index - 1`. If it
+  // has the same timestamp as that packet, which has a higher priority, do not
+  // insert the new packet to the buffer.
+  if (index > 0 && packet.timestamp == At(index - 1).timestamp) {
     LogPacketDiscarded(packet.priority.codec_level);
     return return_val;
   }
 
-  // The new packet is to be inserted to the left of `it`. If it has the same
-  // timestamp as `it`, which has a lower priority, replace `it` with the new
-  // packet.
-  PacketList::iterator it = rit.base();
-  if (it != buffer_.end() && packet.timestamp == it->timestamp) {
-    LogPacketDiscarded(it->priority.codec_level);
-    it = buffer_.erase(it);
+  // The new packet is to be inserted before the packet at `index`. If it has
+  // the same timestamp as that packet, which has a lower priority, replace it
+  // with the new packet.
+  if (index < size_ && packet.timestamp == At(index).timestamp) {
+    LogPacketDiscarded(At(index).priority.codec_level);
+    At(index) = std::move(packet);
+    return return_val;
   }
-  buffer_.insert(it, std::move(packet));  // Insert the packet at that position.
+  InsertAt(index, std::move(packet));
 
   return return_val;
 }
@@ -124,7 +117,7 @@ int PacketBuffer::NextTimestamp(uint32_t* next_timestamp) const {
   if (!next_timestamp) {
     return kInvalidPointer;
   }
-  *next_timestamp = buffer_.front().timestamp;
+  *next_timestamp = Front().timestamp;
   return kOK;
 }
 
@@ -136,11 +129,10 @@ int PacketBuffer::NextHigherTimestamp(uint32_t timestamp,
   if (!next_timestamp) {
     return kInvalidPointer;
   }
-  PacketList::const_iterator it;
-  for (it = buffer_.begin(); it != buffer_.end(); ++it) {
-    if (it->timestamp >= timestamp) {
+  for (size_t i = 0; i < size_; ++i) {
+    if (At(i).timestamp >= timestamp) {
       // Found a packet matching the search.
-      *next_timestamp = it->timestamp;
+      *next_timestamp = At(i).timestamp;
       return kOK;
     }
   }
@@ -148,7 +140,7 @@ int PacketBuffer::NextHigherTimestamp(uint32_t timestamp,
 }
 
 const Packet* PacketBuffer::PeekNextPacket() const {
-  return buffer_.empty() ? nullptr : &buffer_.front();
+  return Empty() ? nullptr : &Front();
 }
 
 std::optional<Packet> PacketBuffer::GetNextPacket() {
@@ -157,10 +149,10 @@ std::optional<Packet> PacketBuffer::GetNextPacket() {
     return std::nullopt;
   }
 
-  std::optional<Packet> packet(std::move(buffer_.front()));
+  std::optional<Packet> packet(std::move(Front()));
   // Assert that the packet sanity checks in InsertPacket method works.
   RTC_DCHECK(!packet->empty());
-  buffer_.pop_front();
+  PopFront();
 
   return packet;
 }
@@ -170,22 +162,18 @@ int PacketBuffer::DiscardNextPacket() {
     return kBufferEmpty;
   }
   // Assert that the packet sanity checks in InsertPacket method works.
-  const Packet& packet = buffer_.front();
+  const Packet& packet = Front();
   RTC_DCHECK(!packet.empty());
   LogPacketDiscarded(packet.priority.codec_level);
-  buffer_.pop_front();
+  PopFront();
   return kOK;
 }
 
 void PacketBuffer::DiscardOldPackets(uint32_t timestamp_limit,
                                      uint32_t horizon_samples) {
-  buffer_.remove_if([this, timestamp_limit, horizon_samples](const Packet& p) {
-    if (timestamp_limit == p.timestamp ||
-        !IsObsoleteTimestamp(p.timestamp, timestamp_limit, horizon_samples)) {
-      return false;
-    }
-    LogPacketDiscarded(p.priority.codec_level);
-    return true;
+  DiscardIf([timestamp_limit, horizon_samples](const Packet& p) {
+    return timestamp_limit != p.timestamp &&
+           IsObsoleteTimestamp(p.timestamp, timestamp_limit, horizon_samples);
   });
 }
 
@@ -194,23 +182,20 @@ void PacketBuffer::DiscardAllOldPackets(uint32_t timestamp_limit) {
 }
 
 void PacketBuffer::DiscardPacketsWithPayloadType(uint8_t payload_type) {
-  buffer_.remove_if([this, payload_type](const Packet& p) {
-    if (p.payload_type != payload_type) {
-      return false;
-    }
-    LogPacketDiscarded(p.priority.codec_level);
-    return true;
+  DiscardIf([payload_type](const Packet& p) {
+    return p.payload_type == payload_type;
   });
 }
 
 size_t PacketBuffer::NumPacketsInBuffer() const {
-  return buffer_.size();
+  return size_;
 }
 
 size_t PacketBuffer::NumSamplesInBuffer(size_t last_decoded_length) const {
   size_t num_samples = 0;
   size_t last_duration = last_decoded_length;
-  for (const Packet& packet : buffer_) {
+  for (size_t i = 0; i < size_; ++i) {
+    const Packet& packet = At(i);
     if (packet.frame) {
       // TODO(hlundin): Verify that it's fine to count all packets and remove
       // this check.
@@ -230,18 +215,19 @@ size_t PacketBuffer::NumSamplesInBuffer(size_t last_decoded_length) const {
 size_t PacketBuffer::GetSpanSamples(size_t last_decoded_length,
                                     size_t sample_rate,
                                     bool count_waiting_time) const {
-  if (buffer_.size() == 0) {
+  if (Empty()) {
     return 0;
   }
 
-  size_t span = buffer_.back().timestamp - buffer_.front().timestamp;
+  const Packet& back = Back();
+  size_t span = back.timestamp - Front().timestamp;
   size_t waiting_time_samples = rtc::dchecked_cast<size_t>(
-      buffer_.back().waiting_time->ElapsedMs() * (sample_rate / 1000));
+      back.waiting_time->ElapsedMs() * (sample_rate / 1000));
   if (count_waiting_time) {
     span += waiting_time_samples;
-  } else if (buffer_.back().frame && buffer_.back().frame->Duration() > 0) {
-    size_t duration = buffer_.back().frame->Duration();
-    if (buffer_.back().frame->IsDtxPacket()) {
+  } else if (back.frame && back.frame->Duration() > 0) {
+    size_t duration = back.frame->Duration();
+    if (back.frame->IsDtxPacket()) {
       duration = std::max(duration, waiting_time_samples);
     }
     span += duration;
@@ -254,7 +240,8 @@ size_t PacketBuffer::GetSpanSamples(size_t last_decoded_length,
 bool PacketBuffer::ContainsDtxOrCngPacket(
     const DecoderDatabase* decoder_database) const {
   RTC_DCHECK(decoder_database);
-  for (const Packet& packet : buffer_) {
+  for (size_t i = 0; i < size_; ++i) {
+    const Packet& packet = At(i);
     if ((packet.frame && packet.frame->IsDtxPacket()) ||
         decoder_database->IsComfortNoise(packet.payload_type)) {
       return true;
@@ -271,4 +258,57 @@ void PacketBuffer::LogPacketDiscarded(int codec_level) {
   }
 }
 
+void PacketBuffer::PopFront() {
+  RTC_DCHECK_GT(size_, 0);
+  // Release what the packet holds now rather than when its slot is reused.
+  Packet& packet = Front();
+  packet.payload = rtc::Buffer();
+  packet.packet_info.reset();
+  packet.waiting_time.reset();
+  packet.frame.reset();
+  first_ = (first_ + 1) & (slots_.size() - 1);
+  --size_;
+}
+
+void PacketBuffer::InsertAt(size_t index, Packet&& packet) {
+  RTC_DCHECK_LE(index, size_);
+  if (size_ == slots_.size()) {
+    // The ring is full, move the packets to a ring twice as large.
+    std::vector<Packet> slots(std::max(kMinNumberOfSlots, 2 * slots_.size()));
+    for (size_t i = 0; i < size_; ++i) {
+      slots[i] = std::move(At(i));
+    }
+    slots_ = std::move(slots);
+    first_ = 0;
+  }
+  if (index < size_ / 2) {
+    // Closer to the front, shift the packets before `index` one slot back.
+    first_ = (first_ - 1) & (slots_.size() - 1);
+    for (size_t i = 0; i < index; ++i) {
+      At(i) = std::move(At(i + 1));
+    }
+  } else {
+    for (size_t i = size_; i > index; --i) {
+      At(i) = std::move(At(i - 1));
+    }
+  }
+  At(index) = std::move(packet);
+  ++size_;
+}
+
+template <typename Predicate>
+void PacketBuffer::DiscardIf(Predicate predicate) {
+  size_t num_kept = 0;
+  for (size_t i = 0; i < size_; ++i) {
+    Packet& packet = At(i);
+    if (predicate(packet)) {
+      LogPacketDiscarded(packet.priority.codec_level);
+      packet = Packet();
+    } else if (num_kept++ != i) {
+      At(num_kept - 1) = std::move(packet);
+    }
+  }
+  size_ = num_kept;
+}
+
 }  // namespace webrtc
@@ -12,6 +12,7 @@
 #define MODULES_AUDIO_CODING_NETEQ_PACKET_BUFFER_H_
 
 #include <optional>
+#include <vector>
 
 #include "modules/audio_coding/neteq/decoder_database.h"
 #include "modules/audio_coding/neteq/packet.h"
@@ -23,7 +24,10 @@ class DecoderDatabase;
 class StatisticsCalculator;
 class TickTimer;
 
-// This is the actual buffer holding the packets before decoding.
+// This is the actual buffer holding the packets before decoding. The packets
+// are kept sorted in a ring of slots that is only ever grown, so that
+// inserting and extracting packets in the common in-order case moves them
+// without allocating.
 class PacketBuffer {
  public:
   enum BufferReturnCodes {
@@ -135,8 +139,32 @@ class PacketBuffer {
  private:
   void LogPacketDiscarded(int codec_level);
 
+  // Returns the packet at position `index`, counted from the first packet.
+  Packet& At(size_t index) {
+    return slots_[(first_ + index) & (slots_.size() - 1)];
+  }
+  const Packet& At(size_t index) const {
+    return slots_[(first_ + index) & (slots_.size() - 1)];
+  }
+  Packet& Front() { return At(0); }
+  const Packet& Front() const { return At(0); }
+  const Packet& Back() const { return At(size_ - 1); }
+
+  // Removes the first packet, leaving an empty slot behind.
+  void PopFront();
+  // Inserts `packet` before the packet at position `index`.
+  void InsertAt(size_t index, Packet&& packet);
+  // Discards all packets for which `predicate` returns true, keeping the
+  // order of the others.
+  template <typename Predicate>
+  void DiscardIf(Predicate predicate);
+
   size_t max_number_of_packets_;
-  PacketList buffer_;
+  // Ring of packet slots whose size is a power of two. The `size_` packets
+  // start at index `first_`; the other slots hold empty packets.
+  std::vector<Packet> slots_;
+  size_t first_ = 0;
+  size_t size_ = 0;
   const TickTimer* tick_timer_;
   StatisticsCalculator* stats_;
 };
@@ -13,6 +13,7 @@
 #include "modules/audio_coding/neteq/packet_buffer.h"
 
 #include <memory>
+#include <vector>
 
 #include "api/audio_codecs/builtin_audio_decoder_factory.h"
 #include "api/neteq/tick_timer.h"
@@ -363,6 +364,45 @@ TEST(PacketBuffer, Reordering) {
   EXPECT_TRUE(buffer.Empty());
 }
 
+// Inserts blocks of packets in reverse order while extracting fewer packets
+// than inserted, so that the buffer grows and its first packet moves around.
+TEST(PacketBuffer, ReorderingWhileGrowing) {
+  TickTimer tick_timer;
+  StrictMock<MockStatisticsCalculator> mock_stats(&tick_timer);
+  PacketBuffer buffer(100, &tick_timer, &mock_stats);  // 100 packets.
+  const uint32_t ts_increment = 10;
+  const uint32_t start_ts = 0xFFFFFFFF - 50 * ts_increment;
+  PacketGenerator gen(0xFFFF - 50, start_ts, 0, ts_increment);
+  const int payload_len = 10;
+  const int kBlockSize = 8;
+  const int kNumExtractedPerBlock = 5;
+
+  uint32_t next_ts = start_ts;
+  for (int block = 0; block < 25; ++block) {
+    std::vector<Packet> packets;
+    for (int i = 0; i < kBlockSize; ++i) {
+      packets.push_back(gen.NextPacket(payload_len, nullptr));
+    }
+    for (int i = kBlockSize - 1; i >= 0; --i) {
+      EXPECT_EQ(PacketBuffer::kOK, buffer.InsertPacket(std::move(packets[i])));
+    }
+    for (int i = 0; i < kNumExtractedPerBlock; ++i) {
+      const std::optional<Packet> packet = buffer.GetNextPacket();
+      ASSERT_TRUE(packet);
+      EXPECT_EQ(next_ts, packet->timestamp);
+      next_ts += ts_increment;
+    }
+  }
+  EXPECT_EQ(25u * (kBlockSize - kNumExtractedPerBlock),
+            buffer.NumPacketsInBuffer());
+  while (!buffer.Empty()) {
+    const std::optional<Packet> packet = buffer.GetNextPacket();
+    ASSERT_TRUE(packet);
+    EXPECT_EQ(next_ts, packet->timestamp);
+    next_ts += ts_increment;
+  }
+}
+
 TEST(PacketBuffer, Failures) {
   const uint16_t start_seq_no = 17;
   const uint32_t start_ts = 4711;
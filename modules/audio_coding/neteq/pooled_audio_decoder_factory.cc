@@ -0,0 +1,191 @@
+/*
+ *  Copyright 2025 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "modules/audio_coding/neteq/pooled_audio_decoder_factory.h"
+
+#include <limits>
+#include <memory>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "api/audio_codecs/audio_codec_pair_id.h"
+#include "api/audio_codecs/audio_decoder.h"
+#include "api/audio_codecs/audio_format.h"
+#include "api/environment/environment.h"
+#include "api/make_ref_counted.h"
+#include "rtc_base/buffer.h"
+#include "rtc_base/checks.h"
+#include "rtc_base/synchronization/mutex.h"
+#include "rtc_base/thread_annotations.h"
+
+namespace webrtc {
+
+namespace {
+
+class PooledAudioDecoderFactory : public AudioDecoderFactory {
+ public:
+  PooledAudioDecoderFactory(scoped_refptr<AudioDecoderFactory> factory,
+                            size_t max_pooled_decoders)
+      : factory_(std::move(factory)),
+        max_pooled_decoders_(max_pooled_decoders) {
+    RTC_DCHECK(factory_);
+  }
+
+  std::vector<AudioCodecSpec> GetSupportedDecoders() override {
+    return factory_->GetSupportedDecoders();
+  }
+
+  bool IsSupportedDecoder(const SdpAudioFormat& format) override {
+    return factory_->IsSupportedDecoder(format);
+  }
+
+  std::unique_ptr<AudioDecoder> Create(
+      const Environment& env,
+      const SdpAudioFormat& format,
+      std::optional<AudioCodecPairId> codec_pair_id) override;
+
+  // Puts `decoder`, created for `format`, in the pool, or deletes it if the
+  // pool is full.
+  void ReturnDecoder(const SdpAudioFormat& format,
+                     std::unique_ptr<AudioDecoder> decoder);
+
+ private:
+  struct PooledDecoder {
+    SdpAudioFormat format;
+    std::unique_ptr<AudioDecoder> decoder;
+  };
+
+  const scoped_refptr<AudioDecoderFactory> factory_;
+  const size_t max_pooled_decoders_;
+  Mutex mutex_;
+  std::vector<PooledDecoder> pool_ RTC_GUARDED_BY(mutex_);
+};
+
+// Forwards to a decoder owned by the pool, which it gives back to the pool
+// when deleted.
+class PooledAudioDecoder : public AudioDecoder {
+ public:
+  PooledAudioDecoder(scoped_refptr<PooledAudioDecoderFactory> factory,
+                     const SdpAudioFormat& format,
+                     std::unique_ptr<AudioDecoder> decoder)
+      : factory_(std::move(factory)),
+        format_(format),
+        decoder_(std::move(decoder)) {}
+
+  ~PooledAudioDecoder() override {
+    factory_->ReturnDecoder(format_, std::move(decoder_));
+  }
+
+  std::vector<ParseResult> ParsePayload(rtc::Buffer&& payload,
+                                        uint32_t timestamp) override {
+    return decoder_->ParsePayload(std::move(payload), timestamp);
+  }
+  bool HasDecodePlc() const override { return decoder_->HasDecodePlc(); }
+  size_t DecodePlc(size_t num_frames, int16_t* decoded) override {
+    return decoder_->DecodePlc(num_frames, decoded);
+  }
+  void GeneratePlc(size_t requested_samples_per_channel,
+                   rtc::BufferT<int16_t>* concealment_audio) override {
+    decoder_->GeneratePlc(requested_samples_per_channel, concealment_audio);
+  }
+  void Reset() override { decoder_->Reset(); }
+  int ErrorCode() override { return decoder_->ErrorCode(); }
+  int PacketDuration(const uint8_t* encoded,
+                     size_t encoded_len) const override {
+    return decoder_->PacketDuration(encoded, encoded_len);
+  }
+  int PacketDurationRedundant(const uint8_t* encoded,
+                              size_t encoded_len) const override {
+    return decoder_->PacketDurationRedundant(encoded, encoded_len);
+  }
+  bool PacketHasFec(const uint8_t* encoded,
+                    size_t encoded_len) const override {
+    return decoder_->PacketHasFec(encoded, encoded_len);
+  }
+  int SampleRateHz() const override { return decoder_->SampleRateHz(); }
+  size_t Channels() const override { return decoder_->Channels(); }
+
+ protected:
+  // The size of `decoded` has already been checked by Decode() and
+  // DecodeRedundant() of this object.
+  int DecodeInternal(const uint8_t* encoded,
+                     size_t encoded_len,
+                     int sample_rate_hz,
+                     int16_t* decoded,
+                     SpeechType* speech_type) override {
+    return decoder_->Decode(encoded, encoded_len, sample_rate_hz,
+                            std::numeric_limits<size_t>::max(), decoded,
+                            speech_type);
+  }
+  int DecodeRedundantInternal(const uint8_t* encoded,
+                              size_t encoded_len,
+                              int sample_rate_hz,
+                              int16_t* decoded,
+                              SpeechType* speech_type) override {
+    return decoder_->DecodeRedundant(encoded, encoded_len, sample_rate_hz,
+                                     std::numeric_limits<size_t>::max(),
+                                     decoded, speech_type);
+  }
+
+ private:
+  const scoped_refptr<PooledAudioDecoderFactory> factory_;
+  const SdpAudioFormat format_;
+  std::unique_ptr<AudioDecoder> decoder_;
+};
+
+std::unique_ptr<AudioDecoder> PooledAudioDecoderFactory::Create(
+    const Environment& env,
+    const SdpAudioFormat& format,
+    std::optional<AudioCodecPairId> codec_pair_id) {
+  std::unique_ptr<AudioDecoder> decoder;
+  {
+    MutexLock lock(&mutex_);
+    // Take the most recently pooled decoder for the format.
+    for (auto it = pool_.rbegin(); it != pool_.rend(); ++it) {
+      if (it->format == format) {
+        decoder = std::move(it->decoder);
+        pool_.erase(std::next(it).base());
+        break;
+      }
+    }
+  }
+  if (decoder) {
+    decoder->Reset();
+  } else {
+    decoder = factory_->Create(env, format, codec_pair_id);
+    if (!decoder) {
+      return nullptr;
+    }
+  }
+  return std::make_unique<PooledAudioDecoder>(
+      scoped_refptr<PooledAudioDecoderFactory>(this), format,
+      std::move(decoder));
+}
+
+void PooledAudioDecoderFactory::ReturnDecoder(
+    const SdpAudioFormat& format,
+    std::unique_ptr<AudioDecoder> decoder) {
+  MutexLock lock(&mutex_);
+  if (pool_.size() < max_pooled_decoders_) {
+    pool_.push_back({format, std::move(decoder)});
+  }
+}
+
+}  // namespace
+
+scoped_refptr<AudioDecoderFactory> CreatePooledAudioDecoderFactory(
+    scoped_refptr<AudioDecoderFactory> factory,
+    size_t max_pooled_decoders) {
+  return make_ref_counted<PooledAudioDecoderFactory>(std::move(factory),
+                                                     max_pooled_decoders);
+}
+
+}  // namespace webrtc
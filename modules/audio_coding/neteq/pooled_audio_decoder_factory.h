@@ -0,0 +1,38 @@
+/*
+ *  Copyright 2025 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef MODULES_AUDIO_CODING_NETEQ_POOLED_AUDIO_DECODER_FACTORY_H_
+#define MODULES_AUDIO_CODING_NETEQ_POOLED_AUDIO_DECODER_FACTORY_H_
+
+#include <stddef.h>
+
+#include "api/audio_codecs/audio_decoder_factory.h"
+#include "api/scoped_refptr.h"
+
+namespace webrtc {
+
+// Returns a factory that creates decoders with `factory`, and keeps up to
+// `max_pooled_decoders` of them in a pool when they are deleted. The limit is
+// for all formats together, and decoders that are deleted while the pool is
+// full are destroyed. A decoder for a format that is in the pool is taken
+// from it and reset, instead of being created. Sharing the factory between
+// receive streams that delete their decoders while inactive, see
+// NetEq::Config::inactive_stream_timeout_ms, lets the streams share a few
+// decoders instead of allocating one each time they become active.
+// Pooled decoders are reused regardless of the codec pair ID they were created
+// with, so `factory` must create decoders that do not depend on it, which is
+// the case of the built-in decoders.
+scoped_refptr<AudioDecoderFactory> CreatePooledAudioDecoderFactory(
+    scoped_refptr<AudioDecoderFactory> factory,
+    size_t max_pooled_decoders);
+
+}  // namespace webrtc
+
+#endif  // MODULES_AUDIO_CODING_NETEQ_POOLED_AUDIO_DECODER_FACTORY_H_
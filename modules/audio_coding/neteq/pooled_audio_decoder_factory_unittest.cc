@@ -0,0 +1,185 @@
+/*
+ *  Copyright 2025 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "modules/audio_coding/neteq/pooled_audio_decoder_factory.h"
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+
+#include "api/audio/audio_frame.h"
+#include "api/audio_codecs/audio_codec_pair_id.h"
+#include "api/audio_codecs/audio_format.h"
+#include "api/audio_codecs/builtin_audio_decoder_factory.h"
+#include "api/environment/environment.h"
+#include "api/environment/environment_factory.h"
+#include "api/make_ref_counted.h"
+#include "api/neteq/default_neteq_factory.h"
+#include "api/neteq/neteq.h"
+#include "api/rtp_headers.h"
+#include "api/units/timestamp.h"
+#include "system_wrappers/include/clock.h"
+#include "test/gmock.h"
+#include "test/gtest.h"
+#include "test/mock_audio_decoder.h"
+#include "test/mock_audio_decoder_factory.h"
+
+namespace webrtc {
+namespace {
+
+using ::testing::_;
+using ::testing::ByMove;
+using ::testing::Return;
+
+const SdpAudioFormat kOpusFormat("opus", 48000, 2);
+const SdpAudioFormat kPcmuFormat("pcmu", 8000, 1);
+
+TEST(PooledAudioDecoderFactoryTest, ReusesDeletedDecoder) {
+  const Environment env = CreateEnvironment();
+  auto factory = make_ref_counted<MockAudioDecoderFactory>();
+  auto decoder = std::make_unique<MockAudioDecoder>();
+  MockAudioDecoder* decoder_ptr = decoder.get();
+  EXPECT_CALL(*factory, Create(_, kOpusFormat, _))
+      .WillOnce(Return(ByMove(std::move(decoder))));
+  auto pooled_factory = CreatePooledAudioDecoderFactory(factory, 1);
+
+  auto pooled_decoder =
+      pooled_factory->Create(env, kOpusFormat, /*codec_pair_id=*/std::nullopt);
+  ASSERT_TRUE(pooled_decoder);
+  EXPECT_CALL(*decoder_ptr, SampleRateHz).WillRepeatedly(Return(48000));
+  EXPECT_EQ(pooled_decoder->SampleRateHz(), 48000);
+  pooled_decoder.reset();
+
+  // The decoder is reset instead of being created again.
+  EXPECT_CALL(*decoder_ptr, Reset);
+  pooled_decoder =
+      pooled_factory->Create(env, kOpusFormat, /*codec_pair_id=*/std::nullopt);
+  ASSERT_TRUE(pooled_decoder);
+  EXPECT_EQ(pooled_decoder->SampleRateHz(), 48000);
+
+  EXPECT_CALL(*decoder_ptr, Die);
+  pooled_decoder.reset();
+  pooled_factory = nullptr;
+}
+
+TEST(PooledAudioDecoderFactoryTest, DoesNotReuseDecoderForOtherFormat) {
+  const Environment env = CreateEnvironment();
+  auto factory = make_ref_counted<MockAudioDecoderFactory>();
+  auto opus_decoder = std::make_unique<MockAudioDecoder>();
+  EXPECT_CALL(*opus_decoder, Die);
+  EXPECT_CALL(*factory, Create(_, kOpusFormat, _))
+      .WillOnce(Return(ByMove(std::move(opus_decoder))));
+  auto pcmu_decoder = std::make_unique<MockAudioDecoder>();
+  EXPECT_CALL(*pcmu_decoder, Die);
+  EXPECT_CALL(*factory, Create(_, kPcmuFormat, _))
+      .WillOnce(Return(ByMove(std::move(pcmu_decoder))));
+  auto pooled_factory = CreatePooledAudioDecoderFactory(factory, 1);
+
+  EXPECT_TRUE(
+      pooled_factory->Create(env, kOpusFormat, /*codec_pair_id=*/std::nullopt));
+  EXPECT_TRUE(
+      pooled_factory->Create(env, kPcmuFormat, /*codec_pair_id=*/std::nullopt));
+}
+
+TEST(PooledAudioDecoderFactoryTest, DeletesDecodersWhenPoolIsFull) {
+  const Environment env = CreateEnvironment();
+  auto factory = make_ref_counted<MockAudioDecoderFactory>();
+  auto first_decoder = std::make_unique<MockAudioDecoder>();
+  MockAudioDecoder* first_decoder_ptr = first_decoder.get();
+  auto second_decoder = std::make_unique<MockAudioDecoder>();
+  MockAudioDecoder* second_decoder_ptr = second_decoder.get();
+  EXPECT_CALL(*factory, Create(_, kOpusFormat, _))
+      .WillOnce(Return(ByMove(std::move(first_decoder))))
+      .WillOnce(Return(ByMove(std::move(second_decoder))));
+  auto pooled_factory = CreatePooledAudioDecoderFactory(factory, 1);
+
+  auto first_pooled_decoder =
+      pooled_factory->Create(env, kOpusFormat, /*codec_pair_id=*/std::nullopt);
+  auto second_pooled_decoder =
+      pooled_factory->Create(env, kOpusFormat, /*codec_pair_id=*/std::nullopt);
+  first_pooled_decoder.reset();
+  EXPECT_CALL(*second_decoder_ptr, Die);
+  second_pooled_decoder.reset();
+
+  EXPECT_CALL(*first_decoder_ptr, Die);
+  pooled_factory = nullptr;
+}
+
+// NetEq instances sharing a pooled factory return the decoders of inactive
+// streams to the pool, and the decoders which don't fit in it are deleted.
+TEST(PooledAudioDecoderFactoryTest, InactiveNetEqReleasesDecoderToPool) {
+  constexpr int kPayloadType = 94;
+  constexpr size_t kSamplesPer10Ms = 160;
+  const SdpAudioFormat kL16Format("L16", 16000, 1);
+  SimulatedClock clock(Timestamp::Seconds(1));
+  const Environment env = CreateEnvironment(&clock);
+  auto builtin_factory = CreateBuiltinAudioDecoderFactory();
+  auto factory = make_ref_counted<MockAudioDecoderFactory>();
+  // Without the pool, every stream would create a decoder each time it
+  // becomes active, i.e. 4 times.
+  EXPECT_CALL(*factory, Create(_, kL16Format, _))
+      .Times(3)
+      .WillRepeatedly([&](const Environment& env, const SdpAudioFormat& format,
+                          std::optional<AudioCodecPairId> codec_pair_id) {
+        return builtin_factory->Create(env, format, codec_pair_id);
+      });
+  auto pooled_factory = CreatePooledAudioDecoderFactory(factory, 1);
+
+  NetEq::Config config;
+  config.inactive_stream_timeout_ms = 100;
+  std::unique_ptr<NetEq> streams[2];
+  for (std::unique_ptr<NetEq>& neteq : streams) {
+    neteq = DefaultNetEqFactory().Create(env, config, pooled_factory);
+    ASSERT_TRUE(neteq->RegisterPayloadType(kPayloadType, kL16Format));
+  }
+
+  uint16_t sequence_number = 0;
+  uint32_t timestamp = 0;
+  // Plays out one packet of speech, then runs until the stream is inactive.
+  auto play_until_inactive = [&](NetEq& neteq) {
+    const uint8_t payload[kSamplesPer10Ms * 2] = {0};
+    RTPHeader header;
+    header.payloadType = kPayloadType;
+    header.sequenceNumber = sequence_number++;
+    header.timestamp = timestamp;
+    header.ssrc = 0x1234;
+    timestamp += 1000 * kSamplesPer10Ms;
+    ASSERT_EQ(neteq.InsertPacket(header, payload, clock.CurrentTime()), 0);
+    AudioFrame frame;
+    bool muted = false;
+    ASSERT_EQ(neteq.GetAudio(&frame, &muted), NetEq::kOK);
+    EXPECT_EQ(frame.speech_type_, AudioFrame::kNormalSpeech);
+    for (int i = 0; i < 100 && !muted; ++i) {
+      ASSERT_EQ(neteq.GetAudio(&frame, &muted), NetEq::kOK);
+    }
+    EXPECT_TRUE(muted);
+  };
+
+  // Both streams create a decoder. When they become inactive, the first
+  // decoder goes to the pool, and the second one is deleted.
+  play_until_inactive(*streams[0]);
+  play_until_inactive(*streams[1]);
+  // The first stream to become active again takes the pooled decoder, and
+  // the other one creates a new one.
+  play_until_inactive(*streams[0]);
+  play_until_inactive(*streams[1]);
+}
+
+TEST(PooledAudioDecoderFactoryTest, ReturnsNullForUnsupportedFormat) {
+  const Environment env = CreateEnvironment();
+  auto factory = make_ref_counted<MockAudioDecoderFactory>();
+  EXPECT_CALL(*factory, Create).WillOnce(Return(nullptr));
+  auto pooled_factory = CreatePooledAudioDecoderFactory(factory, 1);
+  EXPECT_FALSE(
+      pooled_factory->Create(env, kOpusFormat, /*codec_pair_id=*/std::nullopt));
+}
+
+}  // namespace
+}  // namespace webrtc
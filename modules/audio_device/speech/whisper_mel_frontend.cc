@@ -0,0 +1,254 @@
+/*
+ *  (c) 2025, wilddolphin2022
+ *  For WebRTCsays.ai project
+ *  https://github.com/wilddolphin2022
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "modules/audio_device/speech/whisper_mel_frontend.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "rtc_base/checks.h"
+
+extern "C" {
+#include "modules/third_party/fft/fft.h"
+}
+
+namespace webrtc {
+
+namespace {
+
+constexpr double kPi = 3.14159265358979323846;
+// Whisper pads the beginning of the audio with its reflection.
+constexpr size_t kReflectionSize = WhisperMelFrontend::kFrameSize / 2;
+// The floor of the mel energies, in log10.
+constexpr float kLogMelFloor = -10.f;
+
+// Mel scale of Slaney's Auditory Toolbox, which librosa uses by default.
+constexpr double kMinLogHz = 1000.0;
+constexpr double kMinLogMel = 15.0;
+constexpr double kHzPerMel = 200.0 / 3.0;
+// log(6.4) / 27.
+constexpr double kLogStep = 0.06875177742094912;
+
+double HzToMel(double hz) {
+  return hz < kMinLogHz ? hz / kHzPerMel
+                        : kMinLogMel + std::log(hz / kMinLogHz) / kLogStep;
+}
+
+double MelToHz(double mel) {
+  return mel < kMinLogMel ? mel * kHzPerMel
+                          : kMinLogHz * std::exp((mel - kMinLogMel) * kLogStep);
+}
+
+// Computes the filter bank of librosa.filters.mel(sr=16000, n_fft=400,
+// n_mels=num_mel_bins), from which the filters in the Whisper models come.
+std::vector<float> ComputeMelFilters(int num_mel_bins) {
+  constexpr size_t kNumBins = WhisperMelFrontend::kNumFftBins;
+  const double max_mel = HzToMel(WhisperMelFrontend::kSampleRateHz / 2.0);
+  std::vector<double> mel_hz(num_mel_bins + 2);
+  for (size_t i = 0; i < mel_hz.size(); ++i) {
+    mel_hz[i] = MelToHz(max_mel * i / (mel_hz.size() - 1));
+  }
+  std::vector<float> filters(num_mel_bins * kNumBins);
+  for (int m = 0; m < num_mel_bins; ++m) {
+    // Slaney-style normalization to constant energy per channel.
+    const double norm = 2.0 / (mel_hz[m + 2] - mel_hz[m]);
+    for (size_t k = 0; k < kNumBins; ++k) {
+      const double hz = static_cast<double>(k) *
+                        WhisperMelFrontend::kSampleRateHz /
+                        WhisperMelFrontend::kFrameSize;
+      const double lower = (hz - mel_hz[m]) / (mel_hz[m + 1] - mel_hz[m]);
+      const double upper =
+          (mel_hz[m + 2] - hz) / (mel_hz[m + 2] - mel_hz[m + 1]);
+      filters[m * kNumBins + k] =
+          static_cast<float>(std::max(0.0, std::min(lower, upper)) * norm);
+    }
+  }
+  return filters;
+}
+
+// Returns the number of frames which do not reach beyond `num_samples`, and
+// whose reflection padding is available.
+size_t NumCompleteFrames(size_t num_samples) {
+  if (num_samples <= kReflectionSize) {
+    return 0;
+  }
+  return (num_samples - kReflectionSize) / WhisperMelFrontend::kHopSize + 1;
+}
+
+}  // namespace
+
+// The mixed-radix FFT handles the 400 samples of the Whisper frames, unlike
+// the power-of-two FFTs used elsewhere. The frame is transformed as a complex
+// sequence, since the FFT gives wrong results for the half size, 200, whose
+// factorization has an odd power of 2.
+struct WhisperMelFrontend::FftState {
+  FFTstr state = {};
+  std::array<double, kFrameSize> re;
+  std::array<double, kFrameSize> im;
+};
+
+WhisperMelFrontend::WhisperMelFrontend(int num_mel_bins)
+    : num_mel_bins_(num_mel_bins),
+      filters_(ComputeMelFilters(num_mel_bins)),
+      fft_(std::make_unique<FftState>()) {
+  RTC_DCHECK_GT(num_mel_bins, 0);
+  // Periodic Hann window, like the one of Whisper.
+  for (size_t i = 0; i < kFrameSize; ++i) {
+    window_[i] = static_cast<float>(0.5 * (1.0 - std::cos(2.0 * kPi * i /
+                                                          kFrameSize)));
+  }
+  // Only the non-zero weights of each filter are used.
+  filter_ranges_.resize(num_mel_bins);
+  for (int m = 0; m < num_mel_bins; ++m) {
+    const float* filter = &filters_[m * kNumFftBins];
+    size_t begin = 0;
+    while (begin < kNumFftBins && filter[begin] == 0.f) {
+      ++begin;
+    }
+    size_t end = kNumFftBins;
+    while (end > begin && filter[end - 1] == 0.f) {
+      --end;
+    }
+    filter_ranges_[m] = {begin, end};
+  }
+  // One minute of speech, which is more than a segment usually has.
+  samples_.reserve(60 * kSampleRateHz);
+  log_mel_.reserve(60 * kSampleRateHz / kHopSize * num_mel_bins);
+}
+
+WhisperMelFrontend::~WhisperMelFrontend() = default;
+
+void WhisperMelFrontend::Reset() {
+  samples_.clear();
+  log_mel_.clear();
+}
+
+void WhisperMelFrontend::Process(rtc::ArrayView<const float> samples) {
+  samples_.insert(samples_.end(), samples.begin(), samples.end());
+  const size_t num_complete_frames = NumCompleteFrames(samples_.size());
+  for (size_t i = num_frames(); i < num_complete_frames; ++i) {
+    log_mel_.resize(log_mel_.size() + num_mel_bins_);
+    ComputeFrame(samples_.size(), i,
+                 &log_mel_[log_mel_.size() - num_mel_bins_]);
+  }
+}
+
+int WhisperMelFrontend::ComputeMel(size_t num_samples,
+                                   std::vector<float>& mel) const {
+  RTC_DCHECK_LE(num_samples, samples_.size());
+  const size_t num_mel_frames = (num_samples + kNumPaddingSamples) / kHopSize;
+  // The frames computed by Process() for the whole segment are also those of
+  // the first `num_samples`, as long as their window does not reach further.
+  const size_t num_reused_frames =
+      std::min(num_frames(), NumCompleteFrames(num_samples));
+  // The frames after them cover the end of the audio and the padding.
+  const size_t num_audio_frames = std::min(
+      num_mel_frames, (num_samples + kReflectionSize - 1) / kHopSize + 1);
+  std::vector<float> tail_log_mel(
+      (std::max(num_audio_frames, num_reused_frames) - num_reused_frames) *
+      num_mel_bins_);
+  for (size_t i = num_reused_frames; i < num_audio_frames; ++i) {
+    ComputeFrame(num_samples, i,
+                 &tail_log_mel[(i - num_reused_frames) * num_mel_bins_]);
+  }
+
+  // Frames entirely made of padding have the floor energy, so they do not
+  // change the maximum.
+  float max_log_mel = kLogMelFloor;
+  for (size_t i = 0; i < num_reused_frames * num_mel_bins_; ++i) {
+    max_log_mel = std::max(max_log_mel, log_mel_[i]);
+  }
+  for (float v : tail_log_mel) {
+    max_log_mel = std::max(max_log_mel, v);
+  }
+  // Like Whisper, clamp to 80 dB below the maximum and normalize.
+  const double min_log_mel = static_cast<double>(max_log_mel) - 8.0;
+  auto normalize = [min_log_mel](float v) {
+    if (v < min_log_mel) {
+      v = static_cast<float>(min_log_mel);
+    }
+    return static_cast<float>((v + 4.0) / 4.0);
+  };
+
+  mel.resize(num_mel_frames * num_mel_bins_);
+  const float padding = normalize(kLogMelFloor);
+  for (int m = 0; m < num_mel_bins_; ++m) {
+    float* row = &mel[m * num_mel_frames];
+    for (size_t i = 0; i < num_reused_frames; ++i) {
+      row[i] = normalize(log_mel_[i * num_mel_bins_ + m]);
+    }
+    for (size_t i = num_reused_frames; i < num_audio_frames; ++i) {
+      row[i] = normalize(
+          tail_log_mel[(i - num_reused_frames) * num_mel_bins_ + m]);
+    }
+    std::fill(row + std::max(num_audio_frames, num_reused_frames),
+              row + num_mel_frames, padding);
+  }
+  return static_cast<int>(num_mel_frames);
+}
+
+int WhisperMelFrontend::NumAudioFrames(size_t num_samples) {
+  return 1 +
+         (static_cast<int>(num_samples) + static_cast<int>(kReflectionSize) -
+          static_cast<int>(kFrameSize)) /
+             static_cast<int>(kHopSize);
+}
+
+float WhisperMelFrontend::PaddedSample(size_t num_samples,
+                                       size_t index) const {
+  if (index < kReflectionSize) {
+    // samples[1], ..., samples[kReflectionSize] in reverse order.
+    index = 2 * kReflectionSize - index;
+  }
+  index -= kReflectionSize;
+  return index < num_samples ? samples_[index] : 0.f;
+}
+
+void WhisperMelFrontend::ComputeFrame(size_t num_samples,
+                                      size_t index,
+                                      float* log_mel) const {
+  const size_t offset = index * kHopSize;
+  if (offset >= kReflectionSize &&
+      offset - kReflectionSize + kFrameSize <= num_samples) {
+    const float* x = &samples_[offset - kReflectionSize];
+    for (size_t n = 0; n < kFrameSize; ++n) {
+      fft_->re[n] = window_[n] * x[n];
+    }
+  } else {
+    for (size_t n = 0; n < kFrameSize; ++n) {
+      fft_->re[n] = window_[n] * PaddedSample(num_samples, offset + n);
+    }
+  }
+  fft_->im.fill(0.0);
+  const int dims[] = {static_cast<int>(kFrameSize)};
+  const int error = WebRtcIsac_Fftns(1, dims, fft_->re.data(), fft_->im.data(),
+                                     /*iSign=*/-1, /*scaling=*/1.0,
+                                     &fft_->state);
+  RTC_DCHECK_EQ(error, 0);
+
+  std::array<double, kNumFftBins> power;
+  for (size_t k = 0; k < kNumFftBins; ++k) {
+    power[k] = fft_->re[k] * fft_->re[k] + fft_->im[k] * fft_->im[k];
+  }
+
+  for (int m = 0; m < num_mel_bins_; ++m) {
+    const float* filter = &filters_[m * kNumFftBins];
+    double sum = 0.0;
+    for (size_t k = filter_ranges_[m].first; k < filter_ranges_[m].second;
+         ++k) {
+      sum += power[k] * filter[k];
+    }
+    log_mel[m] = static_cast<float>(std::log10(std::max(sum, 1e-10)));
+  }
+}
+
+}  // namespace webrtc
@@ -0,0 +1,99 @@
+/*
+ *  (c) 2025, wilddolphin2022
+ *  For WebRTCsays.ai project
+ *  https://github.com/wilddolphin2022
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef AUDIO_DEVICE_WHISPER_MEL_FRONTEND_H_
+#define AUDIO_DEVICE_WHISPER_MEL_FRONTEND_H_
+
+#include <stddef.h>
+
+#include <array>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "api/array_view.h"
+
+namespace webrtc {
+
+// Computes the log-mel spectrogram that Whisper uses as input while the audio
+// of a segment arrives, e.g. 10 ms at a time, instead of all at once when the
+// segment is transcribed. ComputeMel() gives the same spectrogram as
+// whisper_pcm_to_mel() for the same samples, and its output can be passed to
+// whisper_set_mel().
+class WhisperMelFrontend {
+ public:
+  static constexpr int kSampleRateHz = 16000;
+  // Window and hop sizes of the short-time Fourier transform, see
+  // WHISPER_N_FFT and WHISPER_HOP_LENGTH.
+  static constexpr size_t kFrameSize = 400;
+  static constexpr size_t kHopSize = 160;
+  static constexpr size_t kNumFftBins = kFrameSize / 2 + 1;
+  // Whisper appends 30 seconds of silence to the audio.
+  static constexpr size_t kNumPaddingSamples = 30 * kSampleRateHz;
+
+  // `num_mel_bins` is the one of the model, see whisper_model_n_mels(), i.e.
+  // 80, or 128 for the large-v3 models.
+  explicit WhisperMelFrontend(int num_mel_bins);
+  ~WhisperMelFrontend();
+
+  WhisperMelFrontend(const WhisperMelFrontend&) = delete;
+  WhisperMelFrontend& operator=(const WhisperMelFrontend&) = delete;
+
+  int num_mel_bins() const { return num_mel_bins_; }
+  size_t num_samples() const { return samples_.size(); }
+  // Number of frames computed by Process() so far.
+  size_t num_frames() const { return log_mel_.size() / num_mel_bins_; }
+
+  // The mel filter bank, as `num_mel_bins` rows of kNumFftBins weights.
+  rtc::ArrayView<const float> filters() const { return filters_; }
+
+  // Starts a new segment.
+  void Reset();
+
+  // Appends `samples`, in the range [-1, 1], to the segment and computes the
+  // frames whose window is complete.
+  void Process(rtc::ArrayView<const float> samples);
+
+  // Writes the normalized log-mel spectrogram of the first `num_samples`
+  // samples of the segment, followed by the silence padding, to `mel` as
+  // `num_mel_bins` rows of frames. Returns the number of frames per row.
+  int ComputeMel(size_t num_samples, std::vector<float>& mel) const;
+
+  // Returns the number of frames which cover `num_samples`, i.e. without the
+  // silence padding. The transcription of the ComputeMel() output should stop
+  // there, see whisper_full_params::duration_ms.
+  static int NumAudioFrames(size_t num_samples);
+
+ private:
+  struct FftState;
+
+  // Returns the sample at `index` of the padded segment of `num_samples`.
+  float PaddedSample(size_t num_samples, size_t index) const;
+  // Computes the frame starting at `index` * kHopSize in the padded segment
+  // of `num_samples` and writes its log10 mel energies to `log_mel`.
+  void ComputeFrame(size_t num_samples, size_t index, float* log_mel) const;
+
+  const int num_mel_bins_;
+  std::array<float, kFrameSize> window_;
+  std::vector<float> filters_;
+  // The range of the non-zero weights of each filter.
+  std::vector<std::pair<size_t, size_t>> filter_ranges_;
+  std::vector<float> samples_;
+  // The log10 mel energies of the computed frames, one frame after the other.
+  std::vector<float> log_mel_;
+  // Scratch buffers of the FFT, which are used by the const methods too.
+  const std::unique_ptr<FftState> fft_;
+};
+
+}  // namespace webrtc
+
+#endif  // AUDIO_DEVICE_WHISPER_MEL_FRONTEND_H_
@@ -0,0 +1,195 @@
+/*
+ *  (c) 2025, wilddolphin2022
+ *  For WebRTCsays.ai project
+ *  https://github.com/wilddolphin2022
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "modules/audio_device/speech/whisper_mel_frontend.h"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "api/array_view.h"
+#include "rtc_base/random.h"
+#include "test/gtest.h"
+
+namespace webrtc {
+namespace {
+
+constexpr size_t kFrameSize = WhisperMelFrontend::kFrameSize;
+constexpr size_t kHopSize = WhisperMelFrontend::kHopSize;
+constexpr size_t kNumFftBins = WhisperMelFrontend::kNumFftBins;
+constexpr size_t k10MsSamples = WhisperMelFrontend::kSampleRateHz / 100;
+
+// Port of log_mel_spectrogram() of whisper.cpp, with a plain DFT, used as
+// reference for the output of the frontend.
+std::vector<float> WhisperLogMelSpectrogram(const std::vector<float>& samples,
+                                            rtc::ArrayView<const float> filters,
+                                            int num_mel_bins) {
+  constexpr size_t kReflection = kFrameSize / 2;
+  const size_t n = samples.size();
+  std::vector<float> padded(n + WhisperMelFrontend::kNumPaddingSamples +
+                            2 * kReflection);
+  std::copy(samples.begin(), samples.end(), padded.begin() + kReflection);
+  std::reverse_copy(samples.begin() + 1, samples.begin() + 1 + kReflection,
+                    padded.begin());
+  const size_t num_frames = (padded.size() - kFrameSize) / kHopSize;
+
+  std::vector<float> hann(kFrameSize);
+  std::vector<double> cos_table(kFrameSize);
+  std::vector<double> sin_table(kFrameSize);
+  for (size_t i = 0; i < kFrameSize; ++i) {
+    hann[i] = 0.5 * (1.0 - std::cos(2.0 * M_PI * i / kFrameSize));
+    cos_table[i] = std::cos(2.0 * M_PI * i / kFrameSize);
+    sin_table[i] = std::sin(2.0 * M_PI * i / kFrameSize);
+  }
+  std::vector<float> mel(num_mel_bins * num_frames);
+  std::vector<float> frame(kFrameSize);
+  std::vector<double> power(kNumFftBins);
+  for (size_t i = 0; i < num_frames; ++i) {
+    bool silent = true;
+    for (size_t j = 0; j < kFrameSize; ++j) {
+      frame[j] = hann[j] * padded[i * kHopSize + j];
+      silent = silent && frame[j] == 0.f;
+    }
+    for (size_t k = 0; k < kNumFftBins && !silent; ++k) {
+      double re = 0.0;
+      double im = 0.0;
+      for (size_t j = 0; j < kFrameSize; ++j) {
+        re += frame[j] * cos_table[k * j % kFrameSize];
+        im -= frame[j] * sin_table[k * j % kFrameSize];
+      }
+      power[k] = re * re + im * im;
+    }
+    if (silent) {
+      std::fill(power.begin(), power.end(), 0.0);
+    }
+    for (int m = 0; m < num_mel_bins; ++m) {
+      double sum = 0.0;
+      for (size_t k = 0; k < kNumFftBins; ++k) {
+        sum += power[k] * filters[m * kNumFftBins + k];
+      }
+      mel[m * num_frames + i] = std::log10(std::max(sum, 1e-10));
+    }
+  }
+
+  double max_value = -1e20;
+  for (float v : mel) {
+    max_value = std::max(max_value, static_cast<double>(v));
+  }
+  max_value -= 8.0;
+  for (float& v : mel) {
+    if (v < max_value) {
+      v = max_value;
+    }
+    v = (v + 4.0) / 4.0;
+  }
+  return mel;
+}
+
+// Speech-like test signal: a few harmonics with a slowly changing level, and
+// some noise.
+std::vector<float> CreateSignal(size_t num_samples) {
+  Random random(42);
+  std::vector<float> signal(num_samples);
+  for (size_t i = 0; i < num_samples; ++i) {
+    const double t = static_cast<double>(i) / WhisperMelFrontend::kSampleRateHz;
+    const double level = 0.2 * (1.0 + std::sin(2.0 * M_PI * 1.5 * t));
+    signal[i] = level * (std::sin(2.0 * M_PI * 220.0 * t) +
+                         0.5 * std::sin(2.0 * M_PI * 440.0 * t) +
+                         0.25 * std::sin(2.0 * M_PI * 1320.0 * t)) +
+                0.01f * random.Gaussian(0.0, 1.0);
+  }
+  return signal;
+}
+
+void ExpectMelNear(const std::vector<float>& expected,
+                   const std::vector<float>& actual) {
+  ASSERT_EQ(expected.size(), actual.size());
+  for (size_t i = 0; i < expected.size(); ++i) {
+    ASSERT_NEAR(expected[i], actual[i], 1e-4f) << "index " << i;
+  }
+}
+
+TEST(WhisperMelFrontendTest, FiltersMatchLibrosa) {
+  WhisperMelFrontend frontend(/*num_mel_bins=*/80);
+  rtc::ArrayView<const float> filters = frontend.filters();
+  ASSERT_EQ(filters.size(), 80 * kNumFftBins);
+  // librosa.filters.mel(sr=16000, n_fft=400, n_mels=80)[0][:3].
+  EXPECT_EQ(filters[0], 0.f);
+  EXPECT_NEAR(filters[1], 0.02486259f, 1e-7f);
+  EXPECT_EQ(filters[2], 0.f);
+}
+
+class WhisperMelFrontendParametrization
+    : public ::testing::TestWithParam<int> {};
+
+TEST_P(WhisperMelFrontendParametrization, IncrementalMelMatchesWhisper) {
+  const int num_mel_bins = GetParam();
+  const std::vector<float> signal = CreateSignal(130 * k10MsSamples);
+  WhisperMelFrontend frontend(num_mel_bins);
+  for (size_t i = 0; i < signal.size(); i += k10MsSamples) {
+    frontend.Process(
+        rtc::ArrayView<const float>(&signal[i], k10MsSamples));
+  }
+  EXPECT_EQ(frontend.num_samples(), signal.size());
+  EXPECT_GT(frontend.num_frames(), 0u);
+
+  std::vector<float> mel;
+  const int num_frames = frontend.ComputeMel(signal.size(), mel);
+  const std::vector<float> expected =
+      WhisperLogMelSpectrogram(signal, frontend.filters(), num_mel_bins);
+  EXPECT_EQ(static_cast<size_t>(num_frames) * num_mel_bins, expected.size());
+  ExpectMelNear(expected, mel);
+}
+
+TEST_P(WhisperMelFrontendParametrization, PrefixMelMatchesWhisper) {
+  const int num_mel_bins = GetParam();
+  const std::vector<float> signal = CreateSignal(200 * k10MsSamples);
+  WhisperMelFrontend frontend(num_mel_bins);
+  frontend.Process(signal);
+  for (size_t num_samples : {201, 12345}) {
+    SCOPED_TRACE(num_samples);
+    const std::vector<float> prefix(signal.begin(),
+                                    signal.begin() + num_samples);
+    std::vector<float> mel;
+    frontend.ComputeMel(num_samples, mel);
+    ExpectMelNear(
+        WhisperLogMelSpectrogram(prefix, frontend.filters(), num_mel_bins),
+        mel);
+  }
+}
+
+INSTANTIATE_TEST_SUITE_P(WhisperMelFrontendTest,
+                         WhisperMelFrontendParametrization,
+                         ::testing::Values(80, 128));
+
+TEST(WhisperMelFrontendTest, ResetStartsNewSegment) {
+  const std::vector<float> signal = CreateSignal(50 * k10MsSamples);
+  WhisperMelFrontend frontend(/*num_mel_bins=*/80);
+  frontend.Process(CreateSignal(70 * k10MsSamples));
+  frontend.Reset();
+  EXPECT_EQ(frontend.num_samples(), 0u);
+  EXPECT_EQ(frontend.num_frames(), 0u);
+  frontend.Process(signal);
+  std::vector<float> mel;
+  frontend.ComputeMel(signal.size(), mel);
+  ExpectMelNear(WhisperLogMelSpectrogram(signal, frontend.filters(), 80), mel);
+}
+
+TEST(WhisperMelFrontendTest, NumAudioFrames) {
+  // 1 + (n_samples + 200 - 400) / 160, see whisper_pcm_to_mel().
+  EXPECT_EQ(WhisperMelFrontend::NumAudioFrames(16000), 99);
+  EXPECT_EQ(WhisperMelFrontend::NumAudioFrames(16199), 100);
+  EXPECT_EQ(WhisperMelFrontend::NumAudioFrames(16200), 101);
+}
+
+}  // namespace
+}  // namespace webrtc
@@ -45,6 +45,18 @@ WhisperTranscriber::WhisperTranscriber(
         }
     }
 
+    if (_whisperContext) {
+        for (size_t i = 0; i < kNumMelFrontends; ++i) {
+            _melFrontends.push_back(std::make_unique<webrtc::WhisperMelFrontend>(
+                whisper_model_n_mels(_whisperContext)));
+        }
+        _melFrontend = _melFrontends[0].get();
+        webrtc::MutexLock lock(&_freeMelFrontendsMutex);
+        for (size_t i = 1; i < kNumMelFrontends; ++i) {
+            _freeMelFrontends.push_back(_melFrontends[i].get());
+        }
+    }
+
     // Creating task pool
     if(!_task_queue_factory)
         _task_queue_factory = webrtc::CreateDefaultTaskQueueFactory();
@@ -126,6 +138,44 @@ bool WhisperTranscriber::TranscribeAudioNonBlocking(const std::vector<float>& pc
                     << " Min=" << minVal
                     << " Max=" << maxVal;
 
+    const int result = RunWhisper(pcmf32.data(), pcmf32.size(), 0);
+
+    // Reset processing flag
+    _processingActive = false;
+
+    return result == 0;
+}
+
+bool WhisperTranscriber::TranscribeMelNonBlocking(const std::vector<float>& mel, int numFrames, int durationMs) {
+    // Prevent multiple simultaneous processing attempts, which would also
+    // overwrite the spectrogram of the one in progress
+    if (_processingActive.exchange(true)) {
+        RTC_LOG(LS_WARNING) << "Whisper transcription already in progress";
+        return false;
+    }
+
+    if (!_whisperContext) {
+        RTC_LOG(LS_ERROR) << "Whisper context is null during transcription";
+        _processingActive = false;
+        return false;
+    }
+
+    if (whisper_set_mel(_whisperContext, mel.data(), numFrames,
+                        _melFrontends[0]->num_mel_bins()) != 0) {
+        RTC_LOG(LS_ERROR) << "Failed to set the log-mel spectrogram, frames: " << numFrames;
+        _processingActive = false;
+        return false;
+    }
+
+    // No samples, so that whisper_full() uses the spectrogram set above
+    const int result = RunWhisper(nullptr, 0, durationMs);
+
+    _processingActive = false;
+
+    return result == 0;
+}
+
+int WhisperTranscriber::RunWhisper(const float* pcmf32, size_t numSamples, int durationMs) {
     // Prepare Whisper parameters
     whisper_full_params wparams = whisper_full_default_params(WHISPER_SAMPLING_GREEDY);
     
@@ -136,6 +186,8 @@ bool WhisperTranscriber::TranscribeAudioNonBlocking(const std::vector<float>& pc
     wparams.n_threads = std::min(4, static_cast<int>(std::thread::hardware_concurrency()));
     
     wparams.n_max_text_ctx = 64;
+    // Stop at the end of the audio, before the silence padding
+    wparams.duration_ms = durationMs;
  
     // Diagnostic logging before transcription
     RTC_LOG(LS_INFO) << "Preparing Whisper Transcription:"
@@ -144,7 +196,7 @@ bool WhisperTranscriber::TranscribeAudioNonBlocking(const std::vector<float>& pc
 
     if (!_whisperContext) {
         RTC_LOG(LS_ERROR) << "Failed to initialize Whisper model!";
-        return false;
+        return -1;
     }
 
     int result = 0;
@@ -152,8 +204,8 @@ bool WhisperTranscriber::TranscribeAudioNonBlocking(const std::vector<float>& pc
     result = whisper_full(
         _whisperContext,
         wparams, 
-        pcmf32.data(), 
-        pcmf32.size()
+        pcmf32, 
+        static_cast<int>(numSamples)
         );
 
     // Process results
@@ -190,10 +242,7 @@ bool WhisperTranscriber::TranscribeAudioNonBlocking(const std::vector<float>& pc
         RTC_LOG(LS_ERROR) << "Whisper transcription failed. Error code: " << result;
     }
 
-    // Reset processing flag
-    _processingActive = false;
-
-    return result == 0;
+    return result;
 }
 
 bool WhisperTranscriber::RunProcessingThread() {
@@ -407,6 +456,7 @@ void WhisperTranscriber::ProcessAudioBuffer(uint8_t* playoutBuffer, size_t kPlay
         }
         _silentSamplesCount = 0;
         _accumulatedByteBuffer.insert(_accumulatedByteBuffer.end(), currentBuffer.begin(), currentBuffer.end());
+        FeedMelFrontend(int16Buffer.data(), int16Buffer.size());
         _samplesSinceVoiceStart += currentBuffer.size();
         
         // Check if we've reached 10 seconds while speaking
@@ -414,7 +464,7 @@ void WhisperTranscriber::ProcessAudioBuffer(uint8_t* playoutBuffer, size_t kPlay
             RTC_LOG(LS_INFO) << "Pushing " << kTargetSamples/2 
                             << " samples to Whisper queue (continuous speech)";
             
-            if (!_audioBuffer.write(_accumulatedByteBuffer.data(), kTargetSamples)) {
+            if (!PushSegment(kTargetSamples)) {
                 RTC_LOG(LS_WARNING) << "Ring buffer overflow, data lost";
                 handleOverflow();
             }
@@ -428,6 +478,7 @@ void WhisperTranscriber::ProcessAudioBuffer(uint8_t* playoutBuffer, size_t kPlay
                 _accumulatedByteBuffer.clear();
                 _samplesSinceVoiceStart = 0;
             }
+            RestartMelSegment();
         }
     } else {
         _silentSamplesCount += currentBuffer.size();
@@ -444,7 +495,7 @@ void WhisperTranscriber::ProcessAudioBuffer(uint8_t* playoutBuffer, size_t kPlay
                 RTC_LOG(LS_INFO) << "Pushing " << samplesTo/2 
                                 << " samples to Whisper queue (end of speech)";
                 
-                if (!_audioBuffer.write(_accumulatedByteBuffer.data(), samplesTo)) {
+                if (!PushSegment(samplesTo)) {
                     RTC_LOG(LS_WARNING) << "Ring buffer overflow, data lost";
                     handleOverflow();
                 }
@@ -457,12 +508,71 @@ void WhisperTranscriber::ProcessAudioBuffer(uint8_t* playoutBuffer, size_t kPlay
                     _accumulatedByteBuffer.clear();
                     _samplesSinceVoiceStart = 0;
                 }
+                RestartMelSegment();
             }
             _silentSamplesCount = 0;
         }
     }
 }
 
+bool WhisperTranscriber::PushSegment(size_t numBytes) {
+    if (!_melFrontend) {
+        return _audioBuffer.write(_accumulatedByteBuffer.data(), numBytes);
+    }
+
+    // The segment's frontend finishes the spectrogram on the task queue pool,
+    // and a free one gets the audio of the next segment meanwhile. Without a
+    // free frontend transcription is falling behind, so the segment is
+    // dropped as when the ring buffer overflows
+    webrtc::WhisperMelFrontend* segmentFrontend = _melFrontend;
+    {
+        webrtc::MutexLock lock(&_freeMelFrontendsMutex);
+        if (_freeMelFrontends.empty()) {
+            return false;
+        }
+        _melFrontend = _freeMelFrontends.back();
+        _freeMelFrontends.pop_back();
+    }
+
+    const size_t numSamples = numBytes / 2;
+    _task_queue_pool->enqueue([this, segmentFrontend, numSamples]() {
+        // Most of the spectrogram has been computed while the segment arrived,
+        // so only its last frames and the normalization are left
+        std::vector<float> mel;
+        const int numFrames = segmentFrontend->ComputeMel(numSamples, mel);
+        segmentFrontend->Reset();
+        {
+            webrtc::MutexLock lock(&_freeMelFrontendsMutex);
+            _freeMelFrontends.push_back(segmentFrontend);
+        }
+        const int durationMs =
+            webrtc::WhisperMelFrontend::NumAudioFrames(numSamples) * 10;
+        TranscribeMelNonBlocking(mel, numFrames, durationMs);
+    });
+    return true;
+}
+
+void WhisperTranscriber::FeedMelFrontend(const int16_t* samples, size_t numSamples) {
+    if (!_melFrontend) {
+        return;
+    }
+    _melSamples.resize(numSamples);
+    for (size_t i = 0; i < numSamples; ++i) {
+        _melSamples[i] = samples[i] / 32768.0f;
+    }
+    _melFrontend->Process(_melSamples);
+}
+
+void WhisperTranscriber::RestartMelSegment() {
+    if (!_melFrontend) {
+        return;
+    }
+    // The remainder of the accumulated buffer starts the next segment
+    _melFrontend->Reset();
+    FeedMelFrontend(reinterpret_cast<const int16_t*>(_accumulatedByteBuffer.data()),
+                    _accumulatedByteBuffer.size() / 2);
+}
+
 void WhisperTranscriber::handleOverflow() {
     _overflowCount++;
     if(_overflowCount > 10) {
@@ -32,6 +32,7 @@
 #include "api/task_queue/default_task_queue_factory.h"
 
 #include "speech_audio_device.h"
+#include "whisper_mel_frontend.h"
 
 struct whisper_context;
 
@@ -68,7 +69,24 @@ class WhisperTranscriber {
   webrtc::FileWrapper _pcm_file;
   #endif
 
+  // Log-mel spectrogram of the accumulated voice segment, computed as the
+  // audio arrives and handed to Whisper with whisper_set_mel(). _melFrontend
+  // gets the audio of the current segment, while the other frontends finish
+  // the spectrograms of pushed segments on the task queue pool.
+  static constexpr size_t kNumMelFrontends = 3;
+  std::vector<std::unique_ptr<webrtc::WhisperMelFrontend>> _melFrontends;
+  webrtc::WhisperMelFrontend* _melFrontend = nullptr;
+  webrtc::Mutex _freeMelFrontendsMutex;
+  std::vector<webrtc::WhisperMelFrontend*> _freeMelFrontends
+      RTC_GUARDED_BY(_freeMelFrontendsMutex);
+  std::vector<float> _melSamples;
+
   bool TranscribeAudioNonBlocking(const std::vector<float>& pcmf32);
+  bool TranscribeMelNonBlocking(const std::vector<float>& mel, int numFrames, int durationMs);
+  int RunWhisper(const float* pcmf32, size_t numSamples, int durationMs);
+  bool PushSegment(size_t numBytes);
+  void FeedMelFrontend(const int16_t* samples, size_t numSamples);
+  void RestartMelSegment();
   bool RunProcessingThread();
   bool ValidateWhisperModel(const std::string& modelPath);
   bool InitializeWhisperModel(const std::string& modelPath);
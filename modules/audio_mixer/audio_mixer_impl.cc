@@ -13,10 +13,13 @@
 #include <stdint.h>
 
 #include <algorithm>
+#include <cmath>
 #include <iterator>
+#include <optional>
 #include <type_traits>
 #include <utility>
 
+#include "api/audio/audio_view.h"
 #include "modules/audio_mixer/audio_frame_manipulator.h"
 #include "modules/audio_mixer/default_output_rate_calculator.h"
 #include "rtc_base/checks.h"
@@ -32,10 +35,49 @@ struct AudioMixerImpl::SourceStatus {
 
   // A frame that will be passed to audio_source->GetAudioFrameWithInfo.
   AudioFrame audio_frame;
+
+  // The following are only used when mixing the loudest sources.
+  // Power of the audio of the source relative to full scale, with a peak
+  // hold which decays slowly, so that pauses between words do not let other
+  // sources in.
+  float power = 0.f;
+  // Whether the source reports its audio level.
+  bool has_level = false;
+  // Whether the source is among the loudest ones in the current frame.
+  bool is_selected = false;
+  // Whether the audio of the source was mixed in the previous frame.
+  bool is_mixed = false;
 };
 
 namespace {
 
+// Decay of the power of a source per frame, about 20 dB per second.
+constexpr float kPowerDecay = 0.955f;
+// A source replaces a mixed one only when 3 dB louder, to avoid flapping
+// between sources with similar levels.
+constexpr float kMixedSourceHysteresis = 2.f;
+
+float AudioLevelDbovToPower(int level_dbov) {
+  return std::pow(10.f, -0.1f * level_dbov);
+}
+
+float FramePower(const AudioFrame& frame) {
+  if (frame.muted()) {
+    return 0.f;
+  }
+  InterleavedView<const int16_t> data = frame.data_view();
+  float energy = 0.f;
+  for (int16_t sample : data.data()) {
+    energy += static_cast<float>(sample) * sample;
+  }
+  constexpr float kFullScalePower = 32768.f * 32768.f;
+  return energy / (data.size() * kFullScalePower);
+}
+
+void UpdatePower(float power, AudioMixerImpl::SourceStatus& status) {
+  status.power = std::max(power, kPowerDecay * status.power);
+}
+
 std::vector<std::unique_ptr<AudioMixerImpl::SourceStatus>>::const_iterator
 FindSourceInList(
     AudioMixerImpl::Source const* audio_source,
@@ -53,19 +95,25 @@ struct AudioMixerImpl::HelperContainers {
   void resize(size_t size) {
     audio_to_mix.resize(size);
     preferred_rates.resize(size);
+    sources_by_level.resize(size);
   }
 
   std::vector<AudioFrame*> audio_to_mix;
   std::vector<int> preferred_rates;
+  std::vector<SourceStatus*> sources_by_level;
 };
 
 AudioMixerImpl::AudioMixerImpl(
     std::unique_ptr<OutputRateCalculator> output_rate_calculator,
-    bool use_limiter)
+    bool use_limiter,
+    int max_sources_to_mix)
     : output_rate_calculator_(std::move(output_rate_calculator)),
       audio_source_list_(),
       helper_containers_(std::make_unique<HelperContainers>()),
-      frame_combiner_(use_limiter) {}
+      max_sources_to_mix_(max_sources_to_mix),
+      frame_combiner_(use_limiter) {
+  RTC_DCHECK_GE(max_sources_to_mix, 0);
+}
 
 AudioMixerImpl::~AudioMixerImpl() {}
 
@@ -77,9 +125,10 @@ rtc::scoped_refptr<AudioMixerImpl> AudioMixerImpl::Create() {
 
 rtc::scoped_refptr<AudioMixerImpl> AudioMixerImpl::Create(
     std::unique_ptr<OutputRateCalculator> output_rate_calculator,
-    bool use_limiter) {
+    bool use_limiter,
+    int max_sources_to_mix) {
   return rtc::make_ref_counted<AudioMixerImpl>(
-      std::move(output_rate_calculator), use_limiter);
+      std::move(output_rate_calculator), use_limiter, max_sources_to_mix);
 }
 
 void AudioMixerImpl::Mix(size_t number_of_channels,
@@ -100,7 +149,11 @@ void AudioMixerImpl::Mix(size_t number_of_channels,
       rtc::ArrayView<const int>(helper_containers_->preferred_rates.data(),
                                 number_of_streams));
 
-  frame_combiner_.Combine(GetAudioFromSources(output_frequency),
+  const bool mix_loudest_sources =
+      max_sources_to_mix_ > 0 && number_of_streams > max_sources_to_mix_;
+  frame_combiner_.Combine(mix_loudest_sources
+                              ? GetAudioFromLoudestSources(output_frequency)
+                              : GetAudioFromSources(output_frequency),
                           number_of_channels, output_frequency,
                           number_of_streams, audio_frame_for_mixing);
 }
@@ -143,6 +196,81 @@ rtc::ArrayView<AudioFrame* const> AudioMixerImpl::GetAudioFromSources(
         helper_containers_->audio_to_mix[audio_to_mix_count++] =
             &source_and_status->audio_frame;
     }
+    // All the sources are mixed, see GetAudioFromLoudestSources().
+    source_and_status->is_mixed = true;
+  }
+  return rtc::ArrayView<AudioFrame* const>(
+      helper_containers_->audio_to_mix.data(), audio_to_mix_count);
+}
+
+rtc::ArrayView<AudioFrame* const> AudioMixerImpl::GetAudioFromLoudestSources(
+    int output_frequency) {
+  // Select the loudest sources from their levels so far, favoring those
+  // already mixed. The work is linear in the number of sources.
+  std::vector<SourceStatus*>& sources = helper_containers_->sources_by_level;
+  for (size_t i = 0; i < audio_source_list_.size(); ++i) {
+    SourceStatus& status = *audio_source_list_[i];
+    const std::optional<int> level = status.audio_source->AudioLevelDbov();
+    status.has_level = level.has_value();
+    if (level) {
+      UpdatePower(AudioLevelDbovToPower(*level), status);
+    }
+    status.is_selected = false;
+    sources[i] = &status;
+  }
+  auto score = [](const SourceStatus* status) {
+    return status->is_mixed ? kMixedSourceHysteresis * status->power
+                            : status->power;
+  };
+  std::nth_element(sources.begin(), sources.begin() + max_sources_to_mix_ - 1,
+                   sources.begin() + audio_source_list_.size(),
+                   [&score](const SourceStatus* a, const SourceStatus* b) {
+                     return score(a) > score(b);
+                   });
+  for (size_t i = 0; i < max_sources_to_mix_; ++i) {
+    sources[i]->is_selected = true;
+  }
+
+  int audio_to_mix_count = 0;
+  for (auto& source_and_status : audio_source_list_) {
+    SourceStatus& status = *source_and_status;
+    // Audio is needed to mix the source, to ramp it out of the mix, or to
+    // know its level.
+    if (!status.is_selected && !status.is_mixed && status.has_level) {
+      continue;
+    }
+    const auto audio_frame_info = status.audio_source->GetAudioFrameWithInfo(
+        output_frequency, &status.audio_frame);
+    const bool was_mixed = status.is_mixed;
+    status.is_mixed = false;
+    switch (audio_frame_info) {
+      case Source::AudioFrameInfo::kError:
+        RTC_LOG_F(LS_WARNING)
+            << "failed to GetAudioFrameWithInfo() from source";
+        continue;
+      case Source::AudioFrameInfo::kMuted:
+        if (!status.has_level) {
+          UpdatePower(0.f, status);
+        }
+        continue;
+      case Source::AudioFrameInfo::kNormal:
+        break;
+    }
+    if (!status.has_level) {
+      UpdatePower(FramePower(status.audio_frame), status);
+    }
+    if (status.is_selected) {
+      if (!was_mixed) {
+        Ramp(0.f, 1.f, &status.audio_frame);
+      }
+      status.is_mixed = true;
+    } else if (was_mixed) {
+      Ramp(1.f, 0.f, &status.audio_frame);
+    } else {
+      continue;
+    }
+    helper_containers_->audio_to_mix[audio_to_mix_count++] =
+        &status.audio_frame;
   }
   return rtc::ArrayView<AudioFrame* const>(
       helper_containers_->audio_to_mix.data(), audio_to_mix_count);
@@ -35,11 +35,20 @@ class AudioMixerImpl : public AudioMixer {
   // AudioProcessing only accepts 10 ms frames.
   static const int kFrameDurationInMs = 10;
 
+  // Mix all the sources.
+  static constexpr int kDefaultNumberOfMixedAudioSources = 0;
+
   static rtc::scoped_refptr<AudioMixerImpl> Create();
 
+  // With `max_sources_to_mix` > 0, only the loudest sources are mixed, e.g.
+  // the active speakers of a large conference. Their levels are tracked from
+  // Source::AudioLevelDbov() when available, which lets the mixer skip
+  // pulling audio from the sources that are not mixed, and from their audio
+  // otherwise. The sources which enter or leave the mix are ramped in or out.
   static rtc::scoped_refptr<AudioMixerImpl> Create(
       std::unique_ptr<OutputRateCalculator> output_rate_calculator,
-      bool use_limiter);
+      bool use_limiter,
+      int max_sources_to_mix = kDefaultNumberOfMixedAudioSources);
 
   ~AudioMixerImpl() override;
 
@@ -56,7 +65,8 @@ class AudioMixerImpl : public AudioMixer {
 
  protected:
   AudioMixerImpl(std::unique_ptr<OutputRateCalculator> output_rate_calculator,
-                 bool use_limiter);
+                 bool use_limiter,
+                 int max_sources_to_mix = kDefaultNumberOfMixedAudioSources);
 
  private:
   struct HelperContainers;
@@ -67,6 +77,11 @@ class AudioMixerImpl : public AudioMixer {
   rtc::ArrayView<AudioFrame* const> GetAudioFromSources(int output_frequency)
       RTC_EXCLUSIVE_LOCKS_REQUIRED(mutex_);
 
+  // Fetches audio frames from the loudest sources, and from those whose
+  // level is only known from their audio.
+  rtc::ArrayView<AudioFrame* const> GetAudioFromLoudestSources(
+      int output_frequency) RTC_EXCLUSIVE_LOCKS_REQUIRED(mutex_);
+
   // The critical section lock guards audio source insertion and
   // removal, which can be done from any thread. The race checker
   // checks that mixing is done sequentially.
@@ -80,6 +95,9 @@ class AudioMixerImpl : public AudioMixer {
   const std::unique_ptr<HelperContainers> helper_containers_
       RTC_GUARDED_BY(mutex_);
 
+  // The maximum number of sources to mix, 0 for all.
+  const size_t max_sources_to_mix_;
+
   // Component that handles actual adding of audio frames.
   FrameCombiner frame_combiner_;
 
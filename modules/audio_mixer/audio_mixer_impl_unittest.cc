@@ -12,6 +12,7 @@
 
 #include <string.h>
 
+#include <algorithm>
 #include <cstdint>
 #include <limits>
 #include <memory>
@@ -21,6 +22,7 @@
 #include <vector>
 
 #include "api/audio/audio_mixer.h"
+#include "api/audio/audio_view.h"
 #include "api/rtp_packet_info.h"
 #include "api/rtp_packet_infos.h"
 #include "api/units/timestamp.h"
@@ -68,6 +70,22 @@ std::string ProduceDebugText(int sample_rate_hz,
   return ss.Release();
 }
 
+// Fills the frame with a constant, so that the mix of sources is easy to
+// predict when the limiter is disabled.
+void FillFrame(int16_t value, AudioFrame* frame) {
+  ResetFrame(frame);
+  int16_t* data = frame->mutable_data();
+  std::fill(data, data + frame->samples_per_channel_, value);
+}
+
+void ExpectFrameFilledWith(int16_t value, const AudioFrame& frame) {
+  InterleavedView<const int16_t> data = frame.data_view();
+  ASSERT_FALSE(data.empty());
+  for (size_t i = 0; i < data.size(); ++i) {
+    ASSERT_EQ(value, data[i]) << "sample " << i;
+  }
+}
+
 AudioFrame frame_for_mixing;
 
 }  // namespace
@@ -90,6 +108,7 @@ class MockMixerAudioSource : public ::testing::NiceMock<AudioMixer::Source> {
 
   MOCK_METHOD(int, PreferredSampleRate, (), (const, override));
   MOCK_METHOD(int, Ssrc, (), (const, override));
+  MOCK_METHOD(std::optional<int>, AudioLevelDbov, (), (const, override));
 
   AudioFrame* fake_frame() { return &fake_frame_; }
   AudioFrameInfo fake_info() { return fake_audio_frame_info_; }
@@ -479,6 +498,94 @@ TEST(AudioMixer, ShouldIncludeRtpPacketInfoFromAllMixedSources) {
   EXPECT_THAT(frame_for_mixing.packet_infos_, UnorderedElementsAre(p0, p1, p2));
 }
 
+TEST(AudioMixer, MixesOnlyTheLoudestSources) {
+  constexpr int kMaxSourcesToMix = 2;
+  const auto mixer = AudioMixerImpl::Create(
+      std::make_unique<DefaultOutputRateCalculator>(), /*use_limiter=*/false,
+      kMaxSourcesToMix);
+  std::vector<MockMixerAudioSource> sources(4);
+  for (size_t i = 0; i < sources.size(); ++i) {
+    FillFrame(100 * (i + 1), sources[i].fake_frame());
+    EXPECT_TRUE(mixer->AddSource(&sources[i]));
+  }
+
+  // The levels are measured on the audio since the sources do not report
+  // them. Let the sources ramp in and out of the mix.
+  for (int i = 0; i < 5; ++i) {
+    mixer->Mix(1, &frame_for_mixing);
+  }
+  ExpectFrameFilledWith(300 + 400, frame_for_mixing);
+}
+
+TEST(AudioMixer, MixesAllSourcesWhenFewerThanTheMaximum) {
+  const auto mixer = AudioMixerImpl::Create(
+      std::make_unique<DefaultOutputRateCalculator>(), /*use_limiter=*/false,
+      /*max_sources_to_mix=*/3);
+  std::vector<MockMixerAudioSource> sources(3);
+  for (size_t i = 0; i < sources.size(); ++i) {
+    FillFrame(100 * (i + 1), sources[i].fake_frame());
+    EXPECT_TRUE(mixer->AddSource(&sources[i]));
+  }
+  for (int i = 0; i < 2; ++i) {
+    mixer->Mix(1, &frame_for_mixing);
+  }
+  ExpectFrameFilledWith(100 + 200 + 300, frame_for_mixing);
+}
+
+TEST(AudioMixer, DoesNotPullAudioFromQuietSourcesReportingTheirLevel) {
+  const auto mixer = AudioMixerImpl::Create(
+      std::make_unique<DefaultOutputRateCalculator>(), /*use_limiter=*/false,
+      /*max_sources_to_mix=*/1);
+  MockMixerAudioSource loud_source;
+  MockMixerAudioSource quiet_source;
+  FillFrame(1000, loud_source.fake_frame());
+  FillFrame(100, quiet_source.fake_frame());
+  ON_CALL(loud_source, AudioLevelDbov()).WillByDefault(Return(10));
+  ON_CALL(quiet_source, AudioLevelDbov()).WillByDefault(Return(30));
+  EXPECT_TRUE(mixer->AddSource(&loud_source));
+  EXPECT_TRUE(mixer->AddSource(&quiet_source));
+
+  constexpr int kNumFrames = 10;
+  EXPECT_CALL(loud_source, GetAudioFrameWithInfo(_, _)).Times(kNumFrames);
+  EXPECT_CALL(quiet_source, GetAudioFrameWithInfo(_, _)).Times(0);
+  for (int i = 0; i < kNumFrames; ++i) {
+    mixer->Mix(1, &frame_for_mixing);
+  }
+  ExpectFrameFilledWith(1000, frame_for_mixing);
+}
+
+TEST(AudioMixer, SwitchesSourcesOnlyWhenMuchLouder) {
+  const auto mixer = AudioMixerImpl::Create(
+      std::make_unique<DefaultOutputRateCalculator>(), /*use_limiter=*/false,
+      /*max_sources_to_mix=*/1);
+  MockMixerAudioSource mixed_source;
+  MockMixerAudioSource other_source;
+  FillFrame(1000, mixed_source.fake_frame());
+  FillFrame(2000, other_source.fake_frame());
+  ON_CALL(mixed_source, AudioLevelDbov()).WillByDefault(Return(20));
+  ON_CALL(other_source, AudioLevelDbov()).WillByDefault(Return(127));
+  EXPECT_TRUE(mixer->AddSource(&mixed_source));
+  EXPECT_TRUE(mixer->AddSource(&other_source));
+  for (int i = 0; i < 2; ++i) {
+    mixer->Mix(1, &frame_for_mixing);
+  }
+  ExpectFrameFilledWith(1000, frame_for_mixing);
+
+  // Slightly louder than the mixed source is not enough.
+  ON_CALL(other_source, AudioLevelDbov()).WillByDefault(Return(19));
+  for (int i = 0; i < 10; ++i) {
+    mixer->Mix(1, &frame_for_mixing);
+  }
+  ExpectFrameFilledWith(1000, frame_for_mixing);
+
+  // The sources are switched after the mixed one is ramped out.
+  ON_CALL(other_source, AudioLevelDbov()).WillByDefault(Return(10));
+  for (int i = 0; i < 2; ++i) {
+    mixer->Mix(1, &frame_for_mixing);
+  }
+  ExpectFrameFilledWith(2000, frame_for_mixing);
+}
+
 class HighOutputRateCalculator : public OutputRateCalculator {
  public:
   static const int kDefaultFrequency = 76000;
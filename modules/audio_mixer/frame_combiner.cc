@@ -31,8 +31,17 @@
 #include "rtc_base/arraysize.h"
 #include "rtc_base/checks.h"
 #include "rtc_base/numerics/safe_conversions.h"
+#include "rtc_base/system/arch.h"
 #include "system_wrappers/include/metrics.h"
 
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+#include <emmintrin.h>
+
+#include "system_wrappers/include/cpu_features_wrapper.h"
+#elif defined(WEBRTC_HAS_NEON)
+#include <arm_neon.h>
+#endif
+
 namespace webrtc {
 namespace {
 
@@ -86,6 +95,110 @@ void MixFewFramesWithNoLimiter(rtc::ArrayView<const AudioFrame* const> mix_list,
   CopySamples(dst, mix_list[0]->data_view());
 }
 
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+bool Sse2Available() {
+  static const bool available = GetCPUInfo(kSSE2) != 0;
+  return available;
+}
+
+// Converts 4 FloatS16 samples to S16 like FloatS16ToS16().
+__m128i FloatS16ToS16Sse2(__m128 v) {
+  v = _mm_min_ps(v, _mm_set1_ps(32767.f));
+  v = _mm_max_ps(v, _mm_set1_ps(-32768.f));
+  const __m128 half = _mm_or_ps(_mm_and_ps(v, _mm_set1_ps(-0.f)),
+                                _mm_set1_ps(0.5f));
+  return _mm_cvttps_epi32(_mm_add_ps(v, half));
+}
+#elif defined(WEBRTC_HAS_NEON)
+// Converts 4 FloatS16 samples to S16 like FloatS16ToS16().
+int32x4_t FloatS16ToS16Neon(float32x4_t v) {
+  v = vminq_f32(v, vdupq_n_f32(32767.f));
+  v = vmaxq_f32(v, vdupq_n_f32(-32768.f));
+  const float32x4_t half =
+      vbslq_f32(vdupq_n_u32(0x80000000u), v, vdupq_n_f32(0.5f));
+  return vcvtq_s32_f32(vaddq_f32(v, half));
+}
+#endif
+
+// Adds the samples of a mono frame to `channel`. The SIMD versions convert
+// the samples exactly and add them in the same order as the plain C++ code,
+// so that the results are identical.
+void AddMonoFrame(const int16_t* frame_data, MonoView<float> channel) {
+  const size_t samples_per_channel = SamplesPerChannel(channel);
+  float* dst = channel.data();
+  size_t k = 0;
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+  if (Sse2Available()) {
+    for (; k + 8 <= samples_per_channel; k += 8) {
+      const __m128i x = _mm_loadu_si128(
+          reinterpret_cast<const __m128i*>(&frame_data[k]));
+      const __m128i lo = _mm_srai_epi32(_mm_unpacklo_epi16(x, x), 16);
+      const __m128i hi = _mm_srai_epi32(_mm_unpackhi_epi16(x, x), 16);
+      _mm_storeu_ps(&dst[k],
+                    _mm_add_ps(_mm_loadu_ps(&dst[k]), _mm_cvtepi32_ps(lo)));
+      _mm_storeu_ps(&dst[k + 4], _mm_add_ps(_mm_loadu_ps(&dst[k + 4]),
+                                            _mm_cvtepi32_ps(hi)));
+    }
+  }
+#elif defined(WEBRTC_HAS_NEON)
+  for (; k + 8 <= samples_per_channel; k += 8) {
+    const int16x8_t x = vld1q_s16(&frame_data[k]);
+    vst1q_f32(&dst[k],
+              vaddq_f32(vld1q_f32(&dst[k]),
+                        vcvtq_f32_s32(vmovl_s16(vget_low_s16(x)))));
+    vst1q_f32(&dst[k + 4],
+              vaddq_f32(vld1q_f32(&dst[k + 4]),
+                        vcvtq_f32_s32(vmovl_s16(vget_high_s16(x)))));
+  }
+#endif
+  for (; k < samples_per_channel; ++k) {
+    dst[k] += frame_data[k];
+  }
+}
+
+// Adds the samples of an interleaved stereo frame to `left` and `right`.
+void AddStereoFrame(const int16_t* frame_data,
+                    MonoView<float> left,
+                    MonoView<float> right) {
+  const size_t samples_per_channel = SamplesPerChannel(left);
+  float* dst_left = left.data();
+  float* dst_right = right.data();
+  size_t k = 0;
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+  if (Sse2Available()) {
+    for (; k + 4 <= samples_per_channel; k += 4) {
+      // Each 32 bit lane holds a left sample in its low half and a right
+      // sample in its high half.
+      const __m128i x = _mm_loadu_si128(
+          reinterpret_cast<const __m128i*>(&frame_data[2 * k]));
+      const __m128i l = _mm_srai_epi32(_mm_slli_epi32(x, 16), 16);
+      const __m128i r = _mm_srai_epi32(x, 16);
+      _mm_storeu_ps(&dst_left[k], _mm_add_ps(_mm_loadu_ps(&dst_left[k]),
+                                             _mm_cvtepi32_ps(l)));
+      _mm_storeu_ps(&dst_right[k], _mm_add_ps(_mm_loadu_ps(&dst_right[k]),
+                                              _mm_cvtepi32_ps(r)));
+    }
+  }
+#elif defined(WEBRTC_HAS_NEON)
+  for (; k + 8 <= samples_per_channel; k += 8) {
+    const int16x8x2_t x = vld2q_s16(&frame_data[2 * k]);
+    for (int i = 0; i < 2; ++i) {
+      float* dst = i == 0 ? dst_left : dst_right;
+      vst1q_f32(&dst[k],
+                vaddq_f32(vld1q_f32(&dst[k]),
+                          vcvtq_f32_s32(vmovl_s16(vget_low_s16(x.val[i])))));
+      vst1q_f32(&dst[k + 4],
+                vaddq_f32(vld1q_f32(&dst[k + 4]),
+                          vcvtq_f32_s32(vmovl_s16(vget_high_s16(x.val[i])))));
+    }
+  }
+#endif
+  for (; k < samples_per_channel; ++k) {
+    dst_left[k] += frame_data[2 * k];
+    dst_right[k] += frame_data[2 * k + 1];
+  }
+}
+
 void MixToFloatFrame(rtc::ArrayView<const AudioFrame* const> mix_list,
                      DeinterleavedView<float>& mixing_buffer) {
   const size_t number_of_channels = NumChannels(mixing_buffer);
@@ -97,6 +210,15 @@ void MixToFloatFrame(rtc::ArrayView<const AudioFrame* const> mix_list,
   for (size_t i = 0; i < mix_list.size(); ++i) {
     InterleavedView<const int16_t> frame_data = mix_list[i]->data_view();
     RTC_CHECK(!frame_data.empty());
+    if (number_of_channels == 1) {
+      AddMonoFrame(frame_data.data().data(), mixing_buffer[0]);
+      continue;
+    }
+    if (number_of_channels == 2) {
+      AddStereoFrame(frame_data.data().data(), mixing_buffer[0],
+                     mixing_buffer[1]);
+      continue;
+    }
     for (size_t j = 0; j < number_of_channels; ++j) {
       MonoView<float> channel = mixing_buffer[j];
       for (size_t k = 0; k < SamplesPerChannel(channel); ++k) {
@@ -111,15 +233,72 @@ void RunLimiter(DeinterleavedView<float> deinterleaved, Limiter* limiter) {
   limiter->Process(deinterleaved);
 }
 
+// Interleaves and rounds mono and stereo audio, returns the number of samples
+// per channel processed. The remaining ones are left to the caller.
+size_t InterleaveToAudioFrameSimd(DeinterleavedView<float> deinterleaved,
+                                  int16_t* dst) {
+  const size_t num_channels = deinterleaved.num_channels();
+  const size_t samples_per_channel = deinterleaved.samples_per_channel();
+  size_t k = 0;
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+  if (!Sse2Available()) {
+    return 0;
+  }
+  if (num_channels == 1) {
+    const float* src = deinterleaved[0].data();
+    for (; k + 8 <= samples_per_channel; k += 8) {
+      _mm_storeu_si128(
+          reinterpret_cast<__m128i*>(&dst[k]),
+          _mm_packs_epi32(FloatS16ToS16Sse2(_mm_loadu_ps(&src[k])),
+                          FloatS16ToS16Sse2(_mm_loadu_ps(&src[k + 4]))));
+    }
+  } else if (num_channels == 2) {
+    const float* src_left = deinterleaved[0].data();
+    const float* src_right = deinterleaved[1].data();
+    for (; k + 4 <= samples_per_channel; k += 4) {
+      const __m128i l = FloatS16ToS16Sse2(_mm_loadu_ps(&src_left[k]));
+      const __m128i r = FloatS16ToS16Sse2(_mm_loadu_ps(&src_right[k]));
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(&dst[2 * k]),
+                       _mm_packs_epi32(_mm_unpacklo_epi32(l, r),
+                                       _mm_unpackhi_epi32(l, r)));
+    }
+  }
+#elif defined(WEBRTC_HAS_NEON)
+  if (num_channels == 1) {
+    const float* src = deinterleaved[0].data();
+    for (; k + 8 <= samples_per_channel; k += 8) {
+      vst1q_s16(&dst[k],
+                vcombine_s16(
+                    vqmovn_s32(FloatS16ToS16Neon(vld1q_f32(&src[k]))),
+                    vqmovn_s32(FloatS16ToS16Neon(vld1q_f32(&src[k + 4])))));
+    }
+  } else if (num_channels == 2) {
+    int16x8x2_t x;
+    for (; k + 8 <= samples_per_channel; k += 8) {
+      for (int i = 0; i < 2; ++i) {
+        const float* src = deinterleaved[i].data();
+        x.val[i] = vcombine_s16(
+            vqmovn_s32(FloatS16ToS16Neon(vld1q_f32(&src[k]))),
+            vqmovn_s32(FloatS16ToS16Neon(vld1q_f32(&src[k + 4]))));
+      }
+      vst2q_s16(&dst[2 * k], x);
+    }
+  }
+#endif
+  return k;
+}
+
 // Both interleaves and rounds.
 void InterleaveToAudioFrame(DeinterleavedView<float> deinterleaved,
                             AudioFrame* audio_frame_for_mixing) {
   InterleavedView<int16_t> mixing_data = audio_frame_for_mixing->mutable_data(
       deinterleaved.samples_per_channel(), deinterleaved.num_channels());
+  const size_t first_sample = InterleaveToAudioFrameSimd(
+      deinterleaved, mixing_data.data().data());
   // Put data in the result frame.
   for (size_t i = 0; i < mixing_data.num_channels(); ++i) {
     auto channel = deinterleaved[i];
-    for (size_t j = 0; j < mixing_data.samples_per_channel(); ++j) {
+    for (size_t j = first_sample; j < mixing_data.samples_per_channel(); ++j) {
       mixing_data[mixing_data.num_channels() * j + i] =
           FloatS16ToS16(channel[j]);
     }
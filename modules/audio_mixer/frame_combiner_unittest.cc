@@ -10,6 +10,7 @@
 
 #include "modules/audio_mixer/frame_combiner.h"
 
+#include <algorithm>
 #include <cstdint>
 #include <initializer_list>
 #include <numeric>
@@ -275,6 +276,42 @@ TEST(FrameCombiner, CombiningOneFrameShouldNotChangeFrame) {
   }
 }
 
+// The mono and stereo frames are mixed with SIMD code where available, which
+// must round and saturate like the plain C++ code.
+TEST(FrameCombiner, CombiningTwoFramesSaturatesTheSum) {
+  FrameCombiner combiner(false);
+  for (const int rate : {8000, 11000, 44100, 48000}) {
+    for (const int number_of_channels : {1, 2, 4}) {
+      SCOPED_TRACE(ProduceDebugText(rate, number_of_channels, 2));
+      SetUpFrames(rate, number_of_channels);
+      const size_t num_samples = number_of_channels * rate / 100;
+      int16_t* frame1_data = frame1.mutable_data();
+      int16_t* frame2_data = frame2.mutable_data();
+      std::vector<int16_t> expected(num_samples);
+      for (size_t i = 0; i < num_samples; ++i) {
+        // Covers the whole range of the samples, including the extremes.
+        const int k = static_cast<int>(i);
+        frame1_data[i] = static_cast<int16_t>((k * 7919) % 65536 - 32768);
+        frame2_data[i] = static_cast<int16_t>(32767 - (k * 4099) % 65536);
+        expected[i] = static_cast<int16_t>(
+            std::clamp(frame1_data[i] + frame2_data[i], -32768, 32767));
+      }
+
+      AudioFrame audio_frame_for_mixing;
+      const std::vector<AudioFrame*> frames_to_combine = {&frame1, &frame2};
+      combiner.Combine(frames_to_combine, number_of_channels, rate,
+                       frames_to_combine.size(), &audio_frame_for_mixing);
+
+      const int16_t* audio_frame_for_mixing_data =
+          audio_frame_for_mixing.data();
+      const std::vector<int16_t> mixed_data(
+          audio_frame_for_mixing_data,
+          audio_frame_for_mixing_data + num_samples);
+      EXPECT_EQ(mixed_data, expected);
+    }
+  }
+}
+
 // Send a sine wave through the FrameCombiner, and check that the
 // difference between input and output varies smoothly. Also check
 // that it is inside reasonable bounds. This is to catch issues like
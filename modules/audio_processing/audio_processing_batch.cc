@@ -0,0 +1,109 @@
+/*
+ *  Copyright 2025 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "modules/audio_processing/audio_processing_batch.h"
+
+#include <algorithm>
+#include <atomic>
+#include <string>
+#include <utility>
+
+#include "api/task_queue/task_queue_factory.h"
+#include "modules/audio_processing/include/audio_frame_proxies.h"
+#include "rtc_base/checks.h"
+#include "rtc_base/event.h"
+
+namespace webrtc {
+
+AudioProcessingBatch::AudioProcessingBatch(
+    const Environment& env,
+    std::vector<scoped_refptr<AudioProcessing>> streams,
+    int num_worker_threads)
+    : streams_(std::move(streams)) {
+  RTC_DCHECK_GE(num_worker_threads, 0);
+  for (const auto& stream : streams_) {
+    RTC_DCHECK(stream);
+  }
+  // There is no point in having groups without streams.
+  const size_t num_groups = std::max<size_t>(
+      1,
+      std::min(streams_.size(), static_cast<size_t>(num_worker_threads) + 1));
+  for (size_t k = 1; k < num_groups; ++k) {
+    workers_.push_back(env.task_queue_factory().CreateTaskQueue(
+        "AudioProcessingBatch" + std::to_string(k),
+        TaskQueueFactory::Priority::HIGH));
+  }
+  // Spread the streams as evenly as possible over the groups.
+  group_boundaries_.reserve(num_groups + 1);
+  for (size_t k = 0; k <= num_groups; ++k) {
+    group_boundaries_.push_back(k * streams_.size() / num_groups);
+  }
+}
+
+AudioProcessingBatch::~AudioProcessingBatch() {
+  RTC_DCHECK_RUN_ON(&sequence_checker_);
+  // Destroying the task queues waits for the running tasks to complete.
+  workers_.clear();
+}
+
+void AudioProcessingBatch::ProcessCaptureFrames(
+    rtc::ArrayView<AudioFrame* const> frames,
+    rtc::ArrayView<int> errors) {
+  Process(&ProcessAudioFrame, frames, errors);
+}
+
+void AudioProcessingBatch::ProcessRenderFrames(
+    rtc::ArrayView<AudioFrame* const> frames,
+    rtc::ArrayView<int> errors) {
+  Process(&ProcessReverseAudioFrame, frames, errors);
+}
+
+void AudioProcessingBatch::Process(ProcessFunction process,
+                                   rtc::ArrayView<AudioFrame* const> frames,
+                                   rtc::ArrayView<int> errors) {
+  RTC_DCHECK_RUN_ON(&sequence_checker_);
+  RTC_DCHECK_EQ(frames.size(), streams_.size());
+  RTC_DCHECK(errors.empty() || errors.size() == frames.size());
+
+  // The last worker to finish its group wakes up the calling thread.
+  rtc::Event done;
+  std::atomic<size_t> pending_groups(workers_.size());
+  for (size_t k = 0; k < workers_.size(); ++k) {
+    workers_[k]->PostTask([this, process, group = k + 1, frames, errors, &done,
+                           &pending_groups] {
+      ProcessGroup(process, group, frames, errors);
+      if (pending_groups.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        done.Set();
+      }
+    });
+  }
+  ProcessGroup(process, /*group=*/0, frames, errors);
+  if (!workers_.empty()) {
+    done.Wait(rtc::Event::kForever);
+  }
+}
+
+void AudioProcessingBatch::ProcessGroup(
+    ProcessFunction process,
+    size_t group,
+    rtc::ArrayView<AudioFrame* const> frames,
+    rtc::ArrayView<int> errors) const {
+  for (size_t k = group_boundaries_[group]; k < group_boundaries_[group + 1];
+       ++k) {
+    const int error = frames[k] != nullptr
+                          ? process(streams_[k].get(), frames[k])
+                          : AudioProcessing::kNoError;
+    if (!errors.empty()) {
+      errors[k] = error;
+    }
+  }
+}
+
+}  // namespace webrtc
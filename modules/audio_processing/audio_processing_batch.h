@@ -0,0 +1,90 @@
+/*
+ *  Copyright 2025 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef MODULES_AUDIO_PROCESSING_AUDIO_PROCESSING_BATCH_H_
+#define MODULES_AUDIO_PROCESSING_AUDIO_PROCESSING_BATCH_H_
+
+#include <stddef.h>
+
+#include <memory>
+#include <vector>
+
+#include "api/array_view.h"
+#include "api/audio/audio_processing.h"
+#include "api/environment/environment.h"
+#include "api/scoped_refptr.h"
+#include "api/sequence_checker.h"
+#include "api/task_queue/task_queue_base.h"
+#include "rtc_base/system/no_unique_address.h"
+
+namespace webrtc {
+
+class AudioFrame;
+
+// Processes the 10 ms frames of many independent AudioProcessing streams, e.g.
+// one per call on a media server, with a single call per direction. The
+// streams are split in contiguous groups, each of which is processed by one
+// of a fixed set of worker task queues, so that a stream is always run on the
+// same core while it stays hot in its cache. The calling thread processes the
+// first group itself and returns once all the groups are done.
+//
+// Since every stream is processed by its own AudioProcessing object, in the
+// same order as when calling ProcessAudioFrame() on it, the output is
+// identical to the one of the separate instances.
+class AudioProcessingBatch {
+ public:
+  // Creates a batch processing `streams` using `num_worker_threads` task
+  // queues in addition to the calling thread. With no worker threads, all the
+  // streams are processed on the calling thread.
+  AudioProcessingBatch(const Environment& env,
+                       std::vector<scoped_refptr<AudioProcessing>> streams,
+                       int num_worker_threads);
+  ~AudioProcessingBatch();
+
+  AudioProcessingBatch(const AudioProcessingBatch&) = delete;
+  AudioProcessingBatch& operator=(const AudioProcessingBatch&) = delete;
+
+  size_t num_streams() const { return streams_.size(); }
+  AudioProcessing* stream(size_t index) const {
+    return streams_[index].get();
+  }
+
+  // Processes `frames[k]` with the k-th stream, see ProcessAudioFrame(). Null
+  // frames are skipped, e.g. for calls which did not receive audio. The error
+  // code of each stream, kNoError for the skipped ones, is written to
+  // `errors`, which must be either empty or of the same size as `frames`.
+  void ProcessCaptureFrames(rtc::ArrayView<AudioFrame* const> frames,
+                            rtc::ArrayView<int> errors);
+
+  // Processes the reverse stream `frames`, see ProcessReverseAudioFrame().
+  void ProcessRenderFrames(rtc::ArrayView<AudioFrame* const> frames,
+                           rtc::ArrayView<int> errors);
+
+ private:
+  using ProcessFunction = int (*)(AudioProcessing*, AudioFrame*);
+
+  void Process(ProcessFunction process,
+               rtc::ArrayView<AudioFrame* const> frames,
+               rtc::ArrayView<int> errors);
+  void ProcessGroup(ProcessFunction process,
+                    size_t group,
+                    rtc::ArrayView<AudioFrame* const> frames,
+                    rtc::ArrayView<int> errors) const;
+
+  RTC_NO_UNIQUE_ADDRESS SequenceChecker sequence_checker_;
+  const std::vector<scoped_refptr<AudioProcessing>> streams_;
+  std::vector<std::unique_ptr<TaskQueueBase, TaskQueueDeleter>> workers_;
+  // Index of the first stream of each group, plus the total number of streams.
+  std::vector<size_t> group_boundaries_;
+};
+
+}  // namespace webrtc
+
+#endif  // MODULES_AUDIO_PROCESSING_AUDIO_PROCESSING_BATCH_H_
@@ -0,0 +1,107 @@
+/*
+ *  Copyright 2025 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "api/audio/audio_frame.h"
+#include "api/audio/audio_processing.h"
+#include "api/audio/builtin_audio_processing_builder.h"
+#include "api/environment/environment.h"
+#include "api/environment/environment_factory.h"
+#include "api/scoped_refptr.h"
+#include "benchmark/benchmark.h"
+#include "modules/audio_processing/audio_processing_batch.h"
+#include "rtc_base/random.h"
+
+namespace webrtc {
+namespace {
+
+constexpr int kSampleRateHz = 48000;
+constexpr size_t kSamplesPerChannel = kSampleRateHz / 100;
+
+// The typical configuration of a server mixing voice calls: no echo
+// cancellation, since there is no loudspeaker, but noise suppression and
+// digital gain control.
+AudioProcessing::Config CreateConfig() {
+  AudioProcessing::Config config;
+  config.high_pass_filter.enabled = true;
+  config.noise_suppression.enabled = true;
+  config.gain_controller2.enabled = true;
+  config.gain_controller2.adaptive_digital.enabled = true;
+  return config;
+}
+
+// Processes 10 ms of capture audio of state.range(0) streams, using
+// state.range(1) worker threads in addition to the benchmark thread.
+void BM_AudioProcessingBatch(benchmark::State& state) {
+  const size_t num_streams = static_cast<size_t>(state.range(0));
+  const int num_worker_threads = static_cast<int>(state.range(1));
+  const Environment env = CreateEnvironment();
+  std::vector<scoped_refptr<AudioProcessing>> streams;
+  for (size_t k = 0; k < num_streams; ++k) {
+    streams.push_back(
+        BuiltinAudioProcessingBuilder(CreateConfig()).Build(env));
+  }
+  AudioProcessingBatch batch(env, std::move(streams), num_worker_threads);
+
+  Random random(0x1234);
+  std::vector<AudioFrame> frames(num_streams);
+  std::vector<AudioFrame*> frame_ptrs;
+  for (AudioFrame& frame : frames) {
+    frame.UpdateFrame(/*timestamp=*/0, /*data=*/nullptr, kSamplesPerChannel,
+                      kSampleRateHz, AudioFrame::kNormalSpeech,
+                      AudioFrame::kVadActive, /*num_channels=*/1);
+    frame_ptrs.push_back(&frame);
+  }
+  // Input audio which is refreshed for every frame would dominate the
+  // measurements, so the processed frames are fed back instead.
+  for (AudioFrame& frame : frames) {
+    int16_t* data = frame.mutable_data();
+    for (size_t i = 0; i < kSamplesPerChannel; ++i) {
+      data[i] = static_cast<int16_t>(random.Rand(-8000, 8000));
+    }
+  }
+  std::vector<int> errors(num_streams);
+
+  for (auto _ : state) {
+    batch.ProcessCaptureFrames(frame_ptrs, errors);
+    benchmark::DoNotOptimize(errors.data());
+  }
+  // Items are 10 ms frames. A core sustains real time for as many streams as
+  // the number of items per second divided by 100 and by the threads used.
+  // The batch doesn't use more threads than there are streams.
+  const size_t num_threads =
+      std::min(num_streams, static_cast<size_t>(num_worker_threads) + 1);
+  state.SetItemsProcessed(state.iterations() * num_streams);
+  state.counters["streams_per_core"] = benchmark::Counter(
+      static_cast<double>(state.iterations() * num_streams) / 100 /
+          num_threads,
+      benchmark::Counter::kIsRate);
+}
+
+BENCHMARK(BM_AudioProcessingBatch)
+    ->ArgsProduct({{1, 16, 64, 256}, {0, 1, 3}})
+    ->UseRealTime()
+    ->Unit(benchmark::kMicrosecond);
+
+}  // namespace
+}  // namespace webrtc
+
+/*
+
+BM_AudioProcessingBatch takes the number of streams and the number of worker
+threads as arguments. The streams_per_core counter is the number of streams
+that a fully loaded core would process in real time. Run with:
+
+  out/Default/benchmarks --benchmark_filter=AudioProcessingBatch
+*/
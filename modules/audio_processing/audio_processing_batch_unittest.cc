@@ -0,0 +1,142 @@
+/*
+ *  Copyright 2025 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "modules/audio_processing/audio_processing_batch.h"
+
+#include <memory>
+#include <vector>
+
+#include "api/audio/audio_frame.h"
+#include "api/audio/audio_processing.h"
+#include "api/audio/builtin_audio_processing_builder.h"
+#include "api/environment/environment.h"
+#include "api/environment/environment_factory.h"
+#include "api/scoped_refptr.h"
+#include "modules/audio_processing/include/audio_frame_proxies.h"
+#include "rtc_base/random.h"
+#include "test/gtest.h"
+
+namespace webrtc {
+namespace {
+
+constexpr int kSampleRateHz = 48000;
+constexpr size_t kSamplesPerChannel = kSampleRateHz / 100;
+
+AudioProcessing::Config CreateConfig() {
+  AudioProcessing::Config config;
+  config.high_pass_filter.enabled = true;
+  config.echo_canceller.enabled = true;
+  config.noise_suppression.enabled = true;
+  config.gain_controller2.enabled = true;
+  config.gain_controller2.adaptive_digital.enabled = true;
+  return config;
+}
+
+std::vector<scoped_refptr<AudioProcessing>> CreateStreams(
+    const Environment& env,
+    size_t num_streams) {
+  std::vector<scoped_refptr<AudioProcessing>> streams;
+  for (size_t k = 0; k < num_streams; ++k) {
+    streams.push_back(
+        BuiltinAudioProcessingBuilder(CreateConfig()).Build(env));
+  }
+  return streams;
+}
+
+// Fills `frame` with noise whose level depends on `stream`, so that the
+// streams do not all adapt in the same way.
+void FillFrame(Random& random, size_t stream, AudioFrame& frame) {
+  frame.UpdateFrame(/*timestamp=*/0, /*data=*/nullptr, kSamplesPerChannel,
+                    kSampleRateHz, AudioFrame::kNormalSpeech,
+                    AudioFrame::kVadActive, /*num_channels=*/1);
+  const int amplitude = 1000 * (1 + stream % 8);
+  int16_t* data = frame.mutable_data();
+  for (size_t i = 0; i < kSamplesPerChannel; ++i) {
+    data[i] = static_cast<int16_t>(random.Rand(-amplitude, amplitude));
+  }
+}
+
+class AudioProcessingBatchParametrization
+    : public ::testing::TestWithParam<int> {};
+
+// Checks that the output of the batch is identical to the one of separate
+// AudioProcessing instances fed with the same frames.
+TEST_P(AudioProcessingBatchParametrization, SameOutputAsSeparateInstances) {
+  constexpr size_t kNumStreams = 7;
+  constexpr int kNumFrames = 100;
+  const Environment env = CreateEnvironment();
+  AudioProcessingBatch batch(env, CreateStreams(env, kNumStreams),
+                             /*num_worker_threads=*/GetParam());
+  ASSERT_EQ(batch.num_streams(), kNumStreams);
+  std::vector<scoped_refptr<AudioProcessing>> references =
+      CreateStreams(env, kNumStreams);
+
+  Random random(42);
+  std::vector<AudioFrame> capture(kNumStreams);
+  std::vector<AudioFrame> render(kNumStreams);
+  std::vector<AudioFrame> expected_capture(kNumStreams);
+  std::vector<AudioFrame> expected_render(kNumStreams);
+  std::vector<AudioFrame*> capture_ptrs;
+  std::vector<AudioFrame*> render_ptrs;
+  for (size_t k = 0; k < kNumStreams; ++k) {
+    capture_ptrs.push_back(&capture[k]);
+    render_ptrs.push_back(&render[k]);
+  }
+  std::vector<int> errors(kNumStreams);
+
+  for (int i = 0; i < kNumFrames; ++i) {
+    for (size_t k = 0; k < kNumStreams; ++k) {
+      FillFrame(random, k, render[k]);
+      FillFrame(random, k, capture[k]);
+      expected_render[k].CopyFrom(render[k]);
+      expected_capture[k].CopyFrom(capture[k]);
+      ASSERT_EQ(ProcessReverseAudioFrame(references[k].get(),
+                                         &expected_render[k]),
+                AudioProcessing::kNoError);
+      ASSERT_EQ(ProcessAudioFrame(references[k].get(), &expected_capture[k]),
+                AudioProcessing::kNoError);
+    }
+    batch.ProcessRenderFrames(render_ptrs, errors);
+    for (int error : errors) {
+      ASSERT_EQ(error, AudioProcessing::kNoError);
+    }
+    batch.ProcessCaptureFrames(capture_ptrs, errors);
+    for (int error : errors) {
+      ASSERT_EQ(error, AudioProcessing::kNoError);
+    }
+    for (size_t k = 0; k < kNumStreams; ++k) {
+      for (size_t j = 0; j < kSamplesPerChannel; ++j) {
+        ASSERT_EQ(capture[k].data()[j], expected_capture[k].data()[j])
+            << "stream " << k << ", frame " << i;
+      }
+    }
+  }
+}
+
+INSTANTIATE_TEST_SUITE_P(AudioProcessingBatchTest,
+                         AudioProcessingBatchParametrization,
+                         ::testing::Values(0, 1, 3, 10));
+
+TEST(AudioProcessingBatchTest, SkipsNullFrames) {
+  const Environment env = CreateEnvironment();
+  AudioProcessingBatch batch(env, CreateStreams(env, /*num_streams=*/2),
+                             /*num_worker_threads=*/1);
+  Random random(42);
+  AudioFrame frame;
+  FillFrame(random, /*stream=*/0, frame);
+  std::vector<AudioFrame*> frames = {nullptr, &frame};
+  std::vector<int> errors = {-1, -1};
+  batch.ProcessCaptureFrames(frames, errors);
+  EXPECT_EQ(errors[0], AudioProcessing::kNoError);
+  EXPECT_EQ(errors[1], AudioProcessing::kNoError);
+}
+
+}  // namespace
+}  // namespace webrtc
@@ -159,31 +159,6 @@ void ComputeMagnitudeSpectrum(
   }
 }
 
-// Compute prior and post SNR.
-void ComputeSnr(rtc::ArrayView<const float, kFftSizeBy2Plus1> filter,
-                rtc::ArrayView<const float> prev_signal_spectrum,
-                rtc::ArrayView<const float> signal_spectrum,
-                rtc::ArrayView<const float> prev_noise_spectrum,
-                rtc::ArrayView<const float> noise_spectrum,
-                rtc::ArrayView<float> prior_snr,
-                rtc::ArrayView<float> post_snr) {
-  for (size_t i = 0; i < kFftSizeBy2Plus1; ++i) {
-    // Previous post SNR.
-    // Previous estimate: based on previous frame with gain filter.
-    float prev_estimate = prev_signal_spectrum[i] /
-                          (prev_noise_spectrum[i] + 0.0001f) * filter[i];
-    // Post SNR.
-    if (signal_spectrum[i] > noise_spectrum[i]) {
-      post_snr[i] = signal_spectrum[i] / (noise_spectrum[i] + 0.0001f) - 1.f;
-    } else {
-      post_snr[i] = 0.f;
-    }
-    // The directed decision estimate of the prior SNR is a sum the current and
-    // previous estimates.
-    prior_snr[i] = 0.98f * prev_estimate + (1.f - 0.98f) * post_snr[i];
-  }
-}
-
 // Computes the attenuating gain for the noise suppression of the upper bands.
 float ComputeUpperBandsGain(
     float minimum_attenuating_gain,
@@ -240,9 +215,11 @@ float ComputeUpperBandsGain(
 
 NoiseSuppressor::ChannelState::ChannelState(
     const SuppressionParams& suppression_params,
-    size_t num_bands)
-    : wiener_filter(suppression_params),
-      noise_estimator(suppression_params),
+    size_t num_bands,
+    const AvailableCpuFeatures& cpu_features)
+    : speech_probability_estimator(cpu_features),
+      wiener_filter(suppression_params, cpu_features),
+      noise_estimator(suppression_params, cpu_features),
       process_delay_memory(num_bands > 1 ? num_bands - 1 : 0) {
   analyze_analysis_memory.fill(0.f);
   prev_analysis_signal_spectrum.fill(1.f);
@@ -256,17 +233,27 @@ NoiseSuppressor::ChannelState::ChannelState(
 NoiseSuppressor::NoiseSuppressor(const NsConfig& config,
                                  size_t sample_rate_hz,
                                  size_t num_channels)
+    : NoiseSuppressor(config,
+                      sample_rate_hz,
+                      num_channels,
+                      GetAvailableCpuFeatures()) {}
+
+NoiseSuppressor::NoiseSuppressor(const NsConfig& config,
+                                 size_t sample_rate_hz,
+                                 size_t num_channels,
+                                 const AvailableCpuFeatures& cpu_features)
     : num_bands_(NumBandsForRate(sample_rate_hz)),
       num_channels_(num_channels),
       suppression_params_(config.target_level),
+      vector_math_(cpu_features),
       filter_bank_states_heap_(NumChannelsOnHeap(num_channels_)),
       upper_band_gains_heap_(NumChannelsOnHeap(num_channels_)),
       energies_before_filtering_heap_(NumChannelsOnHeap(num_channels_)),
       gain_adjustments_heap_(NumChannelsOnHeap(num_channels_)),
       channels_(num_channels_) {
   for (size_t ch = 0; ch < num_channels_; ++ch) {
-    channels_[ch] =
-        std::make_unique<ChannelState>(suppression_params_, num_bands_);
+    channels_[ch] = std::make_unique<ChannelState>(suppression_params_,
+                                                   num_bands_, cpu_features);
   }
 }
 
@@ -360,10 +347,12 @@ void NoiseSuppressor::Analyze(const AudioBuffer& audio) {
 
     std::array<float, kFftSizeBy2Plus1> post_snr;
     std::array<float, kFftSizeBy2Plus1> prior_snr;
-    ComputeSnr(ch_p->wiener_filter.get_filter(),
-               ch_p->prev_analysis_signal_spectrum, signal_spectrum,
-               ch_p->noise_estimator.get_prev_noise_spectrum(),
-               ch_p->noise_estimator.get_noise_spectrum(), prior_snr, post_snr);
+    vector_math_.ComputeSnr(ch_p->wiener_filter.get_filter(),
+                            ch_p->prev_analysis_signal_spectrum,
+                            signal_spectrum,
+                            ch_p->noise_estimator.get_prev_noise_spectrum(),
+                            ch_p->noise_estimator.get_noise_spectrum(),
+                            prior_snr, post_snr);
 
     ch_p->speech_probability_estimator.Update(
         num_analyzed_frames_, prior_snr, post_snr,
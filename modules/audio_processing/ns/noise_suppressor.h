@@ -15,11 +15,13 @@
 #include <vector>
 
 #include "api/array_view.h"
+#include "modules/audio_processing/agc2/cpu_features.h"
 #include "modules/audio_processing/audio_buffer.h"
 #include "modules/audio_processing/ns/noise_estimator.h"
 #include "modules/audio_processing/ns/ns_common.h"
 #include "modules/audio_processing/ns/ns_config.h"
 #include "modules/audio_processing/ns/ns_fft.h"
+#include "modules/audio_processing/ns/ns_vector_math.h"
 #include "modules/audio_processing/ns/speech_probability_estimator.h"
 #include "modules/audio_processing/ns/wiener_filter.h"
 
@@ -31,6 +33,11 @@ class NoiseSuppressor {
   NoiseSuppressor(const NsConfig& config,
                   size_t sample_rate_hz,
                   size_t num_channels);
+  // Uses only the given CPU features for the SIMD optimizations.
+  NoiseSuppressor(const NsConfig& config,
+                  size_t sample_rate_hz,
+                  size_t num_channels,
+                  const AvailableCpuFeatures& cpu_features);
   NoiseSuppressor(const NoiseSuppressor&) = delete;
   NoiseSuppressor& operator=(const NoiseSuppressor&) = delete;
 
@@ -53,12 +60,15 @@ class NoiseSuppressor {
   const size_t num_bands_;
   const size_t num_channels_;
   const SuppressionParams suppression_params_;
+  const NsVectorMath vector_math_;
   int32_t num_analyzed_frames_ = -1;
   NrFft fft_;
   bool capture_output_used_ = true;
 
   struct ChannelState {
-    ChannelState(const SuppressionParams& suppression_params, size_t num_bands);
+    ChannelState(const SuppressionParams& suppression_params,
+                 size_t num_bands,
+                 const AvailableCpuFeatures& cpu_features);
 
     SpeechProbabilityEstimator speech_probability_estimator;
     WienerFilter wiener_filter;
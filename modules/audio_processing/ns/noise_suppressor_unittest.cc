@@ -10,13 +10,18 @@
 
 #include "modules/audio_processing/ns/noise_suppressor.h"
 
+#include <math.h>
+
 #include <deque>
 #include <memory>
 #include <string>
 #include <utility>
 #include <vector>
 
+#include "modules/audio_processing/agc2/cpu_features.h"
+#include "rtc_base/random.h"
 #include "rtc_base/strings/string_builder.h"
+#include "rtc_base/system/arch.h"
 #include "test/gmock.h"
 #include "test/gtest.h"
 
@@ -99,4 +104,54 @@ TEST(NoiseSuppressor, IdenticalChannelEffects) {
   }
 }
 
+// Verifies that the SIMD optimizations do not change the output.
+TEST(NoiseSuppressor, SimdOptimizationsGiveSameOutput) {
+  for (auto rate : {16000, 48000}) {
+    SCOPED_TRACE(ProduceDebugText(rate, 1, NsConfig().target_level));
+
+    const size_t num_bands = rate / 16000;
+    AudioBuffer audio(rate, 1, rate, 1, rate, 1);
+    AudioBuffer reference_audio(rate, 1, rate, 1, rate, 1);
+    NsConfig cfg;
+    NoiseSuppressor ns(cfg, rate, 1, GetAvailableCpuFeatures());
+    NoiseSuppressor reference_ns(cfg, rate, 1, NoAvailableCpuFeatures());
+    Random random(42);
+    for (size_t frame_index = 0; frame_index < 500; ++frame_index) {
+      if (rate > 16000) {
+        audio.SplitIntoFrequencyBands();
+        reference_audio.SplitIntoFrequencyBands();
+      }
+
+      // Noise, with a tone every other second.
+      for (size_t b = 0; b < num_bands; ++b) {
+        for (size_t i = 0; i < 160; ++i) {
+          float value = static_cast<float>(random.Gaussian(0.f, 300.f));
+          if ((frame_index / 100) % 2 == 1) {
+            value += 5000.f * sinf(0.1f * (frame_index * 160 + i));
+          }
+          audio.split_bands(0)[b][i] = value;
+          reference_audio.split_bands(0)[b][i] = value;
+        }
+      }
+
+      ns.Analyze(audio);
+      ns.Process(&audio);
+      reference_ns.Analyze(reference_audio);
+      reference_ns.Process(&reference_audio);
+      for (size_t b = 0; b < num_bands; ++b) {
+        for (size_t i = 0; i < 160; ++i) {
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+          ASSERT_EQ(reference_audio.split_bands_const(0)[b][i],
+                    audio.split_bands_const(0)[b][i]);
+#else
+          // The C++ code may be compiled with fused multiply-adds.
+          ASSERT_NEAR(reference_audio.split_bands_const(0)[b][i],
+                      audio.split_bands_const(0)[b][i], 1.f);
+#endif
+        }
+      }
+    }
+  }
+}
+
 }  // namespace webrtc
@@ -0,0 +1,396 @@
+/*
+ *  Copyright 2025 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "modules/audio_processing/ns/ns_vector_math.h"
+
+// Defines WEBRTC_ARCH_X86_FAMILY, used below.
+#include "rtc_base/system/arch.h"
+
+#if defined(WEBRTC_HAS_NEON)
+#include <arm_neon.h>
+#endif
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+#include <emmintrin.h>
+#endif
+#include <math.h>
+
+#include "modules/audio_processing/ns/fast_math.h"
+#include "rtc_base/checks.h"
+
+namespace webrtc {
+
+namespace {
+
+// The SIMD versions below perform the same floating point operations in the
+// same order as the C++ code, without fused multiply-adds, so that the results
+// are identical.
+
+// Constants of LogApproximation(), see FastLog2f() in fast_math.cc.
+constexpr float kOneByTwoPow23 = 1.1920929e-7f;
+constexpr float kExponentBias = 126.942695f;
+constexpr float kLogOf2 = 0.69314718056f;
+
+// Constants of the quantile estimation.
+constexpr float kWidth = 0.01f;
+constexpr float kOneByWidthPlus2 = 1.f / (2.f * kWidth);
+
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+// Returns `a` where `mask` is set and `b` elsewhere.
+__m128 Select(__m128 mask, __m128 a, __m128 b) {
+  return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+}
+
+__m128 LogApproximationSse2(__m128 x) {
+  // The float is interpreted as an integer, which is positive since x > 0.
+  __m128 out = _mm_cvtepi32_ps(_mm_castps_si128(x));
+  out = _mm_mul_ps(out, _mm_set1_ps(kOneByTwoPow23));
+  out = _mm_sub_ps(out, _mm_set1_ps(kExponentBias));
+  return _mm_mul_ps(out, _mm_set1_ps(kLogOf2));
+}
+
+size_t LogSse2(rtc::ArrayView<const float> x, rtc::ArrayView<float> y) {
+  size_t i = 0;
+  for (; i + 4 <= x.size(); i += 4) {
+    _mm_storeu_ps(&y[i], LogApproximationSse2(_mm_loadu_ps(&x[i])));
+  }
+  return i;
+}
+
+size_t ComputeSnrSse2(
+    rtc::ArrayView<const float, kFftSizeBy2Plus1> filter,
+    rtc::ArrayView<const float, kFftSizeBy2Plus1> prev_signal_spectrum,
+    rtc::ArrayView<const float, kFftSizeBy2Plus1> signal_spectrum,
+    rtc::ArrayView<const float, kFftSizeBy2Plus1> prev_noise_spectrum,
+    rtc::ArrayView<const float, kFftSizeBy2Plus1> noise_spectrum,
+    rtc::ArrayView<float, kFftSizeBy2Plus1> prior_snr,
+    rtc::ArrayView<float, kFftSizeBy2Plus1> post_snr) {
+  const __m128 kEpsilon = _mm_set1_ps(0.0001f);
+  size_t i = 0;
+  for (; i + 4 <= kFftSizeBy2Plus1; i += 4) {
+    const __m128 signal = _mm_loadu_ps(&signal_spectrum[i]);
+    const __m128 noise = _mm_loadu_ps(&noise_spectrum[i]);
+    const __m128 prev_estimate = _mm_mul_ps(
+        _mm_div_ps(_mm_loadu_ps(&prev_signal_spectrum[i]),
+                   _mm_add_ps(_mm_loadu_ps(&prev_noise_spectrum[i]), kEpsilon)),
+        _mm_loadu_ps(&filter[i]));
+    const __m128 post = Select(
+        _mm_cmpgt_ps(signal, noise),
+        _mm_sub_ps(_mm_div_ps(signal, _mm_add_ps(noise, kEpsilon)),
+                   _mm_set1_ps(1.f)),
+        _mm_setzero_ps());
+    _mm_storeu_ps(&post_snr[i], post);
+    _mm_storeu_ps(&prior_snr[i],
+                  _mm_add_ps(_mm_mul_ps(_mm_set1_ps(0.98f), prev_estimate),
+                             _mm_mul_ps(_mm_set1_ps(1.f - 0.98f), post)));
+  }
+  return i;
+}
+
+size_t UpdateLogLrtSse2(
+    rtc::ArrayView<const float, kFftSizeBy2Plus1> prior_snr,
+    rtc::ArrayView<const float, kFftSizeBy2Plus1> post_snr,
+    rtc::ArrayView<float, kFftSizeBy2Plus1> avg_log_lrt) {
+  const __m128 kOne = _mm_set1_ps(1.f);
+  const __m128 kTwo = _mm_set1_ps(2.f);
+  size_t i = 0;
+  for (; i + 4 <= kFftSizeBy2Plus1; i += 4) {
+    const __m128 prior = _mm_loadu_ps(&prior_snr[i]);
+    const __m128 tmp1 = _mm_add_ps(kOne, _mm_mul_ps(kTwo, prior));
+    const __m128 tmp2 = _mm_div_ps(_mm_mul_ps(kTwo, prior),
+                                   _mm_add_ps(tmp1, _mm_set1_ps(0.0001f)));
+    const __m128 bessel_tmp =
+        _mm_mul_ps(_mm_add_ps(_mm_loadu_ps(&post_snr[i]), kOne), tmp2);
+    const __m128 avg = _mm_loadu_ps(&avg_log_lrt[i]);
+    const __m128 update = _mm_mul_ps(
+        _mm_set1_ps(.5f),
+        _mm_sub_ps(_mm_sub_ps(bessel_tmp, LogApproximationSse2(tmp1)), avg));
+    _mm_storeu_ps(&avg_log_lrt[i], _mm_add_ps(avg, update));
+  }
+  return i;
+}
+
+size_t UpdateQuantileSse2(
+    rtc::ArrayView<const float, kFftSizeBy2Plus1> log_spectrum,
+    int counter,
+    rtc::ArrayView<float, kFftSizeBy2Plus1> log_quantile,
+    rtc::ArrayView<float, kFftSizeBy2Plus1> density) {
+  const __m128 kOne = _mm_set1_ps(1.f);
+  const __m128 kDeltaScale = _mm_set1_ps(40.f);
+  const __m128 kAbsMask = _mm_castsi128_ps(_mm_set1_epi32(0x7FFFFFFF));
+  const __m128 counter_f = _mm_set1_ps(static_cast<float>(counter));
+  const __m128 one_by_counter_plus_1 = _mm_set1_ps(1.f / (counter + 1.f));
+  size_t i = 0;
+  for (; i + 4 <= kFftSizeBy2Plus1; i += 4) {
+    const __m128 log_signal = _mm_loadu_ps(&log_spectrum[i]);
+    __m128 quantile = _mm_loadu_ps(&log_quantile[i]);
+    __m128 dens = _mm_loadu_ps(&density[i]);
+
+    // Update log quantile estimate.
+    const __m128 delta = Select(_mm_cmpgt_ps(dens, kOne),
+                                _mm_div_ps(kDeltaScale, dens), kDeltaScale);
+    const __m128 multiplier = _mm_mul_ps(delta, one_by_counter_plus_1);
+    quantile = Select(
+        _mm_cmpgt_ps(log_signal, quantile),
+        _mm_add_ps(quantile, _mm_mul_ps(_mm_set1_ps(0.25f), multiplier)),
+        _mm_sub_ps(quantile, _mm_mul_ps(_mm_set1_ps(0.75f), multiplier)));
+    _mm_storeu_ps(&log_quantile[i], quantile);
+
+    // Update density estimate.
+    const __m128 distance =
+        _mm_and_ps(_mm_sub_ps(log_signal, quantile), kAbsMask);
+    const __m128 new_density =
+        _mm_mul_ps(_mm_add_ps(_mm_mul_ps(counter_f, dens),
+                              _mm_set1_ps(kOneByWidthPlus2)),
+                   one_by_counter_plus_1);
+    dens = Select(_mm_cmplt_ps(distance, _mm_set1_ps(kWidth)), new_density,
+                  dens);
+    _mm_storeu_ps(&density[i], dens);
+  }
+  return i;
+}
+#endif  // defined(WEBRTC_ARCH_X86_FAMILY)
+
+#if defined(WEBRTC_HAS_NEON) && defined(WEBRTC_ARCH_ARM64)
+float32x4_t LogApproximationNeon(float32x4_t x) {
+  float32x4_t out = vcvtq_f32_u32(vreinterpretq_u32_f32(x));
+  out = vmulq_f32(out, vdupq_n_f32(kOneByTwoPow23));
+  out = vsubq_f32(out, vdupq_n_f32(kExponentBias));
+  return vmulq_f32(out, vdupq_n_f32(kLogOf2));
+}
+
+size_t LogNeon(rtc::ArrayView<const float> x, rtc::ArrayView<float> y) {
+  size_t i = 0;
+  for (; i + 4 <= x.size(); i += 4) {
+    vst1q_f32(&y[i], LogApproximationNeon(vld1q_f32(&x[i])));
+  }
+  return i;
+}
+
+size_t ComputeSnrNeon(
+    rtc::ArrayView<const float, kFftSizeBy2Plus1> filter,
+    rtc::ArrayView<const float, kFftSizeBy2Plus1> prev_signal_spectrum,
+    rtc::ArrayView<const float, kFftSizeBy2Plus1> signal_spectrum,
+    rtc::ArrayView<const float, kFftSizeBy2Plus1> prev_noise_spectrum,
+    rtc::ArrayView<const float, kFftSizeBy2Plus1> noise_spectrum,
+    rtc::ArrayView<float, kFftSizeBy2Plus1> prior_snr,
+    rtc::ArrayView<float, kFftSizeBy2Plus1> post_snr) {
+  const float32x4_t kEpsilon = vdupq_n_f32(0.0001f);
+  size_t i = 0;
+  for (; i + 4 <= kFftSizeBy2Plus1; i += 4) {
+    const float32x4_t signal = vld1q_f32(&signal_spectrum[i]);
+    const float32x4_t noise = vld1q_f32(&noise_spectrum[i]);
+    const float32x4_t prev_estimate = vmulq_f32(
+        vdivq_f32(vld1q_f32(&prev_signal_spectrum[i]),
+                  vaddq_f32(vld1q_f32(&prev_noise_spectrum[i]), kEpsilon)),
+        vld1q_f32(&filter[i]));
+    const float32x4_t post = vbslq_f32(
+        vcgtq_f32(signal, noise),
+        vsubq_f32(vdivq_f32(signal, vaddq_f32(noise, kEpsilon)),
+                  vdupq_n_f32(1.f)),
+        vdupq_n_f32(0.f));
+    vst1q_f32(&post_snr[i], post);
+    vst1q_f32(&prior_snr[i],
+              vaddq_f32(vmulq_f32(vdupq_n_f32(0.98f), prev_estimate),
+                        vmulq_f32(vdupq_n_f32(1.f - 0.98f), post)));
+  }
+  return i;
+}
+
+size_t UpdateLogLrtNeon(
+    rtc::ArrayView<const float, kFftSizeBy2Plus1> prior_snr,
+    rtc::ArrayView<const float, kFftSizeBy2Plus1> post_snr,
+    rtc::ArrayView<float, kFftSizeBy2Plus1> avg_log_lrt) {
+  const float32x4_t kOne = vdupq_n_f32(1.f);
+  const float32x4_t kTwo = vdupq_n_f32(2.f);
+  size_t i = 0;
+  for (; i + 4 <= kFftSizeBy2Plus1; i += 4) {
+    const float32x4_t prior = vld1q_f32(&prior_snr[i]);
+    const float32x4_t tmp1 = vaddq_f32(kOne, vmulq_f32(kTwo, prior));
+    const float32x4_t tmp2 = vdivq_f32(
+        vmulq_f32(kTwo, prior), vaddq_f32(tmp1, vdupq_n_f32(0.0001f)));
+    const float32x4_t bessel_tmp =
+        vmulq_f32(vaddq_f32(vld1q_f32(&post_snr[i]), kOne), tmp2);
+    const float32x4_t avg = vld1q_f32(&avg_log_lrt[i]);
+    const float32x4_t update =
+        vmulq_f32(vdupq_n_f32(.5f),
+                  vsubq_f32(vsubq_f32(bessel_tmp, LogApproximationNeon(tmp1)),
+                            avg));
+    vst1q_f32(&avg_log_lrt[i], vaddq_f32(avg, update));
+  }
+  return i;
+}
+
+size_t UpdateQuantileNeon(
+    rtc::ArrayView<const float, kFftSizeBy2Plus1> log_spectrum,
+    int counter,
+    rtc::ArrayView<float, kFftSizeBy2Plus1> log_quantile,
+    rtc::ArrayView<float, kFftSizeBy2Plus1> density) {
+  const float32x4_t kOne = vdupq_n_f32(1.f);
+  const float32x4_t kDeltaScale = vdupq_n_f32(40.f);
+  const float32x4_t counter_f = vdupq_n_f32(static_cast<float>(counter));
+  const float32x4_t one_by_counter_plus_1 = vdupq_n_f32(1.f / (counter + 1.f));
+  size_t i = 0;
+  for (; i + 4 <= kFftSizeBy2Plus1; i += 4) {
+    const float32x4_t log_signal = vld1q_f32(&log_spectrum[i]);
+    float32x4_t quantile = vld1q_f32(&log_quantile[i]);
+    float32x4_t dens = vld1q_f32(&density[i]);
+
+    // Update log quantile estimate.
+    const float32x4_t delta = vbslq_f32(
+        vcgtq_f32(dens, kOne), vdivq_f32(kDeltaScale, dens), kDeltaScale);
+    const float32x4_t multiplier = vmulq_f32(delta, one_by_counter_plus_1);
+    quantile = vbslq_f32(
+        vcgtq_f32(log_signal, quantile),
+        vaddq_f32(quantile, vmulq_f32(vdupq_n_f32(0.25f), multiplier)),
+        vsubq_f32(quantile, vmulq_f32(vdupq_n_f32(0.75f), multiplier)));
+    vst1q_f32(&log_quantile[i], quantile);
+
+    // Update density estimate.
+    const float32x4_t new_density =
+        vmulq_f32(vaddq_f32(vmulq_f32(counter_f, dens),
+                            vdupq_n_f32(kOneByWidthPlus2)),
+                  one_by_counter_plus_1);
+    dens = vbslq_f32(
+        vcltq_f32(vabdq_f32(log_signal, quantile), vdupq_n_f32(kWidth)),
+        new_density, dens);
+    vst1q_f32(&density[i], dens);
+  }
+  return i;
+}
+#endif  // defined(WEBRTC_HAS_NEON) && defined(WEBRTC_ARCH_ARM64)
+
+}  // namespace
+
+void NsVectorMath::Log(rtc::ArrayView<const float> x,
+                       rtc::ArrayView<float> y) const {
+  RTC_DCHECK_EQ(x.size(), y.size());
+  size_t i = 0;
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+  if (cpu_features_.avx2) {
+    i = LogAvx2(x, y);
+  } else if (cpu_features_.sse2) {
+    i = LogSse2(x, y);
+  }
+#elif defined(WEBRTC_HAS_NEON) && defined(WEBRTC_ARCH_ARM64)
+  if (cpu_features_.neon) {
+    i = LogNeon(x, y);
+  }
+#endif
+  for (; i < x.size(); ++i) {
+    y[i] = LogApproximation(x[i]);
+  }
+}
+
+void NsVectorMath::ComputeSnr(
+    rtc::ArrayView<const float, kFftSizeBy2Plus1> filter,
+    rtc::ArrayView<const float, kFftSizeBy2Plus1> prev_signal_spectrum,
+    rtc::ArrayView<const float, kFftSizeBy2Plus1> signal_spectrum,
+    rtc::ArrayView<const float, kFftSizeBy2Plus1> prev_noise_spectrum,
+    rtc::ArrayView<const float, kFftSizeBy2Plus1> noise_spectrum,
+    rtc::ArrayView<float, kFftSizeBy2Plus1> prior_snr,
+    rtc::ArrayView<float, kFftSizeBy2Plus1> post_snr) const {
+  size_t i = 0;
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+  if (cpu_features_.avx2) {
+    i = ComputeSnrAvx2(filter, prev_signal_spectrum, signal_spectrum,
+                       prev_noise_spectrum, noise_spectrum, prior_snr,
+                       post_snr);
+  } else if (cpu_features_.sse2) {
+    i = ComputeSnrSse2(filter, prev_signal_spectrum, signal_spectrum,
+                       prev_noise_spectrum, noise_spectrum, prior_snr,
+                       post_snr);
+  }
+#elif defined(WEBRTC_HAS_NEON) && defined(WEBRTC_ARCH_ARM64)
+  if (cpu_features_.neon) {
+    i = ComputeSnrNeon(filter, prev_signal_spectrum, signal_spectrum,
+                       prev_noise_spectrum, noise_spectrum, prior_snr,
+                       post_snr);
+  }
+#endif
+  for (; i < kFftSizeBy2Plus1; ++i) {
+    // Previous post SNR.
+    // Previous estimate: based on previous frame with gain filter.
+    float prev_estimate = prev_signal_spectrum[i] /
+                          (prev_noise_spectrum[i] + 0.0001f) * filter[i];
+    // Post SNR.
+    if (signal_spectrum[i] > noise_spectrum[i]) {
+      post_snr[i] = signal_spectrum[i] / (noise_spectrum[i] + 0.0001f) - 1.f;
+    } else {
+      post_snr[i] = 0.f;
+    }
+    // The directed decision estimate of the prior SNR is a sum the current and
+    // previous estimates.
+    prior_snr[i] = 0.98f * prev_estimate + (1.f - 0.98f) * post_snr[i];
+  }
+}
+
+void NsVectorMath::UpdateLogLrt(
+    rtc::ArrayView<const float, kFftSizeBy2Plus1> prior_snr,
+    rtc::ArrayView<const float, kFftSizeBy2Plus1> post_snr,
+    rtc::ArrayView<float, kFftSizeBy2Plus1> avg_log_lrt) const {
+  size_t i = 0;
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+  if (cpu_features_.avx2) {
+    i = UpdateLogLrtAvx2(prior_snr, post_snr, avg_log_lrt);
+  } else if (cpu_features_.sse2) {
+    i = UpdateLogLrtSse2(prior_snr, post_snr, avg_log_lrt);
+  }
+#elif defined(WEBRTC_HAS_NEON) && defined(WEBRTC_ARCH_ARM64)
+  if (cpu_features_.neon) {
+    i = UpdateLogLrtNeon(prior_snr, post_snr, avg_log_lrt);
+  }
+#endif
+  for (; i < kFftSizeBy2Plus1; ++i) {
+    float tmp1 = 1.f + 2.f * prior_snr[i];
+    float tmp2 = 2.f * prior_snr[i] / (tmp1 + 0.0001f);
+    float bessel_tmp = (post_snr[i] + 1.f) * tmp2;
+    avg_log_lrt[i] +=
+        .5f * (bessel_tmp - LogApproximation(tmp1) - avg_log_lrt[i]);
+  }
+}
+
+void NsVectorMath::UpdateQuantile(
+    rtc::ArrayView<const float, kFftSizeBy2Plus1> log_spectrum,
+    int counter,
+    rtc::ArrayView<float, kFftSizeBy2Plus1> log_quantile,
+    rtc::ArrayView<float, kFftSizeBy2Plus1> density) const {
+  size_t i = 0;
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+  if (cpu_features_.avx2) {
+    i = UpdateQuantileAvx2(log_spectrum, counter, log_quantile, density);
+  } else if (cpu_features_.sse2) {
+    i = UpdateQuantileSse2(log_spectrum, counter, log_quantile, density);
+  }
+#elif defined(WEBRTC_HAS_NEON) && defined(WEBRTC_ARCH_ARM64)
+  if (cpu_features_.neon) {
+    i = UpdateQuantileNeon(log_spectrum, counter, log_quantile, density);
+  }
+#endif
+  const float one_by_counter_plus_1 = 1.f / (counter + 1.f);
+  for (; i < kFftSizeBy2Plus1; ++i) {
+    // Update log quantile estimate.
+    const float delta = density[i] > 1.f ? 40.f / density[i] : 40.f;
+
+    const float multiplier = delta * one_by_counter_plus_1;
+    if (log_spectrum[i] > log_quantile[i]) {
+      log_quantile[i] += 0.25f * multiplier;
+    } else {
+      log_quantile[i] -= 0.75f * multiplier;
+    }
+
+    // Update density estimate.
+    if (fabs(log_spectrum[i] - log_quantile[i]) < kWidth) {
+      density[i] =
+          (counter * density[i] + kOneByWidthPlus2) * one_by_counter_plus_1;
+    }
+  }
+}
+
+}  // namespace webrtc
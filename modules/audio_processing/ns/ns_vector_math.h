@@ -0,0 +1,85 @@
+/*
+ *  Copyright 2025 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef MODULES_AUDIO_PROCESSING_NS_NS_VECTOR_MATH_H_
+#define MODULES_AUDIO_PROCESSING_NS_NS_VECTOR_MATH_H_
+
+#include <stddef.h>
+
+#include "api/array_view.h"
+#include "modules/audio_processing/agc2/cpu_features.h"
+#include "modules/audio_processing/ns/ns_common.h"
+
+namespace webrtc {
+
+// Provides SIMD versions of the per-bin loops of the noise suppressor. All
+// the versions give exactly the same results as the plain C++ code, which is
+// used when no suitable CPU feature is available.
+class NsVectorMath {
+ public:
+  explicit NsVectorMath(const AvailableCpuFeatures& cpu_features)
+      : cpu_features_(cpu_features) {}
+
+  // Computes y[k] = LogApproximation(x[k]), see fast_math.h.
+  void Log(rtc::ArrayView<const float> x, rtc::ArrayView<float> y) const;
+
+  // Computes the prior and the post SNR from the current and the previous
+  // signal and noise spectra, using the decision directed approach.
+  void ComputeSnr(
+      rtc::ArrayView<const float, kFftSizeBy2Plus1> filter,
+      rtc::ArrayView<const float, kFftSizeBy2Plus1> prev_signal_spectrum,
+      rtc::ArrayView<const float, kFftSizeBy2Plus1> signal_spectrum,
+      rtc::ArrayView<const float, kFftSizeBy2Plus1> prev_noise_spectrum,
+      rtc::ArrayView<const float, kFftSizeBy2Plus1> noise_spectrum,
+      rtc::ArrayView<float, kFftSizeBy2Plus1> prior_snr,
+      rtc::ArrayView<float, kFftSizeBy2Plus1> post_snr) const;
+
+  // Updates the time-averaged log likelihood ratio of each bin.
+  void UpdateLogLrt(rtc::ArrayView<const float, kFftSizeBy2Plus1> prior_snr,
+                    rtc::ArrayView<const float, kFftSizeBy2Plus1> post_snr,
+                    rtc::ArrayView<float, kFftSizeBy2Plus1> avg_log_lrt) const;
+
+  // Updates one of the simultaneous log quantile estimates and its density
+  // with the log spectrum of the current frame. `counter` is the number of
+  // updates done to the estimate.
+  void UpdateQuantile(
+      rtc::ArrayView<const float, kFftSizeBy2Plus1> log_spectrum,
+      int counter,
+      rtc::ArrayView<float, kFftSizeBy2Plus1> log_quantile,
+      rtc::ArrayView<float, kFftSizeBy2Plus1> density) const;
+
+ private:
+  // The AVX2 versions process the samples in blocks of 8 and return the
+  // number of processed samples. The remaining ones are left to the caller.
+  size_t LogAvx2(rtc::ArrayView<const float> x, rtc::ArrayView<float> y) const;
+  size_t ComputeSnrAvx2(
+      rtc::ArrayView<const float, kFftSizeBy2Plus1> filter,
+      rtc::ArrayView<const float, kFftSizeBy2Plus1> prev_signal_spectrum,
+      rtc::ArrayView<const float, kFftSizeBy2Plus1> signal_spectrum,
+      rtc::ArrayView<const float, kFftSizeBy2Plus1> prev_noise_spectrum,
+      rtc::ArrayView<const float, kFftSizeBy2Plus1> noise_spectrum,
+      rtc::ArrayView<float, kFftSizeBy2Plus1> prior_snr,
+      rtc::ArrayView<float, kFftSizeBy2Plus1> post_snr) const;
+  size_t UpdateLogLrtAvx2(
+      rtc::ArrayView<const float, kFftSizeBy2Plus1> prior_snr,
+      rtc::ArrayView<const float, kFftSizeBy2Plus1> post_snr,
+      rtc::ArrayView<float, kFftSizeBy2Plus1> avg_log_lrt) const;
+  size_t UpdateQuantileAvx2(
+      rtc::ArrayView<const float, kFftSizeBy2Plus1> log_spectrum,
+      int counter,
+      rtc::ArrayView<float, kFftSizeBy2Plus1> log_quantile,
+      rtc::ArrayView<float, kFftSizeBy2Plus1> density) const;
+
+  const AvailableCpuFeatures cpu_features_;
+};
+
+}  // namespace webrtc
+
+#endif  // MODULES_AUDIO_PROCESSING_NS_NS_VECTOR_MATH_H_
@@ -0,0 +1,157 @@
+/*
+ *  Copyright 2025 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <immintrin.h>
+
+#include "api/array_view.h"
+#include "modules/audio_processing/ns/ns_vector_math.h"
+#include "rtc_base/checks.h"
+
+namespace webrtc {
+
+namespace {
+
+// Constants of LogApproximation(), see FastLog2f() in fast_math.cc.
+constexpr float kOneByTwoPow23 = 1.1920929e-7f;
+constexpr float kExponentBias = 126.942695f;
+constexpr float kLogOf2 = 0.69314718056f;
+
+// Constants of the quantile estimation.
+constexpr float kWidth = 0.01f;
+constexpr float kOneByWidthPlus2 = 1.f / (2.f * kWidth);
+
+__m256 LogApproximationAvx2(__m256 x) {
+  // The float is interpreted as an integer, which is positive since x > 0.
+  __m256 out = _mm256_cvtepi32_ps(_mm256_castps_si256(x));
+  out = _mm256_mul_ps(out, _mm256_set1_ps(kOneByTwoPow23));
+  out = _mm256_sub_ps(out, _mm256_set1_ps(kExponentBias));
+  return _mm256_mul_ps(out, _mm256_set1_ps(kLogOf2));
+}
+
+}  // namespace
+
+// The functions below are built without FMA, so that the results are
+// identical to those of the C++ code.
+
+size_t NsVectorMath::LogAvx2(rtc::ArrayView<const float> x,
+                             rtc::ArrayView<float> y) const {
+  RTC_DCHECK(cpu_features_.avx2);
+  size_t i = 0;
+  for (; i + 8 <= x.size(); i += 8) {
+    _mm256_storeu_ps(&y[i], LogApproximationAvx2(_mm256_loadu_ps(&x[i])));
+  }
+  return i;
+}
+
+size_t NsVectorMath::ComputeSnrAvx2(
+    rtc::ArrayView<const float, kFftSizeBy2Plus1> filter,
+    rtc::ArrayView<const float, kFftSizeBy2Plus1> prev_signal_spectrum,
+    rtc::ArrayView<const float, kFftSizeBy2Plus1> signal_spectrum,
+    rtc::ArrayView<const float, kFftSizeBy2Plus1> prev_noise_spectrum,
+    rtc::ArrayView<const float, kFftSizeBy2Plus1> noise_spectrum,
+    rtc::ArrayView<float, kFftSizeBy2Plus1> prior_snr,
+    rtc::ArrayView<float, kFftSizeBy2Plus1> post_snr) const {
+  RTC_DCHECK(cpu_features_.avx2);
+  const __m256 kEpsilon = _mm256_set1_ps(0.0001f);
+  size_t i = 0;
+  for (; i + 8 <= kFftSizeBy2Plus1; i += 8) {
+    const __m256 signal = _mm256_loadu_ps(&signal_spectrum[i]);
+    const __m256 noise = _mm256_loadu_ps(&noise_spectrum[i]);
+    const __m256 prev_estimate = _mm256_mul_ps(
+        _mm256_div_ps(
+            _mm256_loadu_ps(&prev_signal_spectrum[i]),
+            _mm256_add_ps(_mm256_loadu_ps(&prev_noise_spectrum[i]), kEpsilon)),
+        _mm256_loadu_ps(&filter[i]));
+    const __m256 post = _mm256_blendv_ps(
+        _mm256_setzero_ps(),
+        _mm256_sub_ps(_mm256_div_ps(signal, _mm256_add_ps(noise, kEpsilon)),
+                      _mm256_set1_ps(1.f)),
+        _mm256_cmp_ps(signal, noise, _CMP_GT_OQ));
+    _mm256_storeu_ps(&post_snr[i], post);
+    _mm256_storeu_ps(
+        &prior_snr[i],
+        _mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(0.98f), prev_estimate),
+                      _mm256_mul_ps(_mm256_set1_ps(1.f - 0.98f), post)));
+  }
+  return i;
+}
+
+size_t NsVectorMath::UpdateLogLrtAvx2(
+    rtc::ArrayView<const float, kFftSizeBy2Plus1> prior_snr,
+    rtc::ArrayView<const float, kFftSizeBy2Plus1> post_snr,
+    rtc::ArrayView<float, kFftSizeBy2Plus1> avg_log_lrt) const {
+  RTC_DCHECK(cpu_features_.avx2);
+  const __m256 kOne = _mm256_set1_ps(1.f);
+  const __m256 kTwo = _mm256_set1_ps(2.f);
+  size_t i = 0;
+  for (; i + 8 <= kFftSizeBy2Plus1; i += 8) {
+    const __m256 prior = _mm256_loadu_ps(&prior_snr[i]);
+    const __m256 tmp1 = _mm256_add_ps(kOne, _mm256_mul_ps(kTwo, prior));
+    const __m256 tmp2 =
+        _mm256_div_ps(_mm256_mul_ps(kTwo, prior),
+                      _mm256_add_ps(tmp1, _mm256_set1_ps(0.0001f)));
+    const __m256 bessel_tmp =
+        _mm256_mul_ps(_mm256_add_ps(_mm256_loadu_ps(&post_snr[i]), kOne), tmp2);
+    const __m256 avg = _mm256_loadu_ps(&avg_log_lrt[i]);
+    const __m256 update = _mm256_mul_ps(
+        _mm256_set1_ps(.5f),
+        _mm256_sub_ps(_mm256_sub_ps(bessel_tmp, LogApproximationAvx2(tmp1)),
+                      avg));
+    _mm256_storeu_ps(&avg_log_lrt[i], _mm256_add_ps(avg, update));
+  }
+  return i;
+}
+
+size_t NsVectorMath::UpdateQuantileAvx2(
+    rtc::ArrayView<const float, kFftSizeBy2Plus1> log_spectrum,
+    int counter,
+    rtc::ArrayView<float, kFftSizeBy2Plus1> log_quantile,
+    rtc::ArrayView<float, kFftSizeBy2Plus1> density) const {
+  RTC_DCHECK(cpu_features_.avx2);
+  const __m256 kOne = _mm256_set1_ps(1.f);
+  const __m256 kDeltaScale = _mm256_set1_ps(40.f);
+  const __m256 kAbsMask = _mm256_castsi256_ps(_mm256_set1_epi32(0x7FFFFFFF));
+  const __m256 counter_f = _mm256_set1_ps(static_cast<float>(counter));
+  const __m256 one_by_counter_plus_1 = _mm256_set1_ps(1.f / (counter + 1.f));
+  size_t i = 0;
+  for (; i + 8 <= kFftSizeBy2Plus1; i += 8) {
+    const __m256 log_signal = _mm256_loadu_ps(&log_spectrum[i]);
+    __m256 quantile = _mm256_loadu_ps(&log_quantile[i]);
+    __m256 dens = _mm256_loadu_ps(&density[i]);
+
+    // Update log quantile estimate.
+    const __m256 delta =
+        _mm256_blendv_ps(kDeltaScale, _mm256_div_ps(kDeltaScale, dens),
+                         _mm256_cmp_ps(dens, kOne, _CMP_GT_OQ));
+    const __m256 multiplier = _mm256_mul_ps(delta, one_by_counter_plus_1);
+    quantile = _mm256_blendv_ps(
+        _mm256_sub_ps(quantile,
+                      _mm256_mul_ps(_mm256_set1_ps(0.75f), multiplier)),
+        _mm256_add_ps(quantile,
+                      _mm256_mul_ps(_mm256_set1_ps(0.25f), multiplier)),
+        _mm256_cmp_ps(log_signal, quantile, _CMP_GT_OQ));
+    _mm256_storeu_ps(&log_quantile[i], quantile);
+
+    // Update density estimate.
+    const __m256 distance =
+        _mm256_and_ps(_mm256_sub_ps(log_signal, quantile), kAbsMask);
+    const __m256 new_density =
+        _mm256_mul_ps(_mm256_add_ps(_mm256_mul_ps(counter_f, dens),
+                                    _mm256_set1_ps(kOneByWidthPlus2)),
+                      one_by_counter_plus_1);
+    dens = _mm256_blendv_ps(
+        dens, new_density,
+        _mm256_cmp_ps(distance, _mm256_set1_ps(kWidth), _CMP_LT_OQ));
+    _mm256_storeu_ps(&density[i], dens);
+  }
+  return i;
+}
+
+}  // namespace webrtc
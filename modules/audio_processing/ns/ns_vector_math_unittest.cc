@@ -0,0 +1,162 @@
+/*
+ *  Copyright 2025 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "modules/audio_processing/ns/ns_vector_math.h"
+
+#include <array>
+#include <vector>
+
+#include "modules/audio_processing/agc2/cpu_features.h"
+#include "modules/audio_processing/ns/ns_common.h"
+#include "rtc_base/random.h"
+#include "test/gtest.h"
+
+namespace webrtc {
+namespace {
+
+using Spectrum = std::array<float, kFftSizeBy2Plus1>;
+
+// Fills `x` with positive values spanning a wide range, like spectra do.
+void FillSpectrum(Random& random, Spectrum& x) {
+  for (float& v : x) {
+    v = static_cast<float>(random.Exponential(0.001));
+  }
+}
+
+void ExpectFloatEq(const Spectrum& expected, const Spectrum& actual) {
+  for (size_t i = 0; i < kFftSizeBy2Plus1; ++i) {
+    EXPECT_FLOAT_EQ(expected[i], actual[i]) << "bin " << i;
+  }
+}
+
+class NsVectorMathParametrization
+    : public ::testing::TestWithParam<AvailableCpuFeatures> {};
+
+TEST_P(NsVectorMathParametrization, LogMatchesReference) {
+  const NsVectorMath reference(NoAvailableCpuFeatures());
+  const NsVectorMath vector_math(/*cpu_features=*/GetParam());
+  Random random(42);
+  Spectrum x;
+  Spectrum expected;
+  Spectrum actual;
+  for (int k = 0; k < 10; ++k) {
+    FillSpectrum(random, x);
+    x[k] = 1.f;
+    reference.Log(x, expected);
+    vector_math.Log(x, actual);
+    ExpectFloatEq(expected, actual);
+  }
+}
+
+TEST_P(NsVectorMathParametrization, ComputeSnrMatchesReference) {
+  const NsVectorMath reference(NoAvailableCpuFeatures());
+  const NsVectorMath vector_math(/*cpu_features=*/GetParam());
+  Random random(42);
+  Spectrum filter;
+  Spectrum prev_signal;
+  Spectrum signal;
+  Spectrum prev_noise;
+  Spectrum noise;
+  Spectrum expected_prior_snr;
+  Spectrum expected_post_snr;
+  Spectrum prior_snr;
+  Spectrum post_snr;
+  for (int k = 0; k < 10; ++k) {
+    for (float& v : filter) {
+      v = random.Rand(0, 1000) / 1000.f;
+    }
+    FillSpectrum(random, prev_signal);
+    FillSpectrum(random, signal);
+    FillSpectrum(random, prev_noise);
+    FillSpectrum(random, noise);
+    reference.ComputeSnr(filter, prev_signal, signal, prev_noise, noise,
+                         expected_prior_snr, expected_post_snr);
+    vector_math.ComputeSnr(filter, prev_signal, signal, prev_noise, noise,
+                           prior_snr, post_snr);
+    ExpectFloatEq(expected_prior_snr, prior_snr);
+    ExpectFloatEq(expected_post_snr, post_snr);
+  }
+}
+
+TEST_P(NsVectorMathParametrization, UpdateLogLrtMatchesReference) {
+  const NsVectorMath reference(NoAvailableCpuFeatures());
+  const NsVectorMath vector_math(/*cpu_features=*/GetParam());
+  Random random(42);
+  Spectrum prior_snr;
+  Spectrum post_snr;
+  Spectrum expected_avg_log_lrt;
+  Spectrum avg_log_lrt;
+  expected_avg_log_lrt.fill(kLtrFeatureThr);
+  avg_log_lrt.fill(kLtrFeatureThr);
+  for (int k = 0; k < 100; ++k) {
+    FillSpectrum(random, prior_snr);
+    FillSpectrum(random, post_snr);
+    reference.UpdateLogLrt(prior_snr, post_snr, expected_avg_log_lrt);
+    vector_math.UpdateLogLrt(prior_snr, post_snr, avg_log_lrt);
+    ExpectFloatEq(expected_avg_log_lrt, avg_log_lrt);
+  }
+}
+
+TEST_P(NsVectorMathParametrization, UpdateQuantileMatchesReference) {
+  const NsVectorMath reference(NoAvailableCpuFeatures());
+  const NsVectorMath vector_math(/*cpu_features=*/GetParam());
+  Random random(42);
+  Spectrum spectrum;
+  Spectrum log_spectrum;
+  Spectrum expected_log_quantile;
+  Spectrum expected_density;
+  Spectrum log_quantile;
+  Spectrum density;
+  expected_log_quantile.fill(8.f);
+  expected_density.fill(.3f);
+  log_quantile.fill(8.f);
+  density.fill(.3f);
+  for (int counter = 1; counter <= kLongStartupPhaseBlocks; ++counter) {
+    FillSpectrum(random, spectrum);
+    reference.Log(spectrum, log_spectrum);
+    // Put some of the bins close to the estimate, to update the density.
+    for (size_t i = 0; i < kFftSizeBy2Plus1; i += 3) {
+      log_spectrum[i] = expected_log_quantile[i] + 0.001f;
+    }
+    reference.UpdateQuantile(log_spectrum, counter, expected_log_quantile,
+                             expected_density);
+    vector_math.UpdateQuantile(log_spectrum, counter, log_quantile, density);
+    ExpectFloatEq(expected_log_quantile, log_quantile);
+    ExpectFloatEq(expected_density, density);
+  }
+}
+
+// Finds the relevant CPU features combinations to test.
+std::vector<AvailableCpuFeatures> GetCpuFeaturesToTest() {
+  std::vector<AvailableCpuFeatures> v;
+  v.push_back({/*sse2=*/false, /*avx2=*/false, /*neon=*/false});
+  AvailableCpuFeatures available = GetAvailableCpuFeatures();
+  if (available.avx2) {
+    v.push_back({/*sse2=*/false, /*avx2=*/true, /*neon=*/false});
+  }
+  if (available.sse2) {
+    v.push_back({/*sse2=*/true, /*avx2=*/false, /*neon=*/false});
+  }
+  if (available.neon) {
+    v.push_back({/*sse2=*/false, /*avx2=*/false, /*neon=*/true});
+  }
+  return v;
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    NsTest,
+    NsVectorMathParametrization,
+    ::testing::ValuesIn(GetCpuFeaturesToTest()),
+    [](const ::testing::TestParamInfo<AvailableCpuFeatures>& info) {
+      return info.param.ToString();
+    });
+
+}  // namespace
+}  // namespace webrtc
@@ -16,7 +16,9 @@
 #include <array>
 
 #include "api/array_view.h"
+#include "modules/audio_processing/agc2/cpu_features.h"
 #include "modules/audio_processing/ns/ns_common.h"
+#include "modules/audio_processing/ns/ns_vector_math.h"
 
 namespace webrtc {
 
@@ -25,7 +27,7 @@ constexpr int kSimult = 3;
 // For quantile noise estimation.
 class QuantileNoiseEstimator {
  public:
-  QuantileNoiseEstimator();
+  explicit QuantileNoiseEstimator(const AvailableCpuFeatures& cpu_features);
   QuantileNoiseEstimator(const QuantileNoiseEstimator&) = delete;
   QuantileNoiseEstimator& operator=(const QuantileNoiseEstimator&) = delete;
 
@@ -34,6 +36,7 @@ class QuantileNoiseEstimator {
                 rtc::ArrayView<float, kFftSizeBy2Plus1> noise_spectrum);
 
  private:
+  const NsVectorMath vector_math_;
   std::array<float, kSimult * kFftSizeBy2Plus1> density_;
   std::array<float, kSimult * kFftSizeBy2Plus1> log_quantile_;
   std::array<float, kFftSizeBy2Plus1> quantile_;
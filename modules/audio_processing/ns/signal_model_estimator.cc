@@ -94,19 +94,14 @@ void UpdateSpectralFlatness(
 }
 
 // Updates the log LRT measures.
-void UpdateSpectralLrt(rtc::ArrayView<const float, kFftSizeBy2Plus1> prior_snr,
+void UpdateSpectralLrt(const NsVectorMath& vector_math,
+                       rtc::ArrayView<const float, kFftSizeBy2Plus1> prior_snr,
                        rtc::ArrayView<const float, kFftSizeBy2Plus1> post_snr,
                        rtc::ArrayView<float, kFftSizeBy2Plus1> avg_log_lrt,
                        float* lrt) {
   RTC_DCHECK(lrt);
 
-  for (size_t i = 0; i < kFftSizeBy2Plus1; ++i) {
-    float tmp1 = 1.f + 2.f * prior_snr[i];
-    float tmp2 = 2.f * prior_snr[i] / (tmp1 + 0.0001f);
-    float bessel_tmp = (post_snr[i] + 1.f) * tmp2;
-    avg_log_lrt[i] +=
-        .5f * (bessel_tmp - LogApproximation(tmp1) - avg_log_lrt[i]);
-  }
+  vector_math.UpdateLogLrt(prior_snr, post_snr, avg_log_lrt);
 
   float log_lrt_time_avg_k_sum = 0.f;
   for (size_t i = 0; i < kFftSizeBy2Plus1; ++i) {
@@ -117,8 +112,9 @@ void UpdateSpectralLrt(rtc::ArrayView<const float, kFftSizeBy2Plus1> prior_snr,
 
 }  // namespace
 
-SignalModelEstimator::SignalModelEstimator()
-    : prior_model_estimator_(kLtrFeatureThr) {}
+SignalModelEstimator::SignalModelEstimator(
+    const AvailableCpuFeatures& cpu_features)
+    : vector_math_(cpu_features), prior_model_estimator_(kLtrFeatureThr) {}
 
 void SignalModelEstimator::AdjustNormalization(int32_t num_analyzed_frames,
                                                float signal_energy) {
@@ -169,7 +165,8 @@ void SignalModelEstimator::Update(
   }
 
   // Compute the LRT.
-  UpdateSpectralLrt(prior_snr, post_snr, features_.avg_log_lrt, &features_.lrt);
+  UpdateSpectralLrt(vector_math_, prior_snr, post_snr, features_.avg_log_lrt,
+                    &features_.lrt);
 }
 
 }  // namespace webrtc
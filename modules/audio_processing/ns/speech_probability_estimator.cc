@@ -19,7 +19,9 @@
 
 namespace webrtc {
 
-SpeechProbabilityEstimator::SpeechProbabilityEstimator() {
+SpeechProbabilityEstimator::SpeechProbabilityEstimator(
+    const AvailableCpuFeatures& cpu_features)
+    : signal_model_estimator_(cpu_features) {
   speech_probability_.fill(0.f);
 }
 
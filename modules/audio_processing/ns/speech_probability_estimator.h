@@ -14,6 +14,7 @@
 #include <array>
 
 #include "api/array_view.h"
+#include "modules/audio_processing/agc2/cpu_features.h"
 #include "modules/audio_processing/ns/ns_common.h"
 #include "modules/audio_processing/ns/signal_model_estimator.h"
 
@@ -22,7 +23,8 @@ namespace webrtc {
 // Class for estimating the probability of speech.
 class SpeechProbabilityEstimator {
  public:
-  SpeechProbabilityEstimator();
+  explicit SpeechProbabilityEstimator(
+      const AvailableCpuFeatures& cpu_features);
   SpeechProbabilityEstimator(const SpeechProbabilityEstimator&) = delete;
   SpeechProbabilityEstimator& operator=(const SpeechProbabilityEstimator&) =
       delete;
@@ -14,10 +14,10 @@
 #include <array>
 #include <cstddef>
 #include <cstdint>
-#include <deque>
 #include <memory>
 #include <optional>
 #include <utility>
+#include <vector>
 
 #include "absl/container/inlined_vector.h"
 #include "api/units/data_size.h"
@@ -26,6 +26,7 @@
 #include "modules/rtp_rtcp/include/rtp_rtcp_defines.h"
 #include "modules/rtp_rtcp/source/rtp_packet_to_send.h"
 #include "rtc_base/checks.h"
+#include "rtc_base/containers/flat_map.h"
 #include "rtc_base/logging.h"
 
 namespace webrtc {
@@ -33,6 +34,9 @@ namespace {
 
 constexpr int kAudioPrioLevel = 0;
 
+// `enqueue_times_` is not compacted while it has at most this many entries.
+constexpr size_t kMinEnqueueTimesToCompact = 64;
+
 int GetPriorityForType(
     RtpPacketMediaType type,
     std::optional<RtpPacketToSend::OriginalType> original_type) {
@@ -86,6 +90,12 @@ DataSize PrioritizedPacketQueue::QueuedPacket::PacketSize() const {
 PrioritizedPacketQueue::StreamQueue::StreamQueue(Timestamp creation_time)
     : last_enqueue_time_(creation_time), num_keyframe_packets_(0) {}
 
+void PrioritizedPacketQueue::StreamQueue::Reset(Timestamp creation_time) {
+  RTC_DCHECK(IsEmpty());
+  last_enqueue_time_ = creation_time;
+  num_keyframe_packets_ = 0;
+}
+
 bool PrioritizedPacketQueue::StreamQueue::EnqueuePacket(QueuedPacket packet,
                                                         int priority_level) {
   if (packet.packet->is_key_frame()) {
@@ -99,8 +109,7 @@ bool PrioritizedPacketQueue::StreamQueue::EnqueuePacket(QueuedPacket packet,
 PrioritizedPacketQueue::QueuedPacket
 PrioritizedPacketQueue::StreamQueue::DequeuePacket(int priority_level) {
   RTC_DCHECK(!packets_[priority_level].empty());
-  QueuedPacket packet = std::move(packets_[priority_level].front());
-  packets_[priority_level].pop_front();
+  QueuedPacket packet = packets_[priority_level].pop_front();
   if (packet.packet->is_key_frame()) {
     RTC_DCHECK_GT(num_keyframe_packets_, 0);
     --num_keyframe_packets_;
@@ -114,7 +123,7 @@ bool PrioritizedPacketQueue::StreamQueue::HasPacketsAtPrio(
 }
 
 bool PrioritizedPacketQueue::StreamQueue::IsEmpty() const {
-  for (const std::deque<QueuedPacket>& queue : packets_) {
+  for (const Fifo<QueuedPacket>& queue : packets_) {
     if (!queue.empty()) {
       return false;
     }
@@ -125,24 +134,13 @@ bool PrioritizedPacketQueue::StreamQueue::IsEmpty() const {
 Timestamp PrioritizedPacketQueue::StreamQueue::LeadingPacketEnqueueTime(
     int priority_level) const {
   RTC_DCHECK(!packets_[priority_level].empty());
-  return packets_[priority_level].begin()->enqueue_time;
+  return packets_[priority_level].front().enqueue_time;
 }
 
 Timestamp PrioritizedPacketQueue::StreamQueue::LastEnqueueTime() const {
   return last_enqueue_time_;
 }
 
-std::array<std::deque<PrioritizedPacketQueue::QueuedPacket>,
-           PrioritizedPacketQueue::kNumPriorityLevels>
-PrioritizedPacketQueue::StreamQueue::DequeueAll() {
-  std::array<std::deque<QueuedPacket>, kNumPriorityLevels> packets_by_prio;
-  for (int i = 0; i < kNumPriorityLevels; ++i) {
-    packets_by_prio[i].swap(packets_[i]);
-  }
-  num_keyframe_packets_ = 0;
-  return packets_by_prio;
-}
-
 PrioritizedPacketQueue::PrioritizedPacketQueue(
     Timestamp creation_time,
     bool prioritize_audio_retransmission,
@@ -157,31 +155,40 @@ PrioritizedPacketQueue::PrioritizedPacketQueue(
       last_update_time_(creation_time),
       paused_(false),
       last_culling_time_(creation_time),
-      top_active_prio_level_(-1) {}
+      top_active_prio_level_(-1),
+      first_enqueue_order_(0) {}
 
 void PrioritizedPacketQueue::Push(Timestamp enqueue_time,
                                   std::unique_ptr<RtpPacketToSend> packet) {
-  StreamQueue* stream_queue;
-  auto [it, inserted] = streams_.emplace(packet->Ssrc(), nullptr);
+  auto [it, inserted] = stream_indices_.emplace(packet->Ssrc(), 0);
   if (inserted) {
-    it->second = std::make_unique<StreamQueue>(enqueue_time);
+    if (free_stream_indices_.empty()) {
+      it->second = streams_.size();
+      streams_.emplace_back(enqueue_time);
+    } else {
+      it->second = free_stream_indices_.back();
+      free_stream_indices_.pop_back();
+      streams_[it->second].Reset(enqueue_time);
+    }
   }
-  stream_queue = it->second.get();
+  const int stream_index = it->second;
 
-  auto enqueue_time_iterator =
-      enqueue_times_.insert(enqueue_times_.end(), enqueue_time);
   RTC_DCHECK(packet->packet_type().has_value());
   RtpPacketMediaType packet_type = packet->packet_type().value();
   int prio_level =
       GetPriorityForType(packet_type, prioritize_audio_retransmission_
                                           ? packet->original_packet_type()
                                           : std::nullopt);
-  PurgeOldPacketsAtPriorityLevel(prio_level, enqueue_time);
   RTC_DCHECK_GE(prio_level, 0);
   RTC_DCHECK_LT(prio_level, kNumPriorityLevels);
+  // Purge before reserving the enqueue order of the new packet, as dropping
+  // packets may compact `enqueue_times_` and renumber the queued packets.
+  PurgeOldPacketsAtPriorityLevel(prio_level, enqueue_time);
+  const int64_t enqueue_order = first_enqueue_order_ + enqueue_times_.size();
+  enqueue_times_.push_back(enqueue_time);
   QueuedPacket queued_packed = {.packet = std::move(packet),
                                 .enqueue_time = enqueue_time,
-                                .enqueue_time_iterator = enqueue_time_iterator};
+                                .enqueue_order = enqueue_order};
   // In order to figure out how much time a packet has spent in the queue
   // while not in a paused state, we subtract the total amount of time the
   // queue has been paused so far, and when the packet is popped we subtract
@@ -194,9 +201,10 @@ void PrioritizedPacketQueue::Push(Timestamp enqueue_time,
   ++size_packets_per_media_type_[static_cast<size_t>(packet_type)];
   size_payload_ += queued_packed.PacketSize();
 
-  if (stream_queue->EnqueuePacket(std::move(queued_packed), prio_level)) {
+  if (streams_[stream_index].EnqueuePacket(std::move(queued_packed),
+                                           prio_level)) {
     // Number packets at `prio_level` for this steam is now non-zero.
-    streams_by_prio_[prio_level].push_back(stream_queue);
+    streams_by_prio_[prio_level].push_back(stream_index);
   }
   if (top_active_prio_level_ < 0 || prio_level < top_active_prio_level_) {
     top_active_prio_level_ = prio_level;
@@ -204,14 +212,15 @@ void PrioritizedPacketQueue::Push(Timestamp enqueue_time,
 
   static constexpr TimeDelta kTimeout = TimeDelta::Millis(500);
   if (enqueue_time - last_culling_time_ > kTimeout) {
-    for (auto it = streams_.begin(); it != streams_.end();) {
-      if (it->second->IsEmpty() &&
-          it->second->LastEnqueueTime() + kTimeout < enqueue_time) {
-        streams_.erase(it++);
-      } else {
-        ++it;
+    EraseIf(stream_indices_, [&](const std::pair<uint32_t, int>& entry) {
+      const StreamQueue& stream_queue = streams_[entry.second];
+      if (stream_queue.IsEmpty() &&
+          stream_queue.LastEnqueueTime() + kTimeout < enqueue_time) {
+        free_stream_indices_.push_back(entry.second);
+        return true;
       }
-    }
+      return false;
+    });
     last_culling_time_ = enqueue_time;
   }
 }
@@ -222,15 +231,16 @@ std::unique_ptr<RtpPacketToSend> PrioritizedPacketQueue::Pop() {
   }
 
   RTC_DCHECK_GE(top_active_prio_level_, 0);
-  StreamQueue& stream_queue = *streams_by_prio_[top_active_prio_level_].front();
+  Fifo<int>& streams_at_prio = streams_by_prio_[top_active_prio_level_];
+  StreamQueue& stream_queue = streams_[streams_at_prio.front()];
   QueuedPacket packet = stream_queue.DequeuePacket(top_active_prio_level_);
   DequeuePacketInternal(packet);
 
   // Remove StreamQueue from head of fifo-queue for this prio level, and
   // and add it to the end if it still has packets.
-  streams_by_prio_[top_active_prio_level_].pop_front();
+  const int stream_index = streams_at_prio.pop_front();
   if (stream_queue.HasPacketsAtPrio(top_active_prio_level_)) {
-    streams_by_prio_[top_active_prio_level_].push_back(&stream_queue);
+    streams_at_prio.push_back(stream_index);
   } else {
     MaybeUpdateTopPrioLevel();
   }
@@ -262,8 +272,7 @@ Timestamp PrioritizedPacketQueue::LeadingPacketEnqueueTime(
   if (streams_by_prio_[priority_level].empty()) {
     return Timestamp::MinusInfinity();
   }
-  return streams_by_prio_[priority_level].front()->LeadingPacketEnqueueTime(
-      priority_level);
+  return LeadingStream(priority_level).LeadingPacketEnqueueTime(priority_level);
 }
 
 Timestamp PrioritizedPacketQueue::LeadingPacketEnqueueTimeForRetransmission()
@@ -274,8 +283,8 @@ Timestamp PrioritizedPacketQueue::LeadingPacketEnqueueTimeForRetransmission()
     if (streams_by_prio_[priority_level].empty()) {
       return Timestamp::PlusInfinity();
     }
-    return streams_by_prio_[priority_level].front()->LeadingPacketEnqueueTime(
-        priority_level);
+    return LeadingStream(priority_level)
+        .LeadingPacketEnqueueTime(priority_level);
   }
   const int audio_priority_level =
       GetPriorityForType(RtpPacketMediaType::kRetransmission,
@@ -287,21 +296,19 @@ Timestamp PrioritizedPacketQueue::LeadingPacketEnqueueTimeForRetransmission()
   Timestamp next_audio =
       streams_by_prio_[audio_priority_level].empty()
           ? Timestamp::PlusInfinity()
-          : streams_by_prio_[audio_priority_level]
-                .front()
-                ->LeadingPacketEnqueueTime(audio_priority_level);
+          : LeadingStream(audio_priority_level)
+                .LeadingPacketEnqueueTime(audio_priority_level);
   Timestamp next_video =
       streams_by_prio_[video_priority_level].empty()
           ? Timestamp::PlusInfinity()
-          : streams_by_prio_[video_priority_level]
-                .front()
-                ->LeadingPacketEnqueueTime(video_priority_level);
+          : LeadingStream(video_priority_level)
+                .LeadingPacketEnqueueTime(video_priority_level);
   return std::min(next_audio, next_video);
 }
 
 Timestamp PrioritizedPacketQueue::OldestEnqueueTime() const {
   return enqueue_times_.empty() ? Timestamp::MinusInfinity()
-                                : enqueue_times_.front();
+                                : *enqueue_times_.front();
 }
 
 TimeDelta PrioritizedPacketQueue::AverageQueueTime() const {
@@ -334,41 +341,30 @@ void PrioritizedPacketQueue::SetPauseState(bool paused, Timestamp now) {
 }
 
 void PrioritizedPacketQueue::RemovePacketsForSsrc(uint32_t ssrc) {
-  auto kv = streams_.find(ssrc);
-  if (kv != streams_.end()) {
-    // Dequeue all packets from the queue for this SSRC.
-    StreamQueue& queue = *kv->second;
-    std::array<std::deque<QueuedPacket>, kNumPriorityLevels> packets_by_prio =
-        queue.DequeueAll();
+  auto kv = stream_indices_.find(ssrc);
+  if (kv != stream_indices_.end()) {
+    const int stream_index = kv->second;
+    StreamQueue& queue = streams_[stream_index];
     for (int i = 0; i < kNumPriorityLevels; ++i) {
-      std::deque<QueuedPacket>& packet_queue = packets_by_prio[i];
-      if (packet_queue.empty()) {
+      if (!queue.HasPacketsAtPrio(i)) {
         continue;
       }
 
       // First erase all packets at this prio level.
-      while (!packet_queue.empty()) {
-        QueuedPacket packet = std::move(packet_queue.front());
-        packet_queue.pop_front();
+      while (queue.HasPacketsAtPrio(i)) {
+        QueuedPacket packet = queue.DequeuePacket(i);
         DequeuePacketInternal(packet);
       }
 
-      // Next, deregister this `StreamQueue` from the round-robin tables.
-      RTC_DCHECK(!streams_by_prio_[i].empty());
-      if (streams_by_prio_[i].size() == 1) {
-        // This is the last and only queue that had packets for this prio level.
-        // Update the global top prio level if neccessary.
-        RTC_DCHECK(streams_by_prio_[i].front() == &queue);
-        streams_by_prio_[i].pop_front();
-      } else {
-        // More than stream had packets at this prio level, filter this one out.
-        std::deque<StreamQueue*> filtered_queue;
-        for (StreamQueue* queue_ptr : streams_by_prio_[i]) {
-          if (queue_ptr != &queue) {
-            filtered_queue.push_back(queue_ptr);
-          }
+      // Next, deregister this `StreamQueue` from the round-robin tables,
+      // keeping the order of the other streams.
+      Fifo<int>& streams_at_prio = streams_by_prio_[i];
+      RTC_DCHECK(!streams_at_prio.empty());
+      for (size_t n = streams_at_prio.size(); n > 0; --n) {
+        const int index = streams_at_prio.pop_front();
+        if (index != stream_index) {
+          streams_at_prio.push_back(index);
         }
-        streams_by_prio_[i].swap(filtered_queue);
       }
     }
   }
@@ -376,9 +372,9 @@ void PrioritizedPacketQueue::RemovePacketsForSsrc(uint32_t ssrc) {
 }
 
 bool PrioritizedPacketQueue::HasKeyframePackets(uint32_t ssrc) const {
-  auto it = streams_.find(ssrc);
-  if (it != streams_.end()) {
-    return it->second->has_keyframe_packets();
+  auto it = stream_indices_.find(ssrc);
+  if (it != stream_indices_.end()) {
+    return streams_[it->second].has_keyframe_packets();
   }
   return false;
 }
@@ -410,8 +406,47 @@ void PrioritizedPacketQueue::DequeuePacketInternal(QueuedPacket& packet) {
 
   RTC_DCHECK(size_packets_ > 0 || queue_time_sum_ == TimeDelta::Zero());
 
-  RTC_CHECK(packet.enqueue_time_iterator != enqueue_times_.end());
-  enqueue_times_.erase(packet.enqueue_time_iterator);
+  // Clear the packet's enqueue time, and drop the cleared entries from the
+  // front so that the first entry is the oldest remaining packet's.
+  const int64_t index = packet.enqueue_order - first_enqueue_order_;
+  RTC_CHECK_GE(index, 0);
+  RTC_CHECK_LT(index, enqueue_times_.size());
+  enqueue_times_.at(index).reset();
+  while (!enqueue_times_.empty() && !enqueue_times_.front().has_value()) {
+    enqueue_times_.pop_front();
+    ++first_enqueue_order_;
+  }
+  MaybeCompactEnqueueTimes();
+}
+
+void PrioritizedPacketQueue::MaybeCompactEnqueueTimes() {
+  // The packet being dequeued has already left `size_packets_`, so the entry
+  // count is compared to the packets still in the queue. Compacting when at
+  // least half of the entries are cleared keeps the amortized cost per packet
+  // constant.
+  if (enqueue_times_.size() <= kMinEnqueueTimesToCompact ||
+      enqueue_times_.size() <= 2 * static_cast<size_t>(size_packets_)) {
+    return;
+  }
+  // New position of every remaining entry, by old position.
+  std::vector<int64_t> new_positions(enqueue_times_.size(), -1);
+  Fifo<std::optional<Timestamp>> compacted;
+  for (size_t i = 0; i < enqueue_times_.size(); ++i) {
+    if (enqueue_times_.at(i).has_value()) {
+      new_positions[i] = compacted.size();
+      compacted.push_back(enqueue_times_.at(i));
+    }
+  }
+  RTC_DCHECK_EQ(compacted.size(), static_cast<size_t>(size_packets_));
+  for (StreamQueue& stream_queue : streams_) {
+    stream_queue.ForEachPacket([&](QueuedPacket& packet) {
+      const int64_t new_position =
+          new_positions[packet.enqueue_order - first_enqueue_order_];
+      RTC_DCHECK_GE(new_position, 0);
+      packet.enqueue_order = first_enqueue_order_ + new_position;
+    });
+  }
+  enqueue_times_ = std::move(compacted);
 }
 
 void PrioritizedPacketQueue::MaybeUpdateTopPrioLevel() {
@@ -443,14 +478,15 @@ void PrioritizedPacketQueue::PurgeOldPacketsAtPriorityLevel(int prio_level,
     return;
   }
 
-  std::deque<StreamQueue*>& queues = streams_by_prio_[prio_level];
-  auto iter = queues.begin();
-  while (iter != queues.end()) {
-    StreamQueue* queue_ptr = *iter;
-    while (queue_ptr->HasPacketsAtPrio(prio_level) &&
-           (now - queue_ptr->LeadingPacketEnqueueTime(prio_level)) >
-               time_to_live) {
-      QueuedPacket packet = queue_ptr->DequeuePacket(prio_level);
+  // Visit every stream with packets at this level once, keeping the order of
+  // the streams that still have packets left.
+  Fifo<int>& queues = streams_by_prio_[prio_level];
+  for (size_t n = queues.size(); n > 0; --n) {
+    const int stream_index = queues.pop_front();
+    StreamQueue& queue = streams_[stream_index];
+    while (queue.HasPacketsAtPrio(prio_level) &&
+           (now - queue.LeadingPacketEnqueueTime(prio_level)) > time_to_live) {
+      QueuedPacket packet = queue.DequeuePacket(prio_level);
       RTC_LOG(LS_INFO) << "Dropping old packet on SSRC: "
                        << packet.packet->Ssrc()
                        << " seq:" << packet.packet->SequenceNumber()
@@ -458,10 +494,8 @@ void PrioritizedPacketQueue::PurgeOldPacketsAtPriorityLevel(int prio_level,
                        << " ms";
       DequeuePacketInternal(packet);
     }
-    if (!queue_ptr->HasPacketsAtPrio(prio_level)) {
-      iter = queues.erase(iter);
-    } else {
-      ++iter;
+    if (queue.HasPacketsAtPrio(prio_level)) {
+      queues.push_back(stream_index);
     }
   }
 }
@@ -13,12 +13,13 @@
 
 #include <stddef.h>
 
+#include <algorithm>
 #include <array>
 #include <cstdint>
-#include <deque>
-#include <list>
 #include <memory>
-#include <unordered_map>
+#include <optional>
+#include <utility>
+#include <vector>
 
 #include "absl/container/inlined_vector.h"
 #include "api/units/data_size.h"
@@ -26,6 +27,8 @@
 #include "api/units/timestamp.h"
 #include "modules/rtp_rtcp/include/rtp_rtcp_defines.h"
 #include "modules/rtp_rtcp/source/rtp_packet_to_send.h"
+#include "rtc_base/checks.h"
+#include "rtc_base/containers/flat_map.h"
 
 namespace webrtc {
 
@@ -105,13 +108,63 @@ class PrioritizedPacketQueue {
  private:
   static constexpr int kNumPriorityLevels = 5;
 
+  // FIFO queue in a ring of slots whose size is a power of two. The ring
+  // doubles when full and never shrinks, so a queue that has reached its
+  // working size no longer allocates. Popped slots are reset to T().
+  template <typename T>
+  class Fifo {
+   public:
+    bool empty() const { return size_ == 0; }
+    size_t size() const { return size_; }
+
+    // Returns the element at position `index`, counted from the front.
+    T& at(size_t index) {
+      RTC_DCHECK_LT(index, size_);
+      return slots_[(first_ + index) & (slots_.size() - 1)];
+    }
+    const T& at(size_t index) const {
+      RTC_DCHECK_LT(index, size_);
+      return slots_[(first_ + index) & (slots_.size() - 1)];
+    }
+    T& front() { return at(0); }
+    const T& front() const { return at(0); }
+
+    void push_back(T value) {
+      if (size_ == slots_.size()) {
+        std::vector<T> slots(std::max<size_t>(8, 2 * slots_.size()));
+        for (size_t i = 0; i < size_; ++i) {
+          slots[i] = std::move(at(i));
+        }
+        slots_ = std::move(slots);
+        first_ = 0;
+      }
+      ++size_;
+      at(size_ - 1) = std::move(value);
+    }
+
+    T pop_front() {
+      T value = std::move(front());
+      front() = T();
+      first_ = (first_ + 1) & (slots_.size() - 1);
+      --size_;
+      return value;
+    }
+
+   private:
+    std::vector<T> slots_;
+    size_t first_ = 0;
+    size_t size_ = 0;
+  };
+
   class QueuedPacket {
    public:
     DataSize PacketSize() const;
 
     std::unique_ptr<RtpPacketToSend> packet;
-    Timestamp enqueue_time;
-    std::list<Timestamp>::iterator enqueue_time_iterator;
+    Timestamp enqueue_time = Timestamp::MinusInfinity();
+    // Position of the packet's entry in `enqueue_times_`, counted from the
+    // first packet ever pushed.
+    int64_t enqueue_order = 0;
   };
 
   // Class containing packets for an RTP stream.
@@ -125,6 +178,10 @@ class PrioritizedPacketQueue {
     StreamQueue(const StreamQueue&) = delete;
     StreamQueue& operator=(const StreamQueue&) = delete;
 
+    // Prepares an empty queue to be used for a new stream, keeping the
+    // capacity of its fifo queues.
+    void Reset(Timestamp creation_time);
+
     // Enqueue packet at the given priority level. Returns true if the packet
     // count for that priority level went from zero to non-zero.
     bool EnqueuePacket(QueuedPacket packet, int priority_level);
@@ -137,10 +194,18 @@ class PrioritizedPacketQueue {
     Timestamp LastEnqueueTime() const;
     bool has_keyframe_packets() const { return num_keyframe_packets_ > 0; }
 
-    std::array<std::deque<QueuedPacket>, kNumPriorityLevels> DequeueAll();
+    // Calls `function` with every packet in the queue.
+    template <typename Function>
+    void ForEachPacket(Function function) {
+      for (Fifo<QueuedPacket>& queue : packets_) {
+        for (size_t i = 0; i < queue.size(); ++i) {
+          function(queue.at(i));
+        }
+      }
+    }
 
    private:
-    std::deque<QueuedPacket> packets_[kNumPriorityLevels];
+    Fifo<QueuedPacket> packets_[kNumPriorityLevels];
     Timestamp last_enqueue_time_;
     int num_keyframe_packets_;
   };
@@ -154,6 +219,16 @@ class PrioritizedPacketQueue {
 
   void PurgeOldPacketsAtPriorityLevel(int prio_level, Timestamp now);
 
+  // Drops the cleared entries from `enqueue_times_` if they outnumber the
+  // packets in the queue, and renumbers the packets' `enqueue_order`.
+  void MaybeCompactEnqueueTimes();
+
+  // The stream whose turn it is to send at `priority_level`, which must have
+  // packets pending.
+  const StreamQueue& LeadingStream(int priority_level) const {
+    return streams_[streams_by_prio_[priority_level].front()];
+  }
+
   static absl::InlinedVector<TimeDelta, kNumPriorityLevels> ToTtlPerPrio(
       PacketQueueTTL);
 
@@ -178,20 +253,30 @@ class PrioritizedPacketQueue {
   // Last time `streams_` was culled for inactive streams.
   Timestamp last_culling_time_;
 
-  // Map from SSRC to packet queues for the associated RTP stream.
-  std::unordered_map<uint32_t, std::unique_ptr<StreamQueue>> streams_;
+  // Packet queues for the RTP streams, stored contiguously and referred to by
+  // index. Slots of culled streams are listed in `free_stream_indices_` and
+  // reused for new streams.
+  std::vector<StreamQueue> streams_;
+  std::vector<int> free_stream_indices_;
+  // Map from SSRC to index into `streams_`.
+  flat_map<uint32_t, int> stream_indices_;
 
-  // For each priority level, a queue of StreamQueues which have at least one
-  // packet pending for that prio level.
-  std::deque<StreamQueue*> streams_by_prio_[kNumPriorityLevels];
+  // For each priority level, a queue of indices of the StreamQueues which
+  // have at least one packet pending for that prio level.
+  Fifo<int> streams_by_prio_[kNumPriorityLevels];
 
   // The first index into `stream_by_prio_` that is non-empty.
   int top_active_prio_level_;
 
-  // Ordered list of enqueue times. Additions are always increasing and added to
-  // the end. QueuedPacket instances have a iterators into this list for fast
-  // removal.
-  std::list<Timestamp> enqueue_times_;
+  // Enqueue times of the packets, in the order they were pushed. Additions
+  // are always increasing and added to the end. Entries of packets that have
+  // left the queue are cleared, and cleared entries are dropped from the
+  // front, so the first entry is always the oldest packet's. Cleared entries
+  // behind an old packet, e.g. padding waiting behind media, are compacted
+  // away by MaybeCompactEnqueueTimes().
+  Fifo<std::optional<Timestamp>> enqueue_times_;
+  // `QueuedPacket::enqueue_order` of the first entry in `enqueue_times_`.
+  int64_t first_enqueue_order_;
 };
 
 }  // namespace webrtc
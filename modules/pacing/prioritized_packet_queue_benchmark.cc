@@ -0,0 +1,95 @@
+/*
+ *  Copyright 2025 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "api/units/time_delta.h"
+#include "api/units/timestamp.h"
+#include "benchmark/benchmark.h"
+#include "modules/pacing/prioritized_packet_queue.h"
+#include "modules/rtp_rtcp/include/rtp_rtcp_defines.h"
+#include "modules/rtp_rtcp/source/rtp_packet_to_send.h"
+#include "rtc_base/checks.h"
+
+namespace webrtc {
+namespace {
+
+constexpr uint32_t kFirstSsrc = 1000;
+constexpr size_t kPayloadSize = 1200;
+
+// A video heavy mix, with some retransmissions, FEC, audio and padding.
+constexpr RtpPacketMediaType kPacketTypes[] = {
+    RtpPacketMediaType::kVideo,
+    RtpPacketMediaType::kVideo,
+    RtpPacketMediaType::kVideo,
+    RtpPacketMediaType::kForwardErrorCorrection,
+    RtpPacketMediaType::kVideo,
+    RtpPacketMediaType::kRetransmission,
+    RtpPacketMediaType::kVideo,
+    RtpPacketMediaType::kAudio,
+    RtpPacketMediaType::kVideo,
+    RtpPacketMediaType::kPadding,
+};
+
+// Pushes state.range(1) packets spread over state.range(0) SSRCs into the
+// queue per iteration, and pops them all again, the way the pacer drains its
+// queue in PacingController::ProcessPackets(). The packets are reused, so only
+// the queue itself is measured.
+void BM_PrioritizedPacketQueuePushPop(benchmark::State& state) {
+  const int num_streams = state.range(0);
+  const int num_packets = state.range(1);
+
+  std::vector<std::unique_ptr<RtpPacketToSend>> packets;
+  for (int i = 0; i < num_packets; ++i) {
+    auto packet = std::make_unique<RtpPacketToSend>(/*extensions=*/nullptr);
+    packet->set_packet_type(kPacketTypes[i % std::size(kPacketTypes)]);
+    packet->SetSsrc(kFirstSsrc + i % num_streams);
+    packet->SetSequenceNumber(i);
+    packet->SetPayloadSize(kPayloadSize);
+    packets.push_back(std::move(packet));
+  }
+  Timestamp now = Timestamp::Millis(1);
+  PrioritizedPacketQueue queue(now);
+
+  for (auto _ : state) {
+    for (std::unique_ptr<RtpPacketToSend>& packet : packets) {
+      queue.Push(now, std::move(packet));
+    }
+    now += TimeDelta::Millis(1);
+    queue.UpdateAverageQueueTime(now);
+    benchmark::DoNotOptimize(queue.OldestEnqueueTime());
+    for (std::unique_ptr<RtpPacketToSend>& packet : packets) {
+      packet = queue.Pop();
+      RTC_DCHECK(packet);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * num_packets);
+}
+
+// A single stream, a simulcast stream with RTX and audio, and an SFU sending
+// many streams, with a shallow and a congested queue.
+BENCHMARK(BM_PrioritizedPacketQueuePushPop)
+    ->ArgsProduct({{1, 8, 32}, {16, 256}});
+
+}  // namespace
+}  // namespace webrtc
+
+/*
+
+BM_PrioritizedPacketQueuePushPop takes the number of SSRCs and the number of
+packets pushed and popped per iteration. Run with:
+
+  out/Default/benchmarks --benchmark_filter=PrioritizedPacketQueue
+*/
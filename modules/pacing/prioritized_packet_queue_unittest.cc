@@ -213,6 +213,37 @@ TEST(PrioritizedPacketQueue, ReportsOldestEnqueueTime) {
   EXPECT_EQ(queue.OldestEnqueueTime(), Timestamp::MinusInfinity());
 }
 
+TEST(PrioritizedPacketQueue, ReportsOldestEnqueueTimeWhileNewerPacketsPass) {
+  Timestamp now = Timestamp::Zero();
+  PrioritizedPacketQueue queue(now);
+
+  // An old padding packet waits while many video packets pass it, and two
+  // more padding packets queue up behind it.
+  queue.Push(now, CreatePacket(RtpPacketMediaType::kPadding, /*seq=*/1));
+  for (int i = 0; i < 1000; ++i) {
+    now += TimeDelta::Millis(1);
+    queue.Push(now, CreatePacket(RtpPacketMediaType::kVideo,
+                                 /*seq=*/static_cast<uint16_t>(100 + i)));
+    if (i == 500) {
+      queue.Push(now, CreatePacket(RtpPacketMediaType::kPadding, /*seq=*/2));
+    }
+    EXPECT_EQ(queue.Pop()->SequenceNumber(), 100 + i);
+    EXPECT_EQ(queue.OldestEnqueueTime(), Timestamp::Zero());
+  }
+  queue.Push(now, CreatePacket(RtpPacketMediaType::kPadding, /*seq=*/3));
+  EXPECT_EQ(queue.SizeInPackets(), 3);
+
+  queue.UpdateAverageQueueTime(now);
+  std::unique_ptr<RtpPacketToSend> packet = queue.Pop();
+  EXPECT_EQ(packet->SequenceNumber(), 1);
+  EXPECT_EQ(packet->time_in_send_queue(), TimeDelta::Millis(1000));
+  EXPECT_EQ(queue.OldestEnqueueTime(), Timestamp::Millis(501));
+  EXPECT_EQ(queue.Pop()->SequenceNumber(), 2);
+  EXPECT_EQ(queue.OldestEnqueueTime(), now);
+  EXPECT_EQ(queue.Pop()->SequenceNumber(), 3);
+  EXPECT_EQ(queue.OldestEnqueueTime(), Timestamp::MinusInfinity());
+}
+
 TEST(PrioritizedPacketQueue, ReportsAverageQueueTime) {
   PrioritizedPacketQueue queue(/*creation_time=*/Timestamp::Zero());
   EXPECT_EQ(queue.AverageQueueTime(), TimeDelta::Zero());
@@ -484,6 +515,35 @@ TEST(PrioritizedPacketQueue, ReportsKeyframePackets) {
   EXPECT_FALSE(queue.HasKeyframePackets(kVideoSsrc2));
 }
 
+TEST(PrioritizedPacketQueue, ReusesQueuesOfInactiveStreams) {
+  Timestamp now = Timestamp::Zero();
+  PrioritizedPacketQueue queue(now);
+  const uint32_t kOldSsrc = 1234;
+  const uint32_t kNewSsrc1 = 2345;
+  const uint32_t kNewSsrc2 = 3456;
+
+  queue.Push(now, CreatePacket(RtpPacketMediaType::kVideo, /*seq=*/1, kOldSsrc,
+                               /*is_key_frame=*/true));
+  EXPECT_EQ(queue.Pop()->SequenceNumber(), 1);
+
+  // The queue of the inactive stream is culled, and taken over by a new one.
+  now += TimeDelta::Seconds(1);
+  queue.Push(now, CreatePacket(RtpPacketMediaType::kVideo, /*seq=*/11,
+                               kNewSsrc1));
+  queue.Push(now, CreatePacket(RtpPacketMediaType::kVideo, /*seq=*/21,
+                               kNewSsrc2, /*is_key_frame=*/true));
+  queue.Push(now, CreatePacket(RtpPacketMediaType::kVideo, /*seq=*/12,
+                               kNewSsrc1));
+  EXPECT_FALSE(queue.HasKeyframePackets(kOldSsrc));
+  EXPECT_FALSE(queue.HasKeyframePackets(kNewSsrc1));
+  EXPECT_TRUE(queue.HasKeyframePackets(kNewSsrc2));
+
+  EXPECT_EQ(queue.Pop()->SequenceNumber(), 11);
+  EXPECT_EQ(queue.Pop()->SequenceNumber(), 21);
+  EXPECT_EQ(queue.Pop()->SequenceNumber(), 12);
+  EXPECT_TRUE(queue.Empty());
+}
+
 TEST(PrioritizedPacketQueue, PacketsDroppedIfNotPulledWithinTttl) {
   Timestamp now = Timestamp::Zero();
   PacketQueueTTL ttls;
@@ -545,6 +605,33 @@ TEST(PrioritizedPacketQueue, SendsNewVideoPacketAfterPurgingLastOldRtxPacket) {
   EXPECT_EQ(queue.SizeInPackets(), 0);
 }
 
+TEST(PrioritizedPacketQueue, CompactsEnqueueTimesWhenPushPurgesPackets) {
+  Timestamp now = Timestamp::Zero();
+  PacketQueueTTL ttls;
+  ttls.video_retransmission = TimeDelta::Millis(100);
+  PrioritizedPacketQueue queue(now, /*prioritize_audio_retransmission=*/true,
+                               ttls);
+
+  queue.Push(now, CreatePacket(RtpPacketMediaType::kVideo, /*seq=*/1));
+  for (int i = 0; i < 100; ++i) {
+    queue.Push(now, CreateRetransmissionPacket(
+                        RtpPacketMediaType::kVideo,
+                        /*seq=*/static_cast<uint16_t>(100 + i)));
+  }
+  now += ttls.video_retransmission + TimeDelta::Millis(1);
+  // Purging the old retransmissions leaves few enough packets for the enqueue
+  // times to be compacted before the new packet is queued.
+  queue.Push(now, CreateRetransmissionPacket(RtpPacketMediaType::kVideo,
+                                             /*seq=*/1000));
+  EXPECT_EQ(queue.SizeInPackets(), 2);
+  EXPECT_EQ(queue.OldestEnqueueTime(), Timestamp::Zero());
+
+  EXPECT_EQ(queue.Pop()->SequenceNumber(), 1000);
+  EXPECT_EQ(queue.OldestEnqueueTime(), Timestamp::Zero());
+  EXPECT_EQ(queue.Pop()->SequenceNumber(), 1);
+  EXPECT_EQ(queue.OldestEnqueueTime(), Timestamp::MinusInfinity());
+}
+
 TEST(PrioritizedPacketQueue,
      SendsPacketsAfterTttlIfPrioHigherThanPushedPackets) {
   Timestamp now = Timestamp::Zero();
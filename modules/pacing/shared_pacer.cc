@@ -0,0 +1,475 @@
+/*
+ *  Copyright 2025 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "modules/pacing/shared_pacer.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "absl/functional/any_invocable.h"
+#include "api/environment/environment.h"
+#include "api/sequence_checker.h"
+#include "api/task_queue/pending_task_safety_flag.h"
+#include "api/task_queue/task_queue_base.h"
+#include "api/transport/network_types.h"
+#include "api/units/data_rate.h"
+#include "api/units/data_size.h"
+#include "api/units/time_delta.h"
+#include "api/units/timestamp.h"
+#include "modules/pacing/pacing_controller.h"
+#include "modules/rtp_rtcp/source/rtp_packet_to_send.h"
+#include "rtc_base/checks.h"
+#include "rtc_base/event.h"
+#include "rtc_base/synchronization/mutex.h"
+#include "rtc_base/trace_event.h"
+
+namespace webrtc {
+
+SharedPacer::Connection::Connection(SharedPacer* pacer, int index)
+    : pacer_(pacer), index_(index) {}
+
+SharedPacer::Connection::~Connection() {
+  if (pacer_->task_queue_->IsCurrent()) {
+    RTC_DCHECK_RUN_ON(&pacer_->sequence_checker_);
+    pacer_->RemoveConnection(index_);
+    return;
+  }
+  rtc::Event done;
+  pacer_->task_queue_->PostTask([this, &done] {
+    RTC_DCHECK_RUN_ON(&pacer_->sequence_checker_);
+    pacer_->RemoveConnection(index_);
+    done.Set();
+  });
+  done.Wait(rtc::Event::kForever);
+}
+
+void SharedPacer::Connection::SetWeight(double weight) {
+  RTC_DCHECK_GT(weight, 0.0);
+  SharedPacer* pacer = pacer_;
+  pacer_->PostTask(index_, [pacer, weight](ConnectionState& state) {
+    RTC_DCHECK_RUN_ON(&pacer->sequence_checker_);
+    state.weight = weight;
+    pacer->OnRatesChanged();
+  });
+}
+
+void SharedPacer::Connection::SetSendBurstInterval(TimeDelta burst_interval) {
+  pacer_->PostTask(index_, [burst_interval](ConnectionState& state) {
+    state.controller.SetSendBurstInterval(burst_interval);
+  });
+}
+
+void SharedPacer::Connection::SetAllowProbeWithoutMediaPacket(bool allow) {
+  pacer_->PostTask(index_, [allow](ConnectionState& state) {
+    state.controller.SetAllowProbeWithoutMediaPacket(allow);
+  });
+}
+
+void SharedPacer::Connection::EnqueuePackets(
+    std::vector<std::unique_ptr<RtpPacketToSend>> packets) {
+  pacer_->PostTask(index_, [packets = std::move(packets)](
+                               ConnectionState& state) mutable {
+    TRACE_EVENT0(TRACE_DISABLED_BY_DEFAULT("webrtc"),
+                 "SharedPacer::EnqueuePackets");
+    for (auto& packet : packets) {
+      RTC_DCHECK_GE(packet->capture_time(), Timestamp::Zero());
+      state.controller.EnqueuePacket(std::move(packet));
+    }
+  });
+}
+
+void SharedPacer::Connection::RemovePacketsForSsrc(uint32_t ssrc) {
+  pacer_->PostTask(index_, [ssrc](ConnectionState& state) {
+    state.controller.RemovePacketsForSsrc(ssrc);
+  });
+}
+
+void SharedPacer::Connection::CreateProbeClusters(
+    std::vector<ProbeClusterConfig> probe_cluster_configs) {
+  pacer_->PostTask(index_,
+                   [probe_cluster_configs = std::move(probe_cluster_configs)](
+                       ConnectionState& state) {
+                     state.controller.CreateProbeClusters(
+                         probe_cluster_configs);
+                   });
+}
+
+void SharedPacer::Connection::Pause() {
+  pacer_->PostTask(index_,
+                   [](ConnectionState& state) { state.controller.Pause(); });
+}
+
+void SharedPacer::Connection::Resume() {
+  pacer_->PostTask(index_,
+                   [](ConnectionState& state) { state.controller.Resume(); });
+}
+
+void SharedPacer::Connection::SetCongested(bool congested) {
+  pacer_->PostTask(index_, [congested](ConnectionState& state) {
+    state.controller.SetCongested(congested);
+  });
+}
+
+void SharedPacer::Connection::SetPacingRates(DataRate pacing_rate,
+                                             DataRate padding_rate) {
+  SharedPacer* pacer = pacer_;
+  pacer_->PostTask(index_, [pacer, pacing_rate,
+                            padding_rate](ConnectionState& state) {
+    RTC_DCHECK_RUN_ON(&pacer->sequence_checker_);
+    state.requested_pacing_rate = pacing_rate;
+    state.requested_padding_rate = padding_rate;
+    if (pacer->config_.max_total_rate.IsPlusInfinity() ||
+        state.pacing_rate.IsZero()) {
+      // Until the shares are recomputed at the next wakeup, a new connection
+      // paces at its requested rate up to the cap, as the PacingController
+      // needs a rate before packets are enqueued.
+      state.pacing_rate = std::min(pacing_rate, pacer->config_.max_total_rate);
+      state.padding_rate = std::min(padding_rate, state.pacing_rate);
+      state.controller.SetPacingRates(state.pacing_rate, state.padding_rate);
+    }
+    pacer->OnRatesChanged();
+  });
+}
+
+TimeDelta SharedPacer::Connection::OldestPacketWaitTime() const {
+  Timestamp oldest_packet = Timestamp::MinusInfinity();
+  {
+    MutexLock lock(&mutex_);
+    oldest_packet = stats_.oldest_packet_enqueue_time;
+  }
+  if (oldest_packet.IsInfinite()) {
+    return TimeDelta::Zero();
+  }
+  Timestamp current = pacer_->env_.clock().CurrentTime();
+  if (current < oldest_packet) {
+    return TimeDelta::Zero();
+  }
+  return current - oldest_packet;
+}
+
+DataSize SharedPacer::Connection::QueueSizeData() const {
+  MutexLock lock(&mutex_);
+  return stats_.queue_size;
+}
+
+std::optional<Timestamp> SharedPacer::Connection::FirstSentPacketTime() const {
+  MutexLock lock(&mutex_);
+  return stats_.first_sent_packet_time;
+}
+
+TimeDelta SharedPacer::Connection::ExpectedQueueTime() const {
+  MutexLock lock(&mutex_);
+  return stats_.expected_queue_time;
+}
+
+void SharedPacer::Connection::SetQueueTimeLimit(TimeDelta limit) {
+  pacer_->PostTask(index_, [limit](ConnectionState& state) {
+    state.controller.SetQueueTimeLimit(limit);
+  });
+}
+
+void SharedPacer::Connection::SetAccountForAudioPackets(
+    bool account_for_audio) {
+  pacer_->PostTask(index_, [account_for_audio](ConnectionState& state) {
+    state.controller.SetAccountForAudioPackets(account_for_audio);
+  });
+}
+
+void SharedPacer::Connection::SetIncludeOverhead() {
+  pacer_->PostTask(index_, [](ConnectionState& state) {
+    state.controller.SetIncludeOverhead();
+  });
+}
+
+void SharedPacer::Connection::SetTransportOverhead(
+    DataSize overhead_per_packet) {
+  pacer_->PostTask(index_, [overhead_per_packet](ConnectionState& state) {
+    state.controller.SetTransportOverhead(overhead_per_packet);
+  });
+}
+
+SharedPacer::ConnectionState::ConnectionState(
+    const Environment& env,
+    PacingController::PacketSender* packet_sender,
+    Connection* connection)
+    : controller(&env.clock(), packet_sender, env.field_trials()),
+      connection(connection) {}
+
+SharedPacer::SharedPacer(const Environment& env,
+                         TaskQueueBase* task_queue,
+                         Config config)
+    : env_(env),
+      task_queue_(task_queue),
+      config_(config),
+      processed_tick_(TickAt(env_.clock().CurrentTime()) - 1) {
+  RTC_DCHECK(task_queue_);
+  RTC_DCHECK_GT(config_.tick, TimeDelta::Zero());
+}
+
+SharedPacer::~SharedPacer() {
+  RTC_DCHECK(task_queue_->IsCurrent());
+}
+
+std::unique_ptr<SharedPacer::Connection> SharedPacer::AddConnection(
+    PacingController::PacketSender* packet_sender) {
+  int index;
+  {
+    MutexLock lock(&index_mutex_);
+    if (free_indices_.empty()) {
+      index = num_indices_++;
+    } else {
+      index = free_indices_.back();
+      free_indices_.pop_back();
+    }
+  }
+  std::unique_ptr<Connection> connection(new Connection(this, index));
+  auto add = [this, index, packet_sender, connection = connection.get()] {
+    RTC_DCHECK_RUN_ON(&sequence_checker_);
+    if (index >= static_cast<int>(connections_.size())) {
+      connections_.resize(index + 1);
+    }
+    RTC_DCHECK(!connections_[index]);
+    connections_[index] =
+        std::make_unique<ConnectionState>(env_, packet_sender, connection);
+    ProcessConnection(index);
+  };
+  // The connection is added before it is returned, so that it can be
+  // destroyed on the task queue right away.
+  if (task_queue_->IsCurrent()) {
+    add();
+  } else {
+    rtc::Event done;
+    task_queue_->PostTask([&add, &done] {
+      add();
+      done.Set();
+    });
+    done.Wait(rtc::Event::kForever);
+  }
+  return connection;
+}
+
+int64_t SharedPacer::TickAt(Timestamp time) const {
+  const int64_t tick_us = config_.tick.us();
+  return (std::max<int64_t>(time.us(), 0) + tick_us - 1) / tick_us;
+}
+
+void SharedPacer::PostTask(int index,
+                           absl::AnyInvocable<void(ConnectionState&) &&> task) {
+  task_queue_->PostTask(SafeTask(
+      task_safety_.flag(), [this, index, task = std::move(task)]() mutable {
+        RTC_DCHECK_RUN_ON(&sequence_checker_);
+        // The connection may have been destroyed on the task queue while
+        // the task was queued.
+        if (!connections_[index]) {
+          return;
+        }
+        std::move(task)(*connections_[index]);
+        ProcessConnection(index);
+      }));
+}
+
+void SharedPacer::RemoveConnection(int index) {
+  // Entries left in the wheel are skipped, and dropped once their slot is
+  // processed.
+  connections_[index] = nullptr;
+  // Tasks the connection posted may still be queued, they skip the removed
+  // connection. The index is reused only once they have run.
+  task_queue_->PostTask(SafeTask(task_safety_.flag(), [this, index] {
+    MutexLock lock(&index_mutex_);
+    free_indices_.push_back(index);
+  }));
+  if (!config_.max_total_rate.IsPlusInfinity()) {
+    OnRatesChanged();
+  }
+}
+
+void SharedPacer::ProcessConnection(int index) {
+  ConnectionState& state = *connections_[index];
+  // As TaskQueuePacedSender before EnsureStarted(), a connection is idle
+  // until it has been given a pacing rate.
+  if (state.pacing_rate.IsZero()) {
+    return;
+  }
+  PacingController& controller = state.controller;
+  const Timestamp now = env_.clock().CurrentTime();
+  auto early_execute_margin = [&] {
+    return controller.IsProbing() ? PacingController::kMaxEarlyProbeProcessing
+                                  : TimeDelta::Zero();
+  };
+  while (controller.NextSendTime() <= now + early_execute_margin()) {
+    controller.ProcessPackets();
+  }
+
+  {
+    Connection& connection = *state.connection;
+    MutexLock lock(&connection.mutex_);
+    connection.stats_.oldest_packet_enqueue_time =
+        controller.OldestPacketEnqueueTime();
+    connection.stats_.queue_size = controller.QueueSizeData();
+    connection.stats_.expected_queue_time = controller.ExpectedQueueTime();
+    connection.stats_.first_sent_packet_time = controller.FirstSentPacketTime();
+  }
+  Schedule(index);
+}
+
+void SharedPacer::Schedule(int index) {
+  ConnectionState& state = *connections_[index];
+  const Timestamp next_send_time = state.controller.NextSendTime();
+  RTC_DCHECK(next_send_time.IsFinite());
+  const TimeDelta early_execute_margin =
+      state.controller.IsProbing() ? PacingController::kMaxEarlyProbeProcessing
+                                   : TimeDelta::Zero();
+  const int64_t next_tick = NextTick();
+  const int64_t tick =
+      std::clamp(TickAt(next_send_time - early_execute_margin), next_tick,
+                 next_tick + kNumSlots - 1);
+  if (state.scheduled_tick == tick) {
+    return;
+  }
+  state.scheduled_tick = tick;
+  wheel_[tick % kNumSlots].push_back(index);
+  if (!processing_ && (!wakeup_tick_ || tick < *wakeup_tick_)) {
+    PostWakeup(tick);
+  }
+}
+
+int64_t SharedPacer::NextTick() {
+  if (!wakeup_tick_ && !processing_) {
+    // Nothing is scheduled, so the ticks that passed since the last wakeup
+    // need not be processed.
+    processed_tick_ =
+        std::max(processed_tick_, TickAt(env_.clock().CurrentTime()) - 1);
+  }
+  return processed_tick_ + 1;
+}
+
+bool SharedPacer::IsScheduledAt(int index, int64_t tick) const {
+  const ConnectionState* state = connections_[index].get();
+  return state != nullptr && state->scheduled_tick == tick;
+}
+
+void SharedPacer::PostWakeup(int64_t tick) {
+  wakeup_tick_ = tick;
+  const Timestamp wakeup_time = Timestamp::Zero() + config_.tick * tick;
+  const TimeDelta delay =
+      std::max(wakeup_time - env_.clock().CurrentTime(), TimeDelta::Zero());
+  task_queue_->PostDelayedHighPrecisionTask(
+      SafeTask(task_safety_.flag(),
+               [this, tick] {
+                 RTC_DCHECK_RUN_ON(&sequence_checker_);
+                 OnWakeup(tick);
+               }),
+      delay);
+}
+
+void SharedPacer::OnWakeup(int64_t tick) {
+  // Ignore retired wakeups.
+  if (wakeup_tick_ != tick) {
+    return;
+  }
+  wakeup_tick_ = std::nullopt;
+  TRACE_EVENT0(TRACE_DISABLED_BY_DEFAULT("webrtc"), "SharedPacer::OnWakeup");
+
+  // Connections are rescheduled while they are processed, and only post a
+  // wakeup when all due ones have been.
+  processing_ = true;
+  if (rates_changed_) {
+    UpdatePacingRates();
+  }
+  const int64_t last_tick = std::max(
+      tick, env_.clock().CurrentTime().us() / config_.tick.us());
+  while (processed_tick_ < last_tick) {
+    ++processed_tick_;
+    // Connections processed now are scheduled after `processed_tick_`, so
+    // they are never added to the slot being processed, but they may be
+    // added to its wheel slot for a tick one turn later.
+    due_.swap(wheel_[processed_tick_ % kNumSlots]);
+    for (int index : due_) {
+      if (IsScheduledAt(index, processed_tick_)) {
+        connections_[index]->scheduled_tick = std::nullopt;
+        ProcessConnection(index);
+      }
+    }
+    due_.clear();
+  }
+  processing_ = false;
+
+  for (int64_t next = processed_tick_ + 1; next <= processed_tick_ + kNumSlots;
+       ++next) {
+    for (int index : wheel_[next % kNumSlots]) {
+      if (IsScheduledAt(index, next)) {
+        PostWakeup(next);
+        return;
+      }
+    }
+  }
+}
+
+void SharedPacer::OnRatesChanged() {
+  if (config_.max_total_rate.IsPlusInfinity()) {
+    return;
+  }
+  // Rate changes often come in bursts, e.g. when the estimates of many
+  // connections are updated, so the shares are recomputed once at the next
+  // tick.
+  rates_changed_ = true;
+  const int64_t next_tick = NextTick();
+  if (!processing_ && (!wakeup_tick_ || next_tick < *wakeup_tick_)) {
+    PostWakeup(next_tick);
+  }
+}
+
+void SharedPacer::UpdatePacingRates() {
+  rates_changed_ = false;
+  std::vector<int> indices;
+  double remaining_weight = 0.0;
+  for (int index = 0; index < static_cast<int>(connections_.size());
+       ++index) {
+    if (connections_[index]) {
+      indices.push_back(index);
+      remaining_weight += connections_[index]->weight;
+    }
+  }
+  // Water-filling: the connections asking for the least per unit of weight
+  // are served first, and what they leave of their share is split among the
+  // rest.
+  std::sort(indices.begin(), indices.end(), [&](int a, int b) {
+    const ConnectionState& state_a = *connections_[a];
+    const ConnectionState& state_b = *connections_[b];
+    return state_a.requested_pacing_rate.bps<double>() / state_a.weight <
+           state_b.requested_pacing_rate.bps<double>() / state_b.weight;
+  });
+  DataRate remaining_rate = config_.max_total_rate;
+  for (int index : indices) {
+    ConnectionState& state = *connections_[index];
+    const DataRate share =
+        remaining_rate * (state.weight / remaining_weight);
+    const DataRate pacing_rate = std::min(state.requested_pacing_rate, share);
+    const DataRate padding_rate =
+        std::min(state.requested_padding_rate, pacing_rate);
+    remaining_rate -= pacing_rate;
+    remaining_weight -= state.weight;
+    // Connections that have not set their rates yet keep the default ones.
+    if (pacing_rate > DataRate::Zero() &&
+        (pacing_rate != state.pacing_rate ||
+         padding_rate != state.padding_rate)) {
+      state.pacing_rate = pacing_rate;
+      state.padding_rate = padding_rate;
+      state.controller.SetPacingRates(pacing_rate, padding_rate);
+      Schedule(index);
+    }
+  }
+}
+
+}  // namespace webrtc
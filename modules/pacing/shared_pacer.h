@@ -0,0 +1,234 @@
+/*
+ *  Copyright 2025 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef MODULES_PACING_SHARED_PACER_H_
+#define MODULES_PACING_SHARED_PACER_H_
+
+#include <stdint.h>
+
+#include <array>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "absl/functional/any_invocable.h"
+#include "api/environment/environment.h"
+#include "api/rtp_packet_sender.h"
+#include "api/sequence_checker.h"
+#include "api/task_queue/pending_task_safety_flag.h"
+#include "api/task_queue/task_queue_base.h"
+#include "api/transport/network_types.h"
+#include "api/units/data_rate.h"
+#include "api/units/data_size.h"
+#include "api/units/time_delta.h"
+#include "api/units/timestamp.h"
+#include "modules/pacing/pacing_controller.h"
+#include "modules/pacing/rtp_packet_pacer.h"
+#include "modules/rtp_rtcp/source/rtp_packet_to_send.h"
+#include "rtc_base/synchronization/mutex.h"
+#include "rtc_base/system/no_unique_address.h"
+#include "rtc_base/thread_annotations.h"
+
+namespace webrtc {
+
+// Paces the packets of many connections, e.g. of all the PeerConnections of a
+// server, on one task queue. Each connection has its own PacingController, so
+// pacing rates, probing, padding and packet priorities work as they do with
+// TaskQueuePacedSender. The connections share a timer wheel instead of each
+// posting its own delayed tasks. A connection's next send time is rounded up
+// to the end of a `tick` wide slot, and all connections due in the same slot
+// are processed in one wakeup. As with TaskQueuePacedSender, the packets sent
+// by one PacingController::ProcessPackets() call end with
+// PacketSender::OnBatchComplete(), so batchable packets are handed to the
+// socket layer together.
+//
+// The total pacing rate of the connections can be capped, e.g. to the uplink
+// of the server. The cap is shared in proportion to the connections' weights,
+// and a connection asking for less than its share leaves the rest to the
+// others (weighted max-min fairness).
+//
+// The pacer runs on a task queue it is given, and calls the connections'
+// PacketSenders there. A call's PacketRouter and bandwidth estimation run on
+// the call's worker queue, so a call paces with a connection of a SharedPacer
+// set as CallConfig::shared_pacer, or RtpTransportConfig::shared_pacer, only
+// if the pacer runs on that queue, e.g. on the worker thread shared by all
+// the PeerConnections of a PeerConnectionFactory.
+class SharedPacer {
+ public:
+  struct Config {
+    // Width of a timer wheel slot. Timer driven sends are up to one tick
+    // late, and the pacer wakes up at most once per tick for them.
+    TimeDelta tick = TimeDelta::Millis(1);
+    // Upper bound on the sum of the pacing rates of all connections.
+    DataRate max_total_rate = DataRate::PlusInfinity();
+  };
+
+  // The pacer of one connection, a drop-in for TaskQueuePacedSender. Unlike
+  // TaskQueuePacedSender, all methods may be called on any thread.
+  class Connection : public RtpPacketPacer, public RtpPacketSender {
+   public:
+    // Blocks until the pacer has stopped using the connection's
+    // PacketSender. Must not be called from within a PacketSender callback.
+    ~Connection() override;
+
+    // Weight of the connection when the total rate is capped, 1 by default.
+    void SetWeight(double weight);
+    void SetSendBurstInterval(TimeDelta burst_interval);
+    void SetAllowProbeWithoutMediaPacket(bool allow);
+
+    // Methods implementing RtpPacketSender.
+    void EnqueuePackets(
+        std::vector<std::unique_ptr<RtpPacketToSend>> packets) override;
+    void RemovePacketsForSsrc(uint32_t ssrc) override;
+
+    // Methods implementing RtpPacketPacer.
+    void CreateProbeClusters(
+        std::vector<ProbeClusterConfig> probe_cluster_configs) override;
+    void Pause() override;
+    void Resume() override;
+    void SetCongested(bool congested) override;
+    void SetPacingRates(DataRate pacing_rate, DataRate padding_rate) override;
+    TimeDelta OldestPacketWaitTime() const override;
+    DataSize QueueSizeData() const override;
+    std::optional<Timestamp> FirstSentPacketTime() const override;
+    TimeDelta ExpectedQueueTime() const override;
+    void SetQueueTimeLimit(TimeDelta limit) override;
+    void SetAccountForAudioPackets(bool account_for_audio) override;
+    void SetIncludeOverhead() override;
+    void SetTransportOverhead(DataSize overhead_per_packet) override;
+
+   private:
+    friend class SharedPacer;
+
+    struct Stats {
+      Timestamp oldest_packet_enqueue_time = Timestamp::MinusInfinity();
+      DataSize queue_size = DataSize::Zero();
+      TimeDelta expected_queue_time = TimeDelta::Zero();
+      std::optional<Timestamp> first_sent_packet_time;
+    };
+
+    Connection(SharedPacer* pacer, int index);
+
+    SharedPacer* const pacer_;
+    const int index_;
+    mutable Mutex mutex_;
+    Stats stats_ RTC_GUARDED_BY(mutex_);
+  };
+
+  // Paces on `task_queue`, which must outlive the pacer.
+  SharedPacer(const Environment& env, TaskQueueBase* task_queue, Config config);
+  SharedPacer(const SharedPacer&) = delete;
+  SharedPacer& operator=(const SharedPacer&) = delete;
+  // Must be called on the task queue, after all connections have been
+  // destroyed.
+  ~SharedPacer();
+
+  // The task queue the PacketSenders of the connections are called on.
+  TaskQueueBase* task_queue() const { return task_queue_; }
+
+  // Adds a connection that sends its packets with `packet_sender`, which
+  // must outlive the returned Connection. May be called on any thread, blocks
+  // until the connection has been added when not called on the task queue.
+  std::unique_ptr<Connection> AddConnection(
+      PacingController::PacketSender* packet_sender);
+
+ private:
+  // Number of slots of the timer wheel. Connections due further ahead, such
+  // as idle ones waiting for their next keep-alive, are checked after this
+  // many ticks and scheduled again.
+  static constexpr int kNumSlots = 1024;
+
+  struct ConnectionState {
+    ConnectionState(const Environment& env,
+                    PacingController::PacketSender* packet_sender,
+                    Connection* connection);
+
+    PacingController controller;
+    Connection* const connection;
+    double weight = 1.0;
+    // Rates set by the connection, before the total rate is shared.
+    DataRate requested_pacing_rate = DataRate::Zero();
+    DataRate requested_padding_rate = DataRate::Zero();
+    // Rates the PacingController was last given.
+    DataRate pacing_rate = DataRate::Zero();
+    DataRate padding_rate = DataRate::Zero();
+    // The tick the connection is scheduled at, if any. The wheel may still
+    // list the connection at ticks it was scheduled at before, such entries
+    // are skipped.
+    std::optional<int64_t> scheduled_tick;
+  };
+
+  // The first tick whose end is at or after `time`.
+  int64_t TickAt(Timestamp time) const;
+
+  // Runs `task` on the task queue with the state of the connection at
+  // `index`, and sends the packets that are due afterwards.
+  void PostTask(int index, absl::AnyInvocable<void(ConnectionState&) &&> task);
+  void RemoveConnection(int index) RTC_RUN_ON(sequence_checker_);
+
+  // Sends the packets of the connection that are due, and schedules it for
+  // its next send time.
+  void ProcessConnection(int index) RTC_RUN_ON(sequence_checker_);
+  void Schedule(int index) RTC_RUN_ON(sequence_checker_);
+  // The earliest tick a connection can be scheduled at.
+  int64_t NextTick() RTC_RUN_ON(sequence_checker_);
+  bool IsScheduledAt(int index, int64_t tick) const
+      RTC_RUN_ON(sequence_checker_);
+  void PostWakeup(int64_t tick) RTC_RUN_ON(sequence_checker_);
+  void OnWakeup(int64_t tick) RTC_RUN_ON(sequence_checker_);
+
+  // Called when a requested rate or a weight changed.
+  void OnRatesChanged() RTC_RUN_ON(sequence_checker_);
+  // Sets the pacing rates of the connections to their fair shares of the
+  // capped total rate.
+  void UpdatePacingRates() RTC_RUN_ON(sequence_checker_);
+
+  const Environment env_;
+  TaskQueueBase* const task_queue_;
+  const Config config_;
+  RTC_NO_UNIQUE_ADDRESS SequenceChecker sequence_checker_{
+      SequenceChecker::kDetached};
+
+  // Hands out connection indices on any thread. Indices of removed
+  // connections are reused.
+  Mutex index_mutex_;
+  int num_indices_ RTC_GUARDED_BY(index_mutex_) = 0;
+  std::vector<int> free_indices_ RTC_GUARDED_BY(index_mutex_);
+
+  // Connections by index, nullptr for unused indices.
+  std::vector<std::unique_ptr<ConnectionState>> connections_
+      RTC_GUARDED_BY(sequence_checker_);
+
+  // Indices of the connections due in the slot being processed.
+  std::vector<int> due_ RTC_GUARDED_BY(sequence_checker_);
+  // The timer wheel. Slot `tick % kNumSlots` lists the indices of the
+  // connections scheduled at `tick`.
+  std::array<std::vector<int>, kNumSlots> wheel_
+      RTC_GUARDED_BY(sequence_checker_);
+  // All ticks up to and including this one have been processed.
+  int64_t processed_tick_ RTC_GUARDED_BY(sequence_checker_);
+  // The tick of the pending wakeup task, if any. Wakeup tasks for other
+  // ticks are retired.
+  std::optional<int64_t> wakeup_tick_ RTC_GUARDED_BY(sequence_checker_);
+  // True while a wakeup processes connections. The next wakeup is posted
+  // when it is done.
+  bool processing_ RTC_GUARDED_BY(sequence_checker_) = false;
+  // Set when requested rates or weights changed while the total rate is
+  // capped. The shares are then recomputed once, at the next wakeup.
+  bool rates_changed_ RTC_GUARDED_BY(sequence_checker_) = false;
+
+  // Destroyed first, so that tasks still queued when the pacer is destroyed
+  // do not run.
+  ScopedTaskSafetyDetached task_safety_;
+};
+
+}  // namespace webrtc
+
+#endif  // MODULES_PACING_SHARED_PACER_H_
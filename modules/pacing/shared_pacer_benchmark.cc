@@ -0,0 +1,334 @@
+/*
+ *  Copyright 2025 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "absl/functional/any_invocable.h"
+#include "absl/strings/string_view.h"
+#include "api/environment/environment.h"
+#include "api/environment/environment_factory.h"
+#include "api/location.h"
+#include "api/task_queue/task_queue_base.h"
+#include "api/task_queue/task_queue_factory.h"
+#include "api/units/data_rate.h"
+#include "api/units/data_size.h"
+#include "api/units/time_delta.h"
+#include "api/units/timestamp.h"
+#include "benchmark/benchmark.h"
+#include "modules/pacing/pacing_controller.h"
+#include "modules/pacing/shared_pacer.h"
+#include "modules/pacing/task_queue_paced_sender.h"
+#include "modules/rtp_rtcp/include/rtp_rtcp_defines.h"
+#include "modules/rtp_rtcp/source/rtp_packet_to_send.h"
+#include "rtc_base/task_queue_for_test.h"
+#include "system_wrappers/include/clock.h"
+#include "test/time_controller/simulated_time_controller.h"
+
+namespace webrtc {
+namespace {
+
+constexpr uint32_t kSsrc = 12345;
+constexpr size_t kPacketSize = 1200;
+constexpr TimeDelta kFrameInterval = TimeDelta::Millis(33);
+constexpr TimeDelta kDuration = TimeDelta::Seconds(2);
+
+// Counts the tasks run by the task queues it creates, i.e. the wakeups of the
+// pacers using them.
+class CountingTaskQueueFactory : public TaskQueueFactory {
+ public:
+  explicit CountingTaskQueueFactory(const TaskQueueFactory* factory)
+      : factory_(factory) {}
+
+  std::unique_ptr<TaskQueueBase, TaskQueueDeleter> CreateTaskQueue(
+      absl::string_view name,
+      Priority priority) const override {
+    return std::unique_ptr<TaskQueueBase, TaskQueueDeleter>(new CountingQueue(
+        factory_->CreateTaskQueue(name, priority), &num_tasks_));
+  }
+
+  int num_tasks() const { return num_tasks_.load(); }
+
+ private:
+  class CountingQueue : public TaskQueueBase {
+   public:
+    CountingQueue(std::unique_ptr<TaskQueueBase, TaskQueueDeleter> queue,
+                  std::atomic<int>* num_tasks)
+        : queue_(std::move(queue)), num_tasks_(num_tasks) {}
+
+    void Delete() override {
+      queue_ = nullptr;
+      delete this;
+    }
+
+   protected:
+    void PostTaskImpl(absl::AnyInvocable<void() &&> task,
+                      const PostTaskTraits& /* traits */,
+                      const Location& location) override {
+      queue_->PostTask(Wrap(std::move(task)), location);
+    }
+    void PostDelayedTaskImpl(absl::AnyInvocable<void() &&> task,
+                             TimeDelta delay,
+                             const PostDelayedTaskTraits& traits,
+                             const Location& location) override {
+      if (traits.high_precision) {
+        queue_->PostDelayedHighPrecisionTask(Wrap(std::move(task)), delay,
+                                             location);
+      } else {
+        queue_->PostDelayedTask(Wrap(std::move(task)), delay, location);
+      }
+    }
+
+   private:
+    absl::AnyInvocable<void() &&> Wrap(absl::AnyInvocable<void() &&> task) {
+      return [this, task = std::move(task)]() mutable {
+        CurrentTaskQueueSetter set_current(this);
+        num_tasks_->fetch_add(1);
+        std::move(task)();
+      };
+    }
+
+    std::unique_ptr<TaskQueueBase, TaskQueueDeleter> queue_;
+    std::atomic<int>* const num_tasks_;
+  };
+
+  const TaskQueueFactory* const factory_;
+  mutable std::atomic<int> num_tasks_{0};
+};
+
+class RecordingPacketSender : public PacingController::PacketSender {
+ public:
+  explicit RecordingPacketSender(Clock* clock) : clock_(clock) {}
+
+  void SendPacket(std::unique_ptr<RtpPacketToSend> packet,
+                  const PacedPacketInfo& /* cluster_info */) override {
+    const uint16_t sequence_number = packet->SequenceNumber();
+    if (sequence_number >= send_times_.size()) {
+      send_times_.resize(sequence_number + 1, Timestamp::MinusInfinity());
+    }
+    send_times_[sequence_number] = clock_->CurrentTime();
+  }
+  std::vector<std::unique_ptr<RtpPacketToSend>> FetchFec() override {
+    return {};
+  }
+  std::vector<std::unique_ptr<RtpPacketToSend>> GeneratePadding(
+      DataSize /* size */) override {
+    return {};
+  }
+
+  // Send times by sequence number, minus infinity for unsent packets.
+  const std::vector<Timestamp>& send_times() const { return send_times_; }
+
+ private:
+  Clock* const clock_;
+  std::vector<Timestamp> send_times_;
+};
+
+struct ScenarioResult {
+  int num_wakeups = 0;
+  // Send times of the packets of each connection.
+  std::vector<std::vector<Timestamp>> send_times;
+};
+
+// Connection `i` sends video at 600 kbps plus some per connection spread, as
+// frames of packets every 33 ms, with the frames of the connections spread
+// over the frame interval. The pacing rate leaves 50% headroom, as the
+// congestion controller would.
+DataRate MediaRate(int i) {
+  return DataRate::KilobitsPerSec(600 + 10 * (i % 32));
+}
+
+std::vector<std::unique_ptr<RtpPacketToSend>> GenerateFrame(int connection,
+                                                            int frame) {
+  const int packets_per_frame = static_cast<int>(
+      (MediaRate(connection) * kFrameInterval).bytes() / kPacketSize + 1);
+  std::vector<std::unique_ptr<RtpPacketToSend>> packets;
+  for (int i = 0; i < packets_per_frame; ++i) {
+    auto packet = std::make_unique<RtpPacketToSend>(/*extensions=*/nullptr);
+    packet->set_packet_type(RtpPacketMediaType::kVideo);
+    packet->SetSsrc(kSsrc);
+    packet->SetSequenceNumber(frame * packets_per_frame + i);
+    packet->SetPayloadSize(kPacketSize);
+    packets.push_back(std::move(packet));
+  }
+  return packets;
+}
+
+template <typename Pacer>
+void EnqueueFrames(GlobalSimulatedTimeController& time_controller,
+                   const std::vector<Pacer*>& pacers) {
+  const int num_connections = pacers.size();
+  const Timestamp start = time_controller.GetClock()->CurrentTime();
+  std::vector<int> frames(num_connections, 0);
+  for (TimeDelta elapsed = TimeDelta::Zero(); elapsed < kDuration;
+       elapsed += TimeDelta::Millis(1)) {
+    for (int i = 0; i < num_connections; ++i) {
+      const TimeDelta offset = kFrameInterval * i / num_connections;
+      if (elapsed >= offset + kFrameInterval * frames[i]) {
+        pacers[i]->EnqueuePackets(GenerateFrame(i, frames[i]++));
+      }
+    }
+    time_controller.AdvanceTime(start + elapsed + TimeDelta::Millis(1) -
+                                time_controller.GetClock()->CurrentTime());
+  }
+  time_controller.AdvanceTime(TimeDelta::Millis(500));
+}
+
+// Each connection has its own TaskQueuePacedSender on its own task queue, as
+// each Call does.
+ScenarioResult RunPerCallPacers(int num_connections) {
+  GlobalSimulatedTimeController time_controller(Timestamp::Seconds(1000));
+  CountingTaskQueueFactory task_queue_factory(
+      time_controller.GetTaskQueueFactory());
+  const Environment env = CreateEnvironment(time_controller.GetClock());
+
+  std::vector<std::unique_ptr<RecordingPacketSender>> packet_senders;
+  std::vector<std::unique_ptr<TaskQueueBase, TaskQueueDeleter>> task_queues;
+  std::vector<std::unique_ptr<TaskQueuePacedSender>> pacers;
+  std::vector<TaskQueuePacedSender*> pacer_ptrs;
+  for (int i = 0; i < num_connections; ++i) {
+    packet_senders.push_back(
+        std::make_unique<RecordingPacketSender>(time_controller.GetClock()));
+    task_queues.push_back(task_queue_factory.CreateTaskQueue(
+        "PacerQueue", TaskQueueFactory::Priority::HIGH));
+    SendTask(task_queues.back().get(), [&] {
+      pacers.push_back(std::make_unique<TaskQueuePacedSender>(
+          time_controller.GetClock(), packet_senders.back().get(),
+          env.field_trials(), PacingController::kMinSleepTime,
+          TaskQueuePacedSender::kNoPacketHoldback));
+      pacers.back()->SetPacingRates(MediaRate(i) * 1.5, DataRate::Zero());
+      pacers.back()->EnsureStarted();
+    });
+    pacer_ptrs.push_back(pacers.back().get());
+  }
+  const int tasks_before = task_queue_factory.num_tasks();
+  EnqueueFrames(time_controller, pacer_ptrs);
+
+  ScenarioResult result;
+  result.num_wakeups = task_queue_factory.num_tasks() - tasks_before;
+  for (int i = 0; i < num_connections; ++i) {
+    SendTask(task_queues[i].get(), [&] { pacers[i] = nullptr; });
+    result.send_times.push_back(packet_senders[i]->send_times());
+  }
+  return result;
+}
+
+// All connections share one SharedPacer.
+ScenarioResult RunSharedPacer(int num_connections, TimeDelta tick) {
+  GlobalSimulatedTimeController time_controller(Timestamp::Seconds(1000));
+  CountingTaskQueueFactory task_queue_factory(
+      time_controller.GetTaskQueueFactory());
+  const Environment env = CreateEnvironment(time_controller.GetClock());
+
+  std::unique_ptr<TaskQueueBase, TaskQueueDeleter> task_queue =
+      task_queue_factory.CreateTaskQueue("PacerQueue",
+                                         TaskQueueFactory::Priority::HIGH);
+  SharedPacer::Config config;
+  config.tick = tick;
+  auto shared_pacer =
+      std::make_unique<SharedPacer>(env, task_queue.get(), config);
+  std::vector<std::unique_ptr<RecordingPacketSender>> packet_senders;
+  std::vector<std::unique_ptr<SharedPacer::Connection>> connections;
+  std::vector<SharedPacer::Connection*> connection_ptrs;
+  for (int i = 0; i < num_connections; ++i) {
+    packet_senders.push_back(
+        std::make_unique<RecordingPacketSender>(time_controller.GetClock()));
+    connections.push_back(
+        shared_pacer->AddConnection(packet_senders.back().get()));
+    connections.back()->SetPacingRates(MediaRate(i) * 1.5, DataRate::Zero());
+    connection_ptrs.push_back(connections.back().get());
+  }
+  time_controller.AdvanceTime(TimeDelta::Zero());
+  const int tasks_before = task_queue_factory.num_tasks();
+  EnqueueFrames(time_controller, connection_ptrs);
+
+  ScenarioResult result;
+  result.num_wakeups = task_queue_factory.num_tasks() - tasks_before;
+  SendTask(task_queue.get(), [&] {
+    connections.clear();
+    shared_pacer = nullptr;
+  });
+  for (const auto& packet_sender : packet_senders) {
+    result.send_times.push_back(packet_sender->send_times());
+  }
+  return result;
+}
+
+double WakeupsPerSecond(const ScenarioResult& result) {
+  return result.num_wakeups /
+         (kDuration + TimeDelta::Millis(500)).seconds<double>();
+}
+
+// Simulates state.range(0) connections each paced by its own
+// TaskQueuePacedSender, and reports the task queue wakeups per second.
+void BM_PerCallPacer(benchmark::State& state) {
+  const int num_connections = state.range(0);
+  ScenarioResult result;
+  for (auto _ : state) {
+    result = RunPerCallPacers(num_connections);
+  }
+  state.counters["wakeups_per_s"] = WakeupsPerSecond(result);
+}
+
+// Simulates state.range(0) connections paced by a SharedPacer with a
+// state.range(1) us tick. Besides the wakeups per second, reports how much
+// later than with per-call pacers the packets are sent, on average and at
+// most.
+void BM_SharedPacer(benchmark::State& state) {
+  const int num_connections = state.range(0);
+  const TimeDelta tick = TimeDelta::Micros(state.range(1));
+  const ScenarioResult reference = RunPerCallPacers(num_connections);
+  ScenarioResult result;
+  for (auto _ : state) {
+    result = RunSharedPacer(num_connections, tick);
+  }
+  state.counters["wakeups_per_s"] = WakeupsPerSecond(result);
+
+  double total_error_ms = 0.0;
+  double max_error_ms = 0.0;
+  int num_packets = 0;
+  for (int i = 0; i < num_connections; ++i) {
+    const std::vector<Timestamp>& expected = reference.send_times[i];
+    const std::vector<Timestamp>& actual = result.send_times[i];
+    for (size_t j = 0; j < std::min(expected.size(), actual.size()); ++j) {
+      if (expected[j].IsFinite() && actual[j].IsFinite()) {
+        const double error_ms = (actual[j] - expected[j]).ms<double>();
+        total_error_ms += std::abs(error_ms);
+        max_error_ms = std::max(max_error_ms, std::abs(error_ms));
+        ++num_packets;
+      }
+    }
+  }
+  state.counters["mean_send_time_error_ms"] =
+      num_packets > 0 ? total_error_ms / num_packets : 0.0;
+  state.counters["max_send_time_error_ms"] = max_error_ms;
+}
+
+BENCHMARK(BM_PerCallPacer)->Arg(10)->Arg(100)->Arg(500);
+BENCHMARK(BM_SharedPacer)->ArgsProduct({{10, 100, 500}, {1000, 5000}});
+
+}  // namespace
+}  // namespace webrtc
+
+/*
+
+BM_PerCallPacer and BM_SharedPacer take the number of connections, and
+BM_SharedPacer the timer wheel tick in microseconds. Both simulate 2.5 s of
+paced video, so wall time is the CPU cost of pacing that many connections.
+Run with:
+
+  out/Default/benchmarks --benchmark_filter=Pacer
+*/
@@ -0,0 +1,263 @@
+/*
+ *  Copyright 2025 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "modules/pacing/shared_pacer.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "api/environment/environment.h"
+#include "api/environment/environment_factory.h"
+#include "api/transport/network_types.h"
+#include "api/units/data_rate.h"
+#include "api/units/data_size.h"
+#include "api/units/time_delta.h"
+#include "api/units/timestamp.h"
+#include "modules/pacing/pacing_controller.h"
+#include "modules/rtp_rtcp/include/rtp_rtcp_defines.h"
+#include "modules/rtp_rtcp/source/rtp_packet_to_send.h"
+#include "system_wrappers/include/clock.h"
+#include "test/gtest.h"
+#include "test/time_controller/simulated_time_controller.h"
+
+namespace webrtc {
+namespace {
+
+constexpr uint32_t kSsrc = 12345;
+constexpr size_t kPacketSize = 1000;
+constexpr DataSize kPacketDataSize = DataSize::Bytes(kPacketSize);
+
+class FakePacketSender : public PacingController::PacketSender {
+ public:
+  explicit FakePacketSender(Clock* clock) : clock_(clock) {}
+
+  void SendPacket(std::unique_ptr<RtpPacketToSend> /* packet */,
+                  const PacedPacketInfo& /* cluster_info */) override {
+    send_times_.push_back(clock_->CurrentTime());
+  }
+  std::vector<std::unique_ptr<RtpPacketToSend>> FetchFec() override {
+    return {};
+  }
+  std::vector<std::unique_ptr<RtpPacketToSend>> GeneratePadding(
+      DataSize /* size */) override {
+    return {};
+  }
+
+  const std::vector<Timestamp>& send_times() const { return send_times_; }
+
+ private:
+  Clock* const clock_;
+  std::vector<Timestamp> send_times_;
+};
+
+std::vector<std::unique_ptr<RtpPacketToSend>> GeneratePackets(
+    size_t num_packets) {
+  std::vector<std::unique_ptr<RtpPacketToSend>> packets;
+  for (size_t i = 0; i < num_packets; ++i) {
+    auto packet = std::make_unique<RtpPacketToSend>(/*extensions=*/nullptr);
+    packet->set_packet_type(RtpPacketMediaType::kVideo);
+    packet->SetSsrc(kSsrc);
+    packet->SetSequenceNumber(i);
+    packet->SetPayloadSize(kPacketSize);
+    packets.push_back(std::move(packet));
+  }
+  return packets;
+}
+
+class SharedPacerTest : public ::testing::Test {
+ protected:
+  SharedPacerTest()
+      : time_controller_(Timestamp::Seconds(1000)),
+        env_(CreateEnvironment(time_controller_.GetClock(),
+                               time_controller_.GetTaskQueueFactory())) {}
+
+  GlobalSimulatedTimeController time_controller_;
+  const Environment env_;
+};
+
+TEST_F(SharedPacerTest, PacesPackets) {
+  SharedPacer pacer(env_, time_controller_.GetMainThread(),
+                    SharedPacer::Config());
+  FakePacketSender packet_sender(time_controller_.GetClock());
+  std::unique_ptr<SharedPacer::Connection> connection =
+      pacer.AddConnection(&packet_sender);
+
+  // Insert a number of packets, covering one second.
+  static constexpr size_t kPacketsToSend = 42;
+  connection->SetPacingRates(kPacketDataSize * kPacketsToSend /
+                                 TimeDelta::Seconds(1),
+                             DataRate::Zero());
+  const Timestamp start_time = env_.clock().CurrentTime();
+  connection->EnqueuePackets(GeneratePackets(kPacketsToSend));
+
+  time_controller_.AdvanceTime(TimeDelta::Seconds(1));
+  ASSERT_EQ(packet_sender.send_times().size(), kPacketsToSend);
+  EXPECT_NEAR((packet_sender.send_times().back() - start_time).ms<double>(),
+              1000.0, 50.0);
+  EXPECT_EQ(connection->QueueSizeData(), DataSize::Zero());
+}
+
+TEST_F(SharedPacerTest, ConnectionsShareWakeupsOnTickBoundaries) {
+  SharedPacer::Config config;
+  config.tick = TimeDelta::Millis(10);
+  SharedPacer pacer(env_, time_controller_.GetMainThread(), config);
+  FakePacketSender packet_sender1(time_controller_.GetClock());
+  FakePacketSender packet_sender2(time_controller_.GetClock());
+  std::unique_ptr<SharedPacer::Connection> connection1 =
+      pacer.AddConnection(&packet_sender1);
+  std::unique_ptr<SharedPacer::Connection> connection2 =
+      pacer.AddConnection(&packet_sender2);
+
+  // One packet every 3 ms and every 7 ms.
+  connection1->SetPacingRates(kPacketDataSize / TimeDelta::Millis(3),
+                              DataRate::Zero());
+  connection2->SetPacingRates(kPacketDataSize / TimeDelta::Millis(7),
+                              DataRate::Zero());
+  connection1->EnqueuePackets(GeneratePackets(100));
+  connection2->EnqueuePackets(GeneratePackets(40));
+  time_controller_.AdvanceTime(TimeDelta::Millis(500));
+
+  // The packets are enqueued at the end of a tick, so the ones sent right away
+  // are too, and all others are sent in the wakeups at the end of later ticks.
+  std::vector<Timestamp> send_times1 = packet_sender1.send_times();
+  std::vector<Timestamp> send_times2 = packet_sender2.send_times();
+  ASSERT_GT(send_times1.size(), 100u / 2);
+  ASSERT_GT(send_times2.size(), 40u / 2);
+  for (Timestamp send_time : send_times1) {
+    EXPECT_EQ(send_time.us() % config.tick.us(), 0);
+  }
+  for (Timestamp send_time : send_times2) {
+    EXPECT_EQ(send_time.us() % config.tick.us(), 0);
+  }
+}
+
+TEST_F(SharedPacerTest, SharesCappedRateByWeight) {
+  SharedPacer::Config config;
+  config.max_total_rate = DataRate::KilobitsPerSec(1000);
+  SharedPacer pacer(env_, time_controller_.GetMainThread(), config);
+  FakePacketSender packet_sender1(time_controller_.GetClock());
+  FakePacketSender packet_sender2(time_controller_.GetClock());
+  std::unique_ptr<SharedPacer::Connection> connection1 =
+      pacer.AddConnection(&packet_sender1);
+  std::unique_ptr<SharedPacer::Connection> connection2 =
+      pacer.AddConnection(&packet_sender2);
+
+  connection1->SetWeight(1.0);
+  connection2->SetWeight(3.0);
+  connection1->SetPacingRates(DataRate::KilobitsPerSec(2000),
+                              DataRate::Zero());
+  connection2->SetPacingRates(DataRate::KilobitsPerSec(2000),
+                              DataRate::Zero());
+  // 250 and 750 kbps are 31.25 and 93.75 packets per second. Enqueue 1.8 s
+  // worth of packets, below the queue time limit, above which the pacer
+  // would drain the queues faster.
+  connection1->EnqueuePackets(GeneratePackets(56));
+  connection2->EnqueuePackets(GeneratePackets(168));
+  // Skip the initial burst.
+  time_controller_.AdvanceTime(TimeDelta::Millis(500));
+  const size_t packets_sent1 = packet_sender1.send_times().size();
+  const size_t packets_sent2 = packet_sender2.send_times().size();
+  time_controller_.AdvanceTime(TimeDelta::Seconds(1));
+
+  EXPECT_NEAR(packet_sender1.send_times().size() - packets_sent1, 31.25, 4.0);
+  EXPECT_NEAR(packet_sender2.send_times().size() - packets_sent2, 93.75, 4.0);
+}
+
+TEST_F(SharedPacerTest, LeavesUnusedShareToOtherConnections) {
+  SharedPacer::Config config;
+  config.max_total_rate = DataRate::KilobitsPerSec(1000);
+  SharedPacer pacer(env_, time_controller_.GetMainThread(), config);
+  FakePacketSender packet_sender1(time_controller_.GetClock());
+  FakePacketSender packet_sender2(time_controller_.GetClock());
+  std::unique_ptr<SharedPacer::Connection> connection1 =
+      pacer.AddConnection(&packet_sender1);
+  std::unique_ptr<SharedPacer::Connection> connection2 =
+      pacer.AddConnection(&packet_sender2);
+
+  connection1->SetPacingRates(DataRate::KilobitsPerSec(200),
+                              DataRate::Zero());
+  connection2->SetPacingRates(DataRate::KilobitsPerSec(2000),
+                              DataRate::Zero());
+  // 200 and 800 kbps are 25 and 100 packets per second.
+  connection1->EnqueuePackets(GeneratePackets(45));
+  connection2->EnqueuePackets(GeneratePackets(180));
+  time_controller_.AdvanceTime(TimeDelta::Millis(500));
+  const size_t packets_sent1 = packet_sender1.send_times().size();
+  const size_t packets_sent2 = packet_sender2.send_times().size();
+  time_controller_.AdvanceTime(TimeDelta::Seconds(1));
+
+  EXPECT_NEAR(packet_sender1.send_times().size() - packets_sent1, 25.0, 4.0);
+  EXPECT_NEAR(packet_sender2.send_times().size() - packets_sent2, 100.0, 4.0);
+}
+
+TEST_F(SharedPacerTest, StopsSendingWhenConnectionIsDestroyed) {
+  SharedPacer pacer(env_, time_controller_.GetMainThread(),
+                    SharedPacer::Config());
+  FakePacketSender packet_sender1(time_controller_.GetClock());
+  FakePacketSender packet_sender2(time_controller_.GetClock());
+  std::unique_ptr<SharedPacer::Connection> connection1 =
+      pacer.AddConnection(&packet_sender1);
+  std::unique_ptr<SharedPacer::Connection> connection2 =
+      pacer.AddConnection(&packet_sender2);
+  connection1->SetPacingRates(kPacketDataSize * 10 / TimeDelta::Seconds(1),
+                              DataRate::Zero());
+  connection2->SetPacingRates(kPacketDataSize * 10 / TimeDelta::Seconds(1),
+                              DataRate::Zero());
+  connection1->EnqueuePackets(GeneratePackets(10));
+  connection2->EnqueuePackets(GeneratePackets(10));
+  time_controller_.AdvanceTime(TimeDelta::Millis(500));
+
+  const size_t packets_sent = packet_sender1.send_times().size();
+  EXPECT_GT(packets_sent, 0u);
+  connection1 = nullptr;
+  time_controller_.AdvanceTime(TimeDelta::Seconds(1));
+  EXPECT_EQ(packet_sender1.send_times().size(), packets_sent);
+  EXPECT_EQ(packet_sender2.send_times().size(), 10u);
+
+  // The index of the destroyed connection is reused.
+  FakePacketSender packet_sender3(time_controller_.GetClock());
+  std::unique_ptr<SharedPacer::Connection> connection3 =
+      pacer.AddConnection(&packet_sender3);
+  connection3->SetPacingRates(kPacketDataSize * 10 / TimeDelta::Seconds(1),
+                              DataRate::Zero());
+  connection3->EnqueuePackets(GeneratePackets(5));
+  time_controller_.AdvanceTime(TimeDelta::Seconds(1));
+  EXPECT_EQ(packet_sender1.send_times().size(), packets_sent);
+  EXPECT_EQ(packet_sender3.send_times().size(), 5u);
+}
+
+TEST_F(SharedPacerTest, DropsQueuedTasksOfConnectionDestroyedOnTaskQueue) {
+  SharedPacer pacer(env_, time_controller_.GetMainThread(),
+                    SharedPacer::Config());
+  FakePacketSender packet_sender1(time_controller_.GetClock());
+  FakePacketSender packet_sender2(time_controller_.GetClock());
+  std::unique_ptr<SharedPacer::Connection> connection1 =
+      pacer.AddConnection(&packet_sender1);
+  connection1->SetPacingRates(kPacketDataSize * 10 / TimeDelta::Seconds(1),
+                              DataRate::Zero());
+  connection1->EnqueuePackets(GeneratePackets(10));
+  // Destroyed on the task queue before its tasks ran, and replaced by a
+  // connection that must not get the queued packets.
+  connection1 = nullptr;
+  std::unique_ptr<SharedPacer::Connection> connection2 =
+      pacer.AddConnection(&packet_sender2);
+  connection2->SetPacingRates(kPacketDataSize * 10 / TimeDelta::Seconds(1),
+                              DataRate::Zero());
+  time_controller_.AdvanceTime(TimeDelta::Seconds(2));
+
+  EXPECT_TRUE(packet_sender1.send_times().empty());
+  EXPECT_TRUE(packet_sender2.send_times().empty());
+}
+
+}  // namespace
+}  // namespace webrtc
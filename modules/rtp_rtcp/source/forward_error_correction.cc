@@ -25,6 +25,15 @@
 #include "rtc_base/checks.h"
 #include "rtc_base/logging.h"
 #include "rtc_base/numerics/mod_ops.h"
+#include "rtc_base/system/arch.h"
+
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+#include <emmintrin.h>
+
+#include "system_wrappers/include/cpu_features_wrapper.h"
+#elif defined(WEBRTC_HAS_NEON)
+#include <arm_neon.h>
+#endif
 
 namespace webrtc {
 
@@ -33,6 +42,51 @@ namespace {
 constexpr size_t kTransportOverhead = 28;
 
 constexpr uint16_t kOldSequenceThreshold = 0x3fff;
+
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+bool Sse2Available() {
+  static const bool available = GetCPUInfo(kSSE2) != 0;
+  return available;
+}
+#endif
+
+// XORs `length` bytes of `src` into `dst`.
+void XorBytes(const uint8_t* src, size_t length, uint8_t* dst) {
+  size_t i = 0;
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+  if (Sse2Available()) {
+    for (; i + 32 <= length; i += 32) {
+      const __m128i* s = reinterpret_cast<const __m128i*>(src + i);
+      __m128i* d = reinterpret_cast<__m128i*>(dst + i);
+      const __m128i x0 =
+          _mm_xor_si128(_mm_loadu_si128(d), _mm_loadu_si128(s));
+      const __m128i x1 =
+          _mm_xor_si128(_mm_loadu_si128(d + 1), _mm_loadu_si128(s + 1));
+      _mm_storeu_si128(d, x0);
+      _mm_storeu_si128(d + 1, x1);
+    }
+  }
+#elif defined(WEBRTC_HAS_NEON)
+  for (; i + 32 <= length; i += 32) {
+    const uint8x16_t x0 = veorq_u8(vld1q_u8(dst + i), vld1q_u8(src + i));
+    const uint8x16_t x1 =
+        veorq_u8(vld1q_u8(dst + i + 16), vld1q_u8(src + i + 16));
+    vst1q_u8(dst + i, x0);
+    vst1q_u8(dst + i + 16, x1);
+  }
+#endif
+  for (; i + 8 <= length; i += 8) {
+    uint64_t s;
+    uint64_t d;
+    memcpy(&s, src + i, 8);
+    memcpy(&d, dst + i, 8);
+    d ^= s;
+    memcpy(dst + i, &d, 8);
+  }
+  for (; i < length; ++i) {
+    dst[i] ^= src[i];
+  }
+}
 }  // namespace
 
 ForwardErrorCorrection::Packet::Packet() : data(0), ref_count_(0) {}
@@ -155,8 +209,8 @@ int ForwardErrorCorrection::EncodeFec(const PacketList& media_packets,
   }
   for (int i = 0; i < num_fec_packets; ++i) {
     generated_fec_packets_[i].data.EnsureCapacity(IP_PACKET_SIZE);
-    memset(generated_fec_packets_[i].data.MutableData(), 0, IP_PACKET_SIZE);
-    // Use this as a marker for untouched packets.
+    // Use this as a marker for untouched packets. GenerateFecPayloads() zeroes
+    // the packets as they grow.
     generated_fec_packets_[i].data.SetSize(0);
     fec_packets->push_back(&generated_fec_packets_[i]);
   }
@@ -206,47 +260,50 @@ void ForwardErrorCorrection::GenerateFecPayloads(
     const PacketList& media_packets,
     size_t num_fec_packets) {
   RTC_DCHECK(!media_packets.empty());
+  RTC_DCHECK_LE(num_fec_packets, kUlpfecMaxMediaPackets);
+  size_t fec_header_sizes[kUlpfecMaxMediaPackets];
   for (size_t i = 0; i < num_fec_packets; ++i) {
-    Packet* const fec_packet = &generated_fec_packets_[i];
-    size_t pkt_mask_idx = i * packet_mask_size_;
     const size_t min_packet_mask_size = fec_header_writer_->MinPacketMaskSize(
-        &packet_masks_[pkt_mask_idx], packet_mask_size_);
-    const size_t fec_header_size =
+        &packet_masks_[i * packet_mask_size_], packet_mask_size_);
+    fec_header_sizes[i] =
         fec_header_writer_->FecHeaderSize(min_packet_mask_size);
+  }
 
-    size_t media_pkt_idx = 0;
-    auto media_packets_it = media_packets.cbegin();
-    uint16_t prev_seq_num =
-        ParseSequenceNumber((*media_packets_it)->data.data());
-    while (media_packets_it != media_packets.end()) {
-      Packet* const media_packet = media_packets_it->get();
-      // Should `media_packet` be protected by `fec_packet`?
-      if (packet_masks_[pkt_mask_idx] & (1 << (7 - media_pkt_idx))) {
-        size_t media_payload_length =
-            media_packet->data.size() - kRtpHeaderSize;
-
-        size_t fec_packet_length = fec_header_size + media_payload_length;
-        if (fec_packet_length > fec_packet->data.size()) {
-          size_t old_size = fec_packet->data.size();
-          fec_packet->data.SetSize(fec_packet_length);
-          memset(fec_packet->data.MutableData() + old_size, 0,
-                 fec_packet_length - old_size);
-        }
-        XorHeaders(*media_packet, fec_packet);
-        XorPayloads(*media_packet, media_payload_length, fec_header_size,
-                    fec_packet);
+  // Visit every media packet once, and XOR it into all FEC packets that
+  // protect it while it is in the cache.
+  size_t media_pkt_idx = 0;
+  uint16_t prev_seq_num =
+      ParseSequenceNumber(media_packets.front()->data.data());
+  for (const auto& media_packet : media_packets) {
+    uint16_t seq_num = ParseSequenceNumber(media_packet->data.data());
+    media_pkt_idx += static_cast<uint16_t>(seq_num - prev_seq_num);
+    prev_seq_num = seq_num;
+    const size_t mask_byte_idx = media_pkt_idx / 8;
+    const uint8_t mask_bit = 1 << (7 - media_pkt_idx % 8);
+    const size_t media_payload_length =
+        media_packet->data.size() - kRtpHeaderSize;
+
+    for (size_t i = 0; i < num_fec_packets; ++i) {
+      // Should `media_packet` be protected by FEC packet `i`?
+      if (!(packet_masks_[i * packet_mask_size_ + mask_byte_idx] & mask_bit)) {
+        continue;
       }
-      media_packets_it++;
-      if (media_packets_it != media_packets.end()) {
-        uint16_t seq_num =
-            ParseSequenceNumber((*media_packets_it)->data.data());
-        media_pkt_idx += static_cast<uint16_t>(seq_num - prev_seq_num);
-        prev_seq_num = seq_num;
+      Packet* const fec_packet = &generated_fec_packets_[i];
+      size_t fec_packet_length = fec_header_sizes[i] + media_payload_length;
+      if (fec_packet_length > fec_packet->data.size()) {
+        size_t old_size = fec_packet->data.size();
+        fec_packet->data.SetSize(fec_packet_length);
+        memset(fec_packet->data.MutableData() + old_size, 0,
+               fec_packet_length - old_size);
       }
-      pkt_mask_idx += media_pkt_idx / 8;
-      media_pkt_idx %= 8;
+      XorHeaders(*media_packet, fec_packet);
+      XorPayloads(*media_packet, media_payload_length, fec_header_sizes[i],
+                  fec_packet);
     }
-    RTC_DCHECK_GT(fec_packet->data.size(), 0)
+  }
+
+  for (size_t i = 0; i < num_fec_packets; ++i) {
+    RTC_DCHECK_GT(generated_fec_packets_[i].data.size(), 0)
         << "Packet mask is wrong or poorly designed.";
   }
 }
@@ -635,11 +692,8 @@ void ForwardErrorCorrection::XorPayloads(const Packet& src,
     dst->data.SetSize(new_size);
     memset(dst->data.MutableData() + old_size, 0, new_size - old_size);
   }
-  uint8_t* dst_data = dst->data.MutableData();
-  const uint8_t* src_data = src.data.cdata();
-  for (size_t i = 0; i < payload_length; ++i) {
-    dst_data[dst_offset + i] ^= src_data[kRtpHeaderSize + i];
-  }
+  XorBytes(src.data.cdata() + kRtpHeaderSize, payload_length,
+           dst->data.MutableData() + dst_offset);
 }
 
 bool ForwardErrorCorrection::RecoverPacket(const ReceivedFecPacket& fec_packet,
@@ -0,0 +1,138 @@
+/*
+ *  Copyright 2025 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "modules/include/module_fec_types.h"
+#include "modules/rtp_rtcp/source/fec_test_helper.h"
+#include "modules/rtp_rtcp/source/forward_error_correction.h"
+#include "rtc_base/checks.h"
+#include "rtc_base/copy_on_write_buffer.h"
+#include "rtc_base/random.h"
+
+namespace webrtc {
+namespace {
+
+constexpr uint32_t kMediaSsrc = 1234;
+constexpr uint16_t kStartSeqNum = 100;
+constexpr uint32_t kMediaPacketSize = 1200;
+
+// Generates FEC packets for state.range(0) media packets of 1200 bytes at a
+// protection factor of state.range(1) / 255, with random masks.
+void BM_EncodeFec(benchmark::State& state) {
+  const int num_media_packets = state.range(0);
+  const uint8_t protection_factor = state.range(1);
+  std::unique_ptr<ForwardErrorCorrection> fec =
+      ForwardErrorCorrection::CreateUlpfec(kMediaSsrc);
+  Random random(0x1234);
+  test::fec::MediaPacketGenerator generator(kMediaPacketSize, kMediaPacketSize,
+                                            kMediaSsrc, &random);
+  ForwardErrorCorrection::PacketList media_packets =
+      generator.ConstructMediaPackets(num_media_packets, kStartSeqNum);
+  std::list<ForwardErrorCorrection::Packet*> fec_packets;
+
+  for (auto _ : state) {
+    fec_packets.clear();
+    RTC_CHECK_EQ(fec->EncodeFec(media_packets, protection_factor,
+                                /*num_important_packets=*/0,
+                                /*use_unequal_protection=*/false,
+                                kFecMaskRandom, &fec_packets),
+                 0);
+    benchmark::DoNotOptimize(fec_packets.front()->data.data());
+  }
+  state.SetItemsProcessed(state.iterations() * num_media_packets);
+  state.SetBytesProcessed(state.iterations() * num_media_packets *
+                          kMediaPacketSize);
+}
+
+BENCHMARK(BM_EncodeFec)->ArgsProduct({{4, 12, 48}, {25, 85, 255}});
+
+// Receives state.range(0) media packets of 1200 bytes, the first one lost, and
+// their FEC packets at a protection factor of 85 / 255, and recovers the lost
+// packet.
+void BM_DecodeFec(benchmark::State& state) {
+  const int num_media_packets = state.range(0);
+  std::unique_ptr<ForwardErrorCorrection> fec =
+      ForwardErrorCorrection::CreateUlpfec(kMediaSsrc);
+  Random random(0x1234);
+  test::fec::MediaPacketGenerator generator(kMediaPacketSize, kMediaPacketSize,
+                                            kMediaSsrc, &random);
+  ForwardErrorCorrection::PacketList media_packets =
+      generator.ConstructMediaPackets(num_media_packets, kStartSeqNum);
+  std::list<ForwardErrorCorrection::Packet*> fec_packets;
+  RTC_CHECK_EQ(fec->EncodeFec(media_packets, /*protection_factor=*/85,
+                              /*num_important_packets=*/0,
+                              /*use_unequal_protection=*/false,
+                              kFecMaskRandom, &fec_packets),
+               0);
+
+  std::vector<ForwardErrorCorrection::ReceivedPacket> received_packets;
+  uint16_t seq_num = kStartSeqNum;
+  for (const auto& media_packet : media_packets) {
+    if (seq_num != kStartSeqNum) {
+      ForwardErrorCorrection::ReceivedPacket& received =
+          received_packets.emplace_back();
+      received.ssrc = kMediaSsrc;
+      received.seq_num = seq_num;
+      received.is_fec = false;
+      received.pkt = new ForwardErrorCorrection::Packet();
+      received.pkt->data = media_packet->data;
+    }
+    ++seq_num;
+  }
+  for (const ForwardErrorCorrection::Packet* fec_packet : fec_packets) {
+    ForwardErrorCorrection::ReceivedPacket& received =
+        received_packets.emplace_back();
+    received.ssrc = kMediaSsrc;
+    received.seq_num = seq_num++;
+    received.is_fec = true;
+    received.pkt = new ForwardErrorCorrection::Packet();
+    received.pkt->data = fec_packet->data;
+  }
+
+  // Reading a ULPFEC header rewrites the packet, so restore the packets for
+  // every iteration.
+  std::vector<rtc::CopyOnWriteBuffer> received_data;
+  for (const auto& received : received_packets) {
+    received_data.push_back(received.pkt->data);
+  }
+
+  ForwardErrorCorrection::RecoveredPacketList recovered_packets;
+  for (auto _ : state) {
+    fec->ResetState(&recovered_packets);
+    size_t num_recovered_packets = 0;
+    for (size_t i = 0; i < received_packets.size(); ++i) {
+      received_packets[i].pkt->data = received_data[i];
+      num_recovered_packets +=
+          fec->DecodeFec(received_packets[i], &recovered_packets)
+              .num_recovered_packets;
+    }
+    RTC_CHECK_EQ(num_recovered_packets, 1);
+  }
+  state.SetItemsProcessed(state.iterations() * received_packets.size());
+}
+
+BENCHMARK(BM_DecodeFec)->Arg(4)->Arg(12)->Arg(48);
+
+}  // namespace
+}  // namespace webrtc
+
+/*
+
+BM_EncodeFec takes the number of media packets and the protection factor,
+BM_DecodeFec the number of media packets. Run with:
+
+  out/Default/benchmarks --benchmark_filter=Fec
+*/
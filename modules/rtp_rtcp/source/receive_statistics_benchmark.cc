@@ -0,0 +1,109 @@
+/*
+ *  Copyright 2025 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "modules/rtp_rtcp/include/receive_statistics.h"
+#include "modules/rtp_rtcp/source/rtcp_packet/report_block.h"
+#include "modules/rtp_rtcp/source/rtp_packet_received.h"
+#include "rtc_base/checks.h"
+#include "system_wrappers/include/clock.h"
+
+namespace webrtc {
+namespace {
+
+constexpr int kNumSsrcs = 1000;
+constexpr size_t kMaxReportBlocks = 31;
+constexpr int kPayloadTypeFrequency = 90000;
+
+std::vector<RtpPacketReceived> CreatePackets(int first_ssrc, int num_ssrcs) {
+  std::vector<RtpPacketReceived> packets(num_ssrcs);
+  for (int i = 0; i < num_ssrcs; ++i) {
+    packets[i].SetSsrc(0x10000000 + first_ssrc + i);
+    packets[i].SetSequenceNumber(i);
+    packets[i].SetTimestamp(i * 1000);
+    packets[i].set_payload_type_frequency(kPayloadTypeFrequency);
+    packets[i].SetPayloadSize(1000);
+  }
+  return packets;
+}
+
+void ReceiveNext(ReceiveStatistics& statistics,
+                 std::vector<RtpPacketReceived>& packets,
+                 size_t& next) {
+  RtpPacketReceived& packet = packets[next];
+  statistics.OnRtpPacket(packet);
+  packet.SetSequenceNumber(packet.SequenceNumber() + 1);
+  packet.SetTimestamp(packet.Timestamp() + 3000);
+  if (++next == packets.size()) {
+    next = 0;
+  }
+}
+
+ReceiveStatistics* statistics_for_threads = nullptr;
+
+// Each thread receives packets round robin on its share of `kNumSsrcs`
+// streams, on one ReceiveStatistics shared by all threads.
+void BM_ReceiveStatisticsOnRtpPacket(benchmark::State& state) {
+  if (state.thread_index() == 0) {
+    statistics_for_threads =
+        ReceiveStatistics::Create(Clock::GetRealTimeClock()).release();
+  }
+  const int ssrcs_per_thread = kNumSsrcs / state.threads();
+  std::vector<RtpPacketReceived> packets =
+      CreatePackets(state.thread_index() * ssrcs_per_thread, ssrcs_per_thread);
+  size_t next = 0;
+
+  for (auto _ : state) {
+    ReceiveNext(*statistics_for_threads, packets, next);
+  }
+
+  state.SetItemsProcessed(state.iterations());
+  if (state.thread_index() == 0) {
+    delete statistics_for_threads;
+    statistics_for_threads = nullptr;
+  }
+}
+
+BENCHMARK(BM_ReceiveStatisticsOnRtpPacket)->ThreadRange(1, 8)->UseRealTime();
+
+// Generates RTCP report blocks for `kNumSsrcs` active streams, while packets
+// keep arriving on all of them.
+void BM_ReceiveStatisticsRtcpReportBlocks(benchmark::State& state) {
+  std::unique_ptr<ReceiveStatistics> statistics =
+      ReceiveStatistics::Create(Clock::GetRealTimeClock());
+  std::vector<RtpPacketReceived> packets = CreatePackets(0, kNumSsrcs);
+  size_t next = 0;
+  for (int i = 0; i < kNumSsrcs; ++i) {
+    ReceiveNext(*statistics, packets, next);
+  }
+
+  size_t num_report_blocks = 0;
+  for (auto _ : state) {
+    for (size_t i = 0; i < kMaxReportBlocks; ++i) {
+      ReceiveNext(*statistics, packets, next);
+    }
+    std::vector<rtcp::ReportBlock> report_blocks =
+        statistics->RtcpReportBlocks(kMaxReportBlocks);
+    num_report_blocks += report_blocks.size();
+  }
+
+  RTC_CHECK_EQ(num_report_blocks, kMaxReportBlocks * state.iterations());
+  state.SetItemsProcessed(num_report_blocks);
+}
+
+BENCHMARK(BM_ReceiveStatisticsRtcpReportBlocks);
+
+}  // namespace
+}  // namespace webrtc
@@ -29,6 +29,19 @@ namespace webrtc {
 namespace {
 constexpr TimeDelta kStatisticsTimeout = TimeDelta::Seconds(8);
 constexpr TimeDelta kStatisticsProcessInterval = TimeDelta::Seconds(1);
+constexpr size_t kInitialSsrcTableCapacity = 16;
+
+size_t SsrcTableIndex(uint32_t ssrc, size_t capacity) {
+  // Mix all bits into the low ones (the MurmurHash3 finalizer), since SSRCs
+  // chosen by some senders are not random.
+  uint32_t hash = ssrc;
+  hash ^= hash >> 16;
+  hash *= 0x85ebca6bu;
+  hash ^= hash >> 13;
+  hash *= 0xc2b2ae35u;
+  hash ^= hash >> 16;
+  return hash & (capacity - 1);
+}
 
 TimeDelta UnixEpochDelta(Clock& clock) {
   Timestamp now = clock.CurrentTime();
@@ -330,6 +343,72 @@ bool StreamStatisticianImpl::IsRetransmitOfOldPacket(
   return time_diff > rtp_time_stamp_diff + max_delay;
 }
 
+SsrcStatisticianTable::Table::Table(size_t capacity)
+    : capacity(capacity), slots(std::make_unique<Slot[]>(capacity)) {}
+
+SsrcStatisticianTable::SsrcStatisticianTable() {
+  tables_.push_back(std::make_unique<Table>(kInitialSsrcTableCapacity));
+  table_.store(tables_.back().get(), std::memory_order_release);
+}
+
+SsrcStatisticianTable::~SsrcStatisticianTable() = default;
+
+StreamStatisticianImplInterface* SsrcStatisticianTable::Find(
+    uint32_t ssrc) const {
+  const Table* table = table_.load(std::memory_order_acquire);
+  for (size_t i = SsrcTableIndex(ssrc, table->capacity);;
+       i = (i + 1) & (table->capacity - 1)) {
+    const Slot& slot = table->slots[i];
+    StreamStatisticianImplInterface* statistician =
+        slot.statistician.load(std::memory_order_acquire);
+    if (statistician == nullptr) {
+      return nullptr;
+    }
+    if (slot.ssrc.load(std::memory_order_relaxed) == ssrc) {
+      return statistician;
+    }
+  }
+}
+
+void SsrcStatisticianTable::Insert(
+    uint32_t ssrc,
+    StreamStatisticianImplInterface* statistician) {
+  RTC_DCHECK(statistician);
+  RTC_DCHECK(!Find(ssrc));
+  Table* table = tables_.back().get();
+  // Keep the load factor at most 1/2, so probe sequences stay short.
+  if (2 * (table->size + 1) > table->capacity) {
+    auto grown = std::make_unique<Table>(2 * table->capacity);
+    for (size_t i = 0; i < table->capacity; ++i) {
+      const Slot& slot = table->slots[i];
+      StreamStatisticianImplInterface* existing =
+          slot.statistician.load(std::memory_order_relaxed);
+      if (existing != nullptr) {
+        InsertIntoTable(*grown, slot.ssrc.load(std::memory_order_relaxed),
+                        existing);
+      }
+    }
+    table = grown.get();
+    tables_.push_back(std::move(grown));
+  }
+  InsertIntoTable(*table, ssrc, statistician);
+  table_.store(table, std::memory_order_release);
+}
+
+void SsrcStatisticianTable::InsertIntoTable(
+    Table& table,
+    uint32_t ssrc,
+    StreamStatisticianImplInterface* statistician) {
+  size_t i = SsrcTableIndex(ssrc, table.capacity);
+  while (table.slots[i].statistician.load(std::memory_order_relaxed) !=
+         nullptr) {
+    i = (i + 1) & (table.capacity - 1);
+  }
+  table.slots[i].ssrc.store(ssrc, std::memory_order_relaxed);
+  table.slots[i].statistician.store(statistician, std::memory_order_release);
+  ++table.size;
+}
+
 std::unique_ptr<ReceiveStatistics> ReceiveStatistics::Create(Clock* clock) {
   return std::make_unique<ReceiveStatisticsLocked>(
       clock, [](uint32_t ssrc, Clock* clock) {
@@ -364,20 +443,23 @@ void ReceiveStatisticsImpl::OnRtpPacket(const RtpPacketReceived& packet) {
 
 StreamStatistician* ReceiveStatisticsImpl::GetStatistician(
     uint32_t ssrc) const {
-  const auto& it = statisticians_.find(ssrc);
-  if (it == statisticians_.end())
-    return nullptr;
-  return it->second.get();
+  return FindStatistician(ssrc);
+}
+
+StreamStatisticianImplInterface* ReceiveStatisticsImpl::FindStatistician(
+    uint32_t ssrc) const {
+  return statisticians_by_ssrc_.Find(ssrc);
 }
 
 StreamStatisticianImplInterface* ReceiveStatisticsImpl::GetOrCreateStatistician(
     uint32_t ssrc) {
-  std::unique_ptr<StreamStatisticianImplInterface>& impl = statisticians_[ssrc];
+  StreamStatisticianImplInterface* impl = statisticians_by_ssrc_.Find(ssrc);
   if (impl == nullptr) {  // new element
-    impl = stream_statistician_factory_(ssrc, clock_);
-    all_ssrcs_.push_back(ssrc);
+    statisticians_.push_back(stream_statistician_factory_(ssrc, clock_));
+    impl = statisticians_.back().get();
+    statisticians_by_ssrc_.Insert(ssrc, impl);
   }
-  return impl.get();
+  return impl;
 }
 
 void ReceiveStatisticsImpl::SetMaxReorderingThreshold(
@@ -395,15 +477,18 @@ void ReceiveStatisticsImpl::EnableRetransmitDetection(uint32_t ssrc,
 std::vector<rtcp::ReportBlock> ReceiveStatisticsImpl::RtcpReportBlocks(
     size_t max_blocks) {
   std::vector<rtcp::ReportBlock> result;
-  result.reserve(std::min(max_blocks, all_ssrcs_.size()));
+  result.reserve(std::min(max_blocks, statisticians_.size()));
 
+  // Visit the statisticians in a single pass, in creation order, starting
+  // after the one visited last time.
   size_t ssrc_idx = 0;
-  for (size_t i = 0; i < all_ssrcs_.size() && result.size() < max_blocks; ++i) {
-    ssrc_idx = (last_returned_ssrc_idx_ + i + 1) % all_ssrcs_.size();
-    const uint32_t media_ssrc = all_ssrcs_[ssrc_idx];
-    auto statistician_it = statisticians_.find(media_ssrc);
-    RTC_DCHECK(statistician_it != statisticians_.end());
-    statistician_it->second->MaybeAppendReportBlockAndReset(result);
+  for (size_t i = 0; i < statisticians_.size() && result.size() < max_blocks;
+       ++i) {
+    ssrc_idx = last_returned_ssrc_idx_ + i + 1;
+    if (ssrc_idx >= statisticians_.size()) {
+      ssrc_idx -= statisticians_.size();
+    }
+    statisticians_[ssrc_idx]->MaybeAppendReportBlockAndReset(result);
   }
   last_returned_ssrc_idx_ = ssrc_idx;
   return result;
@@ -12,6 +12,7 @@
 #define MODULES_RTP_RTCP_SOURCE_RECEIVE_STATISTICS_IMPL_H_
 
 #include <algorithm>
+#include <atomic>
 #include <functional>
 #include <memory>
 #include <optional>
@@ -22,8 +23,8 @@
 #include "api/units/timestamp.h"
 #include "modules/rtp_rtcp/include/receive_statistics.h"
 #include "modules/rtp_rtcp/source/rtcp_packet/report_block.h"
+#include "modules/rtp_rtcp/source/rtp_packet_received.h"
 #include "rtc_base/bitrate_tracker.h"
-#include "rtc_base/containers/flat_map.h"
 #include "rtc_base/numerics/sequence_number_unwrapper.h"
 #include "rtc_base/synchronization/mutex.h"
 #include "rtc_base/thread_annotations.h"
@@ -159,6 +160,45 @@ class StreamStatisticianLocked : public StreamStatisticianImplInterface {
   StreamStatisticianImpl impl_ RTC_GUARDED_BY(&stream_lock_);
 };
 
+// Maps SSRCs to statisticians. Find() is lock-free and may run concurrently
+// with Insert(), but calls to Insert() must be serialized. Entries are never
+// removed.
+class SsrcStatisticianTable {
+ public:
+  SsrcStatisticianTable();
+  SsrcStatisticianTable(const SsrcStatisticianTable&) = delete;
+  SsrcStatisticianTable& operator=(const SsrcStatisticianTable&) = delete;
+  ~SsrcStatisticianTable();
+
+  StreamStatisticianImplInterface* Find(uint32_t ssrc) const;
+  // `ssrc` must not already be in the table.
+  void Insert(uint32_t ssrc, StreamStatisticianImplInterface* statistician);
+
+ private:
+  // An open addressing hash table. A slot is in use once `statistician` is
+  // set, which happens after `ssrc` is written.
+  struct Slot {
+    std::atomic<uint32_t> ssrc{0};
+    std::atomic<StreamStatisticianImplInterface*> statistician{nullptr};
+  };
+  struct Table {
+    explicit Table(size_t capacity);
+    const size_t capacity;
+    const std::unique_ptr<Slot[]> slots;
+    size_t size = 0;
+  };
+
+  static void InsertIntoTable(Table& table,
+                              uint32_t ssrc,
+                              StreamStatisticianImplInterface* statistician);
+
+  std::atomic<const Table*> table_;
+  // All tables that have been published, the current one last. Tables that
+  // have been replaced are kept since concurrent Find() calls may still read
+  // them; they sum up to less than the size of the current table.
+  std::vector<std::unique_ptr<Table>> tables_;
+};
+
 // Thread-compatible implementation.
 class ReceiveStatisticsImpl : public ReceiveStatistics {
  public:
@@ -181,6 +221,10 @@ class ReceiveStatisticsImpl : public ReceiveStatistics {
                                  int max_reordering_threshold) override;
   void EnableRetransmitDetection(uint32_t ssrc, bool enable) override;
 
+  // Returns the statistician for `ssrc`, or nullptr if there is none yet. May
+  // be called concurrently with all other methods.
+  StreamStatisticianImplInterface* FindStatistician(uint32_t ssrc) const;
+
  private:
   StreamStatisticianImplInterface* GetOrCreateStatistician(uint32_t ssrc);
 
@@ -188,15 +232,17 @@ class ReceiveStatisticsImpl : public ReceiveStatistics {
   std::function<std::unique_ptr<StreamStatisticianImplInterface>(uint32_t ssrc,
                                                                  Clock* clock)>
       stream_statistician_factory_;
-  // The index within `all_ssrcs_` that was last returned.
+  // The index within `statisticians_` that was last returned.
   size_t last_returned_ssrc_idx_;
-  std::vector<uint32_t> all_ssrcs_;
-  flat_map<uint32_t /*ssrc*/, std::unique_ptr<StreamStatisticianImplInterface>>
-      statisticians_;
+  // In order of creation.
+  std::vector<std::unique_ptr<StreamStatisticianImplInterface>> statisticians_;
+  SsrcStatisticianTable statisticians_by_ssrc_;
 };
 
 // Thread-safe implementation wrapping access to ReceiveStatisticsImpl with a
-// mutex.
+// mutex. Packets for SSRCs that already have a statistician, and lookups of
+// statisticians, don't take the mutex since statisticians are never removed
+// and have their own locking.
 class ReceiveStatisticsLocked : public ReceiveStatistics {
  public:
   explicit ReceiveStatisticsLocked(
@@ -211,12 +257,17 @@ class ReceiveStatisticsLocked : public ReceiveStatistics {
     return impl_.RtcpReportBlocks(max_blocks);
   }
   void OnRtpPacket(const RtpPacketReceived& packet) override {
+    StreamStatisticianImplInterface* statistician =
+        FindStatistician(packet.Ssrc());
+    if (statistician != nullptr) {
+      statistician->UpdateCounters(packet);
+      return;
+    }
     MutexLock lock(&receive_statistics_lock_);
     return impl_.OnRtpPacket(packet);
   }
   StreamStatistician* GetStatistician(uint32_t ssrc) const override {
-    MutexLock lock(&receive_statistics_lock_);
-    return impl_.GetStatistician(ssrc);
+    return FindStatistician(ssrc);
   }
   void SetMaxReorderingThreshold(uint32_t ssrc,
                                  int max_reordering_threshold) override {
@@ -229,6 +280,13 @@ class ReceiveStatisticsLocked : public ReceiveStatistics {
   }
 
  private:
+  // ReceiveStatisticsImpl::FindStatistician() may be called concurrently with
+  // all other methods, so it is the one use of `impl_` without the lock.
+  StreamStatisticianImplInterface* FindStatistician(uint32_t ssrc) const
+      RTC_NO_THREAD_SAFETY_ANALYSIS {
+    return impl_.FindStatistician(ssrc);
+  }
+
   mutable Mutex receive_statistics_lock_;
   ReceiveStatisticsImpl impl_ RTC_GUARDED_BY(&receive_statistics_lock_);
 };
@@ -12,6 +12,7 @@
 
 #include <cstdint>
 #include <memory>
+#include <set>
 #include <vector>
 
 #include "api/units/time_delta.h"
@@ -209,6 +210,33 @@ TEST_P(ReceiveStatisticsTest,
               UnorderedElementsAre(kSsrc1, kSsrc2, kSsrc3, kSsrc4));
 }
 
+TEST_P(ReceiveStatisticsTest, ReportsOnManySsrcs) {
+  constexpr uint32_t kNumSsrcs = 1000;
+  constexpr size_t kMaxBlocks = 31;
+  // Use SSRCs that differ only in their high bits.
+  for (uint32_t i = 0; i < kNumSsrcs; ++i) {
+    receive_statistics_->OnRtpPacket(
+        CreateRtpPacket(/*ssrc=*/i << 20, kPacketSize1));
+  }
+  for (uint32_t i = 0; i < kNumSsrcs; ++i) {
+    StreamStatistician* statistician =
+        receive_statistics_->GetStatistician(i << 20);
+    ASSERT_NE(statistician, nullptr);
+    EXPECT_EQ(statistician->GetReceiveStreamDataCounters().transmitted.packets,
+              1u);
+  }
+  EXPECT_EQ(receive_statistics_->GetStatistician(12345), nullptr);
+
+  std::set<uint32_t> observed_ssrcs;
+  for (uint32_t i = 0; i < kNumSsrcs; i += kMaxBlocks) {
+    for (const rtcp::ReportBlock& report_block :
+         receive_statistics_->RtcpReportBlocks(kMaxBlocks)) {
+      observed_ssrcs.insert(report_block.source_ssrc());
+    }
+  }
+  EXPECT_EQ(observed_ssrcs.size(), kNumSsrcs);
+}
+
 TEST_P(ReceiveStatisticsTest, ActiveStatisticians) {
   receive_statistics_->OnRtpPacket(packet1_);
   IncrementSequenceNumber(&packet1_);
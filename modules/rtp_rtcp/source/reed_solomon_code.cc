@@ -0,0 +1,252 @@
+/*
+ *  Copyright 2025 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "modules/rtp_rtcp/source/reed_solomon_code.h"
+
+#include <string.h>
+
+#include <utility>
+
+#include "rtc_base/checks.h"
+#include "rtc_base/system/arch.h"
+
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+#include "modules/rtp_rtcp/source/reed_solomon_code_avx2.h"
+#include "system_wrappers/include/cpu_features_wrapper.h"
+#elif defined(WEBRTC_HAS_NEON) && defined(WEBRTC_ARCH_ARM64)
+#include <arm_neon.h>
+#endif
+
+namespace webrtc {
+
+namespace {
+
+// x^8 + x^4 + x^3 + x^2 + 1, the primitive polynomial commonly used for
+// GF(2^8). The element 2 generates the multiplicative group.
+constexpr int kPrimitivePolynomial = 0x11d;
+
+struct GaloisFieldTables {
+  GaloisFieldTables() {
+    int x = 1;
+    for (int i = 0; i < 255; ++i) {
+      exp[i] = x;
+      exp[i + 255] = x;
+      log[x] = i;
+      x <<= 1;
+      if (x & 0x100) {
+        x ^= kPrimitivePolynomial;
+      }
+    }
+    log[0] = 0;
+    for (int a = 0; a < 256; ++a) {
+      mul[a][0] = 0;
+      mul[0][a] = 0;
+    }
+    for (int a = 1; a < 256; ++a) {
+      for (int b = 1; b < 256; ++b) {
+        mul[a][b] = exp[log[a] + log[b]];
+      }
+    }
+  }
+
+  uint8_t Inverse(uint8_t a) const {
+    RTC_DCHECK_NE(a, 0);
+    return exp[255 - log[a]];
+  }
+
+  // Doubled, so that the sum of two logarithms needs no reduction.
+  uint8_t exp[2 * 255];
+  uint8_t log[256];
+  // The 256 byte row mul[c] maps x to c * x, which is all a multiplication by
+  // a coefficient needs.
+  uint8_t mul[256][256];
+};
+
+const GaloisFieldTables& Gf() {
+  static const GaloisFieldTables tables;
+  return tables;
+}
+
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+bool Avx2Available() {
+  static const bool available = GetCPUInfo(kAVX2) != 0;
+  return available;
+}
+#endif
+
+// Computes dst[i] ^= c * src[i]. The product of c and a byte is the sum of the
+// products of c and the byte's two nibbles, so the SIMD versions look both up
+// in 16 entry tables with a byte shuffle.
+void MulAdd(uint8_t c, const uint8_t* src, uint8_t* dst, size_t size) {
+  if (c == 0) {
+    return;
+  }
+  const uint8_t* products = Gf().mul[c];
+  uint8_t high_products[16];
+  for (int nibble = 0; nibble < 16; ++nibble) {
+    high_products[nibble] = products[nibble << 4];
+  }
+  size_t i = 0;
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+  if (Avx2Available()) {
+    i = ReedSolomonMulAddAvx2(products, high_products, src, dst, size);
+  }
+#elif defined(WEBRTC_HAS_NEON) && defined(WEBRTC_ARCH_ARM64)
+  const uint8x16_t low_table = vld1q_u8(products);
+  const uint8x16_t high_table = vld1q_u8(high_products);
+  const uint8x16_t low_mask = vdupq_n_u8(0x0f);
+  for (; i + 16 <= size; i += 16) {
+    const uint8x16_t x = vld1q_u8(src + i);
+    const uint8x16_t product =
+        veorq_u8(vqtbl1q_u8(low_table, vandq_u8(x, low_mask)),
+                 vqtbl1q_u8(high_table, vshrq_n_u8(x, 4)));
+    vst1q_u8(dst + i, veorq_u8(vld1q_u8(dst + i), product));
+  }
+#endif
+  for (; i < size; ++i) {
+    dst[i] ^= products[src[i]];
+  }
+}
+
+// Inverts the n x n `matrix`, given row by row, with Gauss-Jordan elimination.
+std::vector<uint8_t> Invert(std::vector<uint8_t> matrix, int n) {
+  const GaloisFieldTables& gf = Gf();
+  std::vector<uint8_t> inverse(n * n, 0);
+  for (int i = 0; i < n; ++i) {
+    inverse[i * n + i] = 1;
+  }
+  for (int col = 0; col < n; ++col) {
+    int pivot = col;
+    while (pivot < n && matrix[pivot * n + col] == 0) {
+      ++pivot;
+    }
+    // Square submatrices of the generator matrix are never singular.
+    RTC_CHECK_LT(pivot, n);
+    if (pivot != col) {
+      for (int j = 0; j < n; ++j) {
+        std::swap(matrix[pivot * n + j], matrix[col * n + j]);
+        std::swap(inverse[pivot * n + j], inverse[col * n + j]);
+      }
+    }
+    const uint8_t* scale = gf.mul[gf.Inverse(matrix[col * n + col])];
+    for (int j = 0; j < n; ++j) {
+      matrix[col * n + j] = scale[matrix[col * n + j]];
+      inverse[col * n + j] = scale[inverse[col * n + j]];
+    }
+    for (int row = 0; row < n; ++row) {
+      const uint8_t factor = matrix[row * n + col];
+      if (row == col || factor == 0) {
+        continue;
+      }
+      const uint8_t* products = gf.mul[factor];
+      for (int j = 0; j < n; ++j) {
+        matrix[row * n + j] ^= products[matrix[col * n + j]];
+        inverse[row * n + j] ^= products[inverse[col * n + j]];
+      }
+    }
+  }
+  return inverse;
+}
+
+}  // namespace
+
+ReedSolomonCode::ReedSolomonCode(int num_data_shards, int num_parity_shards)
+    : num_data_shards_(num_data_shards),
+      num_parity_shards_(num_parity_shards),
+      cauchy_(num_data_shards * num_parity_shards) {
+  RTC_DCHECK_GT(num_data_shards_, 0);
+  RTC_DCHECK_GE(num_parity_shards_, 0);
+  RTC_DCHECK_LE(num_data_shards_ + num_parity_shards_, kMaxShards);
+  // Parity shard i is the point k + i and data shard j the point j, all
+  // distinct, and the coefficient is 1 / (x_i - y_j).
+  const GaloisFieldTables& gf = Gf();
+  for (int i = 0; i < num_parity_shards_; ++i) {
+    for (int j = 0; j < num_data_shards_; ++j) {
+      cauchy_[i * num_data_shards_ + j] =
+          gf.Inverse((num_data_shards_ + i) ^ j);
+    }
+  }
+}
+
+ReedSolomonCode::~ReedSolomonCode() = default;
+
+void ReedSolomonCode::Encode(rtc::ArrayView<const uint8_t* const> data_shards,
+                             rtc::ArrayView<uint8_t* const> parity_shards,
+                             size_t shard_size) const {
+  RTC_DCHECK_EQ(data_shards.size(), num_data_shards_);
+  RTC_DCHECK_EQ(parity_shards.size(), num_parity_shards_);
+  for (int i = 0; i < num_parity_shards_; ++i) {
+    memset(parity_shards[i], 0, shard_size);
+    for (int j = 0; j < num_data_shards_; ++j) {
+      MulAdd(ParityCoefficient(i, j), data_shards[j], parity_shards[i],
+             shard_size);
+    }
+  }
+}
+
+bool ReedSolomonCode::Decode(rtc::ArrayView<const uint8_t* const> shards,
+                             rtc::ArrayView<uint8_t* const> recovered_shards,
+                             size_t shard_size) const {
+  RTC_DCHECK_EQ(shards.size(), num_data_shards_ + num_parity_shards_);
+  RTC_DCHECK_EQ(recovered_shards.size(), num_data_shards_);
+  std::vector<int> lost;
+  for (int j = 0; j < num_data_shards_; ++j) {
+    if (shards[j] == nullptr) {
+      lost.push_back(j);
+    }
+  }
+  if (lost.empty()) {
+    return true;
+  }
+  const int num_lost = lost.size();
+  std::vector<int> parity;
+  for (int i = 0; i < num_parity_shards_ && parity.size() < lost.size(); ++i) {
+    if (shards[num_data_shards_ + i] != nullptr) {
+      parity.push_back(i);
+    }
+  }
+  if (parity.size() < lost.size()) {
+    return false;
+  }
+
+  // Parity shard i is the sum of C[i][j] * d_j over all data shards. Moving
+  // the present data shards to the other side leaves a square system in the
+  // lost ones, C' * d_lost = s, where s_i is parity shard i minus the present
+  // data shards' share.
+  std::vector<uint8_t> syndromes(num_lost * shard_size);
+  std::vector<uint8_t> matrix(num_lost * num_lost);
+  for (int r = 0; r < num_lost; ++r) {
+    uint8_t* syndrome = &syndromes[r * shard_size];
+    memcpy(syndrome, shards[num_data_shards_ + parity[r]], shard_size);
+    for (int j = 0; j < num_data_shards_; ++j) {
+      if (shards[j] != nullptr) {
+        MulAdd(ParityCoefficient(parity[r], j), shards[j], syndrome,
+               shard_size);
+      }
+    }
+    for (int c = 0; c < num_lost; ++c) {
+      matrix[r * num_lost + c] = ParityCoefficient(parity[r], lost[c]);
+    }
+  }
+
+  const std::vector<uint8_t> inverse = Invert(std::move(matrix), num_lost);
+  for (int r = 0; r < num_lost; ++r) {
+    uint8_t* recovered = recovered_shards[lost[r]];
+    RTC_DCHECK(recovered);
+    memset(recovered, 0, shard_size);
+    for (int c = 0; c < num_lost; ++c) {
+      MulAdd(inverse[r * num_lost + c], &syndromes[c * shard_size], recovered,
+             shard_size);
+    }
+  }
+  return true;
+}
+
+}  // namespace webrtc
@@ -0,0 +1,68 @@
+/*
+ *  Copyright 2025 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef MODULES_RTP_RTCP_SOURCE_REED_SOLOMON_CODE_H_
+#define MODULES_RTP_RTCP_SOURCE_REED_SOLOMON_CODE_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <vector>
+
+#include "api/array_view.h"
+
+namespace webrtc {
+
+// Systematic Reed-Solomon erasure code over GF(2^8). k equally sized data
+// shards are protected by m parity shards, and any k of the k + m shards
+// recover all data shards, whatever the loss pattern. The parity shards are
+// computed with a Cauchy matrix. Every square submatrix of a Cauchy matrix is
+// invertible, which is what makes the code maximum distance separable for all
+// k + m <= 256.
+class ReedSolomonCode {
+ public:
+  static constexpr int kMaxShards = 256;
+
+  ReedSolomonCode(int num_data_shards, int num_parity_shards);
+  ~ReedSolomonCode();
+
+  int num_data_shards() const { return num_data_shards_; }
+  int num_parity_shards() const { return num_parity_shards_; }
+
+  // Computes the m `parity_shards` from the k `data_shards`. All shards are
+  // `shard_size` bytes.
+  void Encode(rtc::ArrayView<const uint8_t* const> data_shards,
+              rtc::ArrayView<uint8_t* const> parity_shards,
+              size_t shard_size) const;
+
+  // `shards` holds the k data shards followed by the m parity shards, with
+  // nullptr for the lost ones. Writes every lost data shard i to
+  // `recovered_shards[i]`, which must point to `shard_size` bytes; the other
+  // entries of `recovered_shards` are not used. All lost data shards are
+  // recovered together, with one matrix inversion. Returns false, and recovers
+  // nothing, if fewer than k shards are present.
+  bool Decode(rtc::ArrayView<const uint8_t* const> shards,
+              rtc::ArrayView<uint8_t* const> recovered_shards,
+              size_t shard_size) const;
+
+ private:
+  uint8_t ParityCoefficient(int parity_index, int data_index) const {
+    return cauchy_[parity_index * num_data_shards_ + data_index];
+  }
+
+  const int num_data_shards_;
+  const int num_parity_shards_;
+  // m x k matrix of the parity shard coefficients, row by row.
+  std::vector<uint8_t> cauchy_;
+};
+
+}  // namespace webrtc
+
+#endif  // MODULES_RTP_RTCP_SOURCE_REED_SOLOMON_CODE_H_
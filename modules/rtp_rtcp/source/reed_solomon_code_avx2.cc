@@ -0,0 +1,43 @@
+/*
+ *  Copyright 2025 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "modules/rtp_rtcp/source/reed_solomon_code_avx2.h"
+
+#include <immintrin.h>
+
+namespace webrtc {
+
+size_t ReedSolomonMulAddAvx2(const uint8_t* low_products,
+                             const uint8_t* high_products,
+                             const uint8_t* src,
+                             uint8_t* dst,
+                             size_t size) {
+  const __m256i low_table = _mm256_broadcastsi128_si256(
+      _mm_loadu_si128(reinterpret_cast<const __m128i*>(low_products)));
+  const __m256i high_table = _mm256_broadcastsi128_si256(
+      _mm_loadu_si128(reinterpret_cast<const __m128i*>(high_products)));
+  const __m256i low_mask = _mm256_set1_epi8(0x0f);
+  size_t i = 0;
+  for (; i + 32 <= size; i += 32) {
+    const __m256i x =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+    const __m256i low = _mm256_and_si256(x, low_mask);
+    const __m256i high = _mm256_and_si256(_mm256_srli_epi64(x, 4), low_mask);
+    const __m256i product =
+        _mm256_xor_si256(_mm256_shuffle_epi8(low_table, low),
+                         _mm256_shuffle_epi8(high_table, high));
+    __m256i* out = reinterpret_cast<__m256i*>(dst + i);
+    _mm256_storeu_si256(out,
+                        _mm256_xor_si256(_mm256_loadu_si256(out), product));
+  }
+  return i;
+}
+
+}  // namespace webrtc
@@ -0,0 +1,31 @@
+/*
+ *  Copyright 2025 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef MODULES_RTP_RTCP_SOURCE_REED_SOLOMON_CODE_AVX2_H_
+#define MODULES_RTP_RTCP_SOURCE_REED_SOLOMON_CODE_AVX2_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace webrtc {
+
+// Computes dst[i] ^= c * src[i] in GF(2^8) for the first `size` rounded down to
+// a multiple of 32 bytes, and returns that number of bytes. The products of c
+// with all low and high nibbles are given by `low_products` and
+// `high_products`, 16 bytes each. Needs AVX2.
+size_t ReedSolomonMulAddAvx2(const uint8_t* low_products,
+                             const uint8_t* high_products,
+                             const uint8_t* src,
+                             uint8_t* dst,
+                             size_t size);
+
+}  // namespace webrtc
+
+#endif  // MODULES_RTP_RTCP_SOURCE_REED_SOLOMON_CODE_AVX2_H_
@@ -0,0 +1,137 @@
+/*
+ *  Copyright 2025 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "modules/rtp_rtcp/source/reed_solomon_code.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "rtc_base/random.h"
+#include "test/gtest.h"
+
+namespace webrtc {
+namespace {
+
+// Not a multiple of any SIMD width, so that the scalar tails are covered.
+constexpr size_t kShardSize = 1187;
+
+class ReedSolomonCodeTest : public ::testing::Test {
+ protected:
+  ReedSolomonCodeTest() : random_(0xfec) {}
+
+  void Encode(int num_data_shards, int num_parity_shards) {
+    code_ = std::make_unique<ReedSolomonCode>(num_data_shards,
+                                              num_parity_shards);
+    shards_.assign(num_data_shards + num_parity_shards,
+                   std::vector<uint8_t>(kShardSize));
+    for (int j = 0; j < num_data_shards; ++j) {
+      for (uint8_t& byte : shards_[j]) {
+        byte = random_.Rand<uint8_t>();
+      }
+    }
+    std::vector<const uint8_t*> data_shards;
+    std::vector<uint8_t*> parity_shards;
+    for (int i = 0; i < num_data_shards + num_parity_shards; ++i) {
+      if (i < num_data_shards) {
+        data_shards.push_back(shards_[i].data());
+      } else {
+        parity_shards.push_back(shards_[i].data());
+      }
+    }
+    code_->Encode(data_shards, parity_shards, kShardSize);
+  }
+
+  // Decodes with the shards in `lost` missing, and checks that the lost data
+  // shards are recovered exactly.
+  bool DecodeAndCompare(const std::vector<int>& lost) {
+    const int num_data_shards = code_->num_data_shards();
+    std::vector<const uint8_t*> shards;
+    for (const std::vector<uint8_t>& shard : shards_) {
+      shards.push_back(shard.data());
+    }
+    std::vector<std::vector<uint8_t>> recovered(
+        num_data_shards, std::vector<uint8_t>(kShardSize));
+    std::vector<uint8_t*> recovered_shards;
+    for (std::vector<uint8_t>& shard : recovered) {
+      recovered_shards.push_back(shard.data());
+    }
+    for (int i : lost) {
+      shards[i] = nullptr;
+    }
+    if (!code_->Decode(shards, recovered_shards, kShardSize)) {
+      return false;
+    }
+    for (int i : lost) {
+      if (i < num_data_shards) {
+        EXPECT_EQ(recovered[i], shards_[i]) << "Data shard " << i;
+      }
+    }
+    return true;
+  }
+
+  Random random_;
+  std::unique_ptr<ReedSolomonCode> code_;
+  std::vector<std::vector<uint8_t>> shards_;
+};
+
+TEST_F(ReedSolomonCodeTest, NothingToRecoverWithoutLoss) {
+  Encode(/*num_data_shards=*/8, /*num_parity_shards=*/2);
+  EXPECT_TRUE(DecodeAndCompare({}));
+  EXPECT_TRUE(DecodeAndCompare({8, 9}));
+}
+
+TEST_F(ReedSolomonCodeTest, RecoversEveryLossPatternOfUpToMShards) {
+  constexpr int kNumDataShards = 10;
+  constexpr int kNumParityShards = 4;
+  constexpr int kNumShards = kNumDataShards + kNumParityShards;
+  Encode(kNumDataShards, kNumParityShards);
+  for (int mask = 0; mask < (1 << kNumShards); ++mask) {
+    std::vector<int> lost;
+    for (int i = 0; i < kNumShards; ++i) {
+      if (mask & (1 << i)) {
+        lost.push_back(i);
+      }
+    }
+    if (lost.size() <= kNumParityShards) {
+      EXPECT_TRUE(DecodeAndCompare(lost)) << "Loss mask " << mask;
+    }
+  }
+}
+
+TEST_F(ReedSolomonCodeTest, FailsWithFewerThanKShards) {
+  Encode(/*num_data_shards=*/6, /*num_parity_shards=*/3);
+  EXPECT_FALSE(DecodeAndCompare({0, 1, 2, 3}));
+  EXPECT_FALSE(DecodeAndCompare({0, 1, 6, 7}));
+}
+
+TEST_F(ReedSolomonCodeTest, RecoversLargestBlock) {
+  constexpr int kNumDataShards = 200;
+  constexpr int kNumParityShards = ReedSolomonCode::kMaxShards - 200;
+  Encode(kNumDataShards, kNumParityShards);
+  std::vector<int> shard_indices(kNumDataShards + kNumParityShards);
+  for (size_t i = 0; i < shard_indices.size(); ++i) {
+    shard_indices[i] = i;
+  }
+  for (int round = 0; round < 3; ++round) {
+    // Random loss of as many shards as there are parity shards.
+    for (size_t i = shard_indices.size() - 1; i > 0; --i) {
+      const uint32_t j = random_.Rand(0u, static_cast<uint32_t>(i));
+      std::swap(shard_indices[i], shard_indices[j]);
+    }
+    std::vector<int> lost(shard_indices.begin(),
+                          shard_indices.begin() + kNumParityShards);
+    EXPECT_TRUE(DecodeAndCompare(lost));
+  }
+}
+
+}  // namespace
+}  // namespace webrtc
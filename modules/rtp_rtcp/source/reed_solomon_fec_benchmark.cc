@@ -0,0 +1,183 @@
+/*
+ *  Copyright 2025 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "api/environment/environment.h"
+#include "api/environment/environment_factory.h"
+#include "api/rtp_parameters.h"
+#include "benchmark/benchmark.h"
+#include "modules/include/module_fec_types.h"
+#include "modules/rtp_rtcp/include/flexfec_receiver.h"
+#include "modules/rtp_rtcp/include/flexfec_sender.h"
+#include "modules/rtp_rtcp/include/recovered_packet_receiver.h"
+#include "modules/rtp_rtcp/source/reed_solomon_fec_receiver.h"
+#include "modules/rtp_rtcp/source/reed_solomon_fec_sender.h"
+#include "modules/rtp_rtcp/source/rtp_packet_received.h"
+#include "modules/rtp_rtcp/source/rtp_packet_to_send.h"
+#include "rtc_base/checks.h"
+#include "rtc_base/random.h"
+#include "system_wrappers/include/clock.h"
+
+namespace webrtc {
+namespace {
+
+constexpr int kFecPayloadType = 123;
+constexpr int kMediaPayloadType = 96;
+constexpr uint32_t kMediaSsrc = 1234;
+constexpr uint32_t kFecSsrc = 5678;
+constexpr size_t kMediaPayloadSize = 1100;
+constexpr double kLossRate = 0.05;
+// All schemes see the same loss trace of this many frames.
+constexpr int kNumFrames = 10000;
+
+class RecoveredPacketCounter : public RecoveredPacketReceiver {
+ public:
+  void OnRecoveredPacket(const RtpPacketReceived& packet) override {
+    ++num_recovered_packets;
+  }
+
+  int64_t num_recovered_packets = 0;
+};
+
+// Gilbert-Elliott channel: packets are lost in bursts of on average
+// `mean_burst_length` packets, at an average rate of `kLossRate`.
+class BurstyLossChannel {
+ public:
+  explicit BurstyLossChannel(double mean_burst_length)
+      : random_(0x10551055),
+        loss_to_received_(1.0 / mean_burst_length),
+        received_to_loss_(kLossRate * loss_to_received_ / (1.0 - kLossRate)) {}
+
+  bool Lost() {
+    lost_ = random_.Rand<double>() <
+            (lost_ ? 1.0 - loss_to_received_ : received_to_loss_);
+    return lost_;
+  }
+
+ private:
+  Random random_;
+  const double loss_to_received_;
+  const double received_to_loss_;
+  bool lost_ = false;
+};
+
+// Sends one frame of state.range(0) media packets per iteration through a FEC
+// sender and a lossy channel with a mean burst length of state.range(1)
+// packets, at a FEC rate of state.range(2) / 256 and with FlexFEC packet masks
+// of type state.range(3), and counts the media packets the FEC receiver
+// recovers.
+template <typename Sender, typename Receiver>
+void BM_FecLossTrace(benchmark::State& state) {
+  SimulatedClock clock(1);
+  const Environment env = CreateEnvironment(&clock);
+  Sender sender(env, kFecPayloadType, kFecSsrc, kMediaSsrc, /*mid=*/"",
+                /*rtp_header_extensions=*/{}, /*extension_sizes=*/{},
+                /*rtp_state=*/nullptr);
+  RecoveredPacketCounter recovered_packet_counter;
+  Receiver receiver(&clock, kFecSsrc, kMediaSsrc, &recovered_packet_counter);
+  const int packets_per_frame = state.range(0);
+  BurstyLossChannel channel(state.range(1));
+  FecProtectionParams params;
+  params.fec_rate = state.range(2);
+  params.max_fec_frames = 1;
+  params.fec_mask_type = static_cast<FecMaskType>(state.range(3));
+  sender.SetProtectionParameters(params, params);
+
+  Random random(0x1234);
+  std::vector<RtpPacketToSend> media_packets(packets_per_frame,
+                                             RtpPacketToSend(nullptr));
+  for (RtpPacketToSend& packet : media_packets) {
+    packet.SetPayloadType(kMediaPayloadType);
+    packet.SetSsrc(kMediaSsrc);
+    uint8_t* payload = packet.AllocatePayload(kMediaPayloadSize);
+    for (size_t i = 0; i < kMediaPayloadSize; ++i) {
+      payload[i] = random.Rand<uint8_t>();
+    }
+  }
+  uint16_t seq_num = 0;
+  uint32_t timestamp = 0;
+  int64_t num_media_packets = 0;
+  int64_t num_lost_media_packets = 0;
+  int64_t media_bytes = 0;
+  int64_t fec_bytes = 0;
+
+  for (auto _ : state) {
+    timestamp += 3000;
+    for (int i = 0; i < packets_per_frame; ++i) {
+      RtpPacketToSend& packet = media_packets[i];
+      packet.SetSequenceNumber(seq_num++);
+      packet.SetTimestamp(timestamp);
+      packet.SetMarker(i == packets_per_frame - 1);
+      sender.AddPacketAndGenerateFec(packet);
+      media_bytes += packet.size();
+    }
+    std::vector<std::unique_ptr<RtpPacketToSend>> fec_packets =
+        sender.GetFecPackets();
+
+    for (const RtpPacketToSend& packet : media_packets) {
+      ++num_media_packets;
+      if (channel.Lost()) {
+        ++num_lost_media_packets;
+        continue;
+      }
+      RtpPacketReceived received;
+      RTC_CHECK(received.Parse(packet.Buffer()));
+      receiver.OnRtpPacket(received);
+    }
+    for (const auto& packet : fec_packets) {
+      fec_bytes += packet->size();
+      if (channel.Lost()) {
+        continue;
+      }
+      RtpPacketReceived received;
+      RTC_CHECK(received.Parse(packet->Buffer()));
+      receiver.OnRtpPacket(received);
+    }
+  }
+
+  const int64_t num_recovered_packets =
+      recovered_packet_counter.num_recovered_packets;
+  state.counters["loss"] =
+      static_cast<double>(num_lost_media_packets) / num_media_packets;
+  state.counters["residual_loss"] =
+      static_cast<double>(num_lost_media_packets - num_recovered_packets) /
+      num_media_packets;
+  state.counters["overhead"] = static_cast<double>(fec_bytes) / media_bytes;
+  state.counters["recovered_per_kB"] =
+      fec_bytes > 0 ? 1000.0 * num_recovered_packets / fec_bytes : 0.0;
+}
+
+// 10 packets are a 2.5 Mbps delta frame, 40 a key frame. FlexFEC protects at
+// most 48 packets per block.
+BENCHMARK_TEMPLATE(BM_FecLossTrace, FlexfecSender, FlexfecReceiver)
+    ->ArgsProduct(
+        {{10, 40}, {1, 4}, {51, 85}, {kFecMaskRandom, kFecMaskBursty}})
+    ->Iterations(kNumFrames);
+BENCHMARK_TEMPLATE(BM_FecLossTrace,
+                   ReedSolomonFecSender,
+                   ReedSolomonFecReceiver)
+    ->ArgsProduct({{10, 40}, {1, 4}, {51, 85}, {kFecMaskRandom}})
+    ->Iterations(kNumFrames);
+
+}  // namespace
+}  // namespace webrtc
+
+/*
+
+BM_FecLossTrace takes the packets per frame, the mean loss burst length, the FEC
+rate and the FlexFEC packet mask type, and reports the residual loss and the
+recovered packets per kB of FEC. Run with:
+
+  out/Default/benchmarks --benchmark_filter=FecLossTrace
+*/
@@ -0,0 +1,274 @@
+/*
+ *  Copyright 2025 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "modules/rtp_rtcp/source/reed_solomon_fec_receiver.h"
+
+#include <string.h>
+
+#include <algorithm>
+#include <limits>
+
+#include "api/units/timestamp.h"
+#include "modules/rtp_rtcp/include/rtp_rtcp_defines.h"
+#include "modules/rtp_rtcp/source/byte_io.h"
+#include "modules/rtp_rtcp/source/reed_solomon_code.h"
+#include "modules/rtp_rtcp/source/reed_solomon_fec_sender.h"
+#include "rtc_base/checks.h"
+#include "rtc_base/logging.h"
+#include "system_wrappers/include/clock.h"
+
+namespace webrtc {
+
+namespace {
+
+// Size of the length field in front of every media packet in its shard.
+constexpr size_t kShardLengthSize = 2;
+
+// Media packets and blocks this much older than the newest media packet or
+// block are forgotten. FEC packets of blocks this much newer than the newest
+// media packet are discarded.
+constexpr int64_t kMaxPacketAge = 4 * kReedSolomonFecMaxMediaPackets;
+
+// Like ForwardErrorCorrection bounds the received FEC packets it keeps, at most
+// this many blocks wait for their media and parity packets. The oldest block
+// is forgotten first.
+constexpr size_t kMaxBlocks = 64;
+
+}  // namespace
+
+ReedSolomonFecReceiver::ReedSolomonFecReceiver(
+    Clock* clock,
+    uint32_t ssrc,
+    uint32_t protected_media_ssrc,
+    RecoveredPacketReceiver* recovered_packet_receiver)
+    : ssrc_(ssrc),
+      protected_media_ssrc_(protected_media_ssrc),
+      recovered_packet_receiver_(recovered_packet_receiver),
+      clock_(clock) {
+  // It's OK to create this object on a different thread/task queue than
+  // the one used during main operation.
+  sequence_checker_.Detach();
+}
+
+ReedSolomonFecReceiver::~ReedSolomonFecReceiver() = default;
+
+void ReedSolomonFecReceiver::OnRtpPacket(const RtpPacketReceived& packet) {
+  RTC_DCHECK_RUN_ON(&sequence_checker_);
+  // Packets recovered here are looped back by the callback.
+  if (packet.recovered()) {
+    return;
+  }
+  if (packet.Ssrc() == ssrc_) {
+    AddFecPacket(packet);
+    return;
+  }
+  if (packet.Ssrc() != protected_media_ssrc_) {
+    return;
+  }
+  if (packet_counter_.first_packet_time == Timestamp::MinusInfinity()) {
+    packet_counter_.first_packet_time = clock_->CurrentTime();
+  }
+  ++packet_counter_.num_packets;
+  packet_counter_.num_bytes += packet.size();
+
+  extensions_ = packet.extension_manager();
+  const int64_t seq_num = seq_num_unwrapper_.Unwrap(packet.SequenceNumber());
+  RtpPacketReceived packet_copy(packet);
+  packet_copy.ZeroMutableExtensions();
+  if (!media_packets_.emplace(seq_num, packet_copy.Buffer()).second) {
+    return;
+  }
+  DiscardOldPackets();
+
+  // Blocks do not overlap, so only the last one starting at or before the
+  // packet may protect it.
+  auto block = blocks_.upper_bound(seq_num);
+  if (block == blocks_.begin()) {
+    return;
+  }
+  --block;
+  if (seq_num < block->first + block->second.num_media_packets) {
+    MaybeRecover(block->first);
+  }
+}
+
+FecPacketCounter ReedSolomonFecReceiver::GetPacketCounter() const {
+  RTC_DCHECK_RUN_ON(&sequence_checker_);
+  return packet_counter_;
+}
+
+void ReedSolomonFecReceiver::AddFecPacket(const RtpPacketReceived& packet) {
+  RTC_DCHECK_RUN_ON(&sequence_checker_);
+  rtc::ArrayView<const uint8_t> payload = packet.payload();
+  if (payload.size() < kReedSolomonFecHeaderSize + kShardLengthSize) {
+    RTC_LOG(LS_WARNING) << "Truncated Reed-Solomon FEC packet, discarding.";
+    return;
+  }
+  if (packet_counter_.first_packet_time == Timestamp::MinusInfinity()) {
+    packet_counter_.first_packet_time = clock_->CurrentTime();
+  }
+  ++packet_counter_.num_packets;
+  packet_counter_.num_bytes += packet.size();
+  ++packet_counter_.num_fec_packets;
+
+  const uint16_t base_seq_num =
+      ByteReader<uint16_t>::ReadBigEndian(&payload[0]);
+  const int num_media_packets = payload[2];
+  const int num_parity_packets = payload[3];
+  const int parity_index = payload[4];
+  const size_t shard_size = payload.size() - kReedSolomonFecHeaderSize;
+  if (num_media_packets == 0 || parity_index >= num_parity_packets ||
+      num_media_packets > static_cast<int>(kReedSolomonFecMaxMediaPackets) ||
+      num_media_packets + num_parity_packets > ReedSolomonCode::kMaxShards) {
+    RTC_LOG(LS_WARNING) << "Malformed Reed-Solomon FEC packet, discarding.";
+    return;
+  }
+
+  // Only media packets move the unwrapper, so that a corrupt base cannot
+  // shift the sequence numbers of the media packets.
+  const int64_t unwrapped_base_seq_num =
+      seq_num_unwrapper_.PeekUnwrap(base_seq_num);
+  if (!media_packets_.empty()) {
+    const int64_t newest_seq_num = media_packets_.rbegin()->first;
+    if (unwrapped_base_seq_num < newest_seq_num - kMaxPacketAge ||
+        unwrapped_base_seq_num > newest_seq_num + kMaxPacketAge) {
+      return;
+    }
+  }
+  auto [block, inserted] = blocks_.try_emplace(unwrapped_base_seq_num);
+  if (inserted) {
+    block->second.num_media_packets = num_media_packets;
+    block->second.shard_size = shard_size;
+    block->second.parity_shards.resize(num_parity_packets);
+    DiscardOldPackets();
+    if (blocks_.size() > kMaxBlocks) {
+      blocks_.erase(blocks_.begin());
+    }
+    RTC_DCHECK_LE(blocks_.size(), kMaxBlocks);
+    block = blocks_.find(unwrapped_base_seq_num);
+    if (block == blocks_.end()) {
+      return;
+    }
+  } else if (block->second.num_media_packets != num_media_packets ||
+             block->second.parity_shards.size() !=
+                 static_cast<size_t>(num_parity_packets) ||
+             block->second.shard_size != shard_size) {
+    RTC_LOG(LS_WARNING) << "Reed-Solomon FEC packet does not match its block, "
+                           "discarding.";
+    return;
+  }
+  rtc::CopyOnWriteBuffer& parity_shard =
+      block->second.parity_shards[parity_index];
+  if (!parity_shard.empty()) {
+    return;
+  }
+  parity_shard = packet.Buffer().Slice(
+      packet.headers_size() + kReedSolomonFecHeaderSize, shard_size);
+  ++block->second.num_parity_packets_received;
+  MaybeRecover(unwrapped_base_seq_num);
+}
+
+void ReedSolomonFecReceiver::MaybeRecover(int64_t base_seq_num) {
+  RTC_DCHECK_RUN_ON(&sequence_checker_);
+  auto block_it = blocks_.find(base_seq_num);
+  RTC_DCHECK(block_it != blocks_.end());
+  const Block& block = block_it->second;
+  const int num_media_packets = block.num_media_packets;
+  const int num_parity_packets = block.parity_shards.size();
+  const size_t shard_size = block.shard_size;
+
+  int num_present = 0;
+  for (int j = 0; j < num_media_packets; ++j) {
+    num_present += media_packets_.count(base_seq_num + j);
+  }
+  if (num_present == num_media_packets) {
+    blocks_.erase(block_it);
+    return;
+  }
+  if (num_present + block.num_parity_packets_received < num_media_packets) {
+    return;
+  }
+
+  std::vector<uint8_t> data(num_media_packets * shard_size, 0);
+  std::vector<const uint8_t*> shards(num_media_packets + num_parity_packets,
+                                     nullptr);
+  std::vector<uint8_t*> recovered_shards(num_media_packets, nullptr);
+  for (int j = 0; j < num_media_packets; ++j) {
+    uint8_t* shard = &data[j * shard_size];
+    auto media_packet = media_packets_.find(base_seq_num + j);
+    if (media_packet == media_packets_.end()) {
+      recovered_shards[j] = shard;
+      continue;
+    }
+    const size_t length = media_packet->second.size();
+    if (kShardLengthSize + length > shard_size) {
+      RTC_LOG(LS_WARNING) << "Media packet does not fit its Reed-Solomon FEC "
+                             "block, discarding the block.";
+      blocks_.erase(block_it);
+      return;
+    }
+    ByteWriter<uint16_t>::WriteBigEndian(shard, length);
+    memcpy(shard + kShardLengthSize, media_packet->second.cdata(), length);
+    shards[j] = shard;
+  }
+  for (int i = 0; i < num_parity_packets; ++i) {
+    if (!block.parity_shards[i].empty()) {
+      shards[num_media_packets + i] = block.parity_shards[i].cdata();
+    }
+  }
+  RTC_CHECK(ReedSolomonCode(num_media_packets, num_parity_packets)
+                .Decode(shards, recovered_shards, shard_size));
+  blocks_.erase(block_it);
+
+  for (int j = 0; j < num_media_packets; ++j) {
+    if (recovered_shards[j] == nullptr) {
+      continue;
+    }
+    const size_t length =
+        ByteReader<uint16_t>::ReadBigEndian(recovered_shards[j]);
+    RtpPacketReceived recovered_packet(&extensions_);
+    if (kShardLengthSize + length > shard_size ||
+        !recovered_packet.Parse(recovered_shards[j] + kShardLengthSize,
+                                length) ||
+        recovered_packet.Ssrc() != protected_media_ssrc_ ||
+        recovered_packet.SequenceNumber() !=
+            static_cast<uint16_t>(base_seq_num + j)) {
+      RTC_LOG(LS_WARNING) << "Corrupt Reed-Solomon FEC block, discarding the "
+                             "recovered packet.";
+      continue;
+    }
+    recovered_packet.set_recovered(true);
+    // Only video is protected.
+    recovered_packet.set_payload_type_frequency(kVideoPayloadTypeFrequency);
+    media_packets_.emplace(base_seq_num + j, recovered_packet.Buffer());
+    ++packet_counter_.num_recovered_packets;
+    recovered_packet_receiver_->OnRecoveredPacket(recovered_packet);
+  }
+}
+
+void ReedSolomonFecReceiver::DiscardOldPackets() {
+  RTC_DCHECK_RUN_ON(&sequence_checker_);
+  int64_t newest_seq_num = std::numeric_limits<int64_t>::min();
+  if (!media_packets_.empty()) {
+    newest_seq_num = media_packets_.rbegin()->first;
+  }
+  if (!blocks_.empty()) {
+    newest_seq_num = std::max(newest_seq_num, blocks_.rbegin()->first);
+  }
+  if (newest_seq_num == std::numeric_limits<int64_t>::min()) {
+    return;
+  }
+  const int64_t oldest_seq_num = newest_seq_num - kMaxPacketAge;
+  media_packets_.erase(media_packets_.begin(),
+                       media_packets_.lower_bound(oldest_seq_num));
+  blocks_.erase(blocks_.begin(), blocks_.lower_bound(oldest_seq_num));
+}
+
+}  // namespace webrtc
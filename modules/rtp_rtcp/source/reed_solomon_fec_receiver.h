@@ -0,0 +1,92 @@
+/*
+ *  Copyright 2025 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef MODULES_RTP_RTCP_SOURCE_REED_SOLOMON_FEC_RECEIVER_H_
+#define MODULES_RTP_RTCP_SOURCE_REED_SOLOMON_FEC_RECEIVER_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <map>
+#include <vector>
+
+#include "api/sequence_checker.h"
+#include "modules/rtp_rtcp/include/recovered_packet_receiver.h"
+#include "modules/rtp_rtcp/include/rtp_header_extension_map.h"
+#include "modules/rtp_rtcp/source/rtp_packet_received.h"
+#include "modules/rtp_rtcp/source/ulpfec_receiver.h"
+#include "rtc_base/copy_on_write_buffer.h"
+#include "rtc_base/numerics/sequence_number_unwrapper.h"
+#include "rtc_base/system/no_unique_address.h"
+#include "rtc_base/thread_annotations.h"
+
+namespace webrtc {
+
+class Clock;
+
+// Recovers media packets from the packets of a ReedSolomonFecSender. Media
+// packets are kept for a while, so that a block is decoded as soon as k of its
+// media and parity packets have arrived, in whichever order. All lost media
+// packets of a block are recovered by one decode. Like FlexfecReceiver, only
+// recovered packets are returned through the callback.
+class ReedSolomonFecReceiver {
+ public:
+  ReedSolomonFecReceiver(Clock* clock,
+                         uint32_t ssrc,
+                         uint32_t protected_media_ssrc,
+                         RecoveredPacketReceiver* recovered_packet_receiver);
+  ~ReedSolomonFecReceiver();
+
+  // Inserts a received media or FEC packet, and sends all media packets it
+  // lets recover through the callback.
+  void OnRtpPacket(const RtpPacketReceived& packet);
+
+  // Returns a counter describing the added and recovered packets.
+  FecPacketCounter GetPacketCounter() const;
+
+ private:
+  struct Block {
+    int num_media_packets = 0;
+    size_t shard_size = 0;
+    int num_parity_packets_received = 0;
+    // One entry per parity packet, empty until received.
+    std::vector<rtc::CopyOnWriteBuffer> parity_shards;
+  };
+
+  void AddFecPacket(const RtpPacketReceived& packet);
+  // Decodes the block at `base_seq_num` if enough of it has arrived, and
+  // forgets it once it is decoded or all its media packets have arrived.
+  void MaybeRecover(int64_t base_seq_num);
+  // Forgets the media packets and blocks that are too old compared to the
+  // newest media packet or block.
+  void DiscardOldPackets();
+
+  const uint32_t ssrc_;
+  const uint32_t protected_media_ssrc_;
+  RecoveredPacketReceiver* const recovered_packet_receiver_;
+  Clock* const clock_;
+
+  RtpSequenceNumberUnwrapper seq_num_unwrapper_
+      RTC_GUARDED_BY(sequence_checker_);
+  // Received and recovered media packets by unwrapped sequence number, with
+  // mutable header extensions zeroed.
+  std::map<int64_t, rtc::CopyOnWriteBuffer> media_packets_
+      RTC_GUARDED_BY(sequence_checker_);
+  // Blocks with parity packets by unwrapped media sequence number base.
+  std::map<int64_t, Block> blocks_ RTC_GUARDED_BY(sequence_checker_);
+  RtpHeaderExtensionMap extensions_ RTC_GUARDED_BY(sequence_checker_);
+  FecPacketCounter packet_counter_ RTC_GUARDED_BY(sequence_checker_);
+
+  RTC_NO_UNIQUE_ADDRESS SequenceChecker sequence_checker_;
+};
+
+}  // namespace webrtc
+
+#endif  // MODULES_RTP_RTCP_SOURCE_REED_SOLOMON_FEC_RECEIVER_H_
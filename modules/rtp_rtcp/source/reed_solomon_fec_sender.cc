@@ -0,0 +1,281 @@
+/*
+ *  Copyright 2025 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "modules/rtp_rtcp/source/reed_solomon_fec_sender.h"
+
+#include <string.h>
+
+#include <algorithm>
+#include <utility>
+
+#include "api/units/time_delta.h"
+#include "api/units/timestamp.h"
+#include "modules/rtp_rtcp/source/byte_io.h"
+#include "modules/rtp_rtcp/source/reed_solomon_code.h"
+#include "modules/rtp_rtcp/source/rtp_header_extensions.h"
+#include "rtc_base/checks.h"
+#include "rtc_base/logging.h"
+
+namespace webrtc {
+
+namespace {
+
+// Let first sequence number be in the first half of the interval.
+constexpr uint16_t kMaxInitRtpSeqNumber = 0x7fff;
+
+// Same as for FlexFEC, see flexfec_sender.cc.
+constexpr int kMsToRtpTimestamp = kVideoPayloadTypeFrequency / 1000;
+
+// Size of the length field in front of every media packet in its shard.
+constexpr size_t kShardLengthSize = 2;
+
+// As in UlpfecGenerator, FEC is generated as soon as the actual overhead is
+// less than this much above the requested one. Q8.
+constexpr int kMaxExcessOverhead = 50;
+
+RtpHeaderExtensionMap RegisterSupportedExtensions(
+    const std::vector<RtpExtension>& rtp_header_extensions) {
+  RtpHeaderExtensionMap map;
+  for (const auto& extension : rtp_header_extensions) {
+    if (extension.uri == TransportSequenceNumber::Uri()) {
+      map.Register<TransportSequenceNumber>(extension.id);
+    } else if (extension.uri == AbsoluteSendTime::Uri()) {
+      map.Register<AbsoluteSendTime>(extension.id);
+    } else if (extension.uri == TransmissionOffset::Uri()) {
+      map.Register<TransmissionOffset>(extension.id);
+    } else if (extension.uri == RtpMid::Uri()) {
+      map.Register<RtpMid>(extension.id);
+    }
+  }
+  return map;
+}
+
+}  // namespace
+
+ReedSolomonFecSender::ReedSolomonFecSender(
+    const Environment& env,
+    int payload_type,
+    uint32_t ssrc,
+    uint32_t protected_media_ssrc,
+    absl::string_view mid,
+    const std::vector<RtpExtension>& rtp_header_extensions,
+    rtc::ArrayView<const RtpExtensionSize> extension_sizes,
+    const RtpState* rtp_state)
+    : env_(env),
+      random_(env_.clock().TimeInMicroseconds()),
+      payload_type_(payload_type),
+      timestamp_offset_(rtp_state ? rtp_state->start_timestamp
+                                  : random_.Rand<uint32_t>()),
+      ssrc_(ssrc),
+      protected_media_ssrc_(protected_media_ssrc),
+      mid_(mid),
+      rtp_header_extension_map_(
+          RegisterSupportedExtensions(rtp_header_extensions)),
+      header_extensions_size_(
+          RtpHeaderExtensionSize(extension_sizes, rtp_header_extension_map_)),
+      seq_num_(rtp_state ? rtp_state->sequence_number
+                         : random_.Rand(1, kMaxInitRtpSeqNumber)),
+      fec_bitrate_(/*max_window_size=*/TimeDelta::Seconds(1)) {
+  RTC_DCHECK_GE(payload_type, 0);
+  RTC_DCHECK_LE(payload_type, 127);
+}
+
+ReedSolomonFecSender::~ReedSolomonFecSender() = default;
+
+int ReedSolomonFecSender::NumFecPackets(int num_media_packets, int fec_rate) {
+  // Rounded like ForwardErrorCorrection::NumFecPackets(), so that the rate
+  // machinery sees the same overhead for all FEC schemes.
+  int num_fec_packets = (num_media_packets * fec_rate + (1 << 7)) >> 8;
+  if (fec_rate > 0 && num_fec_packets == 0) {
+    num_fec_packets = 1;
+  }
+  return std::min(num_fec_packets,
+                  ReedSolomonCode::kMaxShards - num_media_packets);
+}
+
+void ReedSolomonFecSender::SetProtectionParameters(
+    const FecProtectionParams& delta_params,
+    const FecProtectionParams& key_params) {
+  RTC_DCHECK_GE(delta_params.fec_rate, 0);
+  RTC_DCHECK_LE(delta_params.fec_rate, 255);
+  RTC_DCHECK_GE(key_params.fec_rate, 0);
+  RTC_DCHECK_LE(key_params.fec_rate, 255);
+  MutexLock lock(&mutex_);
+  pending_params_.emplace(delta_params, key_params);
+}
+
+void ReedSolomonFecSender::AddPacketAndGenerateFec(
+    const RtpPacketToSend& packet) {
+  RTC_DCHECK_RUNS_SERIALIZED(&race_checker_);
+  RTC_DCHECK_EQ(packet.Ssrc(), protected_media_ssrc_);
+  RTC_DCHECK(generated_fec_packets_.empty());
+  {
+    MutexLock lock(&mutex_);
+    if (pending_params_) {
+      delta_params_ = pending_params_->first;
+      key_params_ = pending_params_->second;
+      pending_params_.reset();
+    }
+  }
+
+  // A block protects consecutive sequence numbers only.
+  if (!media_packets_.empty() &&
+      packet.SequenceNumber() !=
+          static_cast<uint16_t>(first_media_seq_num_ + media_packets_.size())) {
+    RTC_LOG(LS_WARNING) << "Media sequence number gap, dropping "
+                        << media_packets_.size() << " unprotected packets.";
+    ResetState();
+  }
+  if (media_packets_.empty()) {
+    first_media_seq_num_ = packet.SequenceNumber();
+  }
+  media_packets_.push_back(packet.Buffer());
+  if (packet.is_key_frame()) {
+    media_contains_keyframe_ = true;
+  }
+  const bool complete_frame = packet.Marker();
+  if (complete_frame) {
+    ++num_protected_frames_;
+  }
+
+  if (CurrentParams().fec_rate == 0) {
+    if (complete_frame) {
+      ResetState();
+    }
+    return;
+  }
+  // A block that reaches the size limit is protected right away, even in the
+  // middle of a frame.
+  if (media_packets_.size() == kReedSolomonFecMaxMediaPackets ||
+      (complete_frame &&
+       (num_protected_frames_ >= CurrentParams().max_fec_frames ||
+        ExcessOverheadBelowMax()))) {
+    GenerateFec();
+  }
+}
+
+const FecProtectionParams& ReedSolomonFecSender::CurrentParams() const {
+  RTC_DCHECK_RUNS_SERIALIZED(&race_checker_);
+  return media_contains_keyframe_ ? key_params_ : delta_params_;
+}
+
+bool ReedSolomonFecSender::ExcessOverheadBelowMax() const {
+  RTC_DCHECK_RUNS_SERIALIZED(&race_checker_);
+  const int num_media_packets = media_packets_.size();
+  const int fec_rate = CurrentParams().fec_rate;
+  const int overhead =
+      (NumFecPackets(num_media_packets, fec_rate) << 8) / num_media_packets;
+  return overhead - fec_rate < kMaxExcessOverhead;
+}
+
+void ReedSolomonFecSender::GenerateFec() {
+  RTC_DCHECK_RUNS_SERIALIZED(&race_checker_);
+  const int num_media_packets = media_packets_.size();
+  const int num_fec_packets =
+      NumFecPackets(num_media_packets, CurrentParams().fec_rate);
+  size_t shard_size = 0;
+  for (const rtc::CopyOnWriteBuffer& media_packet : media_packets_) {
+    shard_size = std::max(shard_size, kShardLengthSize + media_packet.size());
+  }
+
+  std::vector<uint8_t> data(num_media_packets * shard_size, 0);
+  std::vector<const uint8_t*> data_shards(num_media_packets);
+  for (int j = 0; j < num_media_packets; ++j) {
+    uint8_t* shard = &data[j * shard_size];
+    ByteWriter<uint16_t>::WriteBigEndian(shard, media_packets_[j].size());
+    memcpy(shard + kShardLengthSize, media_packets_[j].cdata(),
+           media_packets_[j].size());
+    data_shards[j] = shard;
+  }
+
+  const Timestamp now = env_.clock().CurrentTime();
+  std::vector<uint8_t*> parity_shards(num_fec_packets);
+  for (int i = 0; i < num_fec_packets; ++i) {
+    auto fec_packet =
+        std::make_unique<RtpPacketToSend>(&rtp_header_extension_map_);
+    fec_packet->set_packet_type(RtpPacketMediaType::kForwardErrorCorrection);
+    fec_packet->set_allow_retransmission(false);
+    fec_packet->SetMarker(false);
+    fec_packet->SetPayloadType(payload_type_);
+    fec_packet->SetSequenceNumber(seq_num_++);
+    fec_packet->SetTimestamp(
+        timestamp_offset_ +
+        static_cast<uint32_t>(kMsToRtpTimestamp * now.ms()));
+    fec_packet->set_capture_time(now);
+    fec_packet->SetSsrc(ssrc_);
+    fec_packet->ReserveExtension<AbsoluteSendTime>();
+    fec_packet->ReserveExtension<TransmissionOffset>();
+    fec_packet->ReserveExtension<TransportSequenceNumber>();
+    if (!mid_.empty()) {
+      fec_packet->SetExtension<RtpMid>(mid_);
+    }
+
+    uint8_t* payload =
+        fec_packet->AllocatePayload(kReedSolomonFecHeaderSize + shard_size);
+    ByteWriter<uint16_t>::WriteBigEndian(&payload[0], first_media_seq_num_);
+    payload[2] = num_media_packets;
+    payload[3] = num_fec_packets;
+    payload[4] = i;
+    payload[5] = 0;
+    parity_shards[i] = payload + kReedSolomonFecHeaderSize;
+    generated_fec_packets_.push_back(std::move(fec_packet));
+  }
+
+  ReedSolomonCode(num_media_packets, num_fec_packets)
+      .Encode(data_shards, parity_shards, shard_size);
+  ResetState();
+}
+
+std::vector<std::unique_ptr<RtpPacketToSend>>
+ReedSolomonFecSender::GetFecPackets() {
+  RTC_DCHECK_RUNS_SERIALIZED(&race_checker_);
+  size_t total_fec_size_bytes = 0;
+  for (const auto& fec_packet : generated_fec_packets_) {
+    total_fec_size_bytes += fec_packet->size();
+  }
+  std::vector<std::unique_ptr<RtpPacketToSend>> fec_packets =
+      std::move(generated_fec_packets_);
+  generated_fec_packets_.clear();
+
+  MutexLock lock(&mutex_);
+  fec_bitrate_.Update(total_fec_size_bytes, env_.clock().CurrentTime());
+  return fec_packets;
+}
+
+// The FEC packets carry whole media packets, so the overhead is a second RTP
+// header with the BWE RTP header extensions, the FEC header and the length
+// field.
+size_t ReedSolomonFecSender::MaxPacketOverhead() const {
+  return kRtpHeaderSize + header_extensions_size_ + kReedSolomonFecHeaderSize +
+         kShardLengthSize;
+}
+
+DataRate ReedSolomonFecSender::CurrentFecRate() const {
+  MutexLock lock(&mutex_);
+  return fec_bitrate_.Rate(env_.clock().CurrentTime())
+      .value_or(DataRate::Zero());
+}
+
+std::optional<RtpState> ReedSolomonFecSender::GetRtpState() {
+  RTC_DCHECK_RUNS_SERIALIZED(&race_checker_);
+  RtpState rtp_state;
+  rtp_state.sequence_number = seq_num_;
+  rtp_state.start_timestamp = timestamp_offset_;
+  return rtp_state;
+}
+
+void ReedSolomonFecSender::ResetState() {
+  RTC_DCHECK_RUNS_SERIALIZED(&race_checker_);
+  media_packets_.clear();
+  num_protected_frames_ = 0;
+  media_contains_keyframe_ = false;
+}
+
+}  // namespace webrtc
@@ -0,0 +1,132 @@
+/*
+ *  Copyright 2025 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef MODULES_RTP_RTCP_SOURCE_REED_SOLOMON_FEC_SENDER_H_
+#define MODULES_RTP_RTCP_SOURCE_REED_SOLOMON_FEC_SENDER_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "absl/strings/string_view.h"
+#include "api/array_view.h"
+#include "api/environment/environment.h"
+#include "api/rtp_parameters.h"
+#include "api/units/data_rate.h"
+#include "modules/include/module_fec_types.h"
+#include "modules/rtp_rtcp/include/rtp_header_extension_map.h"
+#include "modules/rtp_rtcp/include/rtp_rtcp_defines.h"
+#include "modules/rtp_rtcp/source/rtp_header_extension_size.h"
+#include "modules/rtp_rtcp/source/rtp_packet_to_send.h"
+#include "modules/rtp_rtcp/source/video_fec_generator.h"
+#include "rtc_base/bitrate_tracker.h"
+#include "rtc_base/copy_on_write_buffer.h"
+#include "rtc_base/race_checker.h"
+#include "rtc_base/random.h"
+#include "rtc_base/synchronization/mutex.h"
+#include "rtc_base/thread_annotations.h"
+
+namespace webrtc {
+
+// Reed-Solomon FEC packets are sent on their own SSRC, like FlexFEC packets,
+// and protect k consecutive packets of one media SSRC with m parity packets,
+// any k of which recover the media packets. The payload of a parity packet is
+//
+//  0                   1                   2                   3
+//  0 1 2 3 4 5 6 7 8 9 0 1 2 3 4 5 6 7 8 9 0 1 2 3 4 5 6 7 8 9 0 1
+// +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+// |    Media sequence number base |       k       |       m       |
+// +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+// | Parity index  |   Reserved    |         Parity shard ...      |
+// +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+//
+// Media packet j of the k is coded as the shard of its 16 bit length followed
+// by the whole RTP packet, zero padded to the shard size of the parity shards.
+// Mutable header extensions are zeroed, as for FlexFEC.
+constexpr size_t kReedSolomonFecHeaderSize = 6;
+constexpr size_t kReedSolomonFecMaxMediaPackets = 128;
+
+// Generates Reed-Solomon FEC packets. It takes the same protection parameters
+// as FlexfecSender: `fec_rate` / 256 parity packets per media packet, over at
+// most `max_fec_frames` frames. Unlike the XOR codes, which use the rate only
+// to pick a packet mask, every m of the parity packets recover any m lost
+// media packets of the block.
+//
+// Like FlexfecSender, this class needs external synchronization, except for
+// SetProtectionParameters() and CurrentFecRate().
+class ReedSolomonFecSender : public VideoFecGenerator {
+ public:
+  ReedSolomonFecSender(const Environment& env,
+                       int payload_type,
+                       uint32_t ssrc,
+                       uint32_t protected_media_ssrc,
+                       absl::string_view mid,
+                       const std::vector<RtpExtension>& rtp_header_extensions,
+                       rtc::ArrayView<const RtpExtensionSize> extension_sizes,
+                       const RtpState* rtp_state);
+  ~ReedSolomonFecSender() override;
+
+  FecType GetFecType() const override {
+    return VideoFecGenerator::FecType::kReedSolomon;
+  }
+  std::optional<uint32_t> FecSsrc() override { return ssrc_; }
+  size_t MaxPacketOverhead() const override;
+  DataRate CurrentFecRate() const override;
+  void SetProtectionParameters(const FecProtectionParams& delta_params,
+                               const FecProtectionParams& key_params) override;
+  void AddPacketAndGenerateFec(const RtpPacketToSend& packet) override;
+  std::vector<std::unique_ptr<RtpPacketToSend>> GetFecPackets() override;
+  std::optional<RtpState> GetRtpState() override;
+
+  // Number of parity packets that protect `num_media_packets` at `fec_rate`.
+  static int NumFecPackets(int num_media_packets, int fec_rate);
+
+ private:
+  const FecProtectionParams& CurrentParams() const;
+  bool ExcessOverheadBelowMax() const;
+  void GenerateFec();
+  void ResetState();
+
+  const Environment env_;
+  Random random_;
+  const int payload_type_;
+  const uint32_t timestamp_offset_;
+  const uint32_t ssrc_;
+  const uint32_t protected_media_ssrc_;
+  const std::string mid_;
+  const RtpHeaderExtensionMap rtp_header_extension_map_;
+  const size_t header_extensions_size_;
+
+  rtc::RaceChecker race_checker_;
+  uint16_t seq_num_ RTC_GUARDED_BY(race_checker_);
+  FecProtectionParams delta_params_ RTC_GUARDED_BY(race_checker_);
+  FecProtectionParams key_params_ RTC_GUARDED_BY(race_checker_);
+  std::vector<rtc::CopyOnWriteBuffer> media_packets_
+      RTC_GUARDED_BY(race_checker_);
+  uint16_t first_media_seq_num_ RTC_GUARDED_BY(race_checker_) = 0;
+  int num_protected_frames_ RTC_GUARDED_BY(race_checker_) = 0;
+  bool media_contains_keyframe_ RTC_GUARDED_BY(race_checker_) = false;
+  std::vector<std::unique_ptr<RtpPacketToSend>> generated_fec_packets_
+      RTC_GUARDED_BY(race_checker_);
+
+  mutable Mutex mutex_;
+  std::optional<std::pair<FecProtectionParams, FecProtectionParams>>
+      pending_params_ RTC_GUARDED_BY(mutex_);
+  BitrateTracker fec_bitrate_ RTC_GUARDED_BY(mutex_);
+};
+
+}  // namespace webrtc
+
+#endif  // MODULES_RTP_RTCP_SOURCE_REED_SOLOMON_FEC_SENDER_H_
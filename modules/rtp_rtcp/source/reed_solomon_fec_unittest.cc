@@ -0,0 +1,341 @@
+/*
+ *  Copyright 2025 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <string.h>
+
+#include <memory>
+#include <vector>
+
+#include "api/environment/environment.h"
+#include "api/environment/environment_factory.h"
+#include "api/rtp_parameters.h"
+#include "modules/include/module_fec_types.h"
+#include "modules/rtp_rtcp/mocks/mock_recovered_packet_receiver.h"
+#include "modules/rtp_rtcp/source/byte_io.h"
+#include "modules/rtp_rtcp/source/fec_test_helper.h"
+#include "modules/rtp_rtcp/source/reed_solomon_fec_receiver.h"
+#include "modules/rtp_rtcp/source/reed_solomon_fec_sender.h"
+#include "modules/rtp_rtcp/source/rtp_packet_received.h"
+#include "modules/rtp_rtcp/source/rtp_packet_to_send.h"
+#include "rtc_base/copy_on_write_buffer.h"
+#include "system_wrappers/include/clock.h"
+#include "test/gmock.h"
+#include "test/gtest.h"
+
+namespace webrtc {
+
+namespace {
+
+using test::fec::AugmentedPacket;
+using test::fec::AugmentedPacketGenerator;
+using ::testing::_;
+using ::testing::Eq;
+using ::testing::Property;
+
+constexpr int kFecPayloadType = 123;
+constexpr uint32_t kMediaSsrc = 1234;
+constexpr uint32_t kFecSsrc = 5678;
+const char kNoMid[] = "";
+const std::vector<RtpExtension> kNoRtpHeaderExtensions;
+const std::vector<RtpExtensionSize> kNoRtpHeaderExtensionSizes;
+constexpr size_t kPayloadLength = 500;
+
+class ReedSolomonFecTest : public ::testing::Test {
+ protected:
+  ReedSolomonFecTest()
+      : clock_(1),
+        env_(CreateEnvironment(&clock_)),
+        sender_(env_,
+                kFecPayloadType,
+                kFecSsrc,
+                kMediaSsrc,
+                kNoMid,
+                kNoRtpHeaderExtensions,
+                kNoRtpHeaderExtensionSizes,
+                /*rtp_state=*/nullptr),
+        receiver_(&clock_, kFecSsrc, kMediaSsrc, &recovered_packet_receiver_),
+        packet_generator_(kMediaSsrc) {}
+
+  void SetFecRate(int fec_rate, int max_fec_frames) {
+    FecProtectionParams params;
+    params.fec_rate = fec_rate;
+    params.max_fec_frames = max_fec_frames;
+    sender_.SetProtectionParameters(params, params);
+  }
+
+  // Sends a frame of `num_packets` media packets through the sender, and
+  // returns them.
+  std::vector<RtpPacketReceived> SendFrame(size_t num_packets) {
+    std::vector<RtpPacketReceived> media_packets;
+    packet_generator_.NewFrame(num_packets);
+    for (size_t i = 0; i < num_packets; ++i) {
+      // Vary the packet sizes, so that shards get padded.
+      std::unique_ptr<AugmentedPacket> packet =
+          packet_generator_.NextPacket(i, kPayloadLength - 7 * i);
+      RtpPacketToSend rtp_packet(nullptr);
+      EXPECT_TRUE(rtp_packet.Parse(packet->data));
+      sender_.AddPacketAndGenerateFec(rtp_packet);
+      RtpPacketReceived& received = media_packets.emplace_back();
+      EXPECT_TRUE(received.Parse(packet->data));
+    }
+    return media_packets;
+  }
+
+  std::vector<RtpPacketReceived> GetFecPackets() {
+    std::vector<RtpPacketReceived> fec_packets;
+    for (const auto& fec_packet : sender_.GetFecPackets()) {
+      RtpPacketReceived& received = fec_packets.emplace_back();
+      EXPECT_TRUE(received.Parse(fec_packet->Buffer()));
+    }
+    return fec_packets;
+  }
+
+  // Returns a parity packet with the given header fields and an arbitrary
+  // parity shard.
+  static RtpPacketReceived CreateFecPacket(uint16_t base_seq_num,
+                                           uint8_t num_media_packets,
+                                           uint8_t num_parity_packets,
+                                           uint8_t parity_index,
+                                           size_t shard_size = 100) {
+    RtpPacketReceived fec_packet;
+    fec_packet.SetPayloadType(kFecPayloadType);
+    fec_packet.SetSsrc(kFecSsrc);
+    uint8_t* payload =
+        fec_packet.AllocatePayload(kReedSolomonFecHeaderSize + shard_size);
+    memset(payload, 0x5a, kReedSolomonFecHeaderSize + shard_size);
+    ByteWriter<uint16_t>::WriteBigEndian(&payload[0], base_seq_num);
+    payload[2] = num_media_packets;
+    payload[3] = num_parity_packets;
+    payload[4] = parity_index;
+    payload[5] = 0;
+    return fec_packet;
+  }
+
+  SimulatedClock clock_;
+  const Environment env_;
+  ReedSolomonFecSender sender_;
+  MockRecoveredPacketReceiver recovered_packet_receiver_;
+  ReedSolomonFecReceiver receiver_;
+  AugmentedPacketGenerator packet_generator_;
+};
+
+}  // namespace
+
+TEST_F(ReedSolomonFecTest, NoFecWithZeroRate) {
+  SetFecRate(/*fec_rate=*/0, /*max_fec_frames=*/1);
+  SendFrame(10);
+  EXPECT_TRUE(sender_.GetFecPackets().empty());
+}
+
+TEST_F(ReedSolomonFecTest, ProtectsFrameWithRateOfFecPackets) {
+  SetFecRate(/*fec_rate=*/85, /*max_fec_frames=*/1);
+  std::vector<RtpPacketReceived> media_packets = SendFrame(12);
+  std::vector<RtpPacketReceived> fec_packets = GetFecPackets();
+  EXPECT_TRUE(sender_.GetFecPackets().empty());
+
+  // 12 * 85 / 256 rounded.
+  ASSERT_EQ(fec_packets.size(), 4u);
+  for (size_t i = 0; i < fec_packets.size(); ++i) {
+    const RtpPacketReceived& fec_packet = fec_packets[i];
+    EXPECT_EQ(fec_packet.Ssrc(), kFecSsrc);
+    EXPECT_EQ(fec_packet.PayloadType(), kFecPayloadType);
+    EXPECT_FALSE(fec_packet.Marker());
+    EXPECT_EQ(fec_packet.SequenceNumber(),
+              static_cast<uint16_t>(fec_packets[0].SequenceNumber() + i));
+    rtc::ArrayView<const uint8_t> payload = fec_packet.payload();
+    EXPECT_EQ(ByteReader<uint16_t>::ReadBigEndian(&payload[0]),
+              media_packets[0].SequenceNumber());
+    EXPECT_EQ(payload[2], 12);
+    EXPECT_EQ(payload[3], 4);
+    EXPECT_EQ(payload[4], i);
+    // The shards fit the largest media packet and its length.
+    EXPECT_EQ(payload.size(),
+              kReedSolomonFecHeaderSize + 2 + media_packets[0].size());
+  }
+  EXPECT_LE(fec_packets[0].size() - media_packets[0].size(),
+            sender_.MaxPacketOverhead());
+}
+
+TEST_F(ReedSolomonFecTest, WaitsForMaxFecFramesAtHighOverhead) {
+  // One FEC packet per one packet frame is far above the requested rate.
+  SetFecRate(/*fec_rate=*/25, /*max_fec_frames=*/3);
+  SendFrame(1);
+  EXPECT_TRUE(sender_.GetFecPackets().empty());
+  SendFrame(1);
+  EXPECT_TRUE(sender_.GetFecPackets().empty());
+  SendFrame(1);
+  std::vector<RtpPacketReceived> fec_packets = GetFecPackets();
+  ASSERT_EQ(fec_packets.size(), 1u);
+  EXPECT_EQ(fec_packets[0].payload()[2], 3);
+}
+
+TEST_F(ReedSolomonFecTest, RecoversBurstAsLongAsFecPackets) {
+  SetFecRate(/*fec_rate=*/85, /*max_fec_frames=*/1);
+  std::vector<RtpPacketReceived> media_packets = SendFrame(12);
+  std::vector<RtpPacketReceived> fec_packets = GetFecPackets();
+  ASSERT_EQ(fec_packets.size(), 4u);
+
+  // Lose packets 3 to 6.
+  for (size_t i = 0; i < media_packets.size(); ++i) {
+    if (i < 3 || i > 6) {
+      receiver_.OnRtpPacket(media_packets[i]);
+    }
+  }
+  for (size_t i = 0; i < 3; ++i) {
+    receiver_.OnRtpPacket(fec_packets[i]);
+  }
+  for (size_t i = 3; i <= 6; ++i) {
+    EXPECT_CALL(recovered_packet_receiver_,
+                OnRecoveredPacket(Property(&RtpPacketReceived::Buffer,
+                                           Eq(media_packets[i].Buffer()))));
+  }
+  receiver_.OnRtpPacket(fec_packets[3]);
+  EXPECT_EQ(receiver_.GetPacketCounter().num_recovered_packets, 4u);
+}
+
+TEST_F(ReedSolomonFecTest, RecoversWhenFecArrivesBeforeMedia) {
+  SetFecRate(/*fec_rate=*/85, /*max_fec_frames=*/1);
+  std::vector<RtpPacketReceived> media_packets = SendFrame(6);
+  std::vector<RtpPacketReceived> fec_packets = GetFecPackets();
+  ASSERT_EQ(fec_packets.size(), 2u);
+
+  // Lose the first two packets, and receive the rest after the FEC packets.
+  receiver_.OnRtpPacket(fec_packets[1]);
+  receiver_.OnRtpPacket(fec_packets[0]);
+  for (size_t i = 2; i < media_packets.size() - 1; ++i) {
+    receiver_.OnRtpPacket(media_packets[i]);
+  }
+  EXPECT_CALL(recovered_packet_receiver_,
+              OnRecoveredPacket(Property(&RtpPacketReceived::Buffer,
+                                         Eq(media_packets[0].Buffer()))));
+  EXPECT_CALL(recovered_packet_receiver_,
+              OnRecoveredPacket(Property(&RtpPacketReceived::Buffer,
+                                         Eq(media_packets[1].Buffer()))));
+  receiver_.OnRtpPacket(media_packets.back());
+}
+
+TEST_F(ReedSolomonFecTest, DoesNotRecoverFromTooFewPackets) {
+  SetFecRate(/*fec_rate=*/85, /*max_fec_frames=*/1);
+  std::vector<RtpPacketReceived> media_packets = SendFrame(12);
+  std::vector<RtpPacketReceived> fec_packets = GetFecPackets();
+  ASSERT_EQ(fec_packets.size(), 4u);
+
+  EXPECT_CALL(recovered_packet_receiver_, OnRecoveredPacket(_)).Times(0);
+  for (size_t i = 5; i < media_packets.size(); ++i) {
+    receiver_.OnRtpPacket(media_packets[i]);
+  }
+  for (const RtpPacketReceived& fec_packet : fec_packets) {
+    receiver_.OnRtpPacket(fec_packet);
+  }
+  EXPECT_EQ(receiver_.GetPacketCounter().num_fec_packets, 4u);
+}
+
+TEST_F(ReedSolomonFecTest, IgnoresRecoveredAndUnknownPackets) {
+  SetFecRate(/*fec_rate=*/255, /*max_fec_frames=*/1);
+  std::vector<RtpPacketReceived> media_packets = SendFrame(2);
+  std::vector<RtpPacketReceived> fec_packets = GetFecPackets();
+  ASSERT_EQ(fec_packets.size(), 2u);
+
+  EXPECT_CALL(recovered_packet_receiver_, OnRecoveredPacket(_)).Times(0);
+  media_packets[0].set_recovered(true);
+  receiver_.OnRtpPacket(media_packets[0]);
+  media_packets[1].SetSsrc(kMediaSsrc + 1);
+  receiver_.OnRtpPacket(media_packets[1]);
+  EXPECT_EQ(receiver_.GetPacketCounter().num_packets, 0u);
+}
+
+TEST_F(ReedSolomonFecTest, DiscardsMalformedFecPackets) {
+  SetFecRate(/*fec_rate=*/85, /*max_fec_frames=*/1);
+  std::vector<RtpPacketReceived> media_packets = SendFrame(6);
+  std::vector<RtpPacketReceived> fec_packets = GetFecPackets();
+  ASSERT_EQ(fec_packets.size(), 2u);
+  const uint16_t base_seq_num = media_packets[0].SequenceNumber();
+
+  EXPECT_CALL(recovered_packet_receiver_, OnRecoveredPacket(_)).Times(0);
+  for (size_t i = 2; i < media_packets.size(); ++i) {
+    receiver_.OnRtpPacket(media_packets[i]);
+  }
+  // Truncated header.
+  RtpPacketReceived truncated = CreateFecPacket(base_seq_num, 6, 2, 0);
+  truncated.SetPayloadSize(kReedSolomonFecHeaderSize - 1);
+  receiver_.OnRtpPacket(truncated);
+  // No media packets.
+  receiver_.OnRtpPacket(CreateFecPacket(base_seq_num, 0, 2, 0));
+  // Parity index out of range.
+  receiver_.OnRtpPacket(CreateFecPacket(base_seq_num, 6, 2, 2));
+  receiver_.OnRtpPacket(CreateFecPacket(base_seq_num, 6, 0, 0));
+  // Too many media packets or shards.
+  receiver_.OnRtpPacket(CreateFecPacket(
+      base_seq_num, kReedSolomonFecMaxMediaPackets + 1, 2, 0));
+  receiver_.OnRtpPacket(CreateFecPacket(base_seq_num, 100, 157, 0));
+  // Header that does not match the block of an earlier parity packet.
+  receiver_.OnRtpPacket(fec_packets[1]);
+  receiver_.OnRtpPacket(CreateFecPacket(base_seq_num, 5, 2, 0));
+  receiver_.OnRtpPacket(CreateFecPacket(base_seq_num, 6, 2, 0,
+                                        fec_packets[1].payload_size() + 1));
+  ::testing::Mock::VerifyAndClearExpectations(&recovered_packet_receiver_);
+
+  // The block is still recovered by its real parity packets.
+  EXPECT_CALL(recovered_packet_receiver_,
+              OnRecoveredPacket(Property(&RtpPacketReceived::Buffer,
+                                         Eq(media_packets[0].Buffer()))));
+  EXPECT_CALL(recovered_packet_receiver_,
+              OnRecoveredPacket(Property(&RtpPacketReceived::Buffer,
+                                         Eq(media_packets[1].Buffer()))));
+  receiver_.OnRtpPacket(fec_packets[0]);
+}
+
+TEST_F(ReedSolomonFecTest, BoundsBlocksWaitingForPackets) {
+  SetFecRate(/*fec_rate=*/85, /*max_fec_frames=*/1);
+  std::vector<RtpPacketReceived> media_packets = SendFrame(6);
+  std::vector<RtpPacketReceived> fec_packets = GetFecPackets();
+  ASSERT_EQ(fec_packets.size(), 2u);
+  const uint16_t base_seq_num = media_packets[0].SequenceNumber();
+
+  // Parity packets of one real block, followed by a flood of blocks right
+  // after it, which never get enough packets to be decoded.
+  for (const RtpPacketReceived& fec_packet : fec_packets) {
+    receiver_.OnRtpPacket(fec_packet);
+  }
+  for (int i = 0; i < 200; ++i) {
+    receiver_.OnRtpPacket(CreateFecPacket(
+        static_cast<uint16_t>(base_seq_num + 6 + 2 * i), 2, 1, 0));
+  }
+  EXPECT_EQ(receiver_.GetPacketCounter().num_fec_packets, 202u);
+
+  // The real block was forgotten.
+  EXPECT_CALL(recovered_packet_receiver_, OnRecoveredPacket(_)).Times(0);
+  for (size_t i = 2; i < media_packets.size(); ++i) {
+    receiver_.OnRtpPacket(media_packets[i]);
+  }
+}
+
+TEST_F(ReedSolomonFecTest, DiscardsFecPacketsFarAheadOfMedia) {
+  SetFecRate(/*fec_rate=*/85, /*max_fec_frames=*/1);
+  std::vector<RtpPacketReceived> media_packets = SendFrame(6);
+  std::vector<RtpPacketReceived> fec_packets = GetFecPackets();
+  ASSERT_EQ(fec_packets.size(), 2u);
+  const uint16_t base_seq_num = media_packets[0].SequenceNumber();
+
+  for (size_t i = 2; i < media_packets.size(); ++i) {
+    receiver_.OnRtpPacket(media_packets[i]);
+  }
+  // Had this block been kept, the media packets would have been forgotten as
+  // too old compared to it.
+  receiver_.OnRtpPacket(
+      CreateFecPacket(static_cast<uint16_t>(base_seq_num + 10000), 2, 1, 0));
+
+  EXPECT_CALL(recovered_packet_receiver_, OnRecoveredPacket(_)).Times(2);
+  for (const RtpPacketReceived& fec_packet : fec_packets) {
+    receiver_.OnRtpPacket(fec_packet);
+  }
+}
+
+}  // namespace webrtc
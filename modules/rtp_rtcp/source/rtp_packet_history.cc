@@ -28,6 +28,10 @@ namespace {
 
 constexpr size_t kOldPayloadPaddingSizeHysteresis = 100;
 constexpr uint16_t kMaxOldPayloadPaddingSequenceNumber = 1 << 13;
+// Bounds of the ring buffer size. Sequence numbers map to the same slot across
+// wrap-arounds since the size divides 2^16.
+constexpr size_t kMinNumSlots = 64;
+constexpr size_t kMaxNumSlots = 1 << 16;
 
 }  // namespace
 
@@ -104,27 +108,37 @@ void RtpPacketHistory::PutRtpPacket(std::unique_ptr<RtpPacketToSend> packet,
   // Store packet.
   const uint16_t rtp_seq_no = packet->SequenceNumber();
   int packet_index = GetPacketIndex(rtp_seq_no);
-  if (packet_index >= 0 &&
-      static_cast<size_t>(packet_index) < packet_history_.size() &&
-      packet_history_[packet_index].packet_ != nullptr) {
+  if (packet_index >= 0 && static_cast<size_t>(packet_index) < num_slots_ &&
+      Slot(packet_index).packet_ != nullptr) {
     RTC_LOG(LS_WARNING) << "Duplicate packet inserted: " << rtp_seq_no;
     // Remove previous packet to avoid inconsistent state.
     RemovePacket(packet_index);
     packet_index = GetPacketIndex(rtp_seq_no);
   }
 
-  // Packet to be inserted ahead of first packet, expand front.
-  for (; packet_index < 0; ++packet_index) {
-    packet_history_.emplace_front();
+  const bool was_empty = num_slots_ == 0;
+  if (was_empty) {
+    first_sequence_number_ = rtp_seq_no;
   }
-  // Packet to be inserted behind last packet, expand back.
-  while (static_cast<int>(packet_history_.size()) <= packet_index) {
-    packet_history_.emplace_back();
+  if (packet_index < 0) {
+    // Packet to be inserted ahead of first packet, expand front.
+    EnsureCapacity(num_slots_ - packet_index);
+    first_sequence_number_ = rtp_seq_no;
+    num_slots_ -= packet_index;
+    last_packet_index_ -= packet_index;
+    packet_index = 0;
+  } else if (static_cast<size_t>(packet_index) >= num_slots_) {
+    // Packet to be inserted behind last packet, expand back.
+    EnsureCapacity(packet_index + 1);
+    num_slots_ = packet_index + 1;
+  }
+  if (was_empty || packet_index > last_packet_index_) {
+    last_packet_index_ = packet_index;
   }
 
   RTC_DCHECK_GE(packet_index, 0);
-  RTC_DCHECK_LT(packet_index, packet_history_.size());
-  RTC_DCHECK(packet_history_[packet_index].packet_ == nullptr);
+  RTC_DCHECK_LT(packet_index, num_slots_);
+  RTC_DCHECK(Slot(packet_index).packet_ == nullptr);
 
   if (padding_mode_ == PaddingMode::kRecentLargePacket) {
     if ((!large_payload_packet_ ||
@@ -137,7 +151,7 @@ void RtpPacketHistory::PutRtpPacket(std::unique_ptr<RtpPacketToSend> packet,
     }
   }
 
-  packet_history_[packet_index] =
+  Slot(packet_index) =
       StoredPacket(std::move(packet), send_time, packets_inserted_++);
 }
 
@@ -207,17 +221,12 @@ bool RtpPacketHistory::GetPacketState(uint16_t sequence_number) const {
     return false;
   }
 
-  int packet_index = GetPacketIndex(sequence_number);
-  if (packet_index < 0 ||
-      static_cast<size_t>(packet_index) >= packet_history_.size()) {
-    return false;
-  }
-  const StoredPacket& packet = packet_history_[packet_index];
-  if (packet.packet_ == nullptr) {
+  const StoredPacket* packet = GetStoredPacket(sequence_number);
+  if (packet == nullptr) {
     return false;
   }
 
-  if (!VerifyRtt(packet)) {
+  if (!VerifyRtt(*packet)) {
     return false;
   }
 
@@ -256,20 +265,12 @@ std::unique_ptr<RtpPacketToSend> RtpPacketHistory::GetPayloadPaddingPacket(
     return encapsulate(*large_payload_packet_);
   }
 
-  StoredPacket* best_packet = nullptr;
-  if (!packet_history_.empty()) {
-    // Pick the last packet.
-    for (auto it = packet_history_.rbegin(); it != packet_history_.rend();
-         ++it) {
-      if (it->packet_ != nullptr) {
-        best_packet = &(*it);
-        break;
-      }
-    }
-  }
-  if (best_packet == nullptr) {
+  if (num_slots_ == 0) {
     return nullptr;
   }
+  // Pick the last packet.
+  StoredPacket* best_packet = &Slot(last_packet_index_);
+  RTC_DCHECK(best_packet->packet_ != nullptr);
 
   if (best_packet->pending_transmission_) {
     // Because PacedSender releases it's lock when it calls
@@ -295,8 +296,8 @@ void RtpPacketHistory::CullAcknowledgedPackets(
   MutexLock lock(&lock_);
   for (uint16_t sequence_number : sequence_numbers) {
     int packet_index = GetPacketIndex(sequence_number);
-    if (packet_index < 0 ||
-        static_cast<size_t>(packet_index) >= packet_history_.size()) {
+    if (packet_index < 0 || static_cast<size_t>(packet_index) >= num_slots_ ||
+        Slot(packet_index).packet_ == nullptr) {
       continue;
     }
     RemovePacket(packet_index);
@@ -310,6 +311,7 @@ void RtpPacketHistory::Clear() {
 
 void RtpPacketHistory::Reset() {
   packet_history_.clear();
+  num_slots_ = 0;
   large_payload_packet_ = std::nullopt;
 }
 
@@ -319,15 +321,15 @@ void RtpPacketHistory::CullOldPackets() {
       rtt_.IsFinite()
           ? std::max(kMinPacketDurationRtt * rtt_, kMinPacketDuration)
           : kMinPacketDuration;
-  while (!packet_history_.empty()) {
-    if (packet_history_.size() >= kMaxCapacity) {
+  while (num_slots_ > 0) {
+    if (num_slots_ >= kMaxCapacity) {
       // We have reached the absolute max capacity, remove one packet
       // unconditionally.
       RemovePacket(0);
       continue;
     }
 
-    const StoredPacket& stored_packet = packet_history_.front();
+    const StoredPacket& stored_packet = Slot(0);
     if (stored_packet.pending_transmission_) {
       // Don't remove packets in the pacer queue, pending tranmission.
       return;
@@ -338,7 +340,7 @@ void RtpPacketHistory::CullOldPackets() {
       return;
     }
 
-    if (packet_history_.size() >= number_to_store_ ||
+    if (num_slots_ >= number_to_store_ ||
         stored_packet.send_time() +
                 (packet_duration * kPacketCullingDelayFactor) <=
             now) {
@@ -356,11 +358,20 @@ std::unique_ptr<RtpPacketToSend> RtpPacketHistory::RemovePacket(
     int packet_index) {
   // Move the packet out from the StoredPacket container.
   std::unique_ptr<RtpPacketToSend> rtp_packet =
-      std::move(packet_history_[packet_index].packet_);
+      std::move(Slot(packet_index).packet_);
+  if (packet_index == last_packet_index_) {
+    // Only packets removed since the last one was inserted are skipped here,
+    // so this is amortized constant time.
+    while (last_packet_index_ > 0 &&
+           Slot(last_packet_index_).packet_ == nullptr) {
+      --last_packet_index_;
+    }
+  }
   if (packet_index == 0) {
-    while (!packet_history_.empty() &&
-           packet_history_.front().packet_ == nullptr) {
-      packet_history_.pop_front();
+    while (num_slots_ > 0 && Slot(0).packet_ == nullptr) {
+      ++first_sequence_number_;
+      --num_slots_;
+      --last_packet_index_;
     }
   }
 
@@ -368,12 +379,11 @@ std::unique_ptr<RtpPacketToSend> RtpPacketHistory::RemovePacket(
 }
 
 int RtpPacketHistory::GetPacketIndex(uint16_t sequence_number) const {
-  if (packet_history_.empty()) {
+  if (num_slots_ == 0) {
     return 0;
   }
 
-  RTC_DCHECK(packet_history_.front().packet_ != nullptr);
-  int first_seq = packet_history_.front().packet_->SequenceNumber();
+  int first_seq = first_sequence_number_;
   if (first_seq == sequence_number) {
     return 0;
   }
@@ -397,11 +407,51 @@ int RtpPacketHistory::GetPacketIndex(uint16_t sequence_number) const {
 RtpPacketHistory::StoredPacket* RtpPacketHistory::GetStoredPacket(
     uint16_t sequence_number) {
   int index = GetPacketIndex(sequence_number);
-  if (index < 0 || static_cast<size_t>(index) >= packet_history_.size() ||
-      packet_history_[index].packet_ == nullptr) {
+  if (index < 0 || static_cast<size_t>(index) >= num_slots_ ||
+      Slot(index).packet_ == nullptr) {
+    return nullptr;
+  }
+  return &Slot(index);
+}
+
+const RtpPacketHistory::StoredPacket* RtpPacketHistory::GetStoredPacket(
+    uint16_t sequence_number) const {
+  int index = GetPacketIndex(sequence_number);
+  if (index < 0 || static_cast<size_t>(index) >= num_slots_ ||
+      Slot(index).packet_ == nullptr) {
     return nullptr;
   }
-  return &packet_history_[index];
+  return &Slot(index);
+}
+
+RtpPacketHistory::StoredPacket& RtpPacketHistory::Slot(int packet_index) {
+  RTC_DCHECK_GE(packet_index, 0);
+  uint16_t sequence_number = first_sequence_number_ + packet_index;
+  return packet_history_[sequence_number & (packet_history_.size() - 1)];
+}
+
+const RtpPacketHistory::StoredPacket& RtpPacketHistory::Slot(
+    int packet_index) const {
+  RTC_DCHECK_GE(packet_index, 0);
+  uint16_t sequence_number = first_sequence_number_ + packet_index;
+  return packet_history_[sequence_number & (packet_history_.size() - 1)];
+}
+
+void RtpPacketHistory::EnsureCapacity(size_t num_slots) {
+  if (num_slots <= packet_history_.size()) {
+    return;
+  }
+  RTC_CHECK_LE(num_slots, kMaxNumSlots);
+  size_t size = std::max(packet_history_.size(), kMinNumSlots);
+  while (size < num_slots) {
+    size *= 2;
+  }
+  std::vector<StoredPacket> packets(size);
+  for (size_t i = 0; i < num_slots_; ++i) {
+    uint16_t sequence_number = first_sequence_number_ + i;
+    packets[sequence_number & (size - 1)] = std::move(Slot(i));
+  }
+  packet_history_ = std::move(packets);
 }
 
 }  // namespace webrtc
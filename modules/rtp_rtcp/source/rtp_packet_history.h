@@ -11,7 +11,6 @@
 #ifndef MODULES_RTP_RTCP_SOURCE_RTP_PACKET_HISTORY_H_
 #define MODULES_RTP_RTCP_SOURCE_RTP_PACKET_HISTORY_H_
 
-#include <deque>
 #include <map>
 #include <memory>
 #include <optional>
@@ -146,17 +145,17 @@ class RtpPacketHistory {
     std::unique_ptr<RtpPacketToSend> packet_;
 
     // True if the packet is currently in the pacer queue pending transmission.
-    bool pending_transmission_;
+    bool pending_transmission_ = false;
 
    private:
     Timestamp send_time_ = Timestamp::Zero();
 
     // Unique number per StoredPacket, incremented by one for each added
     // packet. Used to sort on insert order.
-    uint64_t insert_order_;
+    uint64_t insert_order_ = 0;
 
     // Number of times RE-transmitted, ie excluding the first transmission.
-    size_t times_retransmitted_;
+    size_t times_retransmitted_ = 0;
   };
 
   // Helper method to check if packet has too recently been sent.
@@ -172,6 +171,14 @@ class RtpPacketHistory {
       RTC_EXCLUSIVE_LOCKS_REQUIRED(lock_);
   StoredPacket* GetStoredPacket(uint16_t sequence_number)
       RTC_EXCLUSIVE_LOCKS_REQUIRED(lock_);
+  const StoredPacket* GetStoredPacket(uint16_t sequence_number) const
+      RTC_EXCLUSIVE_LOCKS_REQUIRED(lock_);
+  // Returns the slot of the packet `packet_index` packets after the first one.
+  StoredPacket& Slot(int packet_index) RTC_EXCLUSIVE_LOCKS_REQUIRED(lock_);
+  const StoredPacket& Slot(int packet_index) const
+      RTC_EXCLUSIVE_LOCKS_REQUIRED(lock_);
+  // Grows `packet_history_` to hold at least `num_slots` slots.
+  void EnsureCapacity(size_t num_slots) RTC_EXCLUSIVE_LOCKS_REQUIRED(lock_);
 
   Clock* const clock_;
   const PaddingMode padding_mode_;
@@ -180,13 +187,19 @@ class RtpPacketHistory {
   StorageMode mode_ RTC_GUARDED_BY(lock_);
   TimeDelta rtt_ RTC_GUARDED_BY(lock_);
 
-  // Queue of stored packets, ordered by sequence number, with older packets in
-  // the front and new packets being added to the back. Note that there may be
-  // wrap-arounds so the back may have a lower sequence number.
-  // Packets may also be removed out-of-order, in which case there will be
-  // instances of StoredPacket with `packet_` set to nullptr. The first and last
-  // entry in the queue will however always be populated.
-  std::deque<StoredPacket> packet_history_ RTC_GUARDED_BY(lock_);
+  // Ring buffer of stored packets, indexed by sequence number modulo its size,
+  // which is a power of two. The `num_slots_` slots in use hold consecutive
+  // sequence numbers starting at `first_sequence_number_`, with older packets
+  // in the front and new packets being added to the back. Packets may also be
+  // removed out-of-order, in which case there will be instances of
+  // StoredPacket with `packet_` set to nullptr. The first slot in use will
+  // however always be populated. Slots not in use are always empty.
+  std::vector<StoredPacket> packet_history_ RTC_GUARDED_BY(lock_);
+  uint16_t first_sequence_number_ RTC_GUARDED_BY(lock_) = 0;
+  size_t num_slots_ RTC_GUARDED_BY(lock_) = 0;
+  // Index of the last populated slot, i.e. the most recent packet, which is
+  // used for padding. Only valid if `num_slots_` > 0.
+  int last_packet_index_ RTC_GUARDED_BY(lock_) = 0;
 
   // Total number of packets with inserted.
   uint64_t packets_inserted_ RTC_GUARDED_BY(lock_);
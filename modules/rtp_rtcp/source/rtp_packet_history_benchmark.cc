@@ -0,0 +1,90 @@
+/*
+ *  Copyright 2025 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "api/environment/environment.h"
+#include "api/environment/environment_factory.h"
+#include "api/units/time_delta.h"
+#include "benchmark/benchmark.h"
+#include "modules/rtp_rtcp/source/rtp_packet_history.h"
+#include "modules/rtp_rtcp/source/rtp_packet_to_send.h"
+#include "rtc_base/random.h"
+#include "system_wrappers/include/clock.h"
+
+namespace webrtc {
+namespace {
+
+constexpr size_t kPayloadSize = 1100;
+constexpr TimeDelta kPacketInterval = TimeDelta::Micros(500);
+constexpr TimeDelta kRtt = TimeDelta::Millis(50);
+
+std::unique_ptr<RtpPacketToSend> CreatePacket(uint16_t sequence_number) {
+  auto packet = std::make_unique<RtpPacketToSend>(nullptr);
+  packet->SetSequenceNumber(sequence_number);
+  packet->SetPayloadSize(kPayloadSize);
+  packet->set_allow_retransmission(true);
+  return packet;
+}
+
+// Sends packets at a steady rate while the receiver NACKs a burst of
+// `state.range(1)` random recent packets for every `state.range(0)` packets
+// sent, and the pacer asks for a payload padding packet every sent packet.
+// Sequence numbers wrap around many times during the run.
+void BM_RtpPacketHistoryNackStorm(benchmark::State& state) {
+  const int packets_per_nack = static_cast<int>(state.range(0));
+  const int nack_burst_size = static_cast<int>(state.range(1));
+  SimulatedClock clock(123456);
+  const Environment env = CreateEnvironment(&clock);
+  RtpPacketHistory history(env, RtpPacketHistory::PaddingMode::kDefault);
+  history.SetStorePacketsStatus(RtpPacketHistory::StorageMode::kStoreAndCull,
+                                /*number_to_store=*/600);
+  history.SetRtt(kRtt);
+  Random random(0x5eed);
+
+  uint16_t sequence_number = 0;
+  std::vector<uint16_t> nacked;
+  int64_t retransmissions = 0;
+  for (auto _ : state) {
+    history.PutRtpPacket(CreatePacket(sequence_number), clock.CurrentTime());
+    benchmark::DoNotOptimize(history.GetPayloadPaddingPacket());
+    if (sequence_number % packets_per_nack == 0) {
+      nacked.clear();
+      for (int i = 0; i < nack_burst_size; ++i) {
+        nacked.push_back(sequence_number - random.Rand(1, 500));
+      }
+      for (uint16_t nacked_sequence_number : nacked) {
+        if (history.GetPacketAndMarkAsPending(nacked_sequence_number)) {
+          ++retransmissions;
+        }
+      }
+      for (uint16_t nacked_sequence_number : nacked) {
+        history.MarkPacketAsSent(nacked_sequence_number);
+      }
+    }
+    ++sequence_number;
+    clock.AdvanceTime(kPacketInterval);
+  }
+
+  state.counters["retransmissions"] = benchmark::Counter(
+      static_cast<double>(retransmissions), benchmark::Counter::kAvgIterations);
+}
+
+BENCHMARK(BM_RtpPacketHistoryNackStorm)
+    ->ArgNames({"packets_per_nack", "nack_burst"})
+    ->Args({100, 10})
+    ->Args({10, 50})
+    ->Args({1, 100});
+
+}  // namespace
+}  // namespace webrtc
@@ -620,6 +620,30 @@ TEST_P(RtpPacketHistoryTest, UsesLastPacketAsPaddingWithDefaultMode) {
   EXPECT_EQ(hist_.GetPayloadPaddingPacket(), nullptr);
 }
 
+TEST_P(RtpPacketHistoryTest, KeepsPacketsWhenStorageGrows) {
+  const size_t kHistorySize = 1000;
+  hist_.SetStorePacketsStatus(StorageMode::kStoreAndCull, kHistorySize);
+
+  // Insert every other packet first, then fill in the gaps backwards, so that
+  // the storage grows both at the back and at the front.
+  for (size_t i = 0; i < kHistorySize; i += 2) {
+    hist_.PutRtpPacket(CreateRtpPacket(To16u(kStartSeqNum + i)),
+                       fake_clock_.CurrentTime());
+  }
+  for (size_t i = kHistorySize + 1; i > 1; i -= 2) {
+    hist_.PutRtpPacket(CreateRtpPacket(To16u(kStartSeqNum + i - kHistorySize)),
+                       fake_clock_.CurrentTime());
+  }
+
+  for (size_t i = 0; i < kHistorySize; i += 2) {
+    EXPECT_TRUE(hist_.GetPacketState(To16u(kStartSeqNum + i)));
+  }
+  for (size_t i = kHistorySize + 1; i > 1; i -= 2) {
+    EXPECT_TRUE(hist_.GetPacketState(To16u(kStartSeqNum + i - kHistorySize)));
+  }
+  EXPECT_FALSE(hist_.GetPacketState(To16u(kStartSeqNum + kHistorySize)));
+}
+
 INSTANTIATE_TEST_SUITE_P(
     WithAndWithoutPaddingPrio,
     RtpPacketHistoryTest,
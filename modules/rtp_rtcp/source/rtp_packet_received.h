@@ -10,6 +10,7 @@
 #ifndef MODULES_RTP_RTCP_SOURCE_RTP_PACKET_RECEIVED_H_
 #define MODULES_RTP_RTCP_SOURCE_RTP_PACKET_RECEIVED_H_
 
+#include <stddef.h>
 #include <stdint.h>
 
 #include <utility>
@@ -58,6 +59,12 @@ class RtpPacketReceived : public RtpPacket {
   bool recovered() const { return recovered_; }
   void set_recovered(bool value) { recovered_ = value; }
 
+  // Number of bytes of this packet that were copied on the receive path
+  // between the socket read and parsing, e.g. because the transport could not
+  // take over the socket buffer. Used for instrumentation only.
+  size_t bytes_copied() const { return bytes_copied_; }
+  void set_bytes_copied(size_t value) { bytes_copied_ = value; }
+
   int payload_type_frequency() const { return payload_type_frequency_; }
   void set_payload_type_frequency(int value) {
     payload_type_frequency_ = value;
@@ -76,6 +83,7 @@ class RtpPacketReceived : public RtpPacket {
   webrtc::Timestamp arrival_time_ = Timestamp::MinusInfinity();
   rtc::EcnMarking ecn_ = rtc::EcnMarking::kNotEct;
   int payload_type_frequency_ = 0;
+  size_t bytes_copied_ = 0;
   bool recovered_ = false;
   rtc::scoped_refptr<rtc::RefCountedBase> additional_data_;
 };
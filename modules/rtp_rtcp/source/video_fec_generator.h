@@ -25,7 +25,7 @@ class VideoFecGenerator {
   VideoFecGenerator() = default;
   virtual ~VideoFecGenerator() = default;
 
-  enum class FecType { kFlexFec, kUlpFec };
+  enum class FecType { kFlexFec, kUlpFec, kReedSolomon };
   virtual FecType GetFecType() const = 0;
   // Returns the SSRC used for FEC packets (i.e. FlexFec SSRC).
   virtual std::optional<uint32_t> FecSsrc() = 0;
@@ -0,0 +1,244 @@
+/*
+ *  Copyright 2025 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "modules/video_coding/codecs/test/videocodec_test_batch.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdio>
+#include <iterator>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "api/numerics/samples_stats_counter.h"
+#include "api/units/data_rate.h"
+#include "api/units/frequency.h"
+#include "modules/video_coding/codecs/test/videocodec_test_fixture_impl.h"
+#include "rtc_base/checks.h"
+#include "rtc_base/logging.h"
+#include "rtc_base/platform_thread.h"
+#include "rtc_base/string_to_number.h"
+#include "rtc_base/strings/string_builder.h"
+#include "rtc_base/synchronization/mutex.h"
+#include "system_wrappers/include/cpu_info.h"
+
+namespace webrtc {
+namespace test {
+
+namespace {
+
+using FrameStatistics = VideoCodecTestStats::FrameStatistics;
+
+void CalcPercentilesMs(SamplesStatsCounter& times_us,
+                       double* p50_ms,
+                       double* p90_ms,
+                       double* p99_ms) {
+  if (times_us.IsEmpty()) {
+    return;
+  }
+  *p50_ms = times_us.GetPercentile(0.5) / 1000.0;
+  *p90_ms = times_us.GetPercentile(0.9) / 1000.0;
+  *p99_ms = times_us.GetPercentile(0.99) / 1000.0;
+}
+
+// JSON has no representation for infinite PSNR of lossless frames.
+std::string JsonNumber(const std::string& number) {
+  std::optional<double> value = rtc::StringToNumber<double>(number);
+  return value && std::isfinite(*value) ? number : "null";
+}
+
+std::string JsonEscape(absl::string_view str) {
+  std::string escaped;
+  for (char c : str) {
+    if (c == '"' || c == '\\') {
+      escaped += '\\';
+    }
+    escaped += c;
+  }
+  return escaped;
+}
+
+}  // namespace
+
+std::map<std::string, std::string> VideoCodecTestBatch::Result::ToMap() const {
+  std::map<std::string, std::string> map = video_stat.ToMap();
+  map["rate_profile_idx"] = std::to_string(rate_profile_idx);
+  map["encode_time_p50_ms"] = std::to_string(encode_time_p50_ms);
+  map["encode_time_p90_ms"] = std::to_string(encode_time_p90_ms);
+  map["encode_time_p99_ms"] = std::to_string(encode_time_p99_ms);
+  map["decode_time_p50_ms"] = std::to_string(decode_time_p50_ms);
+  map["decode_time_p90_ms"] = std::to_string(decode_time_p90_ms);
+  map["decode_time_p99_ms"] = std::to_string(decode_time_p99_ms);
+  return map;
+}
+
+VideoCodecTestBatch::VideoCodecTestBatch(size_t num_threads)
+    : num_threads_(num_threads > 0 ? num_threads
+                                   : CpuInfo::DetectNumberOfCores()) {}
+
+VideoCodecTestBatch::~VideoCodecTestBatch() = default;
+
+void VideoCodecTestBatch::AddJob(Job job) {
+  RTC_DCHECK(!job.rate_profiles.empty());
+  if (job.config.measure_cpu) {
+    // Process CPU time is shared by all jobs that run at the same time.
+    RTC_LOG(LS_WARNING) << "CPU usage is not measured in batch mode.";
+    job.config.measure_cpu = false;
+  }
+  jobs_.push_back(std::move(job));
+}
+
+std::vector<VideoCodecTestBatch::Result> VideoCodecTestBatch::Run() {
+  std::vector<std::vector<Result>> job_results(jobs_.size());
+  std::atomic<size_t> next_job(0);
+  const size_t num_threads = std::min(num_threads_, jobs_.size());
+  RTC_LOG(LS_INFO) << "Running " << jobs_.size() << " jobs on " << num_threads
+                   << " threads.";
+
+  std::vector<rtc::PlatformThread> threads;
+  for (size_t i = 0; i < num_threads; ++i) {
+    threads.push_back(rtc::PlatformThread::SpawnJoinable(
+        [this, &job_results, &next_job] {
+          for (size_t job_idx = next_job++; job_idx < jobs_.size();
+               job_idx = next_job++) {
+            job_results[job_idx] = RunJob(jobs_[job_idx]);
+          }
+        },
+        "VidCodecBatch"));
+  }
+  // Joins the threads.
+  threads.clear();
+
+  std::vector<Result> results;
+  for (std::vector<Result>& results_of_job : job_results) {
+    std::move(results_of_job.begin(), results_of_job.end(),
+              std::back_inserter(results));
+  }
+  return results;
+}
+
+std::vector<VideoCodecTestBatch::Result> VideoCodecTestBatch::RunJob(
+    Job& job) {
+  VideoCodecTestFixtureImpl fixture(job.config);
+  fixture.SetReportMutex(&report_mutex_);
+  fixture.RunTest(job.rate_profiles, /*rc_thresholds=*/nullptr,
+                  /*quality_thresholds=*/nullptr,
+                  /*bs_thresholds=*/nullptr);
+  VideoCodecTestStats& stats = fixture.GetStats();
+  const std::vector<FrameStatistics> frame_stats = stats.GetFrameStatistics();
+  if (frame_stats.empty()) {
+    RTC_LOG(LS_WARNING) << "No frames processed by " << job.config.ToString();
+    return {};
+  }
+
+  std::vector<Result> results;
+  for (size_t rate_profile_idx = 0;
+       rate_profile_idx < job.rate_profiles.size(); ++rate_profile_idx) {
+    const RateProfile& rate_profile = job.rate_profiles[rate_profile_idx];
+    const size_t first_frame_num = rate_profile.frame_num;
+    const size_t last_frame_num =
+        rate_profile_idx + 1 < job.rate_profiles.size()
+            ? job.rate_profiles[rate_profile_idx + 1].frame_num - 1
+            : job.config.num_frames - 1;
+    RTC_CHECK_GE(last_frame_num, first_frame_num);
+
+    Result result;
+    result.test_name = job.config.test_name;
+    result.codec_name = job.config.CodecName();
+    result.filename = job.config.filename;
+    result.rate_profile_idx = rate_profile_idx;
+    result.video_stat = stats.CalcVideoStatistic(
+        first_frame_num, last_frame_num,
+        DataRate::KilobitsPerSec(rate_profile.target_kbps),
+        Frequency::Hertz(rate_profile.input_fps));
+
+    SamplesStatsCounter encode_times_us;
+    SamplesStatsCounter decode_times_us;
+    for (const FrameStatistics& frame_stat : frame_stats) {
+      if (frame_stat.frame_number < first_frame_num ||
+          frame_stat.frame_number > last_frame_num) {
+        continue;
+      }
+      if (frame_stat.encoding_successful) {
+        encode_times_us.AddSample(frame_stat.encode_time_us);
+      }
+      if (frame_stat.decoding_successful) {
+        decode_times_us.AddSample(frame_stat.decode_time_us);
+      }
+    }
+    CalcPercentilesMs(encode_times_us, &result.encode_time_p50_ms,
+                      &result.encode_time_p90_ms, &result.encode_time_p99_ms);
+    CalcPercentilesMs(decode_times_us, &result.decode_time_p50_ms,
+                      &result.decode_time_p90_ms, &result.decode_time_p99_ms);
+    results.push_back(std::move(result));
+  }
+  return results;
+}
+
+void VideoCodecTestBatch::WriteCsv(absl::string_view path,
+                                   const std::vector<Result>& results) {
+  RTC_LOG(LS_INFO) << "Write batch results to " << path;
+  FILE* csv_file = fopen(std::string(path).c_str(), "w");
+  RTC_CHECK(csv_file) << "Cannot open " << path;
+
+  rtc::StringBuilder header;
+  header << "test_name;codec_name;filename";
+  if (!results.empty()) {
+    for (const auto& entry : results.front().ToMap()) {
+      header << ";" << entry.first;
+    }
+  }
+  fwrite(header.str().c_str(), 1, header.size(), csv_file);
+
+  for (const Result& result : results) {
+    rtc::StringBuilder row;
+    row << "\n" << result.test_name;
+    row << ";" << result.codec_name;
+    row << ";" << result.filename;
+    for (const auto& entry : result.ToMap()) {
+      row << ";" << entry.second;
+    }
+    fwrite(row.str().c_str(), 1, row.size(), csv_file);
+  }
+
+  fclose(csv_file);
+}
+
+void VideoCodecTestBatch::WriteJson(absl::string_view path,
+                                    const std::vector<Result>& results) {
+  RTC_LOG(LS_INFO) << "Write batch results to " << path;
+  FILE* json_file = fopen(std::string(path).c_str(), "w");
+  RTC_CHECK(json_file) << "Cannot open " << path;
+
+  rtc::StringBuilder json;
+  json << "[";
+  for (size_t i = 0; i < results.size(); ++i) {
+    const Result& result = results[i];
+    json << (i == 0 ? "\n" : ",\n");
+    json << "  {\"test_name\": \"" << JsonEscape(result.test_name) << "\"";
+    json << ", \"codec_name\": \"" << JsonEscape(result.codec_name) << "\"";
+    json << ", \"filename\": \"" << JsonEscape(result.filename) << "\"";
+    // All other values are numbers.
+    for (const auto& entry : result.ToMap()) {
+      json << ", \"" << entry.first << "\": " << JsonNumber(entry.second);
+    }
+    json << "}";
+  }
+  json << "\n]\n";
+  fwrite(json.str().c_str(), 1, json.size(), json_file);
+
+  fclose(json_file);
+}
+
+}  // namespace test
+}  // namespace webrtc
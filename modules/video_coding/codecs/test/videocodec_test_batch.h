@@ -0,0 +1,89 @@
+/*
+ *  Copyright 2025 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef MODULES_VIDEO_CODING_CODECS_TEST_VIDEOCODEC_TEST_BATCH_H_
+#define MODULES_VIDEO_CODING_CODECS_TEST_VIDEOCODEC_TEST_BATCH_H_
+
+#include <cstddef>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "absl/strings/string_view.h"
+#include "api/test/videocodec_test_fixture.h"
+#include "api/test/videocodec_test_stats.h"
+#include "rtc_base/synchronization/mutex.h"
+
+namespace webrtc {
+namespace test {
+
+// Runs many VideoCodecTestFixture configurations (clip, codec, bitrate,
+// resolution) concurrently and merges their results. Every configuration gets
+// its own fixture, and so its own codecs and task queue; `num_threads`
+// fixtures run at a time. Set `Config::use_single_core` to keep each
+// configuration on one core.
+class VideoCodecTestBatch {
+ public:
+  struct Job {
+    VideoCodecTestFixture::Config config;
+    std::vector<RateProfile> rate_profiles;
+  };
+
+  // Result of one rate profile of a job.
+  struct Result {
+    // Returns name -> value text map of the result.
+    std::map<std::string, std::string> ToMap() const;
+
+    std::string test_name;
+    std::string codec_name;
+    std::string filename;
+    size_t rate_profile_idx = 0;
+    VideoCodecTestStats::VideoStatistics video_stat;
+
+    // Percentiles of the per-frame encode and decode times.
+    double encode_time_p50_ms = 0.0;
+    double encode_time_p90_ms = 0.0;
+    double encode_time_p99_ms = 0.0;
+    double decode_time_p50_ms = 0.0;
+    double decode_time_p90_ms = 0.0;
+    double decode_time_p99_ms = 0.0;
+  };
+
+  // If `num_threads` is 0, one fixture runs per core.
+  explicit VideoCodecTestBatch(size_t num_threads = 0);
+  ~VideoCodecTestBatch();
+
+  void AddJob(Job job);
+
+  // Runs all added jobs. Returns the results ordered by job and rate profile,
+  // in the order the jobs were added.
+  std::vector<Result> Run();
+
+  // Write `results` to a semicolon separated CSV file or a JSON file, one row
+  // or object per result.
+  static void WriteCsv(absl::string_view path,
+                       const std::vector<Result>& results);
+  static void WriteJson(absl::string_view path,
+                        const std::vector<Result>& results);
+
+ private:
+  std::vector<Result> RunJob(Job& job);
+
+  const size_t num_threads_;
+  std::vector<Job> jobs_;
+  // Shared by the fixtures of all jobs, which print their results and log
+  // them to the global metrics logger.
+  Mutex report_mutex_;
+};
+
+}  // namespace test
+}  // namespace webrtc
+
+#endif  // MODULES_VIDEO_CODING_CODECS_TEST_VIDEOCODEC_TEST_BATCH_H_
@@ -485,10 +485,14 @@ void VideoCodecTestFixtureImpl::RunTest(
     return;
   }
 
-  PrintSettings(&task_queue);
+  {
+    MutexLock lock(report_mutex_);
+    PrintSettings(&task_queue);
+  }
   ProcessAllFrames(&task_queue, rate_profiles);
   ReleaseAndCloseObjects(&task_queue);
 
+  MutexLock lock(report_mutex_);
   AnalyzeAllFrames(rate_profiles, rc_thresholds, quality_thresholds,
                    bs_thresholds);
 }
@@ -746,6 +750,11 @@ VideoCodecTestStats& VideoCodecTestFixtureImpl::GetStats() {
   return stats_;
 }
 
+void VideoCodecTestFixtureImpl::SetReportMutex(Mutex* report_mutex) {
+  RTC_DCHECK(report_mutex);
+  report_mutex_ = report_mutex;
+}
+
 bool VideoCodecTestFixtureImpl::SetUpAndInitObjects(
     TaskQueueForTest* task_queue,
     size_t initial_bitrate_kbps,
@@ -758,10 +767,15 @@ bool VideoCodecTestFixtureImpl::SetUpAndInitObjects(
   int clip_height = config_.clip_height.value_or(config_.codec_settings.height);
 
   // Create file objects for quality analysis.
-  source_frame_reader_ = CreateYuvFrameReader(
-      config_.filepath,
-      Resolution({.width = clip_width, .height = clip_height}),
-      YuvFrameReaderImpl::RepeatMode::kPingPong);
+  if (absl::EndsWith(config_.filepath, ".y4m")) {
+    source_frame_reader_ = CreateY4mFrameReader(
+        config_.filepath, YuvFrameReaderImpl::RepeatMode::kPingPong);
+  } else {
+    source_frame_reader_ = CreateYuvFrameReader(
+        config_.filepath,
+        Resolution({.width = clip_width, .height = clip_height}),
+        YuvFrameReaderImpl::RepeatMode::kPingPong);
+  }
 
   RTC_DCHECK(encoded_frame_writers_.empty());
   RTC_DCHECK(decoded_frame_writers_.empty());
@@ -23,6 +23,7 @@
 #include "modules/video_coding/codecs/test/videocodec_test_stats_impl.h"
 #include "modules/video_coding/codecs/test/videoprocessor.h"
 #include "modules/video_coding/utility/ivf_file_writer.h"
+#include "rtc_base/synchronization/mutex.h"
 #include "rtc_base/task_queue_for_test.h"
 #include "test/testsupport/frame_reader.h"
 #include "test/testsupport/frame_writer.h"
@@ -57,6 +58,11 @@ class VideoCodecTestFixtureImpl : public VideoCodecTestFixture {
 
   VideoCodecTestStats& GetStats() override;
 
+  // Fixtures that run at the same time and share `report_mutex` print their
+  // settings and results, and log their metrics, one at a time. Must be called
+  // before RunTest().
+  void SetReportMutex(Mutex* report_mutex);
+
  private:
   class CpuProcessTime;
 
@@ -101,6 +107,10 @@ class VideoCodecTestFixtureImpl : public VideoCodecTestFixture {
   VideoProcessor::FrameWriterList decoded_frame_writers_;
   std::unique_ptr<VideoProcessor> processor_;
   std::unique_ptr<CpuProcessTime> cpu_process_time_;
+
+  // Guards printing and the global metrics logger.
+  Mutex own_report_mutex_;
+  Mutex* report_mutex_ = &own_report_mutex_;
 };
 
 }  // namespace test
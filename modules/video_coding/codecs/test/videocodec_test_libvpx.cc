@@ -9,6 +9,7 @@
  */
 
 #include <memory>
+#include <string>
 #include <vector>
 
 #include "api/test/create_videocodec_test_fixture.h"
@@ -18,6 +19,7 @@
 #include "media/engine/internal_decoder_factory.h"
 #include "media/engine/internal_encoder_factory.h"
 #include "media/engine/simulcast_encoder_adapter.h"
+#include "modules/video_coding/codecs/test/videocodec_test_batch.h"
 #include "modules/video_coding/utility/vp8_header_parser.h"
 #include "modules/video_coding/utility/vp9_uncompressed_header_parser.h"
 #include "test/gtest.h"
@@ -408,6 +410,46 @@ TEST(VideoCodecTestLibvpx, MAYBE_SvcVP9) {
   fixture->RunTest(rate_profiles, &rc_thresholds, &quality_thresholds, nullptr);
 }
 
+TEST(VideoCodecTestLibvpx, BatchVP8) {
+  VideoCodecTestBatch batch(/*num_threads=*/2);
+  for (size_t bitrate_kbps : {300, 600}) {
+    for (size_t width : {kCifWidth / 2, kCifWidth}) {
+      auto config = CreateConfig();
+      config.test_name = "BatchVP8_" + std::to_string(width) + "_" +
+                         std::to_string(bitrate_kbps);
+      config.num_frames = kNumFramesShort;
+      config.clip_width = kCifWidth;
+      config.clip_height = kCifHeight;
+      config.SetCodecSettings(cricket::kVp8CodecName, 1, 1, 1, false, true,
+                              false, width, width * kCifHeight / kCifWidth);
+      batch.AddJob({config, {{bitrate_kbps, 30, 0}, {bitrate_kbps, 15, 50}}});
+    }
+  }
+
+  std::vector<VideoCodecTestBatch::Result> results = batch.Run();
+  ASSERT_EQ(results.size(), 8u);
+  EXPECT_EQ(results[0].test_name, "BatchVP8_176_300");
+  EXPECT_EQ(results[7].test_name, "BatchVP8_352_600");
+  for (const auto& result : results) {
+    EXPECT_GT(result.video_stat.avg_psnr, 28);
+    EXPECT_GT(result.video_stat.avg_ssim, 0.8);
+    EXPECT_GT(result.encode_time_p50_ms, 0);
+    EXPECT_LE(result.encode_time_p50_ms, result.encode_time_p99_ms);
+    EXPECT_LE(result.decode_time_p50_ms, result.decode_time_p99_ms);
+  }
+  EXPECT_EQ(results[0].rate_profile_idx, 0u);
+  EXPECT_EQ(results[1].rate_profile_idx, 1u);
+
+  const std::string csv_path = OutputPath() + "videocodec_test_batch.csv";
+  const std::string json_path = OutputPath() + "videocodec_test_batch.json";
+  VideoCodecTestBatch::WriteCsv(csv_path, results);
+  VideoCodecTestBatch::WriteJson(json_path, results);
+  EXPECT_TRUE(FileExists(csv_path));
+  EXPECT_TRUE(FileExists(json_path));
+  RemoveFile(csv_path);
+  RemoveFile(json_path);
+}
+
 TEST(VideoCodecTestLibvpx, DISABLED_MultiresVP8RdPerf) {
   auto config = CreateConfig();
   config.filename = "FourPeople_1280x720_30";
@@ -28,6 +28,7 @@ constexpr TimeDelta kDefaultRtt = TimeDelta::Millis(100);
 // Number of times a packet can be nacked before giving up. Nack is sent at most
 // every RTT.
 constexpr int kMaxNackRetries = 100;
+static_assert(kMaxNackRetries <= 255, "NackInfo::retries is a uint8_t");
 constexpr int kMaxReorderedPackets = 128;
 constexpr int kNumReorderingBuckets = 10;
 constexpr TimeDelta kDefaultSendNackDelay = TimeDelta::Zero();
@@ -91,19 +92,16 @@ ScopedNackPeriodicProcessorRegistration::
 }
 
 NackRequester::NackInfo::NackInfo()
-    : seq_num(0),
-      send_at_seq_num(0),
-      created_at_time(Timestamp::MinusInfinity()),
+    : created_at_time(Timestamp::MinusInfinity()),
       sent_at_time(Timestamp::MinusInfinity()),
+      send_at_seq_num(0),
       retries(0) {}
 
-NackRequester::NackInfo::NackInfo(uint16_t seq_num,
-                                  uint16_t send_at_seq_num,
+NackRequester::NackInfo::NackInfo(uint16_t send_at_seq_num,
                                   Timestamp created_at_time)
-    : seq_num(seq_num),
-      send_at_seq_num(send_at_seq_num),
-      created_at_time(created_at_time),
+    : created_at_time(created_at_time),
       sent_at_time(Timestamp::MinusInfinity()),
+      send_at_seq_num(send_at_seq_num),
       retries(0) {}
 
 NackRequester::NackRequester(TaskQueueBase* current_queue,
@@ -116,6 +114,8 @@ NackRequester::NackRequester(TaskQueueBase* current_queue,
       clock_(clock),
       nack_sender_(nack_sender),
       keyframe_request_sender_(keyframe_request_sender),
+      nack_list_(kMaxPacketAge),
+      recovered_list_(kMaxPacketAge + 1),
       reordering_histogram_(kNumReorderingBuckets, kMaxReorderedPackets),
       initialized_(false),
       rtt_(kDefaultRtt),
@@ -169,11 +169,12 @@ int NackRequester::OnReceivedPacket(uint16_t seq_num, bool is_recovered) {
 
   if (AheadOf(newest_seq_num_, seq_num)) {
     // An out of order packet has been received.
-    auto nack_list_it = nack_list_.find(seq_num);
+    const NackInfo* nack_info = nack_list_.Find(seq_num);
     int nacks_sent_for_packet = 0;
-    if (nack_list_it != nack_list_.end()) {
-      nacks_sent_for_packet = nack_list_it->second.retries;
-      nack_list_.erase(nack_list_it);
+    if (nack_info != nullptr) {
+      nacks_sent_for_packet = nack_info->retries;
+      nack_list_.Erase(seq_num);
+      nack_list_.ShrinkToFit();
     }
     if (!is_retransmitted)
       UpdateReorderingStatistics(seq_num);
@@ -181,12 +182,10 @@ int NackRequester::OnReceivedPacket(uint16_t seq_num, bool is_recovered) {
   }
 
   if (is_recovered) {
-    recovered_list_.insert(seq_num);
+    recovered_list_.Insert(seq_num, true);
 
     // Remove old ones so we don't accumulate recovered packets.
-    auto it = recovered_list_.lower_bound(seq_num - kMaxPacketAge);
-    if (it != recovered_list_.begin())
-      recovered_list_.erase(recovered_list_.begin(), it);
+    recovered_list_.EraseBefore(seq_num - kMaxPacketAge);
 
     // Do not send nack for packets recovered by FEC or RTX.
     return 0;
@@ -213,9 +212,8 @@ void NackRequester::ClearUpTo(uint16_t seq_num) {
   // needs to be posted to the worker thread if callers migrate to the network
   // thread.
   RTC_DCHECK_RUN_ON(worker_thread_);
-  nack_list_.erase(nack_list_.begin(), nack_list_.lower_bound(seq_num));
-  recovered_list_.erase(recovered_list_.begin(),
-                        recovered_list_.lower_bound(seq_num));
+  nack_list_.EraseBefore(seq_num);
+  recovered_list_.EraseBefore(seq_num);
 }
 
 void NackRequester::UpdateRtt(int64_t rtt_ms) {
@@ -227,12 +225,11 @@ void NackRequester::AddPacketsToNack(uint16_t seq_num_start,
                                      uint16_t seq_num_end) {
   // Called on worker_thread_.
   // Remove old packets.
-  auto it = nack_list_.lower_bound(seq_num_end - kMaxPacketAge);
-  nack_list_.erase(nack_list_.begin(), it);
+  nack_list_.EraseBefore(seq_num_end - kMaxPacketAge);
 
   uint16_t num_new_nacks = ForwardDiff(seq_num_start, seq_num_end);
   if (nack_list_.size() + num_new_nacks > kMaxNackPackets) {
-    nack_list_.clear();
+    nack_list_.Clear();
     RTC_LOG(LS_WARNING) << "NACK list full, clearing NACK"
                            " list and requesting keyframe.";
     keyframe_request_sender_->RequestKeyFrame();
@@ -241,12 +238,12 @@ void NackRequester::AddPacketsToNack(uint16_t seq_num_start,
 
   for (uint16_t seq_num = seq_num_start; seq_num != seq_num_end; ++seq_num) {
     // Do not send nack for packets that are already recovered by FEC or RTX
-    if (recovered_list_.find(seq_num) != recovered_list_.end())
+    if (recovered_list_.contains(seq_num))
       continue;
-    NackInfo nack_info(seq_num, seq_num + WaitNumberOfPackets(0.5),
+    NackInfo nack_info(seq_num + WaitNumberOfPackets(0.5),
                        clock_->CurrentTime());
-    RTC_DCHECK(nack_list_.find(seq_num) == nack_list_.end());
-    nack_list_[seq_num] = nack_info;
+    RTC_DCHECK(!nack_list_.contains(seq_num));
+    nack_list_.Insert(seq_num, nack_info);
   }
 }
 
@@ -257,29 +254,26 @@ std::vector<uint16_t> NackRequester::GetNackBatch(NackFilterOptions options) {
   bool consider_timestamp = options != kSeqNumOnly;
   Timestamp now = clock_->CurrentTime();
   std::vector<uint16_t> nack_batch;
-  auto it = nack_list_.begin();
-  while (it != nack_list_.end()) {
-    bool delay_timed_out = now - it->second.created_at_time >= send_nack_delay_;
-    bool nack_on_rtt_passed = now - it->second.sent_at_time >= rtt_;
+  nack_list_.ForEach([&](uint16_t seq_num, NackInfo& nack_info) {
+    bool delay_timed_out = now - nack_info.created_at_time >= send_nack_delay_;
+    bool nack_on_rtt_passed = now - nack_info.sent_at_time >= rtt_;
     bool nack_on_seq_num_passed =
-        it->second.sent_at_time.IsInfinite() &&
-        AheadOrAt(newest_seq_num_, it->second.send_at_seq_num);
+        nack_info.sent_at_time.IsInfinite() &&
+        AheadOrAt(newest_seq_num_, nack_info.send_at_seq_num);
     if (delay_timed_out && ((consider_seq_num && nack_on_seq_num_passed) ||
                             (consider_timestamp && nack_on_rtt_passed))) {
-      nack_batch.emplace_back(it->second.seq_num);
-      ++it->second.retries;
-      it->second.sent_at_time = now;
-      if (it->second.retries >= kMaxNackRetries) {
-        RTC_LOG(LS_WARNING) << "Sequence number " << it->second.seq_num
+      nack_batch.emplace_back(seq_num);
+      ++nack_info.retries;
+      nack_info.sent_at_time = now;
+      if (nack_info.retries >= kMaxNackRetries) {
+        RTC_LOG(LS_WARNING) << "Sequence number " << seq_num
                             << " removed from NACK list due to max retries.";
-        it = nack_list_.erase(it);
-      } else {
-        ++it;
+        nack_list_.Erase(seq_num);
       }
-      continue;
     }
-    ++it;
-  }
+  });
+  // Entries erased above may leave most of the storage unused.
+  nack_list_.ShrinkToFit();
   return nack_batch;
 }
 
@@ -13,8 +13,6 @@
 
 #include <stdint.h>
 
-#include <map>
-#include <set>
 #include <vector>
 
 #include "api/field_trials_view.h"
@@ -26,6 +24,7 @@
 #include "modules/include/module_common_types.h"
 #include "modules/video_coding/histogram.h"
 #include "rtc_base/numerics/sequence_number_util.h"
+#include "rtc_base/numerics/sequence_number_window.h"
 #include "rtc_base/task_utils/repeating_task.h"
 #include "rtc_base/thread_annotations.h"
 #include "system_wrappers/include/clock.h"
@@ -89,20 +88,18 @@ class NackRequester final : public NackRequesterBase {
   // GetNackBatch.
   enum NackFilterOptions { kSeqNumOnly, kTimeOnly, kSeqNumAndTime };
 
-  // This class holds the sequence number of the packet that is in the nack list
-  // as well as the meta data about when it should be nacked and how many times
-  // we have tried to nack this packet.
+  // This class holds the meta data about when a packet in the nack list should
+  // be nacked and how many times we have tried to nack it. The sequence number
+  // is the key in `nack_list_`; a slot is reserved for every sequence number
+  // the list spans, so keep this small.
   struct NackInfo {
     NackInfo();
-    NackInfo(uint16_t seq_num,
-             uint16_t send_at_seq_num,
-             Timestamp created_at_time);
+    NackInfo(uint16_t send_at_seq_num, Timestamp created_at_time);
 
-    uint16_t seq_num;
-    uint16_t send_at_seq_num;
     Timestamp created_at_time;
     Timestamp sent_at_time;
-    int retries;
+    uint16_t send_at_seq_num;
+    uint8_t retries;
   };
 
   void AddPacketsToNack(uint16_t seq_num_start, uint16_t seq_num_end)
@@ -128,10 +125,9 @@ class NackRequester final : public NackRequesterBase {
   // TODO(philipel): Some of the variables below are consistently used on a
   // known thread (e.g. see `initialized_`). Those probably do not need
   // synchronized access.
-  std::map<uint16_t, NackInfo, DescendingSeqNumComp<uint16_t>> nack_list_
-      RTC_GUARDED_BY(worker_thread_);
-  std::set<uint16_t, DescendingSeqNumComp<uint16_t>> recovered_list_
-      RTC_GUARDED_BY(worker_thread_);
+  SequenceNumberWindow<NackInfo> nack_list_ RTC_GUARDED_BY(worker_thread_);
+  // Sequence numbers of packets recovered by FEC or RTX.
+  SequenceNumberWindow<bool> recovered_list_ RTC_GUARDED_BY(worker_thread_);
   video_coding::Histogram reordering_histogram_ RTC_GUARDED_BY(worker_thread_);
   bool initialized_ RTC_GUARDED_BY(worker_thread_);
   TimeDelta rtt_ RTC_GUARDED_BY(worker_thread_);
@@ -15,6 +15,7 @@
 #include <algorithm>
 #include <cstdint>
 #include <limits>
+#include <memory>
 #include <utility>
 #include <vector>
 
@@ -33,6 +34,12 @@
 
 namespace webrtc {
 namespace video_coding {
+namespace {
+
+// Enough to reuse the packets of a frame at 4K bitrates.
+constexpr size_t kMaxFreePackets = 128;
+
+}  // namespace
 
 PacketBuffer::Packet::Packet(const RtpPacketReceived& rtp_packet,
                              int64_t sequence_number,
@@ -65,6 +72,34 @@ PacketBuffer::~PacketBuffer() {
   Clear();
 }
 
+std::unique_ptr<PacketBuffer::Packet> PacketBuffer::CreatePacket(
+    const RtpPacketReceived& rtp_packet,
+    int64_t sequence_number,
+    const RTPVideoHeader& video_header) {
+  if (free_packets_.empty()) {
+    return std::make_unique<Packet>(rtp_packet, sequence_number, video_header);
+  }
+  RTC_DCHECK_EQ(static_cast<uint16_t>(sequence_number),
+                rtp_packet.SequenceNumber());
+  std::unique_ptr<Packet> packet = std::move(free_packets_.back());
+  free_packets_.pop_back();
+  packet->continuous = false;
+  packet->marker_bit = rtp_packet.Marker();
+  packet->payload_type = rtp_packet.PayloadType();
+  packet->sequence_number = sequence_number;
+  packet->timestamp = rtp_packet.Timestamp();
+  packet->times_nacked = -1;
+  packet->video_header = video_header;
+  return packet;
+}
+
+void PacketBuffer::ReturnPackets(
+    std::vector<std::unique_ptr<Packet>> packets) {
+  for (std::unique_ptr<Packet>& packet : packets) {
+    RecyclePacket(std::move(packet));
+  }
+}
+
 PacketBuffer::InsertResult PacketBuffer::InsertPacket(
     std::unique_ptr<PacketBuffer::Packet> packet) {
   PacketBuffer::InsertResult result;
@@ -96,6 +131,7 @@ PacketBuffer::InsertResult PacketBuffer::InsertPacket(
   if (buffer_[index] != nullptr) {
     // Duplicate packet, just delete the payload.
     if (buffer_[index]->seq_num() == packet->seq_num()) {
+      RecyclePacket(std::move(packet));
       return result;
     }
 
@@ -110,6 +146,7 @@ PacketBuffer::InsertResult PacketBuffer::InsertPacket(
       // new keyframe is needed.
       RTC_LOG(LS_WARNING) << "Clear PacketBuffer and request key frame.";
       ClearInternal();
+      RecyclePacket(std::move(packet));
       result.buffer_cleared = true;
       return result;
     }
@@ -146,7 +183,7 @@ void PacketBuffer::ClearTo(uint16_t seq_num) {
   for (size_t i = 0; i < iterations; ++i) {
     auto& stored = buffer_[first_seq_num_ % buffer_.size()];
     if (stored != nullptr && AheadOf<uint16_t>(seq_num, stored->seq_num())) {
-      stored = nullptr;
+      RecyclePacket(std::move(stored));
     }
     ++first_seq_num_;
   }
@@ -185,7 +222,9 @@ void PacketBuffer::ResetSpsPpsIdrIsH264Keyframe() {
 
 void PacketBuffer::ClearInternal() {
   for (auto& entry : buffer_) {
-    entry = nullptr;
+    if (entry != nullptr) {
+      RecyclePacket(std::move(entry));
+    }
   }
 
   first_packet_received_ = false;
@@ -195,6 +234,16 @@ void PacketBuffer::ClearInternal() {
   received_padding_.clear();
 }
 
+void PacketBuffer::RecyclePacket(std::unique_ptr<Packet> packet) {
+  RTC_DCHECK(packet);
+  if (free_packets_.size() >= kMaxFreePackets) {
+    return;
+  }
+  // Release the payload, which references the received RTP packet.
+  packet->video_payload = rtc::CopyOnWriteBuffer();
+  free_packets_.push_back(std::move(packet));
+}
+
 bool PacketBuffer::ExpandBufferSize() {
   if (buffer_.size() == max_size_) {
     RTC_LOG(LS_WARNING) << "PacketBuffer is already at max size (" << max_size_
@@ -77,6 +77,16 @@ class PacketBuffer {
   PacketBuffer(size_t start_buffer_size, size_t max_buffer_size);
   ~PacketBuffer();
 
+  // Returns a packet for `rtp_packet`, reusing a packet given back with
+  // ReturnPackets() if there is one. A packet is about 2 KB, mostly the
+  // RTPVideoHeader, so allocating one per RTP packet shows at high bitrates.
+  std::unique_ptr<Packet> CreatePacket(const RtpPacketReceived& rtp_packet,
+                                       int64_t sequence_number,
+                                       const RTPVideoHeader& video_header);
+  // Gives back the packets of an InsertResult once their frames have been
+  // assembled, for CreatePacket() to reuse.
+  void ReturnPackets(std::vector<std::unique_ptr<Packet>> packets);
+
   ABSL_MUST_USE_RESULT InsertResult
   InsertPacket(std::unique_ptr<Packet> packet);
   ABSL_MUST_USE_RESULT InsertResult InsertPadding(uint16_t seq_num);
@@ -89,6 +99,10 @@ class PacketBuffer {
  private:
   void ClearInternal();
 
+  // Keeps `packet` for CreatePacket() to reuse, unless enough packets are
+  // kept already.
+  void RecyclePacket(std::unique_ptr<Packet> packet);
+
   // Tries to expand the buffer.
   bool ExpandBufferSize();
 
@@ -122,6 +136,9 @@ class PacketBuffer {
 
   std::set<uint16_t, DescendingSeqNumComp<uint16_t>> received_padding_;
 
+  // Packets that are no longer used, reused by CreatePacket().
+  std::vector<std::unique_ptr<Packet>> free_packets_;
+
   // Indicates if we should require SPS, PPS, and IDR for a particular
   // RTP timestamp to treat the corresponding frame as a keyframe.
   bool sps_pps_idr_is_h264_keyframe_;
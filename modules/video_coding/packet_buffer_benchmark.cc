@@ -0,0 +1,120 @@
+/*
+ *  Copyright 2025 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "api/array_view.h"
+#include "api/scoped_refptr.h"
+#include "api/video/encoded_image.h"
+#include "api/video/video_codec_type.h"
+#include "api/video/video_frame_type.h"
+#include "benchmark/benchmark.h"
+#include "modules/rtp_rtcp/source/rtp_packet_received.h"
+#include "modules/rtp_rtcp/source/rtp_video_header.h"
+#include "modules/rtp_rtcp/source/video_rtp_depacketizer_vp8.h"
+#include "modules/video_coding/packet_buffer.h"
+#include "rtc_base/checks.h"
+#include "rtc_base/copy_on_write_buffer.h"
+
+namespace webrtc {
+namespace {
+
+constexpr int kFramesPerSecond = 30;
+constexpr size_t kRtpPayloadSize = 1200;
+constexpr size_t kStartBufferSize = 512;
+constexpr size_t kMaxBufferSize = 2048;
+
+// Receives one frame of a state.range(0) kbps stream per iteration, the way
+// RtpVideoStreamReceiver2 does: a packet is created for each RTP packet and
+// inserted into the PacketBuffer, and the payloads of the complete frame are
+// gathered into one bitstream. The payloads reference the received RTP
+// packets. If state.range(1) is 1, the packets are reused with
+// PacketBuffer::CreatePacket() and ReturnPackets().
+void BM_PacketBufferReceiveFrames(benchmark::State& state) {
+  const size_t frame_size = state.range(0) * 1000 / 8 / kFramesPerSecond;
+  const bool reuse_packets = state.range(1) == 1;
+  const size_t packets_per_frame =
+      (frame_size + kRtpPayloadSize - 1) / kRtpPayloadSize;
+
+  std::vector<rtc::CopyOnWriteBuffer> rtp_payloads;
+  for (size_t i = 0; i < packets_per_frame; ++i) {
+    rtp_payloads.emplace_back(kRtpPayloadSize);
+  }
+  video_coding::PacketBuffer packet_buffer(kStartBufferSize, kMaxBufferSize);
+  VideoRtpDepacketizerVp8 depacketizer;
+  RtpPacketReceived rtp_packet;
+  RTPVideoHeader video_header;
+  video_header.codec = kVideoCodecVP8;
+  video_header.frame_type = VideoFrameType::kVideoFrameDelta;
+  video_header.video_type_header.emplace<RTPVideoHeaderVP8>();
+  std::vector<rtc::ArrayView<const uint8_t>> payloads;
+  int64_t sequence_number = 0;
+  uint32_t timestamp = 0;
+
+  for (auto _ : state) {
+    timestamp += 90000 / kFramesPerSecond;
+    rtp_packet.SetTimestamp(timestamp);
+    for (size_t i = 0; i < packets_per_frame; ++i) {
+      const bool last = i + 1 == packets_per_frame;
+      rtp_packet.SetSequenceNumber(static_cast<uint16_t>(sequence_number));
+      rtp_packet.SetMarker(last);
+      video_header.is_first_packet_in_frame = i == 0;
+      video_header.is_last_packet_in_frame = last;
+      std::unique_ptr<video_coding::PacketBuffer::Packet> packet =
+          reuse_packets
+              ? packet_buffer.CreatePacket(rtp_packet, sequence_number,
+                                           video_header)
+              : std::make_unique<video_coding::PacketBuffer::Packet>(
+                    rtp_packet, sequence_number, video_header);
+      ++sequence_number;
+      packet->video_payload = rtp_payloads[i];
+
+      video_coding::PacketBuffer::InsertResult result =
+          packet_buffer.InsertPacket(std::move(packet));
+      RTC_CHECK(!result.buffer_cleared);
+      if (result.packets.empty()) {
+        continue;
+      }
+      RTC_CHECK(last);
+      for (const auto& frame_packet : result.packets) {
+        payloads.emplace_back(frame_packet->video_payload);
+      }
+      rtc::scoped_refptr<EncodedImageBuffer> bitstream =
+          depacketizer.AssembleFrame(payloads);
+      benchmark::DoNotOptimize(bitstream->data());
+      payloads.clear();
+      packet_buffer.ClearTo(rtp_packet.SequenceNumber());
+      if (reuse_packets) {
+        packet_buffer.ReturnPackets(std::move(result.packets));
+      }
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * packets_per_frame);
+  state.SetBytesProcessed(state.iterations() * frame_size);
+}
+
+// 2.5 Mbps 720p, 6 Mbps 1080p and 25 Mbps 4K.
+BENCHMARK(BM_PacketBufferReceiveFrames)
+    ->ArgsProduct({{2500, 6000, 25000}, {0, 1}});
+
+}  // namespace
+}  // namespace webrtc
+
+/*
+
+BM_PacketBufferReceiveFrames takes the bitrate in kbps and whether packets are
+reused. Run with:
+
+  out/Default/benchmarks --benchmark_filter=PacketBufferReceiveFrames
+*/
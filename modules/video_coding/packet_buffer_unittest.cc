@@ -11,6 +11,7 @@
 
 #include <cstring>
 #include <limits>
+#include <memory>
 #include <ostream>
 #include <string>
 #include <utility>
@@ -18,6 +19,7 @@
 #include "api/array_view.h"
 #include "common_video/h264/h264_common.h"
 #include "modules/rtp_rtcp/source/frame_object.h"
+#include "modules/rtp_rtcp/source/rtp_packet_received.h"
 #include "rtc_base/numerics/sequence_number_unwrapper.h"
 #include "rtc_base/random.h"
 #include "test/field_trial.h"
@@ -30,6 +32,7 @@ namespace {
 
 using ::testing::ElementsAre;
 using ::testing::ElementsAreArray;
+using ::testing::Field;
 using ::testing::IsEmpty;
 using ::testing::Matches;
 using ::testing::Pointee;
@@ -154,6 +157,48 @@ TEST_F(PacketBufferTest, InsertDuplicatePacket) {
               SizeIs(2));
 }
 
+TEST_F(PacketBufferTest, CreatePacketReusesReturnedPackets) {
+  RtpPacketReceived rtp_packet;
+  rtp_packet.SetSequenceNumber(100);
+  rtp_packet.SetTimestamp(1000);
+  rtp_packet.SetPayloadType(96);
+  RTPVideoHeader video_header;
+  video_header.codec = kVideoCodecGeneric;
+  video_header.is_first_packet_in_frame = true;
+  video_header.is_last_packet_in_frame = true;
+
+  std::unique_ptr<PacketBuffer::Packet> packet =
+      packet_buffer_.CreatePacket(rtp_packet, 100, video_header);
+  packet->times_nacked = 2;
+  packet->video_payload = rtc::CopyOnWriteBuffer(10);
+  const PacketBuffer::Packet* const first_packet = packet.get();
+  PacketBuffer::InsertResult result =
+      packet_buffer_.InsertPacket(std::move(packet));
+  ASSERT_THAT(result.packets,
+              ElementsAre(Pointee(
+                  Field(&PacketBuffer::Packet::sequence_number, 100))));
+  packet_buffer_.ReturnPackets(std::move(result.packets));
+
+  rtp_packet.SetSequenceNumber(101);
+  rtp_packet.SetTimestamp(2000);
+  rtp_packet.SetMarker(true);
+  video_header.codec = kVideoCodecVP8;
+  packet = packet_buffer_.CreatePacket(rtp_packet, 101, video_header);
+  EXPECT_EQ(packet.get(), first_packet);
+  EXPECT_FALSE(packet->continuous);
+  EXPECT_TRUE(packet->marker_bit);
+  EXPECT_EQ(packet->payload_type, 96);
+  EXPECT_EQ(packet->sequence_number, 101);
+  EXPECT_EQ(packet->timestamp, 2000u);
+  EXPECT_EQ(packet->times_nacked, -1);
+  EXPECT_EQ(packet->codec(), kVideoCodecVP8);
+  EXPECT_THAT(packet->video_payload, IsEmpty());
+
+  // Only one packet was returned.
+  EXPECT_NE(packet_buffer_.CreatePacket(rtp_packet, 101, video_header).get(),
+            first_packet);
+}
+
 TEST_F(PacketBufferTest, SeqNumWrapOneFrame) {
   Insert(0xFFFF, kKeyFrame, kFirst, kNotLast);
   EXPECT_THAT(Insert(0x1'0000, kKeyFrame, kNotFirst, kLast),
@@ -76,12 +76,10 @@ void BasicIceController::SetSelectedConnection(
 
 void BasicIceController::AddConnection(const Connection* connection) {
   connections_.push_back(connection);
-  unpinged_connections_.insert(connection);
 }
 
 void BasicIceController::OnConnectionDestroyed(const Connection* connection) {
   pinged_connections_.erase(connection);
-  unpinged_connections_.erase(connection);
   connections_.erase(absl::c_find(connections_, connection));
   if (selected_connection_ == connection)
     selected_connection_ = nullptr;
@@ -117,8 +115,8 @@ IceControllerInterface::PingResult BasicIceController::SelectConnectionToPing(
 }
 
 void BasicIceController::MarkConnectionPinged(const Connection* conn) {
-  if (conn && pinged_connections_.insert(conn).second) {
-    unpinged_connections_.erase(conn);
+  if (conn) {
+    pinged_connections_.insert(conn);
   }
 }
 
@@ -169,40 +167,30 @@ const Connection* BasicIceController::FindNextPingableConnection() {
   }
 
   // Rule 4: Unpinged connections have priority over pinged ones.
-  RTC_CHECK(connections_.size() ==
-            pinged_connections_.size() + unpinged_connections_.size());
-  // If there are unpinged and pingable connections, only ping those.
-  // Otherwise, treat everything as unpinged.
-  // TODO(honghaiz): Instead of adding two separate vectors, we can add a state
-  // "pinged" to filter out unpinged connections.
-  if (absl::c_none_of(unpinged_connections_,
-                      [this, now](const Connection* conn) {
-                        return this->IsPingable(conn, now);
-                      })) {
-    unpinged_connections_.insert(pinged_connections_.begin(),
-                                 pinged_connections_.end());
-    pinged_connections_.clear();
-  }
-
   // Among un-pinged pingable connections, "more pingable" takes precedence.
-  std::vector<const Connection*> pingable_connections;
-  absl::c_copy_if(
-      unpinged_connections_, std::back_inserter(pingable_connections),
-      [this, now](const Connection* conn) { return IsPingable(conn, now); });
-  auto iter = absl::c_max_element(
-      pingable_connections,
-      [this](const Connection* conn1, const Connection* conn2) {
-        // Some implementations of max_element
-        // compare an element with itself.
-        if (conn1 == conn2) {
-          return false;
-        }
-        return MorePingable(conn1, conn2) == conn2;
-      });
-  if (iter != pingable_connections.end()) {
-    return *iter;
+  // `connections_` is scanned in order, so that ties go to the connection that
+  // comes first.
+  RTC_DCHECK_LE(pinged_connections_.size(), connections_.size());
+  auto find_most_pingable = [&] {
+    const Connection* most_pingable = nullptr;
+    for (const Connection* conn : connections_) {
+      if (pinged_connections_.contains(conn) || !IsPingable(conn, now)) {
+        continue;
+      }
+      if (!most_pingable || MorePingable(most_pingable, conn) == conn) {
+        most_pingable = conn;
+      }
+    }
+    return most_pingable;
+  };
+  const Connection* most_pingable = find_most_pingable();
+  // If there are no unpinged and pingable connections, treat everything as
+  // unpinged.
+  if (!most_pingable && !pinged_connections_.empty()) {
+    pinged_connections_.clear();
+    most_pingable = find_most_pingable();
   }
-  return nullptr;
+  return most_pingable;
 }
 
 // Find "triggered checks".  We ping first those connections that have
@@ -342,11 +330,7 @@ const Connection* BasicIceController::MorePingable(const Connection* conn1,
 
   // During the initial state when nothing has been pinged yet, return the first
   // one in the ordered `connections_`.
-  auto connections = connections_;
-  return *(std::find_if(connections.begin(), connections.end(),
-                        [conn1, conn2](const Connection* conn) {
-                          return conn == conn1 || conn == conn2;
-                        }));
+  return conn1;
 }
 
 const Connection* BasicIceController::MostLikelyToWork(
@@ -529,15 +513,33 @@ BasicIceController::SortAndSwitchConnection(IceSwitchReason reason) {
   // one whose estimated latency is lowest.  So it is the only one that we
   // need to consider switching to.
   // TODO(honghaiz): Don't sort;  Just use std::max_element in the right places.
-  absl::c_stable_sort(
-      connections_, [this](const Connection* a, const Connection* b) {
-        int cmp = CompareConnections(a, b, std::nullopt, nullptr);
-        if (cmp != 0) {
-          return cmp > 0;
-        }
-        // Otherwise, sort based on latency estimate.
-        return a->rtt() < b->rtt();
-      });
+  auto better = [this](const Connection* a, const Connection* b) {
+    int cmp = CompareConnections(a, b, std::nullopt, nullptr);
+    if (cmp != 0) {
+      return cmp > 0;
+    }
+    // Otherwise, sort based on latency estimate.
+    return a->rtt() < b->rtt();
+  };
+  // `connections_` was sorted the last time, and usually only a few
+  // connections have changed since. Set aside the connections that are better
+  // than the one before them, sort only those and merge them back in. This
+  // gives the same order as a stable sort of all connections.
+  std::vector<const Connection*> displaced;
+  size_t in_order = 0;
+  for (const Connection* conn : connections_) {
+    if (in_order > 0 && better(conn, connections_[in_order - 1])) {
+      displaced.push_back(conn);
+    } else {
+      connections_[in_order++] = conn;
+    }
+  }
+  if (!displaced.empty()) {
+    absl::c_stable_sort(displaced, better);
+    absl::c_copy(displaced, connections_.begin() + in_order);
+    std::inplace_merge(connections_.begin(), connections_.begin() + in_order,
+                       connections_.end(), better);
+  }
 
   RTC_LOG(LS_VERBOSE) << "Sorting " << connections_.size()
                       << " available connections due to: "
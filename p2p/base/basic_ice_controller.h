@@ -13,10 +13,10 @@
 
 #include <algorithm>
 #include <map>
-#include <set>
 #include <utility>
 #include <vector>
 
+#include "absl/container/flat_hash_set.h"
 #include "p2p/base/ice_controller_factory_interface.h"
 #include "p2p/base/ice_controller_interface.h"
 
@@ -82,7 +82,7 @@ class BasicIceController : public IceControllerInterface {
 
   const Connection* FindOldestConnectionNeedingTriggeredCheck(int64_t now);
   // Between `conn1` and `conn2`, this function returns the one which should
-  // be pinged first.
+  // be pinged first. `conn1` must come before `conn2` in `connections_`.
   const Connection* MorePingable(const Connection* conn1,
                                  const Connection* conn2);
   // Select the connection which is Relay/Relay. If both of them are,
@@ -149,14 +149,12 @@ class BasicIceController : public IceControllerInterface {
   const IceFieldTrials* field_trials_;
 
   // `connections_` is a sorted list with the first one always be the
-  // `selected_connection_` when it's not nullptr. The combination of
-  // `pinged_connections_` and `unpinged_connections_` has the same
-  // connections as `connections_`. These 2 sets maintain whether a
-  // connection should be pinged next or not.
+  // `selected_connection_` when it's not nullptr. `pinged_connections_` holds
+  // the connections in `connections_` that have been pinged since all
+  // pingable connections were last pinged; the others are pinged first.
   const Connection* selected_connection_ = nullptr;
   std::vector<const Connection*> connections_;
-  std::set<const Connection*> pinged_connections_;
-  std::set<const Connection*> unpinged_connections_;
+  absl::flat_hash_set<const Connection*> pinged_connections_;
 
   // Timestamp for when we got the first selectable connection.
   int64_t initial_select_timestamp_ms_ = 0;
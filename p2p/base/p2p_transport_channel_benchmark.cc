@@ -0,0 +1,158 @@
+/*
+ *  Copyright 2025 The WebRTC Project Authors. All rights reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <memory>
+#include <utility>
+
+#include "api/candidate.h"
+#include "api/ice_transport_interface.h"
+#include "api/units/time_delta.h"
+#include "benchmark/benchmark.h"
+#include "p2p/base/basic_packet_socket_factory.h"
+#include "p2p/base/connection.h"
+#include "p2p/base/ice_transport_internal.h"
+#include "p2p/base/p2p_transport_channel.h"
+#include "p2p/base/port_allocator.h"
+#include "p2p/base/transport_description.h"
+#include "p2p/client/basic_port_allocator.h"
+#include "rtc_base/checks.h"
+#include "rtc_base/fake_clock.h"
+#include "rtc_base/fake_network.h"
+#include "rtc_base/firewall_socket_server.h"
+#include "rtc_base/ip_address.h"
+#include "rtc_base/socket_address.h"
+#include "rtc_base/thread.h"
+#include "rtc_base/third_party/sigslot/sigslot.h"
+#include "rtc_base/time_utils.h"
+#include "rtc_base/virtual_socket_server.h"
+
+namespace cricket {
+namespace {
+
+constexpr int64_t kTimeoutMs = 600'000;
+
+const IceParameters kIceParams[2] = {
+    {"UF00", "TESTICEPWD00000000000000", false},
+    {"UF01", "TESTICEPWD00000000000001", false}};
+
+// One side of the call, with a host candidate on each of its interfaces.
+class Endpoint : public sigslot::has_slots<> {
+ public:
+  Endpoint(rtc::PacketSocketFactory* socket_factory, int index) {
+    allocator_ =
+        std::make_unique<BasicPortAllocator>(&network_manager_, socket_factory);
+    allocator_->Initialize();
+    allocator_->set_flags(PORTALLOCATOR_DISABLE_STUN |
+                          PORTALLOCATOR_DISABLE_RELAY |
+                          PORTALLOCATOR_DISABLE_TCP);
+    allocator_->set_step_delay(kMinimumStepDelay);
+
+    webrtc::IceTransportInit init;
+    init.set_port_allocator(allocator_.get());
+    channel_ = P2PTransportChannel::Create("benchmark",
+                                           ICE_CANDIDATE_COMPONENT_DEFAULT,
+                                           std::move(init));
+    channel_->SetIceRole(index == 0 ? ICEROLE_CONTROLLING : ICEROLE_CONTROLLED);
+    channel_->SetIceParameters(kIceParams[index]);
+    channel_->SetRemoteIceParameters(kIceParams[1 - index]);
+    channel_->SignalCandidateGathered.connect(this,
+                                              &Endpoint::OnCandidateGathered);
+  }
+
+  void AddInterface(const rtc::SocketAddress& address) {
+    network_manager_.AddInterface(address);
+  }
+
+  void Start(Endpoint* peer) {
+    peer_ = peer;
+    channel_->MaybeStartGathering();
+  }
+
+  bool connected() const {
+    const Connection* selected = channel_->selected_connection();
+    return selected && selected->writable();
+  }
+  size_t num_connections() const { return channel_->connections().size(); }
+
+ private:
+  void OnCandidateGathered(IceTransportInternal* /* transport */,
+                           const Candidate& candidate) {
+    peer_->channel_->AddRemoteCandidate(candidate);
+  }
+
+  rtc::FakeNetworkManager network_manager_;
+  std::unique_ptr<BasicPortAllocator> allocator_;
+  std::unique_ptr<P2PTransportChannel> channel_;
+  Endpoint* peer_ = nullptr;
+};
+
+// Each endpoint has `state.range(0)` interfaces, which gives the square of
+// that many candidate pairs. Only the first interface of each endpoint can
+// reach the other endpoint, so one pair works. The benchmark measures the
+// CPU time for both endpoints to select it, and reports the simulated time
+// it took.
+void BM_TimeToSelectedPair(benchmark::State& state) {
+  const int num_interfaces = static_cast<int>(state.range(0));
+  int64_t total_sim_time_ms = 0;
+  size_t num_pairs = 0;
+  for (auto _ : state) {
+    rtc::ScopedFakeClock clock;
+    clock.AdvanceTime(webrtc::TimeDelta::Seconds(1));
+    rtc::VirtualSocketServer virtual_socket_server;
+    rtc::FirewallSocketServer firewall(&virtual_socket_server);
+    rtc::AutoSocketServerThread thread(&firewall);
+    rtc::BasicPacketSocketFactory socket_factory(&firewall);
+    {
+      Endpoint caller(&socket_factory, 0);
+      Endpoint callee(&socket_factory, 1);
+      for (int i = 0; i < num_interfaces; ++i) {
+        rtc::SocketAddress caller_address(
+            rtc::IPAddress((10u << 24) | (i << 8) | 1), 0);
+        rtc::SocketAddress callee_address(
+            rtc::IPAddress((10u << 24) | (1 << 16) | (i << 8) | 1), 0);
+        caller.AddInterface(caller_address);
+        callee.AddInterface(callee_address);
+        if (i > 0) {
+          firewall.AddRule(false, rtc::FP_ANY, rtc::FD_ANY, caller_address);
+          firewall.AddRule(false, rtc::FP_ANY, rtc::FD_ANY, callee_address);
+        }
+      }
+
+      int64_t start_ms = rtc::TimeMillis();
+      caller.Start(&callee);
+      callee.Start(&caller);
+      while (!(caller.connected() && callee.connected()) &&
+             rtc::TimeMillis() < start_ms + kTimeoutMs) {
+        clock.AdvanceTime(webrtc::TimeDelta::Millis(1));
+      }
+      RTC_CHECK(caller.connected() && callee.connected());
+      total_sim_time_ms += rtc::TimeMillis() - start_ms;
+      num_pairs = caller.num_connections();
+    }
+    // Run the pending deletion of the connections.
+    thread.ProcessMessages(0);
+  }
+  state.counters["pairs"] = num_pairs;
+  state.counters["sim_ms_to_selected_pair"] =
+      static_cast<double>(total_sim_time_ms) / state.iterations();
+}
+
+BENCHMARK(BM_TimeToSelectedPair)
+    ->Unit(benchmark::kMillisecond)
+    ->Arg(4)
+    ->Arg(8)
+    ->Arg(16)
+    ->Arg(32);
+
+}  // namespace
+}  // namespace cricket
@@ -10,6 +10,10 @@
 
 #include "p2p/base/packet_transport_internal.h"
 
+#include <algorithm>
+#include <optional>
+#include <utility>
+
 #include "api/sequence_checker.h"
 #include "rtc_base/network/received_packet.h"
 
@@ -34,11 +38,16 @@ void PacketTransportInternal::RegisterReceivedPacketCallback(
                             const rtc::ReceivedPacket&)> callback) {
   RTC_DCHECK_RUN_ON(&network_checker_);
   received_packet_callback_list_.AddReceiver(id, std::move(callback));
+  received_packet_callback_ids_.push_back(id);
 }
 
 void PacketTransportInternal::DeregisterReceivedPacketCallback(void* id) {
   RTC_DCHECK_RUN_ON(&network_checker_);
   received_packet_callback_list_.RemoveReceivers(id);
+  received_packet_callback_ids_.erase(
+      std::remove(received_packet_callback_ids_.begin(),
+                  received_packet_callback_ids_.end(), id),
+      received_packet_callback_ids_.end());
 }
 
 void PacketTransportInternal::SetOnCloseCallback(
@@ -51,6 +60,15 @@ void PacketTransportInternal::SetOnCloseCallback(
 void PacketTransportInternal::NotifyPacketReceived(
     const rtc::ReceivedPacket& packet) {
   RTC_DCHECK_RUN_ON(&network_checker_);
+  if (packet.has_payload_buffer() && received_packet_callback_ids_.size() > 1) {
+    // A receiver that took the payload buffer could modify or free the payload
+    // while the other receivers still read it.
+    received_packet_callback_list_.Send(
+        this, rtc::ReceivedPacket(packet.payload(), packet.source_address(),
+                                  packet.arrival_time(), packet.ecn(),
+                                  packet.decryption_info()));
+    return;
+  }
   received_packet_callback_list_.Send(this, packet);
 }
 
@@ -82,7 +82,9 @@ class RTC_EXPORT PacketTransportInternal : public sigslot::has_slots<> {
   // Emitted when receiving state changes to true.
   sigslot::signal1<PacketTransportInternal*> SignalReceivingState;
 
-  // Callback is invoked each time a packet is received on this channel.
+  // Callback is invoked each time a packet is received on this channel. If more
+  // than one callback is registered, the packets they get are not backed by a
+  // payload buffer that can be taken, see rtc::ReceivedPacket::TakePayload().
   void RegisterReceivedPacketCallback(
       void* id,
       absl::AnyInvocable<void(PacketTransportInternal*,
@@ -112,6 +114,10 @@ class RTC_EXPORT PacketTransportInternal : public sigslot::has_slots<> {
  private:
   webrtc::CallbackList<PacketTransportInternal*, const rtc::ReceivedPacket&>
       received_packet_callback_list_ RTC_GUARDED_BY(&network_checker_);
+  // Ids of the callbacks in `received_packet_callback_list_`, one entry per
+  // callback.
+  std::vector<const void*> received_packet_callback_ids_
+      RTC_GUARDED_BY(&network_checker_);
   absl::AnyInvocable<void() &&> on_close_;
 };
 
@@ -0,0 +1,132 @@
+/*
+ *  Copyright 2025 The WebRTC Project Authors. All rights reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "p2p/base/sharded_turn_server.h"
+
+#include <stddef.h>
+
+#include <memory>
+#include <vector>
+
+#include "p2p/base/basic_packet_socket_factory.h"
+#include "p2p/base/port_interface.h"
+#include "rtc_base/async_udp_socket.h"
+#include "rtc_base/checks.h"
+#include "rtc_base/logging.h"
+#include "rtc_base/socket.h"
+#include "rtc_base/socket_address.h"
+#include "rtc_base/thread.h"
+
+namespace cricket {
+
+namespace {
+
+int NumShards(int requested_num_shards) {
+#if defined(WEBRTC_LINUX) || defined(WEBRTC_ANDROID)
+  return requested_num_shards;
+#else
+  if (requested_num_shards > 1) {
+    RTC_LOG(LS_WARNING) << "SO_REUSEPORT does not balance load on this "
+                           "platform, running one TURN shard.";
+  }
+  return 1;
+#endif
+}
+
+}  // namespace
+
+ShardedTurnServer::ShardedTurnServer(const Config& config)
+    : config_(config), internal_address_(config.internal_address) {
+  RTC_DCHECK_GT(config_.num_shards, 0);
+}
+
+ShardedTurnServer::~ShardedTurnServer() {
+  Stop();
+}
+
+bool ShardedTurnServer::Start() {
+  RTC_DCHECK(shards_.empty());
+  shards_.resize(NumShards(config_.num_shards));
+  for (Shard& shard : shards_) {
+    shard.thread = rtc::Thread::CreateWithSocketServer();
+    shard.thread->SetName("TurnShard", nullptr);
+    shard.thread->Start();
+    if (!StartShard(shard)) {
+      Stop();
+      return false;
+    }
+  }
+  RTC_LOG(LS_INFO) << "Started " << shards_.size() << " TURN shards at "
+                   << internal_address_.ToString();
+  return true;
+}
+
+void ShardedTurnServer::Stop() {
+  for (Shard& shard : shards_) {
+    if (!shard.thread) {
+      continue;
+    }
+    if (shard.server) {
+      shard.thread->BlockingCall([&] { shard.server = nullptr; });
+    }
+    shard.thread->Stop();
+  }
+  shards_.clear();
+}
+
+std::vector<size_t> ShardedTurnServer::GetAllocationCounts() const {
+  std::vector<size_t> counts;
+  for (const Shard& shard : shards_) {
+    counts.push_back(shard.thread->BlockingCall(
+        [&] { return shard.server->allocations().size(); }));
+  }
+  return counts;
+}
+
+bool ShardedTurnServer::StartShard(Shard& shard) {
+  return shard.thread->BlockingCall([&] {
+    rtc::SocketServer* socket_server = shard.thread->socketserver();
+    std::unique_ptr<rtc::Socket> socket(socket_server->CreateSocket(
+        internal_address_.family(), SOCK_DGRAM));
+    if (!socket) {
+      return false;
+    }
+    if (shards_.size() > 1 &&
+        socket->SetOption(rtc::Socket::OPT_REUSEPORT, 1) < 0) {
+      RTC_LOG(LS_ERROR) << "SO_REUSEPORT is not supported";
+      return false;
+    }
+    if (socket->Bind(internal_address_) < 0) {
+      RTC_LOG(LS_ERROR) << "Failed to bind a TURN shard at "
+                        << internal_address_.ToString()
+                        << ", error=" << socket->GetError();
+      return false;
+    }
+    // The first shard may pick the port, the others bind to the same one.
+    internal_address_ = socket->GetLocalAddress();
+
+    shard.server = std::make_unique<TurnServer>(shard.thread.get());
+    shard.server->set_realm(config_.realm);
+    shard.server->set_software(config_.software);
+    shard.server->set_auth_hook(config_.auth_hook);
+    shard.server->set_reject_private_addresses(
+        config_.reject_private_addresses);
+    shard.server->set_enable_permission_checks(
+        config_.enable_permission_checks);
+    shard.server->AddInternalSocket(new rtc::AsyncUDPSocket(socket.release()),
+                                    PROTO_UDP);
+    shard.server->SetExternalSocketFactory(
+        new rtc::BasicPacketSocketFactory(socket_server),
+        rtc::SocketAddress(config_.external_ip, 0));
+    return true;
+  });
+}
+
+}  // namespace cricket
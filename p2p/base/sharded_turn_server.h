@@ -0,0 +1,92 @@
+/*
+ *  Copyright 2025 The WebRTC Project Authors. All rights reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef P2P_BASE_SHARDED_TURN_SERVER_H_
+#define P2P_BASE_SHARDED_TURN_SERVER_H_
+
+#include <stddef.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "p2p/base/turn_server.h"
+#include "rtc_base/ip_address.h"
+#include "rtc_base/socket_address.h"
+#include "rtc_base/thread.h"
+
+namespace cricket {
+
+// A UDP TURN server that relays on several threads. Each shard is a
+// TurnServer running on its own network thread, with its own UDP socket bound
+// to the shared internal address with SO_REUSEPORT. The kernel spreads the
+// clients over these sockets by a hash of their 5-tuple, so a client's
+// allocation lives on one shard, and is looked up and relayed without locks
+// or thread hops. The relayed sockets of an allocation are created on its
+// shard, so packets from peers are received there as well.
+//
+// Only Linux and Android balance the datagrams of SO_REUSEPORT sockets over
+// the sockets. Other platforms, where the last bound socket may get all of
+// them, run a single shard.
+class ShardedTurnServer {
+ public:
+  struct Config {
+    // Ignored, and one shard is run, unless on Linux or Android.
+    int num_shards = 1;
+    // UDP address the clients send to. The port may be 0, in which case one
+    // is picked, see internal_address().
+    rtc::SocketAddress internal_address;
+    // Address the relayed sockets are bound to.
+    rtc::IPAddress external_ip;
+    std::string realm;
+    std::string software;
+    // Called concurrently from all shards, so must be thread-safe. Not owned.
+    TurnAuthInterface* auth_hook = nullptr;
+    bool reject_private_addresses = false;
+    bool enable_permission_checks = true;
+  };
+
+  explicit ShardedTurnServer(const Config& config);
+  ShardedTurnServer(const ShardedTurnServer&) = delete;
+  ShardedTurnServer& operator=(const ShardedTurnServer&) = delete;
+  ~ShardedTurnServer();
+
+  // Starts the shards. Returns false if the internal sockets could not be
+  // bound, e.g. because SO_REUSEPORT is not supported by the kernel.
+  bool Start();
+  // Stops the shards, destroying their allocations.
+  void Stop();
+
+  // The address the shards are bound to, once started.
+  const rtc::SocketAddress& internal_address() const {
+    return internal_address_;
+  }
+  int num_shards() const { return static_cast<int>(shards_.size()); }
+  // The number of allocations of each shard.
+  std::vector<size_t> GetAllocationCounts() const;
+
+ private:
+  struct Shard {
+    std::unique_ptr<rtc::Thread> thread;
+    std::unique_ptr<TurnServer> server;
+  };
+
+  // Creates the socket and server of `shard` on its thread, bound to
+  // `internal_address_`. Returns false if the socket could not be bound.
+  bool StartShard(Shard& shard);
+
+  const Config config_;
+  rtc::SocketAddress internal_address_;
+  std::vector<Shard> shards_;
+};
+
+}  // namespace cricket
+
+#endif  // P2P_BASE_SHARDED_TURN_SERVER_H_
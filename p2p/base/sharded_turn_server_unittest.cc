@@ -0,0 +1,83 @@
+/*
+ *  Copyright 2025 The WebRTC Project Authors. All rights reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "p2p/base/sharded_turn_server.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "absl/memory/memory.h"
+#include "api/transport/stun.h"
+#include "rtc_base/async_udp_socket.h"
+#include "rtc_base/byte_buffer.h"
+#include "rtc_base/physical_socket_server.h"
+#include "rtc_base/socket_address.h"
+#include "rtc_base/test_client.h"
+#include "rtc_base/thread.h"
+#include "test/gtest.h"
+
+namespace cricket {
+namespace {
+
+#if defined(WEBRTC_LINUX) || defined(WEBRTC_ANDROID)
+constexpr int kExpectedNumShards = 4;
+#else
+// SO_REUSEPORT does not balance load, so only one shard is run.
+constexpr int kExpectedNumShards = 1;
+#endif
+
+TEST(ShardedTurnServerTest, AllShardsAnswerBindingRequests) {
+  rtc::PhysicalSocketServer socket_server;
+  rtc::AutoSocketServerThread main_thread(&socket_server);
+
+  ShardedTurnServer::Config config;
+  config.num_shards = 4;
+  config.internal_address = rtc::SocketAddress("127.0.0.1", 0);
+  config.external_ip = rtc::IPAddress(INADDR_LOOPBACK);
+  ShardedTurnServer server(config);
+  if (!server.Start()) {
+    GTEST_SKIP() << "SO_REUSEPORT is not supported";
+  }
+  EXPECT_EQ(server.num_shards(), kExpectedNumShards);
+  EXPECT_NE(server.internal_address().port(), 0);
+
+  // The kernel spreads the clients over the shards by their address, so with
+  // this many clients every shard answers some of them.
+  for (int i = 0; i < 32; ++i) {
+    rtc::TestClient client(absl::WrapUnique(rtc::AsyncUDPSocket::Create(
+        &socket_server, rtc::SocketAddress("127.0.0.1", 0))));
+    StunMessage request(STUN_BINDING_REQUEST, "0123456789ab");
+    rtc::ByteBufferWriter buf;
+    request.Write(&buf);
+    client.SendTo(reinterpret_cast<const char*>(buf.Data()), buf.Length(),
+                  server.internal_address());
+
+    std::unique_ptr<rtc::TestClient::Packet> packet =
+        client.NextPacket(rtc::TestClient::kTimeoutMs);
+    ASSERT_TRUE(packet);
+    StunMessage response;
+    rtc::ByteBufferReader reader(packet->buf);
+    ASSERT_TRUE(response.Read(&reader));
+    EXPECT_EQ(response.type(), STUN_BINDING_RESPONSE);
+    const StunAddressAttribute* mapped_address =
+        response.GetAddress(STUN_ATTR_XOR_MAPPED_ADDRESS);
+    ASSERT_TRUE(mapped_address);
+    EXPECT_EQ(mapped_address->GetAddress(), client.address());
+  }
+
+  std::vector<size_t> allocation_counts = server.GetAllocationCounts();
+  EXPECT_EQ(allocation_counts, std::vector<size_t>(kExpectedNumShards, 0));
+  server.Stop();
+  EXPECT_EQ(server.num_shards(), 0);
+}
+
+}  // namespace
+}  // namespace cricket
@@ -10,19 +10,36 @@
 
 #include "p2p/base/stun_server.h"
 
+#include <string.h>
+
 #include <string>
 #include <utility>
 
 #include "absl/strings/string_view.h"
+#include "api/array_view.h"
 #include "api/sequence_checker.h"
 #include "rtc_base/async_packet_socket.h"
 #include "rtc_base/byte_buffer.h"
+#include "rtc_base/byte_order.h"
+#include "rtc_base/crc32.h"
+#include "rtc_base/ip_address.h"
 #include "rtc_base/logging.h"
 #include "rtc_base/network/received_packet.h"
 
 namespace cricket {
 
-StunServer::StunServer(rtc::AsyncUDPSocket* socket) : socket_(socket) {
+namespace {
+
+// Offset of the magic cookie, followed by the transaction ID. Legacy (RFC
+// 3489) messages have a 16 byte transaction ID here instead.
+constexpr size_t kStunMagicCookieOffset = 4;
+constexpr size_t kStunFingerprintAttrSize = kStunAttributeHeaderSize + 4;
+
+}  // namespace
+
+StunServer::StunServer(rtc::AsyncUDPSocket* socket,
+                       bool fast_binding_responses)
+    : socket_(socket), fast_binding_responses_(fast_binding_responses) {
   socket_->RegisterReceivedPacketCallback(
       [&](rtc::AsyncPacketSocket* socket, const rtc::ReceivedPacket& packet) {
         OnPacket(socket, packet);
@@ -37,6 +54,10 @@ StunServer::~StunServer() {
 void StunServer::OnPacket(rtc::AsyncPacketSocket* socket,
                           const rtc::ReceivedPacket& packet) {
   RTC_DCHECK_RUN_ON(&sequence_checker_);
+  if (fast_binding_responses_ && SendFastBindingResponse(packet)) {
+    return;
+  }
+
   // Parse the STUN message; eat any messages that fail to parse.
   rtc::ByteBufferReader bbuf(packet.payload());
   StunMessage msg;
@@ -64,9 +85,108 @@ void StunServer::OnBindingRequest(StunMessage* msg,
                                   const rtc::SocketAddress& remote_addr) {
   StunMessage response(STUN_BINDING_RESPONSE, msg->transaction_id());
   GetStunBindResponse(msg, remote_addr, &response);
+  if (!msg->IsLegacy() && msg->GetUInt32(STUN_ATTR_FINGERPRINT)) {
+    response.AddFingerprint();
+  }
   SendResponse(response, remote_addr);
 }
 
+bool StunServer::SendFastBindingResponse(const rtc::ReceivedPacket& packet) {
+  rtc::ArrayView<const uint8_t> request = packet.payload();
+  if (request.size() < kStunHeaderSize ||
+      rtc::GetBE16(request.data()) != STUN_BINDING_REQUEST ||
+      rtc::GetBE16(&request[2]) != request.size() - kStunHeaderSize) {
+    return false;
+  }
+
+  // Check that the attributes are framed correctly, and whether the last one
+  // is a FINGERPRINT. Their values are not needed.
+  bool has_fingerprint = false;
+  size_t pos = kStunHeaderSize;
+  while (pos < request.size()) {
+    if (request.size() - pos < kStunAttributeHeaderSize) {
+      return false;
+    }
+    uint16_t attr_type = rtc::GetBE16(&request[pos]);
+    size_t attr_length = rtc::GetBE16(&request[pos + 2]);
+    size_t padded_length = (attr_length + 3) & ~size_t{3};
+    pos += kStunAttributeHeaderSize;
+    if (request.size() - pos < padded_length) {
+      return false;
+    }
+    pos += padded_length;
+    has_fingerprint = attr_type == STUN_ATTR_FINGERPRINT && attr_length == 4;
+  }
+
+  const rtc::SocketAddress& remote_addr = packet.source_address();
+  const rtc::IPAddress& ip = remote_addr.ipaddr();
+  uint8_t family;
+  size_t ip_size;
+  if (ip.family() == AF_INET) {
+    family = STUN_ADDRESS_IPV4;
+    ip_size = sizeof(in_addr);
+  } else if (ip.family() == AF_INET6) {
+    family = STUN_ADDRESS_IPV6;
+    ip_size = sizeof(in6_addr);
+  } else {
+    return false;
+  }
+  const bool legacy = rtc::GetBE32(&request[kStunMagicCookieOffset]) !=
+                      kStunMagicCookie;
+  has_fingerprint &= !legacy;
+
+  // The response starts with the magic cookie and transaction ID, or the
+  // legacy transaction ID, of the request.
+  const size_t address_attr_size = kStunAttributeHeaderSize + 4 + ip_size;
+  const size_t size = kStunHeaderSize + address_attr_size +
+                      (has_fingerprint ? kStunFingerprintAttrSize : 0);
+  RTC_DCHECK_LE(size, fast_response_.size());
+  uint8_t* response = fast_response_.data();
+  rtc::SetBE16(response, STUN_BINDING_RESPONSE);
+  rtc::SetBE16(&response[2], static_cast<uint16_t>(size - kStunHeaderSize));
+  memcpy(&response[kStunMagicCookieOffset], &request[kStunMagicCookieOffset],
+         kStunHeaderSize - kStunMagicCookieOffset);
+
+  // The MAPPED-ADDRESS, or the XOR-MAPPED-ADDRESS, whose address is XOR-ed
+  // with the magic cookie and transaction ID, i.e. the same header bytes.
+  uint8_t* attr = &response[kStunHeaderSize];
+  rtc::SetBE16(attr, legacy ? STUN_ATTR_MAPPED_ADDRESS
+                            : STUN_ATTR_XOR_MAPPED_ADDRESS);
+  rtc::SetBE16(&attr[2], static_cast<uint16_t>(4 + ip_size));
+  attr[4] = 0;
+  attr[5] = family;
+  uint16_t port = remote_addr.port();
+  uint8_t* attr_ip = &attr[8];
+  if (family == STUN_ADDRESS_IPV4) {
+    in_addr v4addr = ip.ipv4_address();
+    memcpy(attr_ip, &v4addr, ip_size);
+  } else {
+    in6_addr v6addr = ip.ipv6_address();
+    memcpy(attr_ip, &v6addr, ip_size);
+  }
+  if (!legacy) {
+    port ^= kStunMagicCookie >> 16;
+    for (size_t i = 0; i < ip_size; ++i) {
+      attr_ip[i] ^= request[kStunMagicCookieOffset + i];
+    }
+  }
+  rtc::SetBE16(&attr[6], port);
+
+  if (has_fingerprint) {
+    size_t crc_size = kStunHeaderSize + address_attr_size;
+    uint8_t* fingerprint = &response[crc_size];
+    rtc::SetBE16(fingerprint, STUN_ATTR_FINGERPRINT);
+    rtc::SetBE16(&fingerprint[2], 4);
+    rtc::SetBE32(&fingerprint[4], rtc::ComputeCrc32(response, crc_size) ^
+                                      STUN_FINGERPRINT_XOR_VALUE);
+  }
+
+  rtc::PacketOptions options;
+  if (socket_->SendTo(response, size, remote_addr, options) < 0)
+    RTC_LOG_ERR(LS_ERROR) << "sendto";
+  return true;
+}
+
 void StunServer::SendErrorResponse(const StunMessage& msg,
                                    const rtc::SocketAddress& addr,
                                    int error_code,
@@ -12,14 +12,18 @@
 #define P2P_BASE_STUN_SERVER_H_
 
 #include <stddef.h>
+#include <stdint.h>
 
+#include <array>
 #include <memory>
 
 #include "absl/strings/string_view.h"
 #include "api/transport/stun.h"
 #include "rtc_base/async_packet_socket.h"
 #include "rtc_base/async_udp_socket.h"
+#include "rtc_base/network/received_packet.h"
 #include "rtc_base/socket_address.h"
+#include "rtc_base/thread_annotations.h"
 
 namespace cricket {
 
@@ -28,7 +32,14 @@ const int STUN_SERVER_PORT = 3478;
 class StunServer {
  public:
   // Creates a STUN server, which will listen on the given socket.
-  explicit StunServer(rtc::AsyncUDPSocket* socket);
+  //
+  // With `fast_binding_responses`, Binding requests are answered straight
+  // from the received bytes: the request is validated in place, without being
+  // parsed into a StunMessage, and the response is written into a buffer
+  // owned by the server. The response is the same as the one built by
+  // OnBindingRequest(), which is therefore not called for such requests.
+  explicit StunServer(rtc::AsyncUDPSocket* socket,
+                      bool fast_binding_responses = true);
   // Removes the STUN server from the socket and deletes the socket.
   virtual ~StunServer();
 
@@ -37,6 +48,10 @@ class StunServer {
   void OnPacket(rtc::AsyncPacketSocket* socket,
                 const rtc::ReceivedPacket& packet);
 
+  // Answers `packet` if it is a well-formed Binding request. Returns false if
+  // it is anything else, and needs to be parsed by OnPacket().
+  bool SendFastBindingResponse(const rtc::ReceivedPacket& packet);
+
   // Handlers for the different types of STUN/TURN requests:
   virtual void OnBindingRequest(StunMessage* msg,
                                 const rtc::SocketAddress& addr);
@@ -59,8 +74,14 @@ class StunServer {
                            StunMessage* response) const;
 
  private:
+  // Header, XOR-MAPPED-ADDRESS of an IPv6 address and FINGERPRINT.
+  static constexpr size_t kMaxFastResponseSize = 52;
+
   webrtc::SequenceChecker sequence_checker_;
   std::unique_ptr<rtc::AsyncUDPSocket> socket_;
+  const bool fast_binding_responses_;
+  std::array<uint8_t, kMaxFastResponseSize> fast_response_
+      RTC_GUARDED_BY(sequence_checker_);
 };
 
 }  // namespace cricket
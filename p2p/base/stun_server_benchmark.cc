@@ -0,0 +1,135 @@
+/*
+ *  Copyright 2025 The WebRTC Project Authors. All rights reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <algorithm>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "api/transport/stun.h"
+#include "benchmark/benchmark.h"
+#include "p2p/base/stun_server.h"
+#include "rtc_base/async_udp_socket.h"
+#include "rtc_base/buffer.h"
+#include "rtc_base/byte_buffer.h"
+#include "rtc_base/checks.h"
+#include "rtc_base/socket.h"
+#include "rtc_base/socket_address.h"
+
+namespace cricket {
+namespace {
+
+// A socket that receives `request` from a rotating set of clients whenever
+// Deliver() is called, and counts what is sent.
+class FakeDatagramSocket : public rtc::Socket {
+ public:
+  FakeDatagramSocket(rtc::Buffer request, int num_clients)
+      : request_(std::move(request)) {
+    for (int i = 0; i < num_clients; ++i) {
+      clients_.emplace_back(rtc::IPAddress(0x0A000000 + i), 10000 + i % 50000);
+    }
+  }
+
+  void Deliver() {
+    next_client_ = (next_client_ + 1) % clients_.size();
+    SignalReadEvent(this);
+  }
+  int64_t sent_packets() const { return sent_packets_; }
+  int64_t sent_bytes() const { return sent_bytes_; }
+
+  rtc::SocketAddress GetLocalAddress() const override {
+    return rtc::SocketAddress("10.255.255.1", STUN_SERVER_PORT);
+  }
+  rtc::SocketAddress GetRemoteAddress() const override {
+    return rtc::SocketAddress();
+  }
+  int Bind(const rtc::SocketAddress& /* addr */) override { return 0; }
+  int Connect(const rtc::SocketAddress& /* addr */) override { return -1; }
+  int Send(const void* /* pv */, size_t /* cb */) override { return -1; }
+  int SendTo(const void* /* pv */,
+             size_t cb,
+             const rtc::SocketAddress& /* addr */) override {
+    ++sent_packets_;
+    sent_bytes_ += cb;
+    return static_cast<int>(cb);
+  }
+  int Recv(void* /* pv */, size_t /* cb */, int64_t* /* timestamp */) override {
+    return -1;
+  }
+  // Scatter read, like PhysicalSocket.
+  int RecvFrom(ReceiveBuffer& buffer) override {
+    RTC_CHECK_GE(buffer.head.size(), request_.size());
+    memcpy(buffer.head.data(), request_.data(), request_.size());
+    buffer.head_size = request_.size();
+    buffer.payload.Clear();
+    buffer.source_address = clients_[next_client_];
+    return static_cast<int>(request_.size());
+  }
+  int Listen(int /* backlog */) override { return -1; }
+  rtc::Socket* Accept(rtc::SocketAddress* /* paddr */) override {
+    return nullptr;
+  }
+  int Close() override { return 0; }
+  int GetError() const override { return 0; }
+  void SetError(int /* error */) override {}
+  ConnState GetState() const override { return CS_CONNECTED; }
+  int GetOption(Option /* opt */, int* /* value */) override { return -1; }
+  int SetOption(Option /* opt */, int /* value */) override { return -1; }
+
+ private:
+  const rtc::Buffer request_;
+  std::vector<rtc::SocketAddress> clients_;
+  size_t next_client_ = 0;
+  int64_t sent_packets_ = 0;
+  int64_t sent_bytes_ = 0;
+};
+
+rtc::Buffer CreateBindingRequest(bool fingerprint) {
+  StunMessage request(STUN_BINDING_REQUEST);
+  request.AddAttribute(std::make_unique<StunByteStringAttribute>(
+      STUN_ATTR_SOFTWARE, "stun_server_benchmark"));
+  if (fingerprint) {
+    request.AddFingerprint();
+  }
+  rtc::ByteBufferWriter buf;
+  request.Write(&buf);
+  return rtc::Buffer(buf.Data(), buf.Length());
+}
+
+// Arguments: fast binding responses, whether requests carry a FINGERPRINT.
+void BM_StunServerBindingRequests(benchmark::State& state) {
+  const bool fast_binding_responses = state.range(0) != 0;
+  auto* socket = new FakeDatagramSocket(
+      CreateBindingRequest(/*fingerprint=*/state.range(1) != 0),
+      /*num_clients=*/1000);
+  StunServer server(new rtc::AsyncUDPSocket(socket), fast_binding_responses);
+
+  for (auto _ : state) {
+    socket->Deliver();
+  }
+
+  RTC_CHECK_EQ(socket->sent_packets(), state.iterations());
+  state.counters["requests_per_s"] = benchmark::Counter(
+      static_cast<double>(state.iterations()), benchmark::Counter::kIsRate);
+  state.counters["response_bytes"] =
+      static_cast<double>(socket->sent_bytes()) /
+      std::max<int64_t>(socket->sent_packets(), 1);
+}
+
+BENCHMARK(BM_StunServerBindingRequests)
+    ->ArgNames({"fast", "fingerprint"})
+    ->ArgsProduct({{0, 1}, {0, 1}});
+
+}  // namespace
+}  // namespace cricket
@@ -31,12 +31,13 @@ const rtc::SocketAddress server_addr("99.99.99.1", 3478);
 const rtc::SocketAddress client_addr("1.2.3.4", 1234);
 }  // namespace
 
-class StunServerTest : public ::testing::Test {
+// The parameter enables the fast path for Binding requests.
+class StunServerTest : public ::testing::TestWithParam<bool> {
  public:
   StunServerTest() : ss_(new rtc::VirtualSocketServer()) {
     ss_->SetMessageQueue(&main_thread);
-    server_.reset(
-        new StunServer(rtc::AsyncUDPSocket::Create(ss_.get(), server_addr)));
+    server_.reset(new StunServer(
+        rtc::AsyncUDPSocket::Create(ss_.get(), server_addr), GetParam()));
     client_.reset(new rtc::TestClient(
         absl::WrapUnique(rtc::AsyncUDPSocket::Create(ss_.get(), client_addr))));
   }
@@ -51,10 +52,12 @@ class StunServerTest : public ::testing::Test {
     client_->SendTo(buf, len, server_addr);
   }
   bool ReceiveFails() { return (client_->CheckNoPacket()); }
+  std::unique_ptr<rtc::TestClient::Packet> ReceivePacket() {
+    return client_->NextPacket(rtc::TestClient::kTimeoutMs);
+  }
   StunMessage* Receive() {
     StunMessage* msg = NULL;
-    std::unique_ptr<rtc::TestClient::Packet> packet =
-        client_->NextPacket(rtc::TestClient::kTimeoutMs);
+    std::unique_ptr<rtc::TestClient::Packet> packet = ReceivePacket();
     if (packet) {
       rtc::ByteBufferReader buf(packet->buf);
       msg = new StunMessage();
@@ -70,7 +73,7 @@ class StunServerTest : public ::testing::Test {
   std::unique_ptr<rtc::TestClient> client_;
 };
 
-TEST_F(StunServerTest, TestGood) {
+TEST_P(StunServerTest, TestGood) {
   // kStunLegacyTransactionIdLength = 16 for legacy RFC 3489 request
   std::string transaction_id = "0123456789abcdef";
   StunMessage req(STUN_BINDING_REQUEST, transaction_id);
@@ -90,7 +93,7 @@ TEST_F(StunServerTest, TestGood) {
   delete msg;
 }
 
-TEST_F(StunServerTest, TestGoodXorMappedAddr) {
+TEST_P(StunServerTest, TestGoodXorMappedAddr) {
   // kStunTransactionIdLength = 12 for RFC 5389 request
   // StunMessage::Write will automatically insert magic cookie (0x2112A442)
   std::string transaction_id = "0123456789ab";
@@ -107,12 +110,34 @@ TEST_F(StunServerTest, TestGoodXorMappedAddr) {
   EXPECT_TRUE(mapped_addr != NULL);
   EXPECT_EQ(1, mapped_addr->family());
   EXPECT_EQ(client_addr.port(), mapped_addr->port());
+  EXPECT_EQ(client_addr, mapped_addr->GetAddress());
+  EXPECT_FALSE(msg->GetUInt32(STUN_ATTR_FINGERPRINT));
 
   delete msg;
 }
 
+TEST_P(StunServerTest, TestFingerprintIsAddedIfRequestHasOne) {
+  StunMessage req(STUN_BINDING_REQUEST, "0123456789ab");
+  req.AddFingerprint();
+  Send(req);
+
+  std::unique_ptr<rtc::TestClient::Packet> packet = ReceivePacket();
+  ASSERT_TRUE(packet);
+  EXPECT_TRUE(StunMessage::ValidateFingerprint(
+      reinterpret_cast<const char*>(packet->buf.data()), packet->buf.size()));
+  StunMessage msg;
+  rtc::ByteBufferReader buf(packet->buf);
+  ASSERT_TRUE(msg.Read(&buf));
+  EXPECT_EQ(STUN_BINDING_RESPONSE, msg.type());
+  EXPECT_EQ(req.transaction_id(), msg.transaction_id());
+  const StunAddressAttribute* mapped_addr =
+      msg.GetAddress(STUN_ATTR_XOR_MAPPED_ADDRESS);
+  ASSERT_TRUE(mapped_addr != NULL);
+  EXPECT_EQ(client_addr, mapped_addr->GetAddress());
+}
+
 // Send legacy RFC 3489 request, should not get xor mapped addr
-TEST_F(StunServerTest, TestNoXorMappedAddr) {
+TEST_P(StunServerTest, TestNoXorMappedAddr) {
   // kStunLegacyTransactionIdLength = 16 for legacy RFC 3489 request
   std::string transaction_id = "0123456789abcdef";
   StunMessage req(STUN_BINDING_REQUEST, transaction_id);
@@ -130,7 +155,7 @@ TEST_F(StunServerTest, TestNoXorMappedAddr) {
   delete msg;
 }
 
-TEST_F(StunServerTest, TestBad) {
+TEST_P(StunServerTest, TestBad) {
   const char* bad =
       "this is a completely nonsensical message whose only "
       "purpose is to make the parser go 'ack'.  it doesn't "
@@ -140,4 +165,22 @@ TEST_F(StunServerTest, TestBad) {
   ASSERT_TRUE(ReceiveFails());
 }
 
+TEST_P(StunServerTest, TestTruncatedAttributeIsIgnored) {
+  StunMessage req(STUN_BINDING_REQUEST, "0123456789ab");
+  req.AddAttribute(std::make_unique<StunByteStringAttribute>(
+      STUN_ATTR_USERNAME, "username"));
+  rtc::ByteBufferWriter buf;
+  req.Write(&buf);
+  // Claim a longer USERNAME than the message holds.
+  std::string data(reinterpret_cast<const char*>(buf.Data()), buf.Length());
+  data[kStunHeaderSize + 3] = 12;
+  Send(data.data(), static_cast<int>(data.size()));
+
+  ASSERT_TRUE(ReceiveFails());
+}
+
+INSTANTIATE_TEST_SUITE_P(FastBindingResponses,
+                         StunServerTest,
+                         ::testing::Bool());
+
 }  // namespace cricket
@@ -40,7 +40,8 @@ class TestStunServer : StunServer {
   static void DeleteOnNetworkThread(TestStunServer* server);
 
   TestStunServer(rtc::AsyncUDPSocket* socket, rtc::Thread& network_thread)
-      : StunServer(socket), network_thread_(network_thread) {}
+      : StunServer(socket, /*fast_binding_responses=*/false),
+        network_thread_(network_thread) {}
 
   void OnBindingRequest(StunMessage* msg,
                         const rtc::SocketAddress& remote_addr) override;
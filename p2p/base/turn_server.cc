@@ -11,19 +11,22 @@
 #include "p2p/base/turn_server.h"
 
 #include <algorithm>
+#include <cstdint>
+#include <cstring>
 #include <memory>
 #include <tuple>  // for std::tie
 #include <utility>
 
-#include "absl/algorithm/container.h"
 #include "absl/memory/memory.h"
 #include "absl/strings/string_view.h"
 #include "api/array_view.h"
 #include "api/packet_socket_factory.h"
 #include "api/task_queue/task_queue_base.h"
 #include "api/transport/stun.h"
+#include "api/units/timestamp.h"
 #include "p2p/base/async_stun_tcp_socket.h"
 #include "rtc_base/byte_buffer.h"
+#include "rtc_base/byte_order.h"
 #include "rtc_base/checks.h"
 #include "rtc_base/crypto_random.h"
 #include "rtc_base/logging.h"
@@ -495,6 +498,23 @@ void TurnServer::Send(TurnServerConnection* conn,
   conn->socket()->SendTo(buf.Data(), buf.Length(), conn->src(), options);
 }
 
+void TurnServer::SendChannelData(TurnServerConnection* conn,
+                                 uint16_t channel_id,
+                                 rtc::ArrayView<const uint8_t> payload) {
+  RTC_DCHECK_RUN_ON(thread_);
+  channel_data_buffer_.SetSize(TURN_CHANNEL_HEADER_SIZE + payload.size());
+  rtc::SetBE16(channel_data_buffer_.data(), channel_id);
+  rtc::SetBE16(channel_data_buffer_.data() + 2,
+               static_cast<uint16_t>(payload.size()));
+  if (!payload.empty()) {
+    memcpy(channel_data_buffer_.data() + TURN_CHANNEL_HEADER_SIZE,
+           payload.data(), payload.size());
+  }
+  rtc::PacketOptions options;
+  conn->socket()->SendTo(channel_data_buffer_.data(),
+                         channel_data_buffer_.size(), conn->src(), options);
+}
+
 void TurnServer::DestroyAllocation(TurnServerAllocation* allocation) {
   // Removing the internal socket if the connection is not udp.
   rtc::AsyncPacketSocket* socket = allocation->conn()->socket();
@@ -568,8 +588,6 @@ TurnServerAllocation::TurnServerAllocation(TurnServer* server,
 }
 
 TurnServerAllocation::~TurnServerAllocation() {
-  channels_.clear();
-  perms_.clear();
   RTC_LOG(LS_INFO) << ToString() << ": Allocation destroyed";
 }
 
@@ -739,24 +757,22 @@ void TurnServerAllocation::HandleChannelBindRequest(const TurnMessage* msg) {
 
   // Check that this channel id isn't bound to another transport address, and
   // that this transport address isn't bound to another channel id.
-  auto channel1 = FindChannel(channel_id);
-  auto channel2 = FindChannel(peer_attr->GetAddress());
-  if (channel1 != channel2) {
+  const Channel* channel = FindChannel(channel_id);
+  const uint16_t* bound_channel_id = FindChannelId(peer_attr->GetAddress());
+  if ((channel != nullptr && channel->peer != peer_attr->GetAddress()) ||
+      (bound_channel_id != nullptr && *bound_channel_id != channel_id)) {
     SendBadRequestResponse(msg);
     return;
   }
 
   // Add or refresh this channel.
-  if (channel1 == channels_.end()) {
-    channel1 = channels_.insert(
-        channels_.end(), {.id = channel_id, .peer = peer_attr->GetAddress()});
-  } else {
-    channel1->pending_delete.reset();
+  if (channel == nullptr) {
+    RemoveExpiredPermissionsAndChannels();
+    channel_ids_[peer_attr->GetAddress()] = channel_id;
   }
-  thread_->PostDelayedTask(
-      SafeTask(channel1->pending_delete.flag(),
-               [this, channel1] { channels_.erase(channel1); }),
-      kChannelTimeout);
+  channels_.insert_or_assign(
+      channel_id, Channel{.peer = peer_attr->GetAddress(),
+                          .expires = Now() + kChannelTimeout});
 
   // Channel binds also refresh permissions.
   AddPermission(peer_attr->GetAddress().ipaddr());
@@ -774,8 +790,8 @@ void TurnServerAllocation::HandleChannelData(
     rtc::ArrayView<const uint8_t> payload) {
   // Extract the channel number from the data.
   uint16_t channel_id = rtc::GetBE16(payload.data());
-  auto channel = FindChannel(channel_id);
-  if (channel != channels_.end()) {
+  const Channel* channel = FindChannel(channel_id);
+  if (channel != nullptr) {
     // Send the data to the peer address.
     SendExternal(payload.data() + TURN_CHANNEL_HEADER_SIZE,
                  payload.size() - TURN_CHANNEL_HEADER_SIZE, channel->peer);
@@ -789,14 +805,10 @@ void TurnServerAllocation::HandleChannelData(
 void TurnServerAllocation::OnExternalPacket(rtc::AsyncPacketSocket* socket,
                                             const rtc::ReceivedPacket& packet) {
   RTC_DCHECK(external_socket_.get() == socket);
-  auto channel = FindChannel(packet.source_address());
-  if (channel != channels_.end()) {
+  const uint16_t* channel_id = FindChannelId(packet.source_address());
+  if (channel_id != nullptr) {
     // There is a channel bound to this address. Send as a channel message.
-    rtc::ByteBufferWriter buf;
-    buf.WriteUInt16(channel->id);
-    buf.WriteUInt16(static_cast<uint16_t>(packet.payload().size()));
-    buf.WriteBytes(packet.payload().data(), packet.payload().size());
-    server_->Send(&conn_, buf);
+    server_->SendChannelData(&conn_, *channel_id, packet.payload());
   } else if (!server_->enable_permission_checks_ ||
              HasPermission(packet.source_address().ipaddr())) {
     // No channel, but a permission exists. Send as a data indication.
@@ -821,38 +833,51 @@ TimeDelta TurnServerAllocation::ComputeLifetime(const TurnMessage& msg) {
   return kDefaultAllocationTimeout;
 }
 
+webrtc::Timestamp TurnServerAllocation::Now() {
+  return webrtc::Timestamp::Millis(rtc::TimeMillis());
+}
+
 bool TurnServerAllocation::HasPermission(const rtc::IPAddress& addr) {
-  return FindPermission(addr) != perms_.end();
+  auto perm = perms_.find(addr);
+  return perm != perms_.end() && perm->second > Now();
 }
 
 void TurnServerAllocation::AddPermission(const rtc::IPAddress& addr) {
-  auto perm = FindPermission(addr);
-  if (perm == perms_.end()) {
-    perm = perms_.insert(perms_.end(), {.peer = addr});
-  } else {
-    perm->pending_delete.reset();
+  if (!perms_.contains(addr)) {
+    RemoveExpiredPermissionsAndChannels();
   }
-  thread_->PostDelayedTask(SafeTask(perm->pending_delete.flag(),
-                                    [this, perm] { perms_.erase(perm); }),
-                           kPermissionTimeout);
+  perms_.insert_or_assign(addr, Now() + kPermissionTimeout);
 }
 
-TurnServerAllocation::PermissionList::iterator
-TurnServerAllocation::FindPermission(const rtc::IPAddress& addr) {
-  return absl::c_find_if(perms_,
-                         [&](const Permission& p) { return p.peer == addr; });
+const TurnServerAllocation::Channel* TurnServerAllocation::FindChannel(
+    uint16_t channel_id) {
+  auto channel = channels_.find(channel_id);
+  if (channel == channels_.end() || channel->second.expires <= Now()) {
+    return nullptr;
+  }
+  return &channel->second;
 }
 
-TurnServerAllocation::ChannelList::iterator TurnServerAllocation::FindChannel(
-    int channel_id) {
-  return absl::c_find_if(channels_,
-                         [&](const Channel& c) { return c.id == channel_id; });
+const uint16_t* TurnServerAllocation::FindChannelId(
+    const rtc::SocketAddress& addr) {
+  auto channel_id = channel_ids_.find(addr);
+  if (channel_id == channel_ids_.end() ||
+      FindChannel(channel_id->second) == nullptr) {
+    return nullptr;
+  }
+  return &channel_id->second;
 }
 
-TurnServerAllocation::ChannelList::iterator TurnServerAllocation::FindChannel(
-    const rtc::SocketAddress& addr) {
-  return absl::c_find_if(channels_,
-                         [&](const Channel& c) { return c.peer == addr; });
+void TurnServerAllocation::RemoveExpiredPermissionsAndChannels() {
+  const webrtc::Timestamp now = Now();
+  absl::erase_if(perms_, [&](const auto& perm) { return perm.second <= now; });
+  absl::erase_if(channels_, [&](const auto& channel) {
+    if (channel.second.expires > now) {
+      return false;
+    }
+    channel_ids_.erase(channel.second.peer);
+    return true;
+  });
 }
 
 void TurnServerAllocation::SendResponse(TurnMessage* msg) {
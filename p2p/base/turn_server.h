@@ -11,21 +11,24 @@
 #ifndef P2P_BASE_TURN_SERVER_H_
 #define P2P_BASE_TURN_SERVER_H_
 
-#include <list>
+#include <cstdint>
 #include <map>
 #include <memory>
-#include <set>
 #include <string>
 #include <utility>
 #include <vector>
 
+#include "absl/container/flat_hash_map.h"
 #include "absl/strings/string_view.h"
 #include "api/sequence_checker.h"
 #include "api/task_queue/pending_task_safety_flag.h"
 #include "api/task_queue/task_queue_base.h"
 #include "api/units/time_delta.h"
+#include "api/units/timestamp.h"
 #include "p2p/base/port_interface.h"
 #include "rtc_base/async_packet_socket.h"
+#include "rtc_base/buffer.h"
+#include "rtc_base/ip_address.h"
 #include "rtc_base/network/received_packet.h"
 #include "rtc_base/socket_address.h"
 #include "rtc_base/ssl_adapter.h"
@@ -61,6 +64,11 @@ class TurnServerConnection {
   bool operator<(const TurnServerConnection& t) const;
   std::string ToString() const;
 
+  template <typename H>
+  friend H AbslHashValue(H h, const TurnServerConnection& c) {
+    return H::combine(std::move(h), c.src_.Hash(), c.dst_.Hash(), c.proto_);
+  }
+
  private:
   rtc::SocketAddress src_;
   rtc::SocketAddress dst_;
@@ -97,17 +105,32 @@ class TurnServerAllocation final {
   void HandleChannelData(rtc::ArrayView<const uint8_t> payload);
 
  private:
-  struct Channel {
-    webrtc::ScopedTaskSafety pending_delete;
-    const uint16_t id;
-    const rtc::SocketAddress peer;
+  // Permissions and channels are looked up for every relayed packet, so they
+  // are kept in hash tables. Instead of a timer each, they store when they
+  // expire. Expired entries are ignored by lookups, and removed when new
+  // entries are added.
+  struct IPAddressHash {
+    size_t operator()(const rtc::IPAddress& ip) const {
+      return rtc::HashIP(ip);
+    }
   };
-  struct Permission {
-    webrtc::ScopedTaskSafety pending_delete;
-    rtc::IPAddress peer;
+  struct SocketAddressHash {
+    size_t operator()(const rtc::SocketAddress& address) const {
+      return address.Hash();
+    }
   };
-  using PermissionList = std::list<Permission>;
-  using ChannelList = std::list<Channel>;
+  struct Channel {
+    rtc::SocketAddress peer;
+    webrtc::Timestamp expires;
+  };
+  // Expiry time by peer address.
+  using PermissionMap =
+      absl::flat_hash_map<rtc::IPAddress, webrtc::Timestamp, IPAddressHash>;
+  // Channels by channel number.
+  using ChannelMap = absl::flat_hash_map<uint16_t, Channel>;
+  // Channel numbers by peer address.
+  using ChannelIdMap =
+      absl::flat_hash_map<rtc::SocketAddress, uint16_t, SocketAddressHash>;
 
   void PostDeleteSelf(webrtc::TimeDelta delay);
 
@@ -121,11 +144,13 @@ class TurnServerAllocation final {
                         const rtc::ReceivedPacket& packet);
 
   static webrtc::TimeDelta ComputeLifetime(const TurnMessage& msg);
+  static webrtc::Timestamp Now();
   bool HasPermission(const rtc::IPAddress& addr);
   void AddPermission(const rtc::IPAddress& addr);
-  PermissionList::iterator FindPermission(const rtc::IPAddress& addr);
-  ChannelList::iterator FindChannel(int channel_id);
-  ChannelList::iterator FindChannel(const rtc::SocketAddress& addr);
+  // Return nullptr if there is no such channel, or it has expired.
+  const Channel* FindChannel(uint16_t channel_id);
+  const uint16_t* FindChannelId(const rtc::SocketAddress& addr);
+  void RemoveExpiredPermissionsAndChannels();
 
   void SendResponse(TurnMessage* msg);
   void SendBadRequestResponse(const TurnMessage* req);
@@ -144,8 +169,9 @@ class TurnServerAllocation final {
   std::string transaction_id_;
   std::string username_;
   std::string last_nonce_;
-  PermissionList perms_;
-  ChannelList channels_;
+  PermissionMap perms_;
+  ChannelMap channels_;
+  ChannelIdMap channel_ids_;
   webrtc::ScopedTaskSafety safety_;
 };
 
@@ -182,7 +208,8 @@ class StunMessageObserver {
 // Not yet wired up: TCP support.
 class TurnServer : public sigslot::has_slots<> {
  public:
-  typedef std::map<TurnServerConnection, std::unique_ptr<TurnServerAllocation>>
+  typedef absl::flat_hash_map<TurnServerConnection,
+                              std::unique_ptr<TurnServerAllocation>>
       AllocationMap;
 
   explicit TurnServer(webrtc::TaskQueueBase* thread);
@@ -324,6 +351,10 @@ class TurnServer : public sigslot::has_slots<> {
 
   void SendStun(TurnServerConnection* conn, StunMessage* msg);
   void Send(TurnServerConnection* conn, const rtc::ByteBufferWriter& buf);
+  // Sends `payload` from `channel_id` to the client as ChannelData.
+  void SendChannelData(TurnServerConnection* conn,
+                       uint16_t channel_id,
+                       rtc::ArrayView<const uint8_t> payload);
 
   void DestroyAllocation(TurnServerAllocation* allocation) RTC_RUN_ON(thread_);
   void DestroyInternalSocket(rtc::AsyncPacketSocket* socket)
@@ -359,6 +390,10 @@ class TurnServer : public sigslot::has_slots<> {
 
   AllocationMap allocations_ RTC_GUARDED_BY(thread_);
 
+  // Reused for the ChannelData messages relayed to clients, so that relaying
+  // does not allocate.
+  rtc::Buffer channel_data_buffer_ RTC_GUARDED_BY(thread_);
+
   // For testing only. If this is non-zero, the next NONCE will be generated
   // from this value, and it will be reset to 0 after generating the NONCE.
   int64_t ts_for_next_nonce_ RTC_GUARDED_BY(thread_) = 0;
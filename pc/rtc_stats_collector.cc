@@ -13,7 +13,9 @@
 #include <stdint.h>
 #include <stdio.h>
 
+#include <algorithm>
 #include <cstdint>
+#include <iterator>
 #include <map>
 #include <memory>
 #include <set>
@@ -1186,6 +1188,12 @@ void RTCStatsCollector::GetStatsReportInternal(
     RTCStatsCollector::RequestInfo request) {
   RTC_DCHECK_RUN_ON(signaling_thread_);
   requests_.push_back(std::move(request));
+  ProcessRequests_s();
+}
+
+void RTCStatsCollector::ProcessRequests_s() {
+  RTC_DCHECK_RUN_ON(signaling_thread_);
+  RTC_DCHECK(!requests_.empty());
 
   // "Now" using a monotonically increasing timer.
   int64_t cache_now_us = rtc::TimeMicros();
@@ -1203,6 +1211,22 @@ void RTCStatsCollector::GetStatsReportInternal(
     // case of already gathering stats, `callback_` will be invoked when there
     // are no more pending partial reports.
 
+    // Requests filtered by selectors of the same transceiver only need the
+    // stats of that transceiver. Requests that need the stats of more than one
+    // transceiver share a single full report.
+    rtc::scoped_refptr<RtpTransceiver> selected_transceiver =
+        GetSelectedTransceiver(requests_);
+    if (selected_transceiver &&
+        selected_transceiver == cached_selected_transceiver_ &&
+        cache_now_us - cached_selected_report_timestamp_us_ <=
+            cache_lifetime_us_) {
+      signaling_thread_->PostTask(
+          absl::bind_front(&RTCStatsCollector::DeliverCachedReport,
+                           rtc::scoped_refptr<RTCStatsCollector>(this),
+                           cached_selected_report_, std::move(requests_)));
+      return;
+    }
+
     Timestamp timestamp =
         stats_timestamp_with_environment_clock_
             ?
@@ -1216,11 +1240,12 @@ void RTCStatsCollector::GetStatsReportInternal(
 
     num_pending_partial_reports_ = 2;
     partial_report_timestamp_us_ = cache_now_us;
+    selected_transceiver_ = std::move(selected_transceiver);
 
     // Prepare `transceiver_stats_infos_` and `call_stats_` for use in
     // `ProducePartialResultsOnNetworkThread` and
     // `ProducePartialResultsOnSignalingThread`.
-    PrepareTransceiverStatsInfosAndCallStats_s_w_n();
+    PrepareTransceiverStatsInfosAndCallStats_s_w_n(selected_transceiver_.get());
     // Don't touch `network_report_` on the signaling thread until
     // ProducePartialResultsOnNetworkThread() has signaled the
     // `network_report_event_`.
@@ -1239,6 +1264,9 @@ void RTCStatsCollector::GetStatsReportInternal(
 void RTCStatsCollector::ClearCachedStatsReport() {
   RTC_DCHECK_RUN_ON(signaling_thread_);
   cached_report_ = nullptr;
+  cached_selected_transceiver_ = nullptr;
+  cached_selected_report_ = nullptr;
+  transceiver_layout_.clear();
   MutexLock lock(&cached_certificates_mutex_);
   cached_certificates_by_transport_.clear();
 }
@@ -1246,8 +1274,59 @@ void RTCStatsCollector::ClearCachedStatsReport() {
 void RTCStatsCollector::WaitForPendingRequest() {
   RTC_DCHECK_RUN_ON(signaling_thread_);
   // If a request is pending, blocks until the `network_report_event_` is
-  // signaled and then delivers the result. Otherwise this is a NO-OP.
-  MergeNetworkReport_s();
+  // signaled and then delivers the result. Otherwise this is a NO-OP. Merging
+  // the stats of a single transceiver may start a new request for the
+  // requests it does not satisfy, so repeat until nothing is pending.
+  while (num_pending_partial_reports_ > 0) {
+    MergeNetworkReport_s();
+  }
+}
+
+rtc::scoped_refptr<RtpTransceiver> RTCStatsCollector::GetSelectedTransceiver(
+    const RequestInfo& request) const {
+  RTC_DCHECK_RUN_ON(signaling_thread_);
+  if (request.filter_mode() == RequestInfo::FilterMode::kAll) {
+    return nullptr;
+  }
+  bool filter_by_sender_selector =
+      request.filter_mode() == RequestInfo::FilterMode::kSenderSelector;
+  if (filter_by_sender_selector ? !request.sender_selector()
+                                : !request.receiver_selector()) {
+    return nullptr;
+  }
+  for (const auto& transceiver_proxy : pc_->GetTransceiversInternal()) {
+    RtpTransceiver* transceiver = transceiver_proxy->internal();
+    if (filter_by_sender_selector) {
+      for (const auto& sender : transceiver->senders()) {
+        if (sender->internal() == request.sender_selector().get()) {
+          return rtc::scoped_refptr<RtpTransceiver>(transceiver);
+        }
+      }
+    } else {
+      for (const auto& receiver : transceiver->receivers()) {
+        if (receiver->internal() == request.receiver_selector().get()) {
+          return rtc::scoped_refptr<RtpTransceiver>(transceiver);
+        }
+      }
+    }
+  }
+  return nullptr;
+}
+
+rtc::scoped_refptr<RtpTransceiver> RTCStatsCollector::GetSelectedTransceiver(
+    const std::vector<RequestInfo>& requests) const {
+  RTC_DCHECK_RUN_ON(signaling_thread_);
+  rtc::scoped_refptr<RtpTransceiver> selected_transceiver;
+  for (const RequestInfo& request : requests) {
+    rtc::scoped_refptr<RtpTransceiver> transceiver =
+        GetSelectedTransceiver(request);
+    if (!transceiver ||
+        (selected_transceiver && transceiver != selected_transceiver)) {
+      return nullptr;
+    }
+    selected_transceiver = std::move(transceiver);
+  }
+  return selected_transceiver;
 }
 
 void RTCStatsCollector::ProducePartialResultsOnSignalingThread(
@@ -1361,20 +1440,49 @@ void RTCStatsCollector::MergeNetworkReport_s() {
   // asynchronously, so `num_pending_partial_reports_` must now be 0 and we are
   // ready to deliver the result.
   RTC_DCHECK_EQ(num_pending_partial_reports_, 0);
-  cache_timestamp_us_ = partial_report_timestamp_us_;
-  cached_report_ = partial_report_;
+  rtc::scoped_refptr<const RTCStatsReport> report = partial_report_;
   partial_report_ = nullptr;
   transceiver_stats_infos_.clear();
-  // Trace WebRTC Stats when getStats is called on Javascript.
-  // This allows access to WebRTC stats from trace logs. To enable them,
-  // select the "webrtc_stats" category when recording traces.
-  TRACE_EVENT_INSTANT1("webrtc_stats", "webrtc_stats", TRACE_EVENT_SCOPE_GLOBAL,
-                       "report", cached_report_->ToJson());
+  rtc::scoped_refptr<RtpTransceiver> selected_transceiver =
+      std::move(selected_transceiver_);
+  if (selected_transceiver) {
+    cached_selected_transceiver_ = selected_transceiver;
+    cached_selected_report_timestamp_us_ = partial_report_timestamp_us_;
+    cached_selected_report_ = report;
+  } else {
+    cache_timestamp_us_ = partial_report_timestamp_us_;
+    cached_report_ = report;
+    // Trace WebRTC Stats when getStats is called on Javascript.
+    // This allows access to WebRTC stats from trace logs. To enable them,
+    // select the "webrtc_stats" category when recording traces.
+    TRACE_EVENT_INSTANT1("webrtc_stats", "webrtc_stats",
+                         TRACE_EVENT_SCOPE_GLOBAL, "report", report->ToJson());
+  }
 
   // Deliver report and clear `requests_`.
   std::vector<RequestInfo> requests;
   requests.swap(requests_);
-  DeliverCachedReport(cached_report_, std::move(requests));
+  std::vector<RequestInfo> unsatisfied_requests;
+  if (selected_transceiver) {
+    // The report only has the stats of `selected_transceiver`. Requests that
+    // were added while it was gathered may need more than that.
+    auto it = std::stable_partition(
+        requests.begin(), requests.end(), [&](const RequestInfo& request) {
+          return GetSelectedTransceiver(request) == selected_transceiver;
+        });
+    unsatisfied_requests.assign(std::make_move_iterator(it),
+                                std::make_move_iterator(requests.end()));
+    requests.erase(it, requests.end());
+  }
+  if (!unsatisfied_requests.empty()) {
+    // Serve all of them with a single new report. This is done before
+    // delivering `report` so that requests made from the callbacks join it.
+    requests_ = std::move(unsatisfied_requests);
+    ProcessRequests_s();
+  }
+  if (!requests.empty()) {
+    DeliverCachedReport(report, std::move(requests));
+  }
 }
 
 void RTCStatsCollector::DeliverCachedReport(
@@ -2052,7 +2160,48 @@ RTCStatsCollector::PrepareTransportCertificateStats_n(
   return transport_cert_stats;
 }
 
-void RTCStatsCollector::PrepareTransceiverStatsInfosAndCallStats_s_w_n() {
+void RTCStatsCollector::UpdateTransceiverLayout_s_n(
+    const std::vector<
+        rtc::scoped_refptr<RtpTransceiverProxyWithInternal<RtpTransceiver>>>&
+        transceivers) {
+  RTC_DCHECK_RUN_ON(signaling_thread_);
+
+  bool is_up_to_date = transceiver_layout_.size() == transceivers.size();
+  for (size_t i = 0; is_up_to_date && i < transceivers.size(); ++i) {
+    RtpTransceiver* transceiver = transceivers[i]->internal();
+    is_up_to_date = transceiver_layout_[i].transceiver.get() == transceiver &&
+                    transceiver_layout_[i].channel == transceiver->channel();
+  }
+  if (is_up_to_date) {
+    return;
+  }
+
+  transceiver_layout_.clear();
+  transceiver_layout_.reserve(transceivers.size());
+  for (const auto& transceiver_proxy : transceivers) {
+    RtpTransceiver* transceiver = transceiver_proxy->internal();
+    transceiver_layout_.push_back(
+        {.transceiver = rtc::scoped_refptr<RtpTransceiver>(transceiver),
+         .channel = transceiver->channel()});
+  }
+
+  // TODO(tommi): See if we can avoid synchronously blocking the signaling
+  // thread while we do this (or avoid the BlockingCall at all).
+  network_thread_->BlockingCall([&] {
+    rtc::Thread::ScopedDisallowBlockingCalls no_blocking_calls;
+
+    for (TransceiverLayout& layout : transceiver_layout_) {
+      if (!layout.channel) {
+        continue;
+      }
+      layout.mid = layout.channel->mid();
+      layout.transport_name = std::string(layout.channel->transport_name());
+    }
+  });
+}
+
+void RTCStatsCollector::PrepareTransceiverStatsInfosAndCallStats_s_w_n(
+    const RtpTransceiver* selected_transceiver) {
   RTC_DCHECK_RUN_ON(signaling_thread_);
 
   transceiver_stats_infos_.clear();
@@ -2071,61 +2220,58 @@ void RTCStatsCollector::PrepareTransceiverStatsInfosAndCallStats_s_w_n() {
            cricket::VideoMediaReceiveInfo>
       video_receive_stats;
 
-  auto transceivers = pc_->GetTransceiversInternal();
+  UpdateTransceiverLayout_s_n(pc_->GetTransceiversInternal());
 
-  // TODO(tommi): See if we can avoid synchronously blocking the signaling
-  // thread while we do this (or avoid the BlockingCall at all).
-  network_thread_->BlockingCall([&] {
-    rtc::Thread::ScopedDisallowBlockingCalls no_blocking_calls;
-
-    for (const auto& transceiver_proxy : transceivers) {
-      RtpTransceiver* transceiver = transceiver_proxy->internal();
-      cricket::MediaType media_type = transceiver->media_type();
-
-      // Prepare stats entry. The TrackMediaInfoMap will be filled in after the
-      // stats have been fetched on the worker thread.
-      transceiver_stats_infos_.emplace_back();
-      RtpTransceiverStatsInfo& stats = transceiver_stats_infos_.back();
-      stats.transceiver = transceiver;
-      stats.media_type = media_type;
-
-      cricket::ChannelInterface* channel = transceiver->channel();
-      if (!channel) {
-        // The remaining fields require a BaseChannel.
-        continue;
-      }
+  for (const TransceiverLayout& layout : transceiver_layout_) {
+    if (selected_transceiver && layout.transceiver != selected_transceiver) {
+      continue;
+    }
+    RtpTransceiver* transceiver = layout.transceiver.get();
+    cricket::MediaType media_type = transceiver->media_type();
+
+    // Prepare stats entry. The TrackMediaInfoMap will be filled in after the
+    // stats have been fetched on the worker thread.
+    transceiver_stats_infos_.emplace_back();
+    RtpTransceiverStatsInfo& stats = transceiver_stats_infos_.back();
+    stats.transceiver = layout.transceiver;
+    stats.media_type = media_type;
+
+    cricket::ChannelInterface* channel = layout.channel;
+    if (!channel) {
+      // The remaining fields require a BaseChannel.
+      continue;
+    }
 
-      stats.mid = channel->mid();
-      stats.transport_name = std::string(channel->transport_name());
-
-      if (media_type == cricket::MEDIA_TYPE_AUDIO) {
-        auto voice_send_channel = channel->voice_media_send_channel();
-        RTC_DCHECK(voice_send_stats.find(voice_send_channel) ==
-                   voice_send_stats.end());
-        voice_send_stats.insert(
-            std::make_pair(voice_send_channel, cricket::VoiceMediaSendInfo()));
-
-        auto voice_receive_channel = channel->voice_media_receive_channel();
-        RTC_DCHECK(voice_receive_stats.find(voice_receive_channel) ==
-                   voice_receive_stats.end());
-        voice_receive_stats.insert(std::make_pair(
-            voice_receive_channel, cricket::VoiceMediaReceiveInfo()));
-      } else if (media_type == cricket::MEDIA_TYPE_VIDEO) {
-        auto video_send_channel = channel->video_media_send_channel();
-        RTC_DCHECK(video_send_stats.find(video_send_channel) ==
-                   video_send_stats.end());
-        video_send_stats.insert(
-            std::make_pair(video_send_channel, cricket::VideoMediaSendInfo()));
-        auto video_receive_channel = channel->video_media_receive_channel();
-        RTC_DCHECK(video_receive_stats.find(video_receive_channel) ==
-                   video_receive_stats.end());
-        video_receive_stats.insert(std::make_pair(
-            video_receive_channel, cricket::VideoMediaReceiveInfo()));
-      } else {
-        RTC_DCHECK_NOTREACHED();
-      }
+    stats.mid = layout.mid;
+    stats.transport_name = layout.transport_name;
+
+    if (media_type == cricket::MEDIA_TYPE_AUDIO) {
+      auto voice_send_channel = channel->voice_media_send_channel();
+      RTC_DCHECK(voice_send_stats.find(voice_send_channel) ==
+                 voice_send_stats.end());
+      voice_send_stats.insert(
+          std::make_pair(voice_send_channel, cricket::VoiceMediaSendInfo()));
+
+      auto voice_receive_channel = channel->voice_media_receive_channel();
+      RTC_DCHECK(voice_receive_stats.find(voice_receive_channel) ==
+                 voice_receive_stats.end());
+      voice_receive_stats.insert(std::make_pair(
+          voice_receive_channel, cricket::VoiceMediaReceiveInfo()));
+    } else if (media_type == cricket::MEDIA_TYPE_VIDEO) {
+      auto video_send_channel = channel->video_media_send_channel();
+      RTC_DCHECK(video_send_stats.find(video_send_channel) ==
+                 video_send_stats.end());
+      video_send_stats.insert(
+          std::make_pair(video_send_channel, cricket::VideoMediaSendInfo()));
+      auto video_receive_channel = channel->video_media_receive_channel();
+      RTC_DCHECK(video_receive_stats.find(video_receive_channel) ==
+                 video_receive_stats.end());
+      video_receive_stats.insert(std::make_pair(
+          video_receive_channel, cricket::VideoMediaReceiveInfo()));
+    } else {
+      RTC_DCHECK_NOTREACHED();
     }
-  });
+  }
 
   // We jump to the worker thread and call GetStats() on each media channel as
   // well as GetCallStats(). At the same time we construct the
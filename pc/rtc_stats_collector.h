@@ -29,6 +29,7 @@
 #include "api/stats/rtcstats_objects.h"
 #include "call/call.h"
 #include "media/base/media_channel.h"
+#include "pc/channel_interface.h"
 #include "pc/data_channel_utils.h"
 #include "pc/peer_connection_internal.h"
 #include "pc/rtp_receiver.h"
@@ -55,7 +56,10 @@ class RtpReceiverInternal;
 // All public methods of the collector are to be called on the signaling thread.
 // Stats are gathered on the signaling, worker and network threads
 // asynchronously. The callback is invoked on the signaling thread. Resulting
-// reports are cached for `cache_lifetime_` ms.
+// reports are cached for `cache_lifetime_` ms. Properties of the transceivers
+// that only change on negotiation are cached until the next
+// `ClearCachedStatsReport()`, and requests filtered by selectors of a single
+// transceiver only gather stats for that transceiver.
 class RTCStatsCollector : public RefCountInterface {
  public:
   static rtc::scoped_refptr<RTCStatsCollector> Create(
@@ -162,6 +166,17 @@ class RTCStatsCollector : public RefCountInterface {
   };
 
   void GetStatsReportInternal(RequestInfo request);
+  // Delivers a fresh cached report to `requests_`, or starts gathering a new
+  // report for them unless one is already being gathered.
+  void ProcessRequests_s();
+  // Returns the transceiver whose sender or receiver is the selector of
+  // `request`, or null if `request` is not filtered by a (non-null) selector.
+  rtc::scoped_refptr<RtpTransceiver> GetSelectedTransceiver(
+      const RequestInfo& request) const;
+  // Returns the transceiver that all of `requests` are filtered by, or null if
+  // they need the stats of more than one transceiver.
+  rtc::scoped_refptr<RtpTransceiver> GetSelectedTransceiver(
+      const std::vector<RequestInfo>& requests) const;
 
   // Structure for tracking stats about each RtpTransceiver managed by the
   // PeerConnection. This can either by a Plan B style or Unified Plan style
@@ -179,6 +194,15 @@ class RTCStatsCollector : public RefCountInterface {
     std::optional<RtpTransceiverDirection> current_direction;
   };
 
+  // The properties of an RtpTransceiver that can only change as a result of
+  // negotiation. `mid` and `transport_name` are read on the network thread.
+  struct TransceiverLayout {
+    rtc::scoped_refptr<RtpTransceiver> transceiver;
+    cricket::ChannelInterface* channel = nullptr;
+    std::optional<std::string> mid;
+    std::optional<std::string> transport_name;
+  };
+
   void DeliverCachedReport(
       rtc::scoped_refptr<const RTCStatsReport> cached_report,
       std::vector<RequestInfo> requests);
@@ -236,8 +260,17 @@ class RTCStatsCollector : public RefCountInterface {
   PrepareTransportCertificateStats_n(
       const std::map<std::string, cricket::TransportStats>&
           transport_stats_by_name);
-  // The results are stored in `transceiver_stats_infos_` and `call_stats_`.
-  void PrepareTransceiverStatsInfosAndCallStats_s_w_n();
+  // Makes `transceiver_layout_` match `transceivers`. Only blocks on the
+  // network thread if a transceiver or channel was added or removed since the
+  // last call, or if ClearCachedStatsReport() was called in between.
+  void UpdateTransceiverLayout_s_n(
+      const std::vector<
+          rtc::scoped_refptr<RtpTransceiverProxyWithInternal<RtpTransceiver>>>&
+          transceivers);
+  // The results are stored in `transceiver_stats_infos_` and `call_stats_`. If
+  // `selected_transceiver` is not null, only its stats are prepared.
+  void PrepareTransceiverStatsInfosAndCallStats_s_w_n(
+      const RtpTransceiver* selected_transceiver);
 
   // Stats gathering on a particular thread.
   void ProducePartialResultsOnSignalingThread(Timestamp timestamp);
@@ -289,6 +322,12 @@ class RTCStatsCollector : public RefCountInterface {
   // now get rid of the variable and keep the data scoped within a stats
   // collection sequence.
   std::vector<RtpTransceiverStatsInfo> transceiver_stats_infos_;
+  // Set while gathering stats for a single transceiver. The resulting report
+  // is only delivered to requests filtered by a selector of this transceiver,
+  // and is cached for those in `cached_selected_report_`.
+  rtc::scoped_refptr<RtpTransceiver> selected_transceiver_;
+  // Only touched on the signaling thread. Cleared by ClearCachedStatsReport().
+  std::vector<TransceiverLayout> transceiver_layout_;
   // This cache avoids having to call rtc::SSLCertChain::GetStats(), which can
   // relatively expensive. ClearCachedStatsReport() needs to be called on
   // negotiation to ensure the cache is not obsolete.
@@ -307,6 +346,11 @@ class RTCStatsCollector : public RefCountInterface {
   int64_t cache_timestamp_us_;
   int64_t cache_lifetime_us_;
   rtc::scoped_refptr<const RTCStatsReport> cached_report_;
+  // The last report gathered for the requests of a single transceiver. Only
+  // used for requests filtered by a selector of `cached_selected_transceiver_`.
+  rtc::scoped_refptr<RtpTransceiver> cached_selected_transceiver_;
+  int64_t cached_selected_report_timestamp_us_ = 0;
+  rtc::scoped_refptr<const RTCStatsReport> cached_selected_report_;
 
   // Data recorded and maintained by the stats collector during its lifetime.
   // Some stats are produced from this record instead of other components.
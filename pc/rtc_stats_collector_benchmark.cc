@@ -0,0 +1,131 @@
+/*
+ *  Copyright 2025 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <cstdint>
+#include <string>
+#include <utility>
+
+#include "api/environment/environment_factory.h"
+#include "api/make_ref_counted.h"
+#include "api/rtp_parameters.h"
+#include "api/scoped_refptr.h"
+#include "api/stats/rtc_stats_report.h"
+#include "api/units/time_delta.h"
+#include "benchmark/benchmark.h"
+#include "media/base/media_channel.h"
+#include "pc/rtc_stats_collector.h"
+#include "pc/test/fake_peer_connection_for_stats.h"
+#include "pc/test/rtc_stats_obtainer.h"
+#include "rtc_base/checks.h"
+#include "rtc_base/fake_clock.h"
+#include "rtc_base/string_encode.h"
+#include "rtc_base/thread.h"
+
+namespace webrtc {
+namespace {
+
+cricket::VideoMediaInfo CreateVideoMediaInfo(uint32_t send_ssrc,
+                                             uint32_t receive_ssrc) {
+  cricket::VideoMediaInfo info;
+  RtpCodecParameters send_codec;
+  send_codec.payload_type = 96;
+  send_codec.clock_rate = 90000;
+  info.send_codecs.insert(std::make_pair(send_codec.payload_type, send_codec));
+  RtpCodecParameters receive_codec;
+  receive_codec.payload_type = 97;
+  receive_codec.clock_rate = 90000;
+  info.receive_codecs.insert(
+      std::make_pair(receive_codec.payload_type, receive_codec));
+
+  info.senders.emplace_back();
+  info.senders[0].local_stats.emplace_back();
+  info.senders[0].local_stats[0].ssrc = send_ssrc;
+  info.senders[0].codec_payload_type = send_codec.payload_type;
+  info.aggregated_senders.push_back(info.senders[0]);
+
+  info.receivers.emplace_back();
+  info.receivers[0].local_stats.emplace_back();
+  info.receivers[0].local_stats[0].ssrc = receive_ssrc;
+  info.receivers[0].codec_payload_type = receive_codec.payload_type;
+  return info;
+}
+
+class StatsCollectorFixture {
+ public:
+  explicit StatsCollectorFixture(int num_transceivers)
+      : pc_(rtc::make_ref_counted<FakePeerConnectionForStats>()),
+        // With a zero cache lifetime each request gathers a new report, as
+        // long as `fake_clock_` advances in between.
+        collector_(RTCStatsCollector::Create(pc_.get(),
+                                             CreateEnvironment(),
+                                             /*cache_lifetime_us=*/0)) {
+    for (int i = 0; i < num_transceivers; ++i) {
+      // All transceivers are bundled on one transport.
+      pc_->AddVideoChannel("mid" + rtc::ToString(i), "TransportName",
+                           CreateVideoMediaInfo(2 * i + 1, 2 * i + 2));
+    }
+  }
+
+  ~StatsCollectorFixture() { collector_->WaitForPendingRequest(); }
+
+  rtc::scoped_refptr<const RTCStatsReport> GetStatsReport() {
+    fake_clock_.AdvanceTime(TimeDelta::Micros(1));
+    rtc::scoped_refptr<RTCStatsObtainer> callback = RTCStatsObtainer::Create();
+    collector_->GetStatsReport(callback);
+    // All threads of the fake are the current thread, process the tasks
+    // posted by the collector until the report is delivered.
+    while (!callback->report()) {
+      main_thread_.ProcessMessages(0);
+    }
+    return callback->report();
+  }
+
+ private:
+  rtc::ScopedBaseFakeClock fake_clock_;
+  rtc::AutoThread main_thread_;
+  rtc::scoped_refptr<FakePeerConnectionForStats> pc_;
+  rtc::scoped_refptr<RTCStatsCollector> collector_;
+};
+
+// Repeated getStats() polling, as done by monitoring, with a fresh report for
+// each call.
+void BM_GetStatsReport(benchmark::State& state) {
+  StatsCollectorFixture fixture(state.range(0));
+  for (auto _ : state) {
+    rtc::scoped_refptr<const RTCStatsReport> report = fixture.GetStatsReport();
+    benchmark::DoNotOptimize(report);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_StatsReportToJson(benchmark::State& state) {
+  StatsCollectorFixture fixture(state.range(0));
+  rtc::scoped_refptr<const RTCStatsReport> report = fixture.GetStatsReport();
+  RTC_CHECK_GT(report->size(), 0u);
+  for (auto _ : state) {
+    std::string json = report->ToJson();
+    benchmark::DoNotOptimize(json);
+  }
+  state.SetItemsProcessed(state.iterations() * report->size());
+}
+
+BENCHMARK(BM_GetStatsReport)->RangeMultiplier(4)->Range(1, 64);
+BENCHMARK(BM_StatsReportToJson)->RangeMultiplier(4)->Range(1, 64);
+
+}  // namespace
+}  // namespace webrtc
+
+/*
+
+items_per_second is the number of transceivers (BM_GetStatsReport) or stats
+objects (BM_StatsReportToJson) processed per second. Run with:
+
+  out/Default/benchmarks --benchmark_filter=Stats
+*/
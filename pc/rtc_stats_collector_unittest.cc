@@ -3674,6 +3674,97 @@ TEST_F(RTCStatsCollectorTest, GetStatsWithNullReceiverSelector) {
   EXPECT_EQ(empty_report->size(), 0u);
 }
 
+TEST_F(RTCStatsCollectorTest, GetStatsWithSelectorCachesSelectedStats) {
+  ExampleStatsGraph graph = SetupExampleStatsGraphForSelectorTests();
+  stats_->stats_collector()->ClearCachedStatsReport();
+  int get_call_stats_count = pc_->get_call_stats_count();
+  // Only the stats of the sender's transceiver are gathered.
+  rtc::scoped_refptr<const RTCStatsReport> sender_report =
+      stats_->GetStatsReportWithSenderSelector(graph.sender);
+  EXPECT_EQ(sender_report->size(), 4u);
+  EXPECT_TRUE(sender_report->Get(graph.outbound_rtp_id));
+  EXPECT_EQ(pc_->get_call_stats_count(), get_call_stats_count + 1);
+  // Selectors of the same transceiver are served from the cache.
+  rtc::scoped_refptr<const RTCStatsReport> receiver_report =
+      stats_->GetStatsReportWithReceiverSelector(graph.receiver);
+  EXPECT_EQ(receiver_report->size(), 3u);
+  EXPECT_EQ(pc_->get_call_stats_count(), get_call_stats_count + 1);
+  // The next request without a selector gets all stats.
+  rtc::scoped_refptr<const RTCStatsReport> full_report =
+      stats_->GetStatsReport();
+  EXPECT_EQ(full_report->size(), graph.full_report->size());
+  EXPECT_TRUE(full_report->Get(graph.peer_connection_id));
+  EXPECT_EQ(pc_->get_call_stats_count(), get_call_stats_count + 2);
+}
+
+TEST_F(RTCStatsCollectorTest,
+       GetStatsWithSelectorsOfDifferentTransceiversGathersOnce) {
+  ExampleStatsGraph graph = SetupExampleStatsGraphForSelectorTests();
+  pc_->AddVoiceChannel("AudioMid", "TransportName");
+  rtc::scoped_refptr<MockRtpSenderInternal> audio_sender =
+      stats_->SetupLocalTrackAndSender(cricket::MEDIA_TYPE_AUDIO,
+                                       "LocalAudioTrackID", 5, false, 51);
+  stats_->stats_collector()->ClearCachedStatsReport();
+  int get_call_stats_count = pc_->get_call_stats_count();
+
+  // The first request starts gathering the stats of the video transceiver.
+  // The requests made in the meantime that need the stats of the audio
+  // transceiver are all served by one more gathering.
+  rtc::scoped_refptr<const RTCStatsReport> video_sender_report,
+      video_receiver_report, audio_sender_report, second_audio_sender_report,
+      full_report;
+  rtc::scoped_refptr<RTCStatsCollector> collector = stats_->stats_collector();
+  collector->GetStatsReport(graph.sender,
+                            RTCStatsObtainer::Create(&video_sender_report));
+  collector->GetStatsReport(audio_sender,
+                            RTCStatsObtainer::Create(&audio_sender_report));
+  collector->GetStatsReport(graph.receiver,
+                            RTCStatsObtainer::Create(&video_receiver_report));
+  collector->GetStatsReport(
+      audio_sender, RTCStatsObtainer::Create(&second_audio_sender_report));
+  collector->GetStatsReport(RTCStatsObtainer::Create(&full_report));
+  EXPECT_THAT(
+      WaitUntil(
+          [&] {
+            return video_sender_report && video_receiver_report &&
+                   audio_sender_report && second_audio_sender_report &&
+                   full_report;
+          },
+          ::testing::IsTrue(),
+          {.timeout = webrtc::TimeDelta::Millis(kGetStatsReportTimeoutMs)}),
+      IsRtcOk());
+  EXPECT_EQ(pc_->get_call_stats_count(), get_call_stats_count + 2);
+  EXPECT_TRUE(video_sender_report->Get(graph.outbound_rtp_id));
+  EXPECT_TRUE(video_receiver_report->Get(graph.inbound_rtp_id));
+  EXPECT_TRUE(full_report->Get(graph.peer_connection_id));
+
+  // The full report is cached for all of them.
+  stats_->GetStatsReportWithSenderSelector(graph.sender);
+  stats_->GetStatsReportWithSenderSelector(audio_sender);
+  EXPECT_EQ(pc_->get_call_stats_count(), get_call_stats_count + 2);
+}
+
+TEST_F(RTCStatsCollectorTest,
+       GetStatsWithoutSelectorWhileGatheringSelectedStats) {
+  ExampleStatsGraph graph = SetupExampleStatsGraphForSelectorTests();
+  stats_->stats_collector()->ClearCachedStatsReport();
+  rtc::scoped_refptr<const RTCStatsReport> receiver_report, full_report;
+  stats_->stats_collector()->GetStatsReport(
+      graph.receiver, RTCStatsObtainer::Create(&receiver_report));
+  stats_->stats_collector()->GetStatsReport(
+      RTCStatsObtainer::Create(&full_report));
+  EXPECT_THAT(
+      WaitUntil(
+          [&] { return receiver_report != nullptr && full_report != nullptr; },
+          ::testing::IsTrue(),
+          {.timeout = webrtc::TimeDelta::Millis(kGetStatsReportTimeoutMs)}),
+      IsRtcOk());
+  EXPECT_EQ(receiver_report->size(), 3u);
+  EXPECT_TRUE(receiver_report->Get(graph.inbound_rtp_id));
+  EXPECT_EQ(full_report->size(), graph.full_report->size());
+  EXPECT_TRUE(full_report->Get(graph.media_source_id));
+}
+
 // Before SetLocalDescription() senders don't have an SSRC.
 // To simulate this case we create a mock sender with SSRC=0.
 TEST_F(RTCStatsCollectorTest, RtpIsMissingWhileSsrcIsZero) {
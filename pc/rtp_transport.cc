@@ -22,6 +22,7 @@
 #include "rtc_base/checks.h"
 #include "rtc_base/copy_on_write_buffer.h"
 #include "rtc_base/logging.h"
+#include "rtc_base/network/ecn_marking.h"
 #include "rtc_base/trace_event.h"
 
 namespace webrtc {
@@ -192,10 +193,12 @@ flat_set<uint32_t> RtpTransport::GetSsrcsForSink(RtpPacketSinkInterface* sink) {
 
 void RtpTransport::DemuxPacket(rtc::CopyOnWriteBuffer packet,
                                webrtc::Timestamp arrival_time,
-                               rtc::EcnMarking ecn) {
+                               rtc::EcnMarking ecn,
+                               size_t bytes_copied) {
   RtpPacketReceived parsed_packet(&header_extension_map_);
   parsed_packet.set_arrival_time(arrival_time);
   parsed_packet.set_ecn(ecn);
+  parsed_packet.set_bytes_copied(bytes_copied);
 
   if (!parsed_packet.Parse(std::move(packet))) {
     RTC_LOG(LS_ERROR)
@@ -247,23 +250,24 @@ void RtpTransport::OnSentPacket(rtc::PacketTransportInternal* packet_transport,
   processing_sent_packet_ = false;
 }
 
-void RtpTransport::OnRtpPacketReceived(
-    const rtc::ReceivedPacket& received_packet) {
-  rtc::CopyOnWriteBuffer payload(received_packet.payload());
-  DemuxPacket(
-      payload,
-      received_packet.arrival_time().value_or(Timestamp::MinusInfinity()),
-      received_packet.ecn());
+void RtpTransport::OnRtpPacketReceived(rtc::ReceivedPacket received_packet) {
+  Timestamp arrival_time =
+      received_packet.arrival_time().value_or(Timestamp::MinusInfinity());
+  rtc::EcnMarking ecn = received_packet.ecn();
+  size_t bytes_copied = 0;
+  rtc::CopyOnWriteBuffer payload =
+      std::move(received_packet).TakePayload(&bytes_copied);
+  DemuxPacket(std::move(payload), arrival_time, ecn, bytes_copied);
 }
 
-void RtpTransport::OnRtcpPacketReceived(
-    const rtc::ReceivedPacket& received_packet) {
-  rtc::CopyOnWriteBuffer payload(received_packet.payload());
+void RtpTransport::OnRtcpPacketReceived(rtc::ReceivedPacket received_packet) {
   // TODO(bugs.webrtc.org/15368): Propagate timestamp and maybe received packet
   // further.
-  SendRtcpPacketReceived(&payload, received_packet.arrival_time()
-                                       ? received_packet.arrival_time()->us()
-                                       : -1);
+  int64_t packet_time_us = received_packet.arrival_time()
+                               ? received_packet.arrival_time()->us()
+                               : -1;
+  rtc::CopyOnWriteBuffer payload = std::move(received_packet).TakePayload();
+  SendRtcpPacketReceived(&payload, packet_time_us);
 }
 
 void RtpTransport::OnReadPacket(rtc::PacketTransportInternal* transport,
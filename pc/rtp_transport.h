@@ -95,9 +95,12 @@ class RtpTransport : public RtpTransportInternal {
 
  protected:
   // These methods will be used in the subclasses.
+  // `bytes_copied` is the number of bytes of `packet` that were copied since
+  // the socket read, see RtpPacketReceived::bytes_copied().
   void DemuxPacket(rtc::CopyOnWriteBuffer packet,
                    Timestamp arrival_time,
-                   rtc::EcnMarking ecn);
+                   rtc::EcnMarking ecn,
+                   size_t bytes_copied = 0);
 
   bool SendPacket(bool rtcp,
                   rtc::CopyOnWriteBuffer* packet,
@@ -108,8 +111,10 @@ class RtpTransport : public RtpTransportInternal {
   // Overridden by SrtpTransport.
   virtual void OnNetworkRouteChanged(
       std::optional<rtc::NetworkRoute> network_route);
-  virtual void OnRtpPacketReceived(const rtc::ReceivedPacket& packet);
-  virtual void OnRtcpPacketReceived(const rtc::ReceivedPacket& packet);
+  // The transport is the final receiver of `packet`, so these may take over its
+  // payload.
+  virtual void OnRtpPacketReceived(rtc::ReceivedPacket packet);
+  virtual void OnRtcpPacketReceived(rtc::ReceivedPacket packet);
   // Overridden by SrtpTransport and DtlsSrtpTransport.
   virtual void OnWritableState(rtc::PacketTransportInternal* packet_transport);
 
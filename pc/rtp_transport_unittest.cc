@@ -18,12 +18,16 @@
 #include "api/units/time_delta.h"
 #include "call/rtp_demuxer.h"
 #include "p2p/base/fake_packet_transport.h"
+#include "p2p/base/packet_transport_internal.h"
 #include "pc/test/rtp_transport_test_util.h"
 #include "rtc_base/buffer.h"
 #include "rtc_base/containers/flat_set.h"
+#include "rtc_base/copy_on_write_buffer.h"
 #include "rtc_base/network/ecn_marking.h"
+#include "rtc_base/network/received_packet.h"
 #include "rtc_base/network/sent_packet.h"
 #include "rtc_base/network_route.h"
+#include "rtc_base/socket_address.h"
 #include "rtc_base/third_party/sigslot/sigslot.h"
 #include "test/explicit_key_value_config.h"
 #include "test/gmock.h"
@@ -337,6 +341,59 @@ TEST(RtpTransportTest, ReceivedPacketEcnMarkingPropagatedToDemuxedPacket) {
   transport.UnregisterRtpDemuxerSink(&observer);
 }
 
+TEST(RtpTransportTest, TakesPayloadBufferWithoutCopy) {
+  RtpTransport transport(kMuxDisabled, ExplicitKeyValueConfig(""));
+  rtc::FakePacketTransport fake_rtp("fake_rtp");
+  transport.SetRtpPacketTransport(&fake_rtp);
+  TransportObserver observer(&transport);
+  RtpDemuxerCriteria demuxer_criteria;
+  demuxer_criteria.payload_types().insert(0x11);
+  transport.RegisterRtpDemuxerSink(demuxer_criteria, &observer);
+
+  rtc::CopyOnWriteBuffer buffer(kRtpData, kRtpLen);
+  const uint8_t* data = buffer.cdata();
+  fake_rtp.NotifyPacketReceived(rtc::ReceivedPacket::CreateWithPayloadBuffer(
+      buffer, rtc::SocketAddress()));
+  ASSERT_EQ(observer.rtp_count(), 1);
+  EXPECT_TRUE(buffer.empty());
+  EXPECT_EQ(observer.last_recv_rtp_packet().data(), data);
+  EXPECT_EQ(observer.last_recv_rtp_packet().bytes_copied(), 0u);
+
+  transport.UnregisterRtpDemuxerSink(&observer);
+}
+
+TEST(RtpTransportTest, DoesNotTakePayloadBufferFromOtherReceivers) {
+  RtpTransport transport(kMuxDisabled, ExplicitKeyValueConfig(""));
+  rtc::FakePacketTransport fake_rtp("fake_rtp");
+  transport.SetRtpPacketTransport(&fake_rtp);
+  TransportObserver observer(&transport);
+  RtpDemuxerCriteria demuxer_criteria;
+  demuxer_criteria.payload_types().insert(0x11);
+  transport.RegisterRtpDemuxerSink(demuxer_criteria, &observer);
+  // Registered after `transport`, so it reads the packet after the transport
+  // has processed it.
+  rtc::CopyOnWriteBuffer seen_by_other_receiver;
+  fake_rtp.RegisterReceivedPacketCallback(
+      &seen_by_other_receiver,
+      [&](rtc::PacketTransportInternal* packet_transport,
+          const rtc::ReceivedPacket& packet) {
+        seen_by_other_receiver.SetData(packet.payload().data(),
+                                      packet.payload().size());
+      });
+
+  rtc::CopyOnWriteBuffer buffer(kRtpData, kRtpLen);
+  fake_rtp.NotifyPacketReceived(rtc::ReceivedPacket::CreateWithPayloadBuffer(
+      buffer, rtc::SocketAddress()));
+  ASSERT_EQ(observer.rtp_count(), 1);
+  EXPECT_EQ(observer.last_recv_rtp_packet().bytes_copied(),
+            static_cast<size_t>(kRtpLen));
+  EXPECT_EQ(buffer, rtc::CopyOnWriteBuffer(kRtpData, kRtpLen));
+  EXPECT_EQ(seen_by_other_receiver, rtc::CopyOnWriteBuffer(kRtpData, kRtpLen));
+
+  fake_rtp.DeregisterReceivedPacketCallback(&seen_by_other_receiver);
+  transport.UnregisterRtpDemuxerSink(&observer);
+}
+
 // Test that SignalPacketReceived does not fire when a RTP packet with an
 // unhandled payload type is received.
 TEST(RtpTransportTest, DontSignalUnhandledRtpPayloadType) {
@@ -3224,6 +3224,9 @@ RTCError SdpOfferAnswerHandler::Rollback(SdpType desc_type) {
   }
   RTC_DCHECK_RUN_ON(signaling_thread());
   RTC_DCHECK(IsUnifiedPlan());
+  // Rolling back may change the transports of the channels, invalidate the
+  // stats caches like when applying a description.
+  pc_->ClearStatsCache();
   std::vector<rtc::scoped_refptr<RtpTransceiverInterface>>
       now_receiving_transceivers;
   std::vector<rtc::scoped_refptr<MediaStreamInterface>> all_added_streams;
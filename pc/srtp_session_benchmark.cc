@@ -0,0 +1,137 @@
+/*
+ *  Copyright 2025 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "pc/srtp_session.h"
+#include "pc/test/srtp_test_util.h"
+#include "rtc_base/byte_order.h"
+#include "rtc_base/checks.h"
+#include "rtc_base/copy_on_write_buffer.h"
+#include "rtc_base/ssl_stream_adapter.h"
+
+namespace webrtc {
+namespace {
+
+// Typical video packet size after packetization.
+constexpr size_t kPayloadSize = 1100;
+constexpr size_t kRtpHeaderSize = 12;
+constexpr size_t kMaxAuthTagSize = 16;
+// Number of SSRCs the packets are spread over, e.g. three simulcast layers
+// plus audio.
+constexpr uint32_t kNumSsrcs = 4;
+
+const rtc::ZeroOnFreeBuffer<uint8_t>& KeyForSuite(int crypto_suite) {
+  return rtc::IsGcmCryptoSuite(crypto_suite) ? rtc::kTestKeyGcm128
+                                             : rtc::kTestKey1;
+}
+
+void WriteRtpPacket(rtc::CopyOnWriteBuffer& packet,
+                    uint16_t sequence_number,
+                    uint32_t ssrc) {
+  packet.SetSize(kRtpHeaderSize + kPayloadSize);
+  uint8_t* data = packet.MutableData();
+  data[0] = 0x80;
+  data[1] = 96;
+  rtc::SetBE16(data + 2, sequence_number);
+  rtc::SetBE32(data + 4, sequence_number * 90);
+  rtc::SetBE32(data + 8, ssrc);
+}
+
+std::vector<rtc::CopyOnWriteBuffer> CreatePackets(size_t count) {
+  std::vector<rtc::CopyOnWriteBuffer> packets;
+  packets.reserve(count);
+  for (size_t i = 0; i < count; ++i) {
+    rtc::CopyOnWriteBuffer packet(kRtpHeaderSize + kPayloadSize,
+                                  kRtpHeaderSize + kPayloadSize +
+                                      kMaxAuthTagSize);
+    WriteRtpPacket(packet, static_cast<uint16_t>(i), 1 + i % kNumSsrcs);
+    packets.push_back(std::move(packet));
+  }
+  return packets;
+}
+
+// Protects `state.range(0)` packets per iteration, one per call, as
+// SrtpTransport::SendRtpPacket() does.
+void BM_ProtectRtp(benchmark::State& state, int crypto_suite) {
+  const size_t num_packets = state.range(0);
+  cricket::SrtpSession session;
+  RTC_CHECK(session.SetSend(crypto_suite, KeyForSuite(crypto_suite), {}));
+  std::vector<rtc::CopyOnWriteBuffer> packets = CreatePackets(num_packets);
+  uint16_t sequence_number = 0;
+  for (auto _ : state) {
+    for (size_t i = 0; i < num_packets; ++i) {
+      WriteRtpPacket(packets[i], sequence_number++, 1 + i % kNumSsrcs);
+      bool ok = session.ProtectRtp(packets[i]);
+      benchmark::DoNotOptimize(ok);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * num_packets);
+  state.SetBytesProcessed(state.iterations() * num_packets * kPayloadSize);
+}
+
+// Unprotects freshly protected packets one per call, as
+// SrtpTransport::OnRtpPacketReceived() does. Protection happens outside of the
+// timed region since the receiver rejects replayed packets.
+void BM_UnprotectRtp(benchmark::State& state, int crypto_suite) {
+  const size_t num_packets = state.range(0);
+  cricket::SrtpSession sender;
+  cricket::SrtpSession receiver;
+  RTC_CHECK(sender.SetSend(crypto_suite, KeyForSuite(crypto_suite), {}));
+  RTC_CHECK(receiver.SetReceive(crypto_suite, KeyForSuite(crypto_suite), {}));
+  std::vector<rtc::CopyOnWriteBuffer> packets = CreatePackets(num_packets);
+  uint16_t sequence_number = 0;
+  for (auto _ : state) {
+    state.PauseTiming();
+    for (size_t i = 0; i < num_packets; ++i) {
+      WriteRtpPacket(packets[i], sequence_number++, 1 + i % kNumSsrcs);
+      RTC_CHECK(sender.ProtectRtp(packets[i]));
+    }
+    state.ResumeTiming();
+    for (rtc::CopyOnWriteBuffer& packet : packets) {
+      bool ok = receiver.UnprotectRtp(packet);
+      benchmark::DoNotOptimize(ok);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * num_packets);
+  state.SetBytesProcessed(state.iterations() * num_packets * kPayloadSize);
+}
+
+BENCHMARK_CAPTURE(BM_ProtectRtp,
+                  AES_CM_128_HMAC_SHA1_80,
+                  rtc::kSrtpAes128CmSha1_80)
+    ->RangeMultiplier(4)
+    ->Range(1, 64);
+BENCHMARK_CAPTURE(BM_ProtectRtp, AEAD_AES_128_GCM, rtc::kSrtpAeadAes128Gcm)
+    ->RangeMultiplier(4)
+    ->Range(1, 64);
+BENCHMARK_CAPTURE(BM_UnprotectRtp,
+                  AES_CM_128_HMAC_SHA1_80,
+                  rtc::kSrtpAes128CmSha1_80)
+    ->RangeMultiplier(4)
+    ->Range(4, 64);
+BENCHMARK_CAPTURE(BM_UnprotectRtp, AEAD_AES_128_GCM, rtc::kSrtpAeadAes128Gcm)
+    ->RangeMultiplier(4)
+    ->Range(4, 64);
+
+}  // namespace
+}  // namespace webrtc
+
+/*
+
+The benchmarks are single threaded, so items_per_second is the number of
+packets per second per core. Run with:
+
+  out/Default/benchmarks --benchmark_filter=Rtp
+*/
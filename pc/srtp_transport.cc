@@ -27,6 +27,7 @@
 #include "rtc_base/checks.h"
 #include "rtc_base/copy_on_write_buffer.h"
 #include "rtc_base/logging.h"
+#include "rtc_base/network/ecn_marking.h"
 #include "rtc_base/network/received_packet.h"
 #include "rtc_base/network_route.h"
 #include "rtc_base/trace_event.h"
@@ -113,7 +114,7 @@ bool SrtpTransport::SendRtcpPacket(rtc::CopyOnWriteBuffer* packet,
   return SendPacket(/*rtcp=*/true, packet, options, flags);
 }
 
-void SrtpTransport::OnRtpPacketReceived(const rtc::ReceivedPacket& packet) {
+void SrtpTransport::OnRtpPacketReceived(rtc::ReceivedPacket packet) {
   TRACE_EVENT0("webrtc", "SrtpTransport::OnRtpPacketReceived");
   if (!IsSrtpActive()) {
     RTC_LOG(LS_WARNING)
@@ -121,7 +122,13 @@ void SrtpTransport::OnRtpPacketReceived(const rtc::ReceivedPacket& packet) {
     return;
   }
 
-  rtc::CopyOnWriteBuffer payload(packet.payload());
+  Timestamp arrival_time =
+      packet.arrival_time().value_or(Timestamp::MinusInfinity());
+  rtc::EcnMarking ecn = packet.ecn();
+  size_t bytes_copied = 0;
+  rtc::CopyOnWriteBuffer payload = std::move(packet).TakePayload(&bytes_copied);
+  // Decryption happens in place; it only copies if `payload` is shared.
+  const uint8_t* encrypted_data = payload.cdata();
   if (!UnprotectRtp(payload)) {
     // Limit the error logging to avoid excessive logs when there are lots of
     // bad packets.
@@ -137,19 +144,22 @@ void SrtpTransport::OnRtpPacketReceived(const rtc::ReceivedPacket& packet) {
     ++decryption_failure_count_;
     return;
   }
-  DemuxPacket(std::move(payload),
-              packet.arrival_time().value_or(Timestamp::MinusInfinity()),
-              packet.ecn());
+  if (payload.cdata() != encrypted_data) {
+    bytes_copied += payload.size();
+  }
+  DemuxPacket(std::move(payload), arrival_time, ecn, bytes_copied);
 }
 
-void SrtpTransport::OnRtcpPacketReceived(const rtc::ReceivedPacket& packet) {
+void SrtpTransport::OnRtcpPacketReceived(rtc::ReceivedPacket packet) {
   TRACE_EVENT0("webrtc", "SrtpTransport::OnRtcpPacketReceived");
   if (!IsSrtpActive()) {
     RTC_LOG(LS_WARNING)
         << "Inactive SRTP transport received an RTCP packet. Drop it.";
     return;
   }
-  rtc::CopyOnWriteBuffer payload(packet.payload());
+  int64_t packet_time_us =
+      packet.arrival_time() ? packet.arrival_time()->us() : -1;
+  rtc::CopyOnWriteBuffer payload = std::move(packet).TakePayload();
   if (!UnprotectRtcp(payload)) {
     int type = -1;
     cricket::GetRtcpType(payload.data(), payload.size(), &type);
@@ -157,8 +167,7 @@ void SrtpTransport::OnRtcpPacketReceived(const rtc::ReceivedPacket& packet) {
                       << payload.size() << ", type=" << type;
     return;
   }
-  SendRtcpPacketReceived(
-      &payload, packet.arrival_time() ? packet.arrival_time()->us() : -1);
+  SendRtcpPacketReceived(&payload, packet_time_us);
 }
 
 void SrtpTransport::OnNetworkRouteChanged(
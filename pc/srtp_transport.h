@@ -114,8 +114,8 @@ class SrtpTransport : public RtpTransport {
   void ConnectToRtpTransport();
   void CreateSrtpSessions();
 
-  void OnRtpPacketReceived(const rtc::ReceivedPacket& packet) override;
-  void OnRtcpPacketReceived(const rtc::ReceivedPacket& packet) override;
+  void OnRtpPacketReceived(rtc::ReceivedPacket packet) override;
+  void OnRtcpPacketReceived(rtc::ReceivedPacket packet) override;
   void OnNetworkRouteChanged(
       std::optional<rtc::NetworkRoute> network_route) override;
 
@@ -19,6 +19,7 @@
 #include "call/rtp_demuxer.h"
 #include "media/base/fake_rtp.h"
 #include "p2p/base/fake_packet_transport.h"
+#include "p2p/base/packet_transport_internal.h"
 #include "p2p/dtls/dtls_transport_internal.h"
 #include "pc/test/rtp_transport_test_util.h"
 #include "pc/test/srtp_test_util.h"
@@ -28,6 +29,8 @@
 #include "rtc_base/checks.h"
 #include "rtc_base/containers/flat_set.h"
 #include "rtc_base/copy_on_write_buffer.h"
+#include "rtc_base/network/received_packet.h"
+#include "rtc_base/socket_address.h"
 #include "rtc_base/ssl_stream_adapter.h"
 #include "rtc_base/third_party/sigslot/sigslot.h"
 #include "test/gtest.h"
@@ -330,6 +333,31 @@ class SrtpTransportTest : public ::testing::Test, public sigslot::has_slots<> {
                                                    encrypted_headers);
   }
 
+  // Returns kPcmuFrame as protected by `srtp_transport1_`, without delivering
+  // it to `srtp_transport2_`. The returned buffer is not shared.
+  rtc::CopyOnWriteBuffer ProtectPcmuFrame() {
+    std::vector<int> extension_ids;
+    EXPECT_TRUE(srtp_transport1_->SetRtpParams(
+        rtc::kSrtpAes128CmSha1_80, kTestKey1, extension_ids,
+        rtc::kSrtpAes128CmSha1_80, kTestKey2, extension_ids));
+    EXPECT_TRUE(srtp_transport2_->SetRtpParams(
+        rtc::kSrtpAes128CmSha1_80, kTestKey2, extension_ids,
+        rtc::kSrtpAes128CmSha1_80, kTestKey1, extension_ids));
+    rtc::FakePacketTransport sink_transport("sink_transport");
+    rtp_packet_transport1_->SetDestination(&sink_transport,
+                                           /*asymmetric=*/true);
+    rtc::CopyOnWriteBuffer packet(
+        kPcmuFrame, sizeof(kPcmuFrame),
+        sizeof(kPcmuFrame) + rtc::rtp_auth_tag_len(rtc::kSrtpAes128CmSha1_80));
+    EXPECT_TRUE(srtp_transport1_->SendRtpPacket(&packet, rtc::PacketOptions(),
+                                                cricket::PF_SRTP_BYPASS));
+    rtp_packet_transport1_->SetDestination(rtp_packet_transport2_.get(),
+                                           /*asymmetric=*/true);
+    const rtc::CopyOnWriteBuffer* sent =
+        rtp_packet_transport1_->last_sent_packet();
+    return rtc::CopyOnWriteBuffer(sent->cdata(), sent->size());
+  }
+
   std::unique_ptr<SrtpTransport> srtp_transport1_;
   std::unique_ptr<SrtpTransport> srtp_transport2_;
 
@@ -482,4 +510,42 @@ TEST_F(SrtpTransportTest, RemoveSrtpReceiveStream) {
   srtp_transport->UnregisterRtpDemuxerSink(&rtp_sink);
 }
 
+TEST_F(SrtpTransportTest, DecryptsTakenPayloadBufferInPlace) {
+  rtc::CopyOnWriteBuffer buffer = ProtectPcmuFrame();
+  const uint8_t* data = buffer.cdata();
+  rtp_packet_transport2_->NotifyPacketReceived(
+      rtc::ReceivedPacket::CreateWithPayloadBuffer(buffer,
+                                                   rtc::SocketAddress()));
+  ASSERT_EQ(rtp_sink2_.rtp_count(), 1);
+  // The buffer was taken and decrypted without copying.
+  EXPECT_TRUE(buffer.empty());
+  EXPECT_EQ(rtp_sink2_.last_recv_rtp_packet().data(), data);
+  EXPECT_EQ(rtp_sink2_.last_recv_rtp_packet().bytes_copied(), 0u);
+  EXPECT_EQ(0, memcmp(rtp_sink2_.last_recv_rtp_packet().data(), kPcmuFrame,
+                      sizeof(kPcmuFrame)));
+}
+
+TEST_F(SrtpTransportTest, DoesNotTakePayloadBufferFromOtherReceivers) {
+  rtc::CopyOnWriteBuffer buffer = ProtectPcmuFrame();
+  const rtc::CopyOnWriteBuffer encrypted(buffer.cdata(), buffer.size());
+  // Registered after `srtp_transport2_`, so it reads the packet after the
+  // SRTP transport has processed it.
+  rtc::CopyOnWriteBuffer seen_by_other_receiver;
+  rtp_packet_transport2_->RegisterReceivedPacketCallback(
+      this, [&](rtc::PacketTransportInternal* transport,
+                const rtc::ReceivedPacket& packet) {
+        seen_by_other_receiver.SetData(packet.payload().data(),
+                                      packet.payload().size());
+      });
+  rtp_packet_transport2_->NotifyPacketReceived(
+      rtc::ReceivedPacket::CreateWithPayloadBuffer(buffer,
+                                                   rtc::SocketAddress()));
+  rtp_packet_transport2_->DeregisterReceivedPacketCallback(this);
+
+  ASSERT_EQ(rtp_sink2_.rtp_count(), 1);
+  EXPECT_EQ(rtp_sink2_.last_recv_rtp_packet().bytes_copied(), encrypted.size());
+  EXPECT_EQ(buffer, encrypted);
+  EXPECT_EQ(seen_by_other_receiver, encrypted);
+}
+
 }  // namespace webrtc
@@ -471,7 +471,13 @@ class FakePeerConnectionForStats : public FakePeerConnectionBase {
     return transport_stats_by_name;
   }
 
-  Call::Stats GetCallStats() override { return call_stats_; }
+  Call::Stats GetCallStats() override {
+    ++get_call_stats_count_;
+    return call_stats_;
+  }
+
+  // The number of times stats were gathered from the media channels.
+  int get_call_stats_count() const { return get_call_stats_count_; }
 
   std::optional<AudioDeviceModule::Stats> GetAudioDeviceStats() override {
     return audio_device_stats_;
@@ -557,6 +563,7 @@ class FakePeerConnectionForStats : public FakePeerConnectionBase {
   std::map<std::string, cricket::TransportStats> transport_stats_by_name_;
 
   Call::Stats call_stats_;
+  int get_call_stats_count_ = 0;
 
   std::optional<AudioDeviceModule::Stats> audio_device_stats_;
 
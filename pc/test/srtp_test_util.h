@@ -19,6 +19,9 @@ static const rtc::ZeroOnFreeBuffer<uint8_t> kTestKey1{
     "ABCDEFGHIJKLMNOPQRSTUVWXYZ1234", 30};
 static const rtc::ZeroOnFreeBuffer<uint8_t> kTestKey2{
     "4321ZYXWVUTSRQPONMLKJIHGFEDCBA", 30};
+// 128 bits key + 96 bits salt.
+static const rtc::ZeroOnFreeBuffer<uint8_t> kTestKeyGcm128{
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZ12", 28};
 
 static int rtp_auth_tag_len(int crypto_suite) {
   switch (crypto_suite) {
@@ -14,11 +14,13 @@
 #include <memory>
 #include <optional>
 
+#include "api/array_view.h"
 #include "api/sequence_checker.h"
 #include "api/units/time_delta.h"
 #include "api/units/timestamp.h"
 #include "rtc_base/async_packet_socket.h"
 #include "rtc_base/checks.h"
+#include "rtc_base/copy_on_write_buffer.h"
 #include "rtc_base/logging.h"
 #include "rtc_base/network/received_packet.h"
 #include "rtc_base/network/sent_packet.h"
@@ -29,6 +31,15 @@
 
 namespace rtc {
 
+namespace {
+
+// Size of the buffer the start of each datagram is read into. Datagrams that
+// fit in a typical Ethernet MTU, which covers all media packets, are handed to
+// receivers without copying.
+constexpr size_t kHeadBufferSize = 1500;
+
+}  // namespace
+
 AsyncUDPSocket* AsyncUDPSocket::Create(Socket* socket,
                                        const SocketAddress& bind_address) {
   std::unique_ptr<Socket> owned_socket(socket);
@@ -122,7 +133,14 @@ void AsyncUDPSocket::OnReadEvent(Socket* socket) {
   RTC_DCHECK(socket_.get() == socket);
   RTC_DCHECK_RUN_ON(&sequence_checker_);
 
+  if (head_buffer_.capacity() < kHeadBufferSize) {
+    // The previous buffer was taken by a receiver.
+    head_buffer_ = CopyOnWriteBuffer(kHeadBufferSize);
+  }
+  head_buffer_.SetSize(kHeadBufferSize);
   Socket::ReceiveBuffer receive_buffer(buffer_);
+  receive_buffer.head = rtc::ArrayView<uint8_t>(head_buffer_.MutableData(),
+                                                head_buffer_.size());
   int len = socket_->RecvFrom(receive_buffer);
   if (len < 0) {
     // An error here typically means we got an ICMP error in response to our
@@ -150,9 +168,21 @@ void AsyncUDPSocket::OnReadEvent(Socket* socket) {
     }
     *receive_buffer.arrival_time += *socket_time_offset_;
   }
-  NotifyPacketReceived(
-      ReceivedPacket(receive_buffer.payload, receive_buffer.source_address,
-                     receive_buffer.arrival_time, receive_buffer.ecn));
+  if (receive_buffer.head_size == 0) {
+    // Scatter reads are not supported by `socket_`.
+    NotifyPacketReceived(
+        ReceivedPacket(receive_buffer.payload, receive_buffer.source_address,
+                       receive_buffer.arrival_time, receive_buffer.ecn));
+    return;
+  }
+  head_buffer_.SetSize(receive_buffer.head_size);
+  if (!receive_buffer.payload.empty()) {
+    // The datagram did not fit in `head_buffer_`; stitch it together.
+    head_buffer_.AppendData(receive_buffer.payload);
+  }
+  NotifyPacketReceived(ReceivedPacket::CreateWithPayloadBuffer(
+      head_buffer_, receive_buffer.source_address, receive_buffer.arrival_time,
+      receive_buffer.ecn));
 }
 
 void AsyncUDPSocket::OnWriteEvent(Socket* socket) {
@@ -20,6 +20,7 @@
 #include "api/units/time_delta.h"
 #include "rtc_base/async_packet_socket.h"
 #include "rtc_base/buffer.h"
+#include "rtc_base/copy_on_write_buffer.h"
 #include "rtc_base/socket.h"
 #include "rtc_base/socket_address.h"
 #include "rtc_base/socket_factory.h"
@@ -70,6 +71,12 @@ class AsyncUDPSocket : public AsyncPacketSocket {
   RTC_NO_UNIQUE_ADDRESS webrtc::SequenceChecker sequence_checker_;
   std::unique_ptr<Socket> socket_;
   bool has_set_ect1_options_ = false;
+  // Datagrams are read into `head_buffer_` first, which receivers can take
+  // over through ReceivedPacket::TakePayload() to keep the payload without
+  // copying it. It is only reallocated after it has been taken. `buffer_`
+  // receives the tail of datagrams that don't fit in `head_buffer_`, or the
+  // whole datagram if the socket does not support scatter reads.
+  rtc::CopyOnWriteBuffer head_buffer_ RTC_GUARDED_BY(sequence_checker_);
   rtc::Buffer buffer_ RTC_GUARDED_BY(sequence_checker_);
   std::optional<webrtc::TimeDelta> socket_time_offset_
       RTC_GUARDED_BY(sequence_checker_);
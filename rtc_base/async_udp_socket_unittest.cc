@@ -10,15 +10,25 @@
 
 #include "rtc_base/async_udp_socket.h"
 
+#include <cstddef>
 #include <cstdint>
 #include <memory>
+#include <optional>
+#include <vector>
 
 #include "absl/memory/memory.h"
+#include "api/test/rtc_error_matchers.h"
 #include "rtc_base/async_packet_socket.h"
+#include "rtc_base/copy_on_write_buffer.h"
+#include "rtc_base/network/received_packet.h"
+#include "rtc_base/physical_socket_server.h"
 #include "rtc_base/socket.h"
 #include "rtc_base/socket_address.h"
+#include "rtc_base/thread.h"
 #include "rtc_base/virtual_socket_server.h"
+#include "test/gmock.h"
 #include "test/gtest.h"
+#include "test/wait_until.h"
 
 namespace rtc {
 
@@ -52,4 +62,67 @@ TEST(AsyncUDPSocketTest, SetSocketOptionIfEctChange) {
   EXPECT_EQ(ect, 0);
 }
 
+class AsyncUDPSocketReceiveTest : public ::testing::Test {
+ protected:
+  AsyncUDPSocketReceiveTest() : thread_(&socket_server_) {
+    receiver_ = absl::WrapUnique(
+        AsyncUDPSocket::Create(&socket_server_, SocketAddress("127.0.0.1", 0)));
+    sender_ = absl::WrapUnique(
+        AsyncUDPSocket::Create(&socket_server_, SocketAddress("127.0.0.1", 0)));
+  }
+
+  // Sends `size` bytes to the receiver and returns the payload taken from the
+  // ReceivedPacket, and the number of bytes copied to take it.
+  std::optional<CopyOnWriteBuffer> SendAndTake(size_t size,
+                                               size_t& bytes_copied) {
+    std::vector<uint8_t> data(size);
+    for (size_t i = 0; i < size; ++i) {
+      data[i] = static_cast<uint8_t>(i);
+    }
+    std::optional<CopyOnWriteBuffer> taken;
+    receiver_->RegisterReceivedPacketCallback(
+        [&](AsyncPacketSocket* socket, const ReceivedPacket& packet) {
+          taken = ReceivedPacket(packet).TakePayload(&bytes_copied);
+        });
+    sender_->SendTo(data.data(), data.size(), receiver_->GetLocalAddress(),
+                    PacketOptions());
+    EXPECT_THAT(webrtc::WaitUntil([&] { return taken.has_value(); },
+                                  ::testing::IsTrue()),
+                webrtc::IsRtcOk());
+    receiver_->DeregisterReceivedPacketCallback();
+    if (taken) {
+      EXPECT_EQ(*taken, CopyOnWriteBuffer(data.data(), data.size()));
+    }
+    return taken;
+  }
+
+  PhysicalSocketServer socket_server_;
+  AutoSocketServerThread thread_;
+  std::unique_ptr<AsyncUDPSocket> receiver_;
+  std::unique_ptr<AsyncUDPSocket> sender_;
+};
+
+// Scatter reads are only implemented for POSIX sockets.
+#if defined(WEBRTC_POSIX)
+TEST_F(AsyncUDPSocketReceiveTest, PayloadIsTakenWithoutCopy) {
+  size_t bytes_copied = 0;
+  std::optional<CopyOnWriteBuffer> first = SendAndTake(1200, bytes_copied);
+  std::optional<CopyOnWriteBuffer> second = SendAndTake(1200, bytes_copied);
+  ASSERT_TRUE(first && second);
+  EXPECT_EQ(bytes_copied, 0u);
+  // Each packet got its own buffer, which can be modified in place.
+  EXPECT_NE(first->cdata(), second->cdata());
+  const uint8_t* data = first->cdata();
+  first->MutableData()[0] = 0xFF;
+  EXPECT_EQ(first->cdata(), data);
+}
+#endif  // defined(WEBRTC_POSIX)
+
+TEST_F(AsyncUDPSocketReceiveTest, LargePayloadIsReceivedWhole) {
+  size_t bytes_copied = 0;
+  std::optional<CopyOnWriteBuffer> taken = SendAndTake(4000, bytes_copied);
+  ASSERT_TRUE(taken);
+  EXPECT_EQ(taken->size(), 4000u);
+}
+
 }  // namespace rtc
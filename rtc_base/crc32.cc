@@ -10,40 +10,97 @@
 
 #include "rtc_base/crc32.h"
 
-#include "rtc_base/arraysize.h"
+#include <string.h>
+
+#include "rtc_base/system/arch.h"
+
+#if defined(__aarch64__) && defined(__ARM_FEATURE_CRC32)
+#include <arm_acle.h>
+#define WEBRTC_HAS_ARM_CRC32
+#endif
 
 namespace rtc {
 
-// This implementation is based on the sample implementation in RFC 1952.
+// This implementation is based on the sample implementation in RFC 1952,
+// extended to process 8 bytes per step ("slicing-by-8").
 
 // CRC32 polynomial, in reversed form.
 // See RFC 1952, or http://en.wikipedia.org/wiki/Cyclic_redundancy_check
 static const uint32_t kCrc32Polynomial = 0xEDB88320;
 
-static uint32_t* LoadCrc32Table() {
-  static uint32_t kCrc32Table[256];
-  for (uint32_t i = 0; i < arraysize(kCrc32Table); ++i) {
-    uint32_t c = i;
-    for (size_t j = 0; j < 8; ++j) {
-      if (c & 1) {
-        c = kCrc32Polynomial ^ (c >> 1);
-      } else {
-        c >>= 1;
+namespace {
+
+#if !defined(WEBRTC_HAS_ARM_CRC32)
+// `table[0]` is the usual byte-wise table. `table[k][i]` is the CRC of byte
+// `i` followed by `k` zero bytes, so that 8 bytes can be folded into the CRC
+// with 8 independent lookups.
+struct Crc32Tables {
+  uint32_t table[8][256];
+};
+
+const Crc32Tables& GetCrc32Tables() {
+  static const Crc32Tables* const kTables = [] {
+    Crc32Tables* tables = new Crc32Tables();
+    for (uint32_t i = 0; i < 256; ++i) {
+      uint32_t c = i;
+      for (size_t j = 0; j < 8; ++j) {
+        if (c & 1) {
+          c = kCrc32Polynomial ^ (c >> 1);
+        } else {
+          c >>= 1;
+        }
       }
+      tables->table[0][i] = c;
     }
-    kCrc32Table[i] = c;
-  }
-  return kCrc32Table;
+    for (uint32_t i = 0; i < 256; ++i) {
+      uint32_t c = tables->table[0][i];
+      for (size_t k = 1; k < 8; ++k) {
+        c = tables->table[0][c & 0xFF] ^ (c >> 8);
+        tables->table[k][i] = c;
+      }
+    }
+    return tables;
+  }();
+  return *kTables;
 }
+#endif
 
-uint32_t UpdateCrc32(uint32_t start, const void* buf, size_t len) {
-  static uint32_t* kCrc32Table = LoadCrc32Table();
+}  // namespace
 
+uint32_t UpdateCrc32(uint32_t start, const void* buf, size_t len) {
   uint32_t c = start ^ 0xFFFFFFFF;
   const uint8_t* u = static_cast<const uint8_t*>(buf);
-  for (size_t i = 0; i < len; ++i) {
-    c = kCrc32Table[(c ^ u[i]) & 0xFF] ^ (c >> 8);
+#if defined(WEBRTC_HAS_ARM_CRC32)
+  // The ARMv8 CRC32 instructions use the same polynomial as above. Note that
+  // the SSE4.2 crc32 instruction on x86 computes CRC-32C, which STUN does not
+  // use, so x86 takes the table-driven path below.
+  for (; len >= 8; len -= 8, u += 8) {
+    uint64_t word;
+    memcpy(&word, u, sizeof(word));
+    c = __crc32d(c, word);
+  }
+  for (; len > 0; --len, ++u) {
+    c = __crc32b(c, *u);
+  }
+#else
+  const Crc32Tables& tables = GetCrc32Tables();
+#if defined(WEBRTC_ARCH_LITTLE_ENDIAN)
+  for (; len >= 8; len -= 8, u += 8) {
+    uint32_t low;
+    uint32_t high;
+    memcpy(&low, u, sizeof(low));
+    memcpy(&high, u + 4, sizeof(high));
+    low ^= c;
+    c = tables.table[7][low & 0xFF] ^ tables.table[6][(low >> 8) & 0xFF] ^
+        tables.table[5][(low >> 16) & 0xFF] ^ tables.table[4][low >> 24] ^
+        tables.table[3][high & 0xFF] ^ tables.table[2][(high >> 8) & 0xFF] ^
+        tables.table[1][(high >> 16) & 0xFF] ^ tables.table[0][high >> 24];
+  }
+#endif
+  for (; len > 0; --len, ++u) {
+    c = tables.table[0][(c ^ *u) & 0xFF] ^ (c >> 8);
   }
+#endif
   return c ^ 0xFFFFFFFF;
 }
 
@@ -34,4 +34,19 @@ TEST(Crc32Test, TestMultipleUpdates) {
   EXPECT_EQ(0x171A3F5FU, c);
 }
 
+TEST(Crc32Test, LongInputMatchesByteWiseUpdates) {
+  // Long enough to be processed in 8-byte steps, at every alignment.
+  std::string input;
+  for (int i = 0; i < 100; ++i) {
+    input.push_back(static_cast<char>(i * 37));
+  }
+  for (size_t offset = 0; offset < 8; ++offset) {
+    uint32_t expected = 0;
+    for (size_t i = offset; i < input.size(); ++i) {
+      expected = UpdateCrc32(expected, &input[i], 1);
+    }
+    EXPECT_EQ(expected, ComputeCrc32(&input[offset], input.size() - offset));
+  }
+}
+
 }  // namespace rtc
@@ -10,9 +10,11 @@
 
 #include "rtc_base/network/received_packet.h"
 
+#include <cstddef>
 #include <optional>
 #include <utility>
 
+#include "rtc_base/copy_on_write_buffer.h"
 #include "rtc_base/socket_address.h"
 
 namespace rtc {
@@ -30,8 +32,47 @@ ReceivedPacket::ReceivedPacket(rtc::ArrayView<const uint8_t> payload,
 
 ReceivedPacket ReceivedPacket::CopyAndSet(
     DecryptionInfo decryption_info) const {
-  return ReceivedPacket(payload_, source_address_, arrival_time_, ecn_,
+  ReceivedPacket packet(payload_, source_address_, arrival_time_, ecn_,
                         decryption_info);
+  packet.payload_buffer_ = payload_buffer_;
+  return packet;
+}
+
+CopyOnWriteBuffer ReceivedPacket::TakePayload(size_t* bytes_copied) && {
+  rtc::ArrayView<const uint8_t> payload = payload_;
+  CopyOnWriteBuffer* payload_buffer = payload_buffer_;
+  payload_ = {};
+  payload_buffer_ = nullptr;
+  if (payload_buffer != nullptr && !payload.empty() &&
+      payload.data() >= payload_buffer->cdata() &&
+      payload.data() + payload.size() <=
+          payload_buffer->cdata() + payload_buffer->size()) {
+    size_t offset = payload.data() - payload_buffer->cdata();
+    // Move the buffer out first so that the returned slice holds the only
+    // reference once `buffer` goes out of scope.
+    CopyOnWriteBuffer buffer = std::move(*payload_buffer);
+    if (offset == 0 && payload.size() == buffer.size()) {
+      return buffer;
+    }
+    return buffer.Slice(offset, payload.size());
+  }
+  if (bytes_copied) {
+    *bytes_copied += payload.size();
+  }
+  return CopyOnWriteBuffer(payload.data(), payload.size());
+}
+
+// static
+ReceivedPacket ReceivedPacket::CreateWithPayloadBuffer(
+    CopyOnWriteBuffer& payload_buffer,
+    const SocketAddress& source_address,
+    std::optional<webrtc::Timestamp> arrival_time,
+    EcnMarking ecn) {
+  ReceivedPacket packet(
+      rtc::MakeArrayView(payload_buffer.cdata(), payload_buffer.size()),
+      source_address, std::move(arrival_time), ecn);
+  packet.payload_buffer_ = &payload_buffer;
+  return packet;
 }
 
 // static
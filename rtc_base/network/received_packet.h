@@ -10,11 +10,13 @@
 #ifndef RTC_BASE_NETWORK_RECEIVED_PACKET_H_
 #define RTC_BASE_NETWORK_RECEIVED_PACKET_H_
 
+#include <cstddef>
 #include <cstdint>
 #include <optional>
 
 #include "api/array_view.h"
 #include "api/units/timestamp.h"
+#include "rtc_base/copy_on_write_buffer.h"
 #include "rtc_base/network/ecn_marking.h"
 #include "rtc_base/socket_address.h"
 #include "rtc_base/system/rtc_export.h"
@@ -59,6 +61,31 @@ class RTC_EXPORT ReceivedPacket {
 
   const DecryptionInfo& decryption_info() const { return decryption_info_; }
 
+  // Takes the payload out of the packet, which is left with an empty payload.
+  // Only the final receiver of a packet may call this. If the packet is backed
+  // by a payload buffer that has not been taken yet, the buffer is handed over
+  // without copying and the returned buffer holds the only reference to it, so
+  // it can be modified in place (e.g. SRTP decrypted). Otherwise the payload is
+  // copied and the number of copied bytes is added to `bytes_copied`, if
+  // non-null.
+  CopyOnWriteBuffer TakePayload(size_t* bytes_copied = nullptr) &&;
+
+  // True if the packet is backed by a payload buffer that TakePayload() may
+  // hand over without copying.
+  bool has_payload_buffer() const { return payload_buffer_ != nullptr; }
+
+  // Creates a packet whose payload is held by `payload_buffer`. The final
+  // receiver of the packet may take over the buffer with TakePayload() instead
+  // of copying it. Copies of the packet share `payload_buffer`, so a packet
+  // that is delivered to more than one receiver must be delivered without it.
+  // The caller must keep `payload_buffer` valid for the lifetime of the
+  // returned packet.
+  static ReceivedPacket CreateWithPayloadBuffer(
+      CopyOnWriteBuffer& payload_buffer,
+      const SocketAddress& source_address,
+      std::optional<webrtc::Timestamp> arrival_time = std::nullopt,
+      EcnMarking ecn = EcnMarking::kNotEct);
+
   static ReceivedPacket CreateFromLegacy(
       const char* data,
       size_t size,
@@ -76,6 +103,8 @@ class RTC_EXPORT ReceivedPacket {
 
  private:
   rtc::ArrayView<const uint8_t> payload_;
+  // Buffer backing `payload_`, if any. Not owned.
+  CopyOnWriteBuffer* payload_buffer_ = nullptr;
   std::optional<webrtc::Timestamp> arrival_time_;
   const SocketAddress& source_address_;
   EcnMarking ecn_;
@@ -0,0 +1,328 @@
+/*
+ *  Copyright (c) 2025 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef RTC_BASE_NUMERICS_SEQUENCE_NUMBER_WINDOW_H_
+#define RTC_BASE_NUMERICS_SEQUENCE_NUMBER_WINDOW_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "absl/numeric/bits.h"
+#include "rtc_base/checks.h"
+#include "rtc_base/numerics/sequence_number_util.h"
+
+namespace webrtc {
+
+// Maps 16 bit sequence numbers to values of type `T`, for sequence numbers
+// that are at most `max_size` - 1 older than the newest one in the window.
+//
+// Presence is kept in a bitset indexed by the sequence number modulo the
+// storage size, so Insert(), Find() and Erase() are constant time, while
+// ForEach() and EraseBefore() process 64 sequence numbers per step. The storage
+// grows with the distance between the oldest and the newest entry, up to
+// `max_size`. EraseBefore(), Clear() and ShrinkToFit() shrink it again once
+// that distance is a quarter of the storage size, and release it when the
+// window is empty. Erase() never reallocates, so that it may be called from
+// ForEach().
+//
+// Inserting a sequence number ahead of the newest entry moves the window
+// forward and drops the entries that fall out of it. Sequence numbers that are
+// older than the window are not inserted.
+//
+// Erased values are not destroyed until their slot is reused, so `T` is
+// restricted to trivially destructible types.
+template <typename T>
+class SequenceNumberWindow {
+ public:
+  static_assert(std::is_trivially_destructible_v<T>,
+                "Values must be trivially destructible.");
+
+  static constexpr size_t kMaxSize = 1 << 15;
+
+  explicit SequenceNumberWindow(size_t max_size) : max_size_(max_size) {
+    RTC_DCHECK_GT(max_size_, 0);
+    RTC_DCHECK_LE(max_size_, kMaxSize);
+  }
+
+  bool empty() const { return size_ == 0; }
+  size_t size() const { return size_; }
+  // Number of sequence numbers the storage has room for.
+  size_t capacity() const { return capacity_; }
+
+  bool contains(uint16_t sequence_number) const {
+    return !empty() && InRange(sequence_number) &&
+           IsSet(Slot(sequence_number));
+  }
+
+  T* Find(uint16_t sequence_number) {
+    return contains(sequence_number) ? &values_[Slot(sequence_number)]
+                                     : nullptr;
+  }
+
+  // Inserts `value` for `sequence_number`, replacing any previous value.
+  // Returns nullptr if `sequence_number` is too old to fit in the window.
+  T* Insert(uint16_t sequence_number, T value) {
+    if (empty()) {
+      // Storage left behind by Erase() is not needed anymore.
+      if (capacity_ > kMinCapacity) {
+        Resize(kMinCapacity);
+      }
+      EnsureCapacity(1);
+      oldest_ = sequence_number;
+      newest_ = sequence_number;
+    } else {
+      uint16_t age = newest_ - sequence_number;
+      if (age < max_size_) {
+        if (age > static_cast<uint16_t>(newest_ - oldest_)) {
+          EnsureCapacity(age + 1);
+          oldest_ = sequence_number;
+        }
+      } else if (AheadOf(sequence_number, newest_)) {
+        // The storage is kept, as it is about to be filled again.
+        EraseBits(sequence_number - static_cast<uint16_t>(max_size_ - 1));
+        if (empty()) {
+          EnsureCapacity(1);
+          oldest_ = sequence_number;
+        } else {
+          EnsureCapacity(static_cast<uint16_t>(sequence_number - oldest_) + 1);
+        }
+        newest_ = sequence_number;
+      } else {
+        return nullptr;
+      }
+    }
+
+    size_t slot = Slot(sequence_number);
+    if (!IsSet(slot)) {
+      bits_[slot / 64] |= uint64_t{1} << (slot % 64);
+      ++size_;
+    }
+    values_[slot] = std::move(value);
+    return &values_[slot];
+  }
+
+  // Returns false if `sequence_number` was not in the window.
+  bool Erase(uint16_t sequence_number) {
+    if (!contains(sequence_number)) {
+      return false;
+    }
+    size_t slot = Slot(sequence_number);
+    bits_[slot / 64] &= ~(uint64_t{1} << (slot % 64));
+    if (--size_ == 0) {
+      return true;
+    }
+    if (sequence_number == oldest_) {
+      oldest_ = sequence_number + DistanceToNext(sequence_number + 1) + 1;
+    } else if (sequence_number == newest_) {
+      newest_ = sequence_number - DistanceToPrevious(sequence_number - 1) - 1;
+    }
+    return true;
+  }
+
+  // Erases all entries older than `sequence_number`. Must not be called from
+  // ForEach().
+  void EraseBefore(uint16_t sequence_number) {
+    EraseBits(sequence_number);
+    ShrinkToFit();
+  }
+
+  // Must not be called from ForEach().
+  void Clear() {
+    size_ = 0;
+    ShrinkToFit();
+  }
+
+  // Shrinks the storage if the entries use at most a quarter of it, and
+  // releases it if the window is empty. Must not be called from ForEach().
+  void ShrinkToFit() {
+    if (capacity_ <= kMinCapacity) {
+      if (empty()) {
+        std::fill(bits_.begin(), bits_.end(), 0);
+      }
+      return;
+    }
+    if (empty()) {
+      bits_ = std::vector<uint64_t>();
+      values_ = nullptr;
+      capacity_ = 0;
+      return;
+    }
+    const size_t span = static_cast<uint16_t>(newest_ - oldest_) + 1;
+    if (span > capacity_ / 4) {
+      return;
+    }
+    // Leave room for the span to double before growing again.
+    size_t capacity = kMinCapacity;
+    while (capacity < 2 * span) {
+      capacity *= 2;
+    }
+    Resize(capacity);
+  }
+
+  // Calls `f(sequence_number, value)` for each entry, from the oldest to the
+  // newest. `f` may erase the entry it is called for, but must not otherwise
+  // modify the window.
+  template <typename F>
+  void ForEach(F&& f) {
+    ForEachSequenceNumber([&](uint16_t sequence_number) {
+      f(sequence_number, values_[Slot(sequence_number)]);
+    });
+  }
+  template <typename F>
+  void ForEach(F&& f) const {
+    ForEachSequenceNumber([&](uint16_t sequence_number) {
+      f(sequence_number, values_[Slot(sequence_number)]);
+    });
+  }
+
+ private:
+  static constexpr size_t kMinCapacity = 64;
+
+  // Erases all entries older than `sequence_number`, keeping the storage.
+  void EraseBits(uint16_t sequence_number) {
+    if (empty() || !AheadOf(sequence_number, oldest_)) {
+      return;
+    }
+    if (AheadOf(sequence_number, newest_)) {
+      std::fill(bits_.begin(), bits_.end(), 0);
+      size_ = 0;
+      return;
+    }
+    ForEachWord(oldest_, static_cast<uint16_t>(sequence_number - oldest_),
+                [&](size_t word_index, uint64_t mask) {
+                  size_ -= absl::popcount(bits_[word_index] & mask);
+                  bits_[word_index] &= ~mask;
+                });
+    oldest_ = sequence_number + DistanceToNext(sequence_number);
+  }
+
+  size_t Slot(uint16_t sequence_number) const {
+    return sequence_number & (capacity_ - 1);
+  }
+  bool IsSet(size_t slot) const {
+    return (bits_[slot / 64] >> (slot % 64)) & 1;
+  }
+  bool InRange(uint16_t sequence_number) const {
+    return static_cast<uint16_t>(newest_ - sequence_number) <=
+           static_cast<uint16_t>(newest_ - oldest_);
+  }
+
+  // Calls `f(word_index, mask)` for the bits of the `count` sequence numbers
+  // starting at `first`, one word at a time.
+  template <typename F>
+  void ForEachWord(uint16_t first, size_t count, F&& f) const {
+    while (count > 0) {
+      size_t slot = Slot(first);
+      size_t bit = slot % 64;
+      size_t n = std::min(64 - bit, count);
+      uint64_t mask = n == 64 ? ~uint64_t{0} : ((uint64_t{1} << n) - 1) << bit;
+      f(slot / 64, mask);
+      first += static_cast<uint16_t>(n);
+      count -= n;
+    }
+  }
+
+  template <typename F>
+  void ForEachSequenceNumber(F&& f) const {
+    if (empty()) {
+      return;
+    }
+    uint16_t first = oldest_;
+    ForEachWord(first, static_cast<uint16_t>(newest_ - oldest_) + 1,
+                [&](size_t word_index, uint64_t mask) {
+                  uint64_t word = bits_[word_index] & mask;
+                  uint16_t word_start = first - first % 64;
+                  while (word != 0) {
+                    f(static_cast<uint16_t>(word_start +
+                                            absl::countr_zero(word)));
+                    word &= word - 1;
+                  }
+                  first = word_start + 64;
+                });
+  }
+
+  // Returns the distance from `sequence_number` to the first entry at or after
+  // it. There must be such an entry in the window.
+  uint16_t DistanceToNext(uint16_t sequence_number) const {
+    size_t slot = Slot(sequence_number);
+    uint64_t word = bits_[slot / 64] >> (slot % 64);
+    uint16_t distance = 0;
+    while (word == 0) {
+      distance += 64 - slot % 64;
+      RTC_DCHECK_LE(distance, capacity_);
+      slot = (slot - slot % 64 + 64) & (capacity_ - 1);
+      word = bits_[slot / 64];
+    }
+    return distance + absl::countr_zero(word);
+  }
+
+  // Returns the distance from `sequence_number` back to the first entry at or
+  // before it. There must be such an entry in the window.
+  uint16_t DistanceToPrevious(uint16_t sequence_number) const {
+    size_t slot = Slot(sequence_number);
+    uint64_t word = bits_[slot / 64] << (63 - slot % 64);
+    uint16_t distance = 0;
+    while (word == 0) {
+      distance += slot % 64 + 1;
+      RTC_DCHECK_LE(distance, capacity_);
+      slot = (slot - slot % 64 - 1) & (capacity_ - 1);
+      word = bits_[slot / 64];
+    }
+    return distance + absl::countl_zero(word);
+  }
+
+  // Grows the storage to hold at least `span` consecutive sequence numbers.
+  void EnsureCapacity(size_t span) {
+    if (span <= capacity_) {
+      return;
+    }
+    RTC_DCHECK_LE(span, max_size_);
+    size_t capacity = std::max(capacity_, kMinCapacity);
+    while (capacity < span) {
+      capacity *= 2;
+    }
+    Resize(capacity);
+  }
+
+  // Moves the entries to storage for `capacity` sequence numbers, a power of
+  // two that is at least the span of the entries.
+  void Resize(size_t capacity) {
+    RTC_DCHECK_GE(capacity, kMinCapacity);
+    std::vector<uint64_t> bits(capacity / 64);
+    auto values = std::make_unique<T[]>(capacity);
+    ForEachSequenceNumber([&](uint16_t sequence_number) {
+      size_t slot = sequence_number & (capacity - 1);
+      bits[slot / 64] |= uint64_t{1} << (slot % 64);
+      values[slot] = std::move(values_[Slot(sequence_number)]);
+    });
+    bits_ = std::move(bits);
+    values_ = std::move(values);
+    capacity_ = capacity;
+  }
+
+  const size_t max_size_;
+  std::vector<uint64_t> bits_;
+  std::unique_ptr<T[]> values_;
+  size_t capacity_ = 0;
+  size_t size_ = 0;
+  // Valid when not empty; both are always present in the window.
+  uint16_t oldest_ = 0;
+  uint16_t newest_ = 0;
+};
+
+}  // namespace webrtc
+
+#endif  // RTC_BASE_NUMERICS_SEQUENCE_NUMBER_WINDOW_H_
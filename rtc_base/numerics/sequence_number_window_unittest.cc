@@ -0,0 +1,168 @@
+/*
+ *  Copyright (c) 2025 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "rtc_base/numerics/sequence_number_window.h"
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "test/gmock.h"
+#include "test/gtest.h"
+
+namespace webrtc {
+namespace {
+
+using ::testing::ElementsAre;
+using ::testing::IsEmpty;
+using ::testing::Pair;
+
+std::vector<std::pair<uint16_t, int>> Entries(
+    const SequenceNumberWindow<int>& window) {
+  std::vector<std::pair<uint16_t, int>> entries;
+  window.ForEach([&](uint16_t sequence_number, const int& value) {
+    entries.emplace_back(sequence_number, value);
+  });
+  return entries;
+}
+
+TEST(SequenceNumberWindowTest, InsertFindAndErase) {
+  SequenceNumberWindow<int> window(100);
+  EXPECT_TRUE(window.empty());
+  EXPECT_EQ(window.Find(1), nullptr);
+
+  ASSERT_NE(window.Insert(1, 10), nullptr);
+  ASSERT_NE(window.Insert(3, 30), nullptr);
+  EXPECT_EQ(window.size(), 2u);
+  EXPECT_TRUE(window.contains(1));
+  EXPECT_FALSE(window.contains(2));
+  EXPECT_EQ(*window.Find(3), 30);
+
+  *window.Insert(3, 31) += 1;
+  EXPECT_EQ(window.size(), 2u);
+  EXPECT_EQ(*window.Find(3), 32);
+
+  EXPECT_TRUE(window.Erase(1));
+  EXPECT_FALSE(window.Erase(1));
+  EXPECT_FALSE(window.Erase(2));
+  EXPECT_THAT(Entries(window), ElementsAre(Pair(3, 32)));
+}
+
+TEST(SequenceNumberWindowTest, IteratesInSequenceNumberOrderOverWrap) {
+  SequenceNumberWindow<int> window(1000);
+  window.Insert(2, 2);
+  window.Insert(65534, -2);
+  window.Insert(0, 0);
+  window.Insert(65000, -536);
+  EXPECT_THAT(Entries(window), ElementsAre(Pair(65000, -536), Pair(65534, -2),
+                                           Pair(0, 0), Pair(2, 2)));
+}
+
+TEST(SequenceNumberWindowTest, DropsEntriesThatFallOutOfTheWindow) {
+  SequenceNumberWindow<int> window(100);
+  window.Insert(65500, 1);
+  window.Insert(65530, 2);
+  window.Insert(64, 3);
+  EXPECT_THAT(Entries(window), ElementsAre(Pair(65530, 2), Pair(64, 3)));
+
+  // Too old to fit in the window.
+  EXPECT_EQ(window.Insert(65500, 1), nullptr);
+
+  window.Insert(1000, 4);
+  EXPECT_THAT(Entries(window), ElementsAre(Pair(1000, 4)));
+}
+
+TEST(SequenceNumberWindowTest, EraseBefore) {
+  SequenceNumberWindow<int> window(1000);
+  for (uint16_t i = 0; i < 200; i += 2) {
+    window.Insert(65400 + i, i);
+  }
+  window.EraseBefore(65535);
+  EXPECT_EQ(window.size(), 32u);
+  EXPECT_EQ(Entries(window).front(), std::make_pair(uint16_t{0}, 136));
+
+  window.EraseBefore(100);
+  EXPECT_THAT(Entries(window), IsEmpty());
+  EXPECT_TRUE(window.empty());
+}
+
+TEST(SequenceNumberWindowTest, EraseWhileIterating) {
+  SequenceNumberWindow<int> window(1000);
+  for (uint16_t i = 0; i < 500; ++i) {
+    window.Insert(65300 + i, i);
+  }
+  window.ForEach([&](uint16_t sequence_number, int& value) {
+    if (value % 3 != 0) {
+      window.Erase(sequence_number);
+    }
+  });
+  EXPECT_EQ(window.size(), 167u);
+  for (uint16_t i = 0; i < 500; ++i) {
+    EXPECT_EQ(window.contains(65300 + i), i % 3 == 0);
+  }
+}
+
+TEST(SequenceNumberWindowTest, ShrinksStorageAsEntriesAreErased) {
+  SequenceNumberWindow<int> window(10000);
+  for (uint16_t i = 0; i < 4000; ++i) {
+    window.Insert(65000 + i, i);
+  }
+  const size_t full_capacity = window.capacity();
+  EXPECT_GE(full_capacity, 4000u);
+
+  window.EraseBefore(65000 + 3990);
+  EXPECT_LT(window.capacity(), full_capacity);
+  EXPECT_GE(window.capacity(), 10u);
+  EXPECT_EQ(window.size(), 10u);
+  EXPECT_EQ(Entries(window).front(),
+            std::make_pair(static_cast<uint16_t>(65000 + 3990), 3990));
+  EXPECT_EQ(Entries(window).back(),
+            std::make_pair(static_cast<uint16_t>(65000 + 3999), 3999));
+}
+
+TEST(SequenceNumberWindowTest, ReleasesStorageWhenCleared) {
+  SequenceNumberWindow<int> window(10000);
+  for (uint16_t i = 0; i < 4000; ++i) {
+    window.Insert(i, i);
+  }
+  window.Clear();
+  EXPECT_EQ(window.capacity(), 0u);
+  EXPECT_THAT(Entries(window), IsEmpty());
+
+  window.Insert(7, 7);
+  EXPECT_THAT(Entries(window), ElementsAre(Pair(7, 7)));
+}
+
+TEST(SequenceNumberWindowTest, ShrinksStorageAfterErase) {
+  SequenceNumberWindow<int> window(10000);
+  for (uint16_t i = 0; i < 4000; ++i) {
+    window.Insert(i, i);
+  }
+  window.ForEach([&](uint16_t sequence_number, int& /* value */) {
+    window.Erase(sequence_number);
+  });
+  EXPECT_TRUE(window.empty());
+  window.ShrinkToFit();
+  EXPECT_EQ(window.capacity(), 0u);
+
+  // Storage left behind by Erase() is also dropped on the next insertion.
+  for (uint16_t i = 0; i < 4000; ++i) {
+    window.Insert(i, i);
+  }
+  for (uint16_t i = 0; i < 4000; ++i) {
+    window.Erase(i);
+  }
+  window.Insert(5000, 1);
+  EXPECT_LE(window.capacity(), 64u);
+  EXPECT_THAT(Entries(window), ElementsAre(Pair(5000, 1)));
+}
+
+}  // namespace
+}  // namespace webrtc
@@ -9,6 +9,7 @@
  */
 #include "rtc_base/physical_socket_server.h"
 
+#include <algorithm>
 #include <cstdint>
 #include <cstring>
 #include <utility>
@@ -487,10 +488,12 @@ int PhysicalSocket::RecvFrom(ReceiveBuffer& buffer) {
   static constexpr int BUF_SIZE = 64 * 1024;
   buffer.payload.EnsureCapacity(BUF_SIZE);
 
+  buffer.head_size = 0;
   int received = DoReadFromSocket(
       buffer.payload.data(), buffer.payload.capacity(), &buffer.source_address,
-      &timestamp, ecn_ ? &buffer.ecn : nullptr);
-  buffer.payload.SetSize(received > 0 ? received : 0);
+      &timestamp, ecn_ ? &buffer.ecn : nullptr, buffer.head, &buffer.head_size);
+  buffer.payload.SetSize(
+      received > 0 ? static_cast<size_t>(received) - buffer.head_size : 0);
   if (received > 0 && timestamp != -1) {
     buffer.arrival_time = webrtc::Timestamp::Micros(timestamp);
   }
@@ -510,15 +513,22 @@ int PhysicalSocket::DoReadFromSocket(void* buffer,
                                      size_t length,
                                      SocketAddress* out_addr,
                                      int64_t* timestamp,
-                                     EcnMarking* ecn) {
+                                     EcnMarking* ecn,
+                                     rtc::ArrayView<uint8_t> head,
+                                     size_t* head_size) {
   sockaddr_storage addr_storage;
   socklen_t addr_len = sizeof(addr_storage);
   sockaddr* addr = reinterpret_cast<sockaddr*>(&addr_storage);
 
 #if defined(WEBRTC_POSIX)
   int received = 0;
-  iovec iov = {.iov_base = buffer, .iov_len = length};
-  msghdr msg = {.msg_iov = &iov, .msg_iovlen = 1};
+  iovec iov[2] = {{.iov_base = head.data(), .iov_len = head.size()},
+                  {.iov_base = buffer, .iov_len = length}};
+  msghdr msg = {.msg_iov = iov, .msg_iovlen = 2};
+  if (head.empty()) {
+    msg.msg_iov = &iov[1];
+    msg.msg_iovlen = 1;
+  }
   if (out_addr) {
     out_addr->Clear();
     msg.msg_name = addr;
@@ -561,6 +571,10 @@ int PhysicalSocket::DoReadFromSocket(void* buffer,
   if (out_addr) {
     SocketAddressFromSockAddrStorage(addr_storage, out_addr);
   }
+  if (!head.empty()) {
+    RTC_DCHECK(head_size);
+    *head_size = std::min(static_cast<size_t>(received), head.size());
+  }
   return received;
 
 #else
@@ -791,6 +805,15 @@ int PhysicalSocket::TranslateOption(Option opt, int* slevel, int* sopt) {
 #else
       RTC_LOG(LS_WARNING) << "Socket::OPT_TCP_USER_TIMEOUT not supported.";
       return -1;
+#endif
+    case OPT_REUSEPORT:
+#if defined(WEBRTC_POSIX) && defined(SO_REUSEPORT)
+      *slevel = SOL_SOCKET;
+      *sopt = SO_REUSEPORT;
+      break;
+#else
+      RTC_LOG(LS_WARNING) << "Socket::OPT_REUSEPORT not supported.";
+      return -1;
 #endif
     default:
       RTC_DCHECK_NOTREACHED();
@@ -11,6 +11,7 @@
 #ifndef RTC_BASE_PHYSICAL_SOCKET_SERVER_H_
 #define RTC_BASE_PHYSICAL_SOCKET_SERVER_H_
 
+#include "api/array_view.h"
 #include "api/async_dns_resolver.h"
 #include "api/units/time_delta.h"
 #include "rtc_base/socket.h"
@@ -218,11 +219,17 @@ class PhysicalSocket : public Socket, public sigslot::has_slots<> {
                        const struct sockaddr* dest_addr,
                        socklen_t addrlen);
 
+  // Reads a datagram into `buffer`. If `head` is non-empty and scatter reads
+  // are supported, the first `head.size()` bytes are read into `head` instead
+  // and `head_size`, which must then be non-null, is set to the number of
+  // bytes written there.
   int DoReadFromSocket(void* buffer,
                        size_t length,
                        SocketAddress* out_addr,
                        int64_t* timestamp,
-                       EcnMarking* ecn);
+                       EcnMarking* ecn,
+                       rtc::ArrayView<uint8_t> head = {},
+                       size_t* head_size = nullptr);
 
   void OnResolveResult(const webrtc::AsyncDnsResolverResult& resolver);
 
@@ -23,6 +23,7 @@
 #define SOCKET_EACCES EACCES
 #endif
 
+#include "api/array_view.h"
 #include "api/units/timestamp.h"
 #include "rtc_base/buffer.h"
 #include "rtc_base/checks.h"
@@ -92,6 +93,13 @@ class RTC_EXPORT Socket {
     SocketAddress source_address;
     EcnMarking ecn = EcnMarking::kNotEct;
     Buffer& payload;
+    // Optional caller provided memory for the start of the datagram.
+    // Implementations that support scatter reads fill `head` first, set
+    // `head_size` to the number of bytes written to it and put only the
+    // remainder in `payload`. Other implementations leave `head_size` at 0 and
+    // read the whole datagram into `payload`.
+    rtc::ArrayView<uint8_t> head;
+    size_t head_size = 0;
   };
   virtual ~Socket() {}
 
@@ -151,6 +159,8 @@ class RTC_EXPORT Socket {
     OPT_TCP_KEEPIDLE,      // Set TCP keep alive idle time in seconds
     OPT_TCP_KEEPINTVL,     // Set TCP keep alive interval in seconds
     OPT_TCP_USER_TIMEOUT,  // Set TCP user timeout
+    OPT_REUSEPORT,         // Allow several sockets to bind the same address,
+                           // set before Bind()
   };
   virtual int GetOption(Option opt, int* value) = 0;
   virtual int SetOption(Option opt, int value) = 0;
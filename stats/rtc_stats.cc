@@ -41,6 +41,11 @@ bool RTCStats::operator!=(const RTCStats& other) const {
 
 std::string RTCStats::ToJson() const {
   rtc::StringBuilder sb;
+  AppendJson(sb);
+  return sb.Release();
+}
+
+void RTCStats::AppendJson(rtc::StringBuilder& sb) const {
   sb << "{\"type\":\"" << type()
      << "\","
         "\"id\":\""
@@ -48,7 +53,7 @@ std::string RTCStats::ToJson() const {
      << "\","
         "\"timestamp\":"
      << timestamp_.us();
-  for (const Attribute& attribute : Attributes()) {
+  VisitAttributes([&](const Attribute& attribute) {
     if (attribute.has_value()) {
       sb << ",\"" << attribute.name() << "\":";
       if (attribute.holds_alternative<std::string>()) {
@@ -59,20 +64,44 @@ std::string RTCStats::ToJson() const {
         sb << "\"";
       }
     }
-  }
+  });
   sb << "}";
-  return sb.Release();
 }
 
 std::vector<Attribute> RTCStats::Attributes() const {
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wdeprecated-declarations"
   return AttributesImpl(0);
+#pragma clang diagnostic pop
+}
+
+void RTCStats::VisitAttributes(
+    rtc::FunctionView<void(const Attribute&)> visitor) const {
+  // Stats defined with WEBRTC_RTCSTATS_IMPL have at least one attribute, so
+  // an empty visit means that the subclass only overrides AttributesImpl().
+  bool visited = false;
+  VisitAttributesImpl([&](const Attribute& attribute) {
+    visited = true;
+    visitor(attribute);
+  });
+  if (visited) {
+    return;
+  }
+  for (const Attribute& attribute : Attributes()) {
+    visitor(attribute);
+  }
 }
 
 std::vector<Attribute> RTCStats::AttributesImpl(
     size_t additional_capacity) const {
   std::vector<Attribute> attributes;
   attributes.reserve(additional_capacity);
+  VisitAttributesImpl(
+      [&](const Attribute& attribute) { attributes.push_back(attribute); });
   return attributes;
 }
 
+void RTCStats::VisitAttributesImpl(
+    rtc::FunctionView<void(const Attribute&)> visitor) const {}
+
 }  // namespace webrtc
@@ -122,7 +122,8 @@ std::string RTCStatsReport::ToJson() const {
   sb << "[";
   const char* separator = "";
   for (ConstIterator it = begin(); it != end(); ++it) {
-    sb << separator << it->ToJson();
+    sb << separator;
+    it->AppendJson(sb);
     separator = ",";
   }
   sb << "]";
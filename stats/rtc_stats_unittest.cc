@@ -76,6 +76,35 @@ WEBRTC_RTCSTATS_IMPL(RTCGrandChildStats,
                      "grandchild-stats",
                      AttributeInit("grandchildInt", &grandchild_int))
 
+// Implements the deprecated `AttributesImpl()` instead of using
+// WEBRTC_RTCSTATS_IMPL.
+class RTCLegacyStats : public RTCStats {
+ public:
+  static constexpr char kType[] = "legacy-stats";
+
+  RTCLegacyStats(const std::string& id, Timestamp timestamp)
+      : RTCStats(id, timestamp) {}
+
+  std::unique_ptr<RTCStats> copy() const override {
+    return std::make_unique<RTCLegacyStats>(*this);
+  }
+  const char* type() const override { return kType; }
+
+  std::optional<int32_t> legacy_int;
+
+ protected:
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wdeprecated-declarations"
+  std::vector<Attribute> AttributesImpl(
+      size_t additional_capacity) const override {
+    std::vector<Attribute> attributes =
+        RTCStats::AttributesImpl(additional_capacity + 1);
+    attributes.push_back(Attribute("legacyInt", &legacy_int));
+    return attributes;
+  }
+#pragma clang diagnostic pop
+};
+
 TEST(RTCStatsTest, RTCStatsAndAttributes) {
   RTCTestStats stats("testId", Timestamp::Micros(42));
   EXPECT_EQ(stats.id(), "testId");
@@ -239,6 +268,36 @@ TEST(RTCStatsTest, RTCStatsGrandChild) {
   EXPECT_EQ(*copy.grandchild_int, *stats.grandchild_int);
 }
 
+TEST(RTCStatsTest, VisitAttributesMatchesAttributes) {
+  RTCGrandChildStats stats("grandchild", Timestamp::Micros(0));
+  stats.grandchild_int = 2;
+  std::vector<Attribute> attributes = stats.Attributes();
+  size_t index = 0;
+  stats.VisitAttributes([&](const Attribute& attribute) {
+    ASSERT_LT(index, attributes.size());
+    EXPECT_STREQ(attribute.name(), attributes[index].name());
+    EXPECT_EQ(attribute, attributes[index]);
+    ++index;
+  });
+  EXPECT_EQ(index, 2u);
+  EXPECT_STREQ(attributes[0].name(), "childInt");
+  EXPECT_STREQ(attributes[1].name(), "grandchildInt");
+}
+
+TEST(RTCStatsTest, VisitsAttributesOfDeprecatedAttributesImpl) {
+  RTCLegacyStats stats("legacy", Timestamp::Micros(0));
+  stats.legacy_int = 7;
+  std::vector<std::string> names;
+  stats.VisitAttributes(
+      [&](const Attribute& attribute) { names.push_back(attribute.name()); });
+  EXPECT_EQ(names, std::vector<std::string>{"legacyInt"});
+  ASSERT_EQ(stats.Attributes().size(), 1u);
+  EXPECT_EQ(stats.Attributes()[0].get<int32_t>(), 7);
+  EXPECT_EQ(stats.ToJson(),
+            "{\"type\":\"legacy-stats\",\"id\":\"legacy\",\"timestamp\":0,"
+            "\"legacyInt\":7}");
+}
+
 TEST(RTCStatsTest, RTCStatsPrintsValidJson) {
   std::string id = "statsId";
   int timestamp = 42;
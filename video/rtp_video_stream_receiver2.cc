@@ -341,6 +341,10 @@ RtpVideoStreamReceiver2::RtpVideoStreamReceiver2(
 }
 
 RtpVideoStreamReceiver2::~RtpVideoStreamReceiver2() {
+  if (rtp_packets_received_ > 0) {
+    RTC_HISTOGRAM_COUNTS_10000("WebRTC.Video.RtpReceiveBytesCopiedPerPacket",
+                               rtp_bytes_copied_ / rtp_packets_received_);
+  }
   if (packet_router_)
     packet_router_->RemoveReceiveRtpModule(rtp_rtcp_.get());
   ulpfec_receiver_.reset();
@@ -531,8 +535,8 @@ bool RtpVideoStreamReceiver2::OnReceivedPayloadData(
   int64_t unwrapped_rtp_seq_num =
       rtp_seq_num_unwrapper_.Unwrap(rtp_packet.SequenceNumber());
 
-  auto packet = std::make_unique<video_coding::PacketBuffer::Packet>(
-      rtp_packet, unwrapped_rtp_seq_num, video);
+  std::unique_ptr<video_coding::PacketBuffer::Packet> packet =
+      packet_buffer_.CreatePacket(rtp_packet, unwrapped_rtp_seq_num, video);
 
   RtpPacketInfo& packet_info =
       packet_infos_
@@ -763,6 +767,8 @@ void RtpVideoStreamReceiver2::OnRtpPacket(const RtpPacketReceived& packet) {
   if (!receiving_)
     return;
 
+  rtp_bytes_copied_ += packet.bytes_copied();
+  ++rtp_packets_received_;
   ReceivePacket(packet);
 
   // Update receive statistics after ReceivePacket.
@@ -880,6 +886,7 @@ void RtpVideoStreamReceiver2::OnInsertedPacket(
     }
   }
   RTC_DCHECK(frame_boundary);
+  packet_buffer_.ReturnPackets(std::move(result.packets));
   if (result.buffer_cleared) {
     last_received_rtp_system_time_.reset();
     last_received_keyframe_rtp_system_time_.reset();
@@ -353,6 +353,10 @@ class RtpVideoStreamReceiver2 : public LossNotificationSender,
   RTC_NO_UNIQUE_ADDRESS SequenceChecker packet_sequence_checker_;
   RtpPacketSinkInterface* packet_sink_ RTC_GUARDED_BY(packet_sequence_checker_);
   bool receiving_ RTC_GUARDED_BY(packet_sequence_checker_);
+  // Sum of RtpPacketReceived::bytes_copied() over all received packets,
+  // reported per packet when the receiver is destroyed.
+  int64_t rtp_bytes_copied_ RTC_GUARDED_BY(packet_sequence_checker_) = 0;
+  int64_t rtp_packets_received_ RTC_GUARDED_BY(packet_sequence_checker_) = 0;
   int64_t last_packet_log_ms_ RTC_GUARDED_BY(packet_sequence_checker_);
 
   const std::unique_ptr<ModuleRtpRtcpImpl2> rtp_rtcp_;